@@ -0,0 +1,113 @@
+// arena.c
+#include "arena.h"
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdalign.h>
+
+// First chunk size; each new chunk doubles the previous one up to the maximum.
+// A request larger than the next chunk gets a chunk of its own size.
+#define ARENA_MIN_CHUNK (16 * 1024)
+#define ARENA_MAX_CHUNK (1024 * 1024)
+#define ARENA_ALIGN alignof(max_align_t)
+
+Arena ast_arena = {"ast"};
+Arena symtab_arena = {"symtab"};
+Arena tac_arena = {"tac"};
+Arena cfg_arena = {"cfg"};
+Arena codegen_arena = {"codegen"};
+
+static size_t total_allocations = 0;
+static size_t total_bytes = 0;
+
+static ArenaChunk *new_chunk(Arena *arena, size_t min_size)
+{
+    size_t size = arena->head ? arena->head->size * 2 : ARENA_MIN_CHUNK;
+    if (size > ARENA_MAX_CHUNK)
+        size = ARENA_MAX_CHUNK;
+    if (size < min_size)
+        size = min_size;
+
+    ArenaChunk *chunk = (ArenaChunk *)malloc(sizeof(ArenaChunk) + size);
+    if (!chunk)
+    {
+        fprintf(stderr, "Fatal: Memory allocation failed for %s arena chunk.\n", arena->name);
+        exit(EXIT_FAILURE);
+    }
+    chunk->size = size;
+    chunk->used = 0;
+    chunk->next = arena->head;
+    arena->head = chunk;
+
+    arena->bytes_reserved += size;
+    if (arena->bytes_reserved > arena->peak_reserved)
+        arena->peak_reserved = arena->bytes_reserved;
+    return chunk;
+}
+
+void *arena_alloc(Arena *arena, size_t size)
+{
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+
+    ArenaChunk *chunk = arena->head;
+    if (!chunk || chunk->size - chunk->used < size)
+        chunk = new_chunk(arena, size);
+
+    void *p = chunk->data + chunk->used;
+    chunk->used += size;
+
+    arena->bytes_used += size;
+    arena->allocation_count++;
+    total_allocations++;
+    total_bytes += size;
+    if (arena->bytes_used > arena->peak_used)
+        arena->peak_used = arena->bytes_used;
+    return p;
+}
+
+void *arena_calloc(Arena *arena, size_t size)
+{
+    void *p = arena_alloc(arena, size);
+    memset(p, 0, size);
+    return p;
+}
+
+char *arena_strdup(Arena *arena, const char *text)
+{
+    size_t length = strlen(text);
+    char *copy = (char *)arena_alloc(arena, length + 1);
+    memcpy(copy, text, length + 1);
+    return copy;
+}
+
+void arena_release(Arena *arena)
+{
+    if (!arena->head)
+        return; // Nothing allocated since the last release
+
+    TRACE(TRACE_MEM, "Arena %-8s peak %zu bytes in use, %zu bytes reserved; %zu allocations released\n",
+          arena->name, arena->peak_used, arena->peak_reserved, arena->allocation_count);
+
+    ArenaChunk *chunk = arena->head;
+    while (chunk)
+    {
+        ArenaChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    arena->head = NULL;
+    arena->bytes_used = 0;
+    arena->bytes_reserved = 0;
+    arena->allocation_count = 0;
+}
+
+size_t arena_total_allocations(void)
+{
+    return total_allocations;
+}
+
+size_t arena_total_bytes(void)
+{
+    return total_bytes;
+}
@@ -0,0 +1,56 @@
+// arena.h
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// A bump-pointer allocator for objects that all die together at the end of a
+// compiler phase. Allocation is pointer arithmetic inside large chunks;
+// nothing is freed individually. arena_release() drops every chunk at once,
+// so teardown never walks the data structures built in the arena.
+typedef struct ArenaChunk
+{
+    struct ArenaChunk *next; // Previously filled chunk
+    size_t size;             // Usable bytes in data[]
+    size_t used;             // Bytes handed out from data[]
+    char data[];
+} ArenaChunk;
+
+typedef struct Arena
+{
+    const char *name;        // For reports ("ast", "tac", ...)
+    ArenaChunk *head;        // Chunk currently being filled
+    size_t bytes_used;       // Bytes handed out since the last release
+    size_t bytes_reserved;   // Bytes obtained from malloc for chunks
+    size_t peak_used;        // High-water marks over the arena's whole life
+    size_t peak_reserved;
+    size_t allocation_count; // arena_alloc() calls since the last release
+} Arena;
+
+// One arena per phase. Each is released when the last phase that reads its
+// contents has finished (see main.c).
+extern Arena ast_arena;     // AST nodes and string literal text
+extern Arena symtab_arena;  // Scopes and symbol table entries
+extern Arena tac_arena;     // TAC instructions
+extern Arena cfg_arena;     // Control-flow graphs and their analyses
+extern Arena codegen_arena; // Frame layouts, string literal table, asm labels
+
+// Returns uninitialized memory aligned for any object type.
+void *arena_alloc(Arena *arena, size_t size);
+
+// Same as arena_alloc() but zero-filled.
+void *arena_calloc(Arena *arena, size_t size);
+
+// Copies a NUL terminated string into the arena.
+char *arena_strdup(Arena *arena, const char *text);
+
+// Frees every chunk of the arena. All pointers into it become invalid; the
+// arena itself can be used again afterwards. Peak figures are kept.
+void arena_release(Arena *arena);
+
+// Allocations and bytes handed out by all arenas since startup. Unlike the
+// per-arena figures these are never reset; --stats samples them per phase.
+size_t arena_total_allocations(void);
+size_t arena_total_bytes(void);
+
+#endif // ARENA_H
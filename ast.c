@@ -1,5 +1,7 @@
 #include "ast.h"
 #include "miniJava.tab.h" // For TOKEN_... definitions (ensure this path is correct)
+#include "arena.h"        // All nodes are allocated from ast_arena
+#include "stats.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -112,14 +114,10 @@ const char *get_token_name_from_int(int token)
 // --- Helper for creating base AST node ---
 AstNode *create_node(AstNodeType ast_node_type, size_t size, int line_number)
 {
-    AstNode *node = (AstNode *)calloc(1, size);
-    if (!node)
-    {
-        perror("Failed to allocate AST node");
-        exit(EXIT_FAILURE);
-    }
+    AstNode *node = (AstNode *)arena_calloc(&ast_arena, size);
     node->node_type = ast_node_type; // CORRECTED: was node->type
     node->line_number = line_number;
+    STATS_INC(STAT_AST_NODES);
     return node;
 }
 
@@ -165,6 +163,16 @@ StatementListNode *create_statement_list_node(StatementNode *statement, Statemen
     return node;
 }
 
+void append_statement_to_list(StatementListBuilder *list, StatementNode *statement)
+{
+    StatementListNode *node = create_statement_list_node(statement, NULL);
+    if (list->tail)
+        list->tail->next = node;
+    else
+        list->head = node;
+    list->tail = node;
+}
+
 VariableDeclarationNode *create_variable_declaration_node(TypeNode *var_type, IdentifierNode *identifier, ExpressionNode *initializer, int is_final, int line_number)
 {
     VariableDeclarationNode *node = (VariableDeclarationNode *)create_node(NODE_VARIABLE_DECLARATION, sizeof(VariableDeclarationNode), line_number);
@@ -363,22 +371,11 @@ ExpressionNode *create_boolean_literal_expression_node(int is_true_param, int li
 }
 
 // --- Other Node Creation Functions ---
-IdentifierNode *create_identifier_node(char *name, int line_number)
+IdentifierNode *create_identifier_node(SourceSlice name, int line_number)
 {
     IdentifierNode *node = (IdentifierNode *)create_node(NODE_IDENTIFIER, sizeof(IdentifierNode), line_number);
-    if (name)
-    {
-        node->name = strdup(name); // Make a copy
-        if (!node->name)
-        {
-            perror("Failed to strdup identifier name");
-            exit(EXIT_FAILURE);
-        }
-    }
-    else
-    {
-        node->name = NULL; // Should not happen if lexer provides name
-    }
+    node->atom = intern(source_slice_ptr(name), name.length); // Each spelling is stored once
+    node->name = atom_name(node->atom);
     return node;
 }
 
@@ -406,23 +403,12 @@ LiteralNode *create_char_literal_node(char value, int line_number)
     return node;
 }
 
-LiteralNode *create_string_literal_node(char *value, int line_number)
+LiteralNode *create_string_literal_node(SourceSlice value, int line_number)
 {
     LiteralNode *node = (LiteralNode *)create_node(NODE_LITERAL_STRING, sizeof(LiteralNode), line_number);
     node->kind = LIT_STRING;
-    if (value)
-    {
-        node->data.string_val = strdup(value);
-        if (!node->data.string_val)
-        {
-            perror("Failed to strdup string literal");
-            exit(EXIT_FAILURE);
-        }
-    }
-    else
-    {
-        node->data.string_val = NULL; // Or an empty string ""
-    }
+    node->data.string_val = (char *)arena_alloc(&ast_arena, value.length + 1); // Decoding never makes it longer
+    source_slice_unescape(value, node->data.string_val);
     return node;
 }
 
@@ -676,51 +662,101 @@ void print_return_statement_node(ReturnStatementNode *node, int indent)
     printf("\n");
 }
 
+// Walks the expression with an explicit stack. A frame's state counts the
+// children already printed, so text between and after children is emitted
+// when the frame is revisited.
 void print_expression(ExpressionNode *node, int indent_level)
 { // Changed param name to avoid conflict
     if (!node)
         return;
-    switch (node->kind)
+
+    ExpressionWalkStack stack;
+    expr_walk_init(&stack);
+    expr_walk_push(&stack, node, 0);
+
+    while (stack.count > 0)
     {
-    case EXPR_BINARY:
-        printf("(");
-        print_expression(node->data.binary_expr.left, 0);
-        printf(" %s ", get_token_name_from_int(node->data.binary_expr.op_token)); // CORRECTED
-        print_expression(node->data.binary_expr.right, 0);
-        printf(")");
-        break;
-    case EXPR_UNARY:
-        printf("%s(", get_token_name_from_int(node->data.unary_expr.op_token)); // CORRECTED
-        print_expression(node->data.unary_expr.operand, 0);
-        printf(")");
-        break;
-    case EXPR_LITERAL:
-        print_literal(node->data.literal_expr, 0);
-        break;
-    case EXPR_IDENTIFIER:
-        print_identifier(node->data.identifier_expr, 0);
-        break;
-    case EXPR_ARRAY_ACCESS:
-        print_identifier(node->data.array_access_expr.array_name_ident, 0); // CORRECTED
-        printf("[");
-        print_expression(node->data.array_access_expr.index_expr, 0);
-        printf("]"); // CORRECTED
-        break;
-    case EXPR_PARENTHESIZED:
-        printf("(");
-        print_expression(node->data.parenthesized_expr_val, 0);
-        printf(")"); // CORRECTED
-        break;
-    case EXPR_BOOLEAN_TRUE: // CORRECTED
-        printf("true");
-        break;
-    case EXPR_BOOLEAN_FALSE: // CORRECTED
-        printf("false");
-        break;
-    default:
-        printf("<Unknown Expression Kind: %d>", node->kind);
-        break;
+        ExpressionWalkFrame frame = stack.frames[--stack.count];
+        node = frame.node;
+        if (!node)
+            continue;
+
+        switch (node->kind)
+        {
+        case EXPR_BINARY:
+            if (frame.state == 0)
+            {
+                printf("(");
+                expr_walk_push(&stack, node, 1);
+                expr_walk_push(&stack, node->data.binary_expr.left, 0);
+            }
+            else if (frame.state == 1)
+            {
+                printf(" %s ", get_token_name_from_int(node->data.binary_expr.op_token)); // CORRECTED
+                expr_walk_push(&stack, node, 2);
+                expr_walk_push(&stack, node->data.binary_expr.right, 0);
+            }
+            else
+            {
+                printf(")");
+            }
+            break;
+        case EXPR_UNARY:
+            if (frame.state == 0)
+            {
+                printf("%s(", get_token_name_from_int(node->data.unary_expr.op_token)); // CORRECTED
+                expr_walk_push(&stack, node, 1);
+                expr_walk_push(&stack, node->data.unary_expr.operand, 0);
+            }
+            else
+            {
+                printf(")");
+            }
+            break;
+        case EXPR_LITERAL:
+            print_literal(node->data.literal_expr, 0);
+            break;
+        case EXPR_IDENTIFIER:
+            print_identifier(node->data.identifier_expr, 0);
+            break;
+        case EXPR_ARRAY_ACCESS:
+            if (frame.state == 0)
+            {
+                print_identifier(node->data.array_access_expr.array_name_ident, 0); // CORRECTED
+                printf("[");
+                expr_walk_push(&stack, node, 1);
+                expr_walk_push(&stack, node->data.array_access_expr.index_expr, 0);
+            }
+            else
+            {
+                printf("]"); // CORRECTED
+            }
+            break;
+        case EXPR_PARENTHESIZED:
+            if (frame.state == 0)
+            {
+                printf("(");
+                expr_walk_push(&stack, node, 1);
+                expr_walk_push(&stack, node->data.parenthesized_expr_val, 0);
+            }
+            else
+            {
+                printf(")"); // CORRECTED
+            }
+            break;
+        case EXPR_BOOLEAN_TRUE: // CORRECTED
+            printf("true");
+            break;
+        case EXPR_BOOLEAN_FALSE: // CORRECTED
+            printf("false");
+            break;
+        default:
+            printf("<Unknown Expression Kind: %d>", node->kind);
+            break;
+        }
     }
+
+    expr_walk_free(&stack);
 }
 
 void print_identifier(IdentifierNode *node, int indent_level)
@@ -792,250 +828,55 @@ void print_ast(ProgramNode *node, int indent)
     print_program_node(node, indent);
 }
 
-// --- Memory Management Functions (Ensure prototypes in ast.h match these definitions) ---
-// Forward declarations for free functions called before definition
-void free_class_declaration_node(ClassDeclarationNode *node);
-void free_identifier_node(IdentifierNode *node);
-void free_main_method_node(MainMethodNode *node);
-void free_variable_declaration_list_node(VariableDeclarationListNode *node);
-void free_block_statement_node(BlockStatementNode *node);
-void free_statement_node(StatementNode *node);
-void free_variable_declaration_node(VariableDeclarationNode *node);
-void free_type_node(TypeNode *node);
-void free_expression_node(ExpressionNode *node);
-void free_assignment_node(AssignmentNode *node);
-void free_if_statement_node(IfStatementNode *node);
-void free_while_statement_node(WhileStatementNode *node);
-void free_print_statement_node(PrintStatementNode *node);
-void free_return_statement_node(ReturnStatementNode *node);
-void free_statement_list_node(StatementListNode *node);
-void free_literal_node(LiteralNode *node);
-
-void free_ast(ProgramNode *node)
-{
-    if (!node)
-        return;
-    free_class_declaration_node(node->class_decl);
-    free(node);
-}
-
-void free_class_declaration_node(ClassDeclarationNode *node)
-{
-    if (!node)
-        return;
-    free_identifier_node(node->name);
-    free_main_method_node(node->main_method);
-    free_variable_declaration_list_node(node->var_decls);
-    // free(node->associated_scope); // If Scope is managed here
-    free(node);
-}
-
-void free_main_method_node(MainMethodNode *node)
-{
-    if (!node)
-        return;
-    free_identifier_node(node->name);
-    free_block_statement_node(node->body);
-    // free(node->associated_scope); // If Scope is managed here
-    free(node);
-}
+// --- Expression Walking ---
 
-void free_statement_list_node(StatementListNode *node)
+void expr_walk_init(ExpressionWalkStack *stack)
 {
-    StatementListNode *current = node;
-    while (current)
-    {
-        StatementListNode *next = current->next;
-        free_statement_node(current->statement);
-        free(current);
-        current = next;
-    }
+    stack->frames = stack->inline_frames;
+    stack->count = 0;
+    stack->capacity = EXPR_WALK_INLINE_FRAMES;
 }
 
-void free_statement_node(StatementNode *node)
+void expr_walk_push(ExpressionWalkStack *stack, ExpressionNode *node, int state)
 {
-    if (!node)
-        return;
-    switch (node->kind)
+    if (stack->count == stack->capacity)
     {
-    case STMT_KIND_VAR_DECL:
-        free_variable_declaration_node(node->data.var_decl_data);
-        break; // C
-    case STMT_KIND_ASSIGNMENT:
-        free_assignment_node(node->data.assignment_data);
-        break; // C
-    case STMT_KIND_IF:
-        free_if_statement_node(node->data.if_data);
-        break; // C
-    case STMT_KIND_WHILE:
-        free_while_statement_node(node->data.while_data);
-        break; // C
-    case STMT_KIND_PRINT:
-        free_print_statement_node(node->data.print_data);
-        break; // C
-    case STMT_KIND_RETURN:
-        free_return_statement_node(node->data.return_data);
-        break; // C
-    case STMT_KIND_BLOCK:
-        free_block_statement_node(node->data.block_data);
-        break; // C
-    case STMT_KIND_EXPRESSION:
-        free_expression_node(node->data.expression_data);
-        break;
-    default:
-        break;
-    }
-    free(node);
-}
-
-void free_variable_declaration_node(VariableDeclarationNode *node)
-{
-    if (!node)
-        return;
-    free_type_node(node->var_type);
-    free_identifier_node(node->identifier);
-    free_expression_node(node->initializer);
-    free(node);
-}
-
-void free_variable_declaration_list_node(VariableDeclarationListNode *node)
-{
-    VariableDeclarationListNode *current = node;
-    while (current)
-    {
-        VariableDeclarationListNode *next = current->next;
-        free_variable_declaration_node(current->declaration);
-        free(current);
-        current = next;
-    }
-}
-
-void free_assignment_node(AssignmentNode *node)
-{
-    if (!node)
-        return;
-    free_identifier_node(node->target_identifier);
-    free_expression_node(node->array_index);
-    free_expression_node(node->value);
-    free(node);
-}
-
-void free_if_statement_node(IfStatementNode *node)
-{
-    if (!node)
-        return;
-    free_expression_node(node->condition);
-    free_statement_node(node->then_branch);
-    free_statement_node(node->else_branch);
-    free(node);
-}
-
-void free_while_statement_node(WhileStatementNode *node)
-{
-    if (!node)
-        return;
-    free_expression_node(node->condition);
-    free_statement_node(node->body);
-    free(node);
-}
-
-void free_print_statement_node(PrintStatementNode *node)
-{
-    if (!node)
-        return;
-    free_expression_node(node->expression);
-    free(node);
-}
-
-void free_return_statement_node(ReturnStatementNode *node)
-{
-    if (!node)
-        return;
-    free_expression_node(node->expression);
-    free(node);
-}
-
-void free_block_statement_node(BlockStatementNode *node)
-{
-    if (!node)
-        return;
-    free_statement_list_node(node->statements);
-    // free(node->associated_scope); // If Scope is managed here
-    free(node);
-}
-
-void free_expression_node(ExpressionNode *node)
-{
-    if (!node)
-        return;
-    switch (node->kind)
-    {
-    case EXPR_BINARY:
-        free_expression_node(node->data.binary_expr.left);
-        free_expression_node(node->data.binary_expr.right);
-        break;
-    case EXPR_UNARY:
-        free_expression_node(node->data.unary_expr.operand);
-        break;
-    case EXPR_LITERAL:
-        free_literal_node(node->data.literal_expr);
-        break;
-    case EXPR_IDENTIFIER:
-        free_identifier_node(node->data.identifier_expr);
-        break;
-    case EXPR_ARRAY_ACCESS:
-        free_identifier_node(node->data.array_access_expr.array_name_ident); // C
-        free_expression_node(node->data.array_access_expr.index_expr);       // C
-        break;
-    case EXPR_PARENTHESIZED:
-        free_expression_node(node->data.parenthesized_expr_val); // C
-        break;
-    case EXPR_BOOLEAN_TRUE:  // C
-    case EXPR_BOOLEAN_FALSE: // C
-        break;
-    default:
-        break;
+        int new_capacity = stack->capacity * 2;
+        ExpressionWalkFrame *grown;
+        if (stack->frames == stack->inline_frames)
+        {
+            grown = (ExpressionWalkFrame *)malloc((size_t)new_capacity * sizeof(ExpressionWalkFrame));
+            if (grown)
+                memcpy(grown, stack->inline_frames, sizeof(stack->inline_frames));
+        }
+        else
+        {
+            grown = (ExpressionWalkFrame *)realloc(stack->frames, (size_t)new_capacity * sizeof(ExpressionWalkFrame));
+        }
+        if (!grown)
+        {
+            fprintf(stderr, "Fatal: Memory allocation failed for expression walk stack.\n");
+            exit(EXIT_FAILURE);
+        }
+        stack->frames = grown;
+        stack->capacity = new_capacity;
     }
-    free(node);
+    stack->frames[stack->count].node = node;
+    stack->frames[stack->count].state = state;
+    stack->count++;
 }
 
-void free_identifier_node(IdentifierNode *node)
+void expr_walk_free(ExpressionWalkStack *stack)
 {
-    if (!node)
-        return;
-    if (node->name)
-        free(node->name);
-    free(node);
+    if (stack->frames != stack->inline_frames)
+        free(stack->frames);
+    expr_walk_init(stack);
 }
 
-void free_literal_node(LiteralNode *node)
+// --- Memory Management ---
+// Every node, and every string literal's text, lives in ast_arena, so the
+// whole tree is released at once without visiting it.
+void free_ast(void)
 {
-    if (!node)
-        return;
-    if (node->kind == LIT_STRING && node->data.string_val)
-    {
-        free(node->data.string_val);
-    }
-    free(node);
+    arena_release(&ast_arena);
 }
-
-void free_type_node(TypeNode *node)
-{
-    if (!node)
-        return;
-    free(node);
-}
-
-void free_parsed_class_contents(ParsedClassContents *pcc)
-{
-    if (!pcc)
-        return;
-    // Do NOT free pcc->main_method or pcc->var_decls here if they have been
-    // transferred to a ClassDeclarationNode. This function is for cleanup
-    // if parsing fails *before* transfer.
-    // If they are transferred, the ClassDeclarationNode's free function handles them.
-    // If this is called on error *before* transfer:
-    // free_main_method_node(pcc->main_method);
-    // free_variable_declaration_list_node(pcc->var_decls);
-    free(pcc);
-}
\ No newline at end of file
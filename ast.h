@@ -5,6 +5,8 @@
 // Ensure symbol_table_types.h is appropriate.
 // It should define TypeKind and at least forward declare 'struct Scope;' or define it.
 #include "symbol_table_types.h"
+#include "source_buffer.h" // SourceSlice, for identifier and string literal text
+#include "intern.h"        // Atom, for identifier names
 
 // Forward Declarations for Node Structures (struct keyword is good practice here)
 typedef struct AstNode AstNode;
@@ -36,6 +38,15 @@ typedef struct ParsedClassContents
     struct VariableDeclarationListNode *var_decls;
 } ParsedClassContents;
 
+// A statement list under construction in the parser. 'statements' is
+// left-recursive, so each statement is appended at 'tail' in constant time
+// and the parser stack does not grow with the length of the list.
+typedef struct StatementListBuilder
+{
+    struct StatementListNode *head;
+    struct StatementListNode *tail;
+} StatementListBuilder;
+
 // --- Node Type Enumeration ---
 typedef enum AstNodeType
 {
@@ -279,14 +290,17 @@ struct LiteralNode
         int int_val;
         float float_val;
         char char_val;
-        char *string_val; // Must be allocated (e.g. strdup) and freed
+        char *string_val; // Decoded text, allocated in ast_arena
     } data;
 };
 
 struct IdentifierNode
 {
-    AstNode base; // base.node_type = NODE_IDENTIFIER
-    char *name;   // Must be allocated (e.g. strdup) and freed
+    AstNode base;     // base.node_type = NODE_IDENTIFIER
+    Atom atom;        // Interned name; compare identifiers by atom
+    const char *name; // Spelling of 'atom', owned by the intern table (for messages)
+    struct SymbolTableEntry *symbol; // Declaration this identifier resolves to; set by
+                                     // semantic analysis, NULL if it did not resolve
 };
 
 struct TypeNode
@@ -302,6 +316,7 @@ MainMethodNode *create_main_method_node(IdentifierNode *name, BlockStatementNode
 
 StatementListNode *create_statement_list_node(StatementNode *statement, StatementListNode *next_list_item); // Corrected param name
 VariableDeclarationListNode *create_variable_declaration_list_node(VariableDeclarationNode *declaration, VariableDeclarationListNode *next_list_item);
+void append_statement_to_list(StatementListBuilder *list, StatementNode *statement); // Adds a node at list->tail
 
 // Concrete Node Creation
 VariableDeclarationNode *create_variable_declaration_node(TypeNode *var_type, IdentifierNode *identifier, ExpressionNode *initializer, int is_final, int line_number);
@@ -331,11 +346,11 @@ ExpressionNode *create_parenthesized_expression_node(ExpressionNode *inner_expr,
 ExpressionNode *create_boolean_literal_expression_node(int is_true, int line_number); // For TRUE/FALSE, e.g., is_true=1 for true
 
 // Other Node Creation Functions
-IdentifierNode *create_identifier_node(char *name, int line_number); // Name should be strdup'd by this function
+IdentifierNode *create_identifier_node(SourceSlice name, int line_number); // Interns the name from the source buffer
 LiteralNode *create_int_literal_node(int value, int line_number);
 LiteralNode *create_float_literal_node(float value, int line_number);
 LiteralNode *create_char_literal_node(char value, int line_number);
-LiteralNode *create_string_literal_node(char *value, int line_number); // Value should be strdup'd by this function
+LiteralNode *create_string_literal_node(SourceSlice value, int line_number); // Decodes escapes into a copy
 TypeNode *create_type_node(TypeKind kind, int line_number);            // TypeKind from symbol_table_types.h
 
 // --- AST Printing Function Prototypes (for debugging) ---
@@ -344,10 +359,34 @@ void print_ast(ProgramNode *node, int indent);
 // ... and so on for all node types ...
 const char *get_token_name_from_int(int token); // Changed from get_token_name to avoid potential conflicts
 
-// --- AST Freeing Function Prototypes ---
-// (Keep your existing free function prototypes, ensure they handle all members, including strdup'd strings)
-void free_ast(ProgramNode *node);
-// ... and so on for all node types, ensuring to free sub-nodes and allocated strings ...
-void free_parsed_class_contents(ParsedClassContents *pcc); // Add if needed for cleanup on error
+// --- Expression Walking ---
+// Expressions can nest thousands of levels deep (long operator chains), so
+// the phases walk them with an explicit stack instead of C recursion. Each
+// frame is a node plus a walker-defined state (e.g. how many children have
+// been visited). The first frames live inside the stack object itself; deeper
+// walks spill to the heap.
+#define EXPR_WALK_INLINE_FRAMES 64
+
+typedef struct ExpressionWalkFrame
+{
+    ExpressionNode *node;
+    int state;
+} ExpressionWalkFrame;
+
+typedef struct ExpressionWalkStack
+{
+    ExpressionWalkFrame *frames; // inline_frames, or a heap block once that is full
+    int count;
+    int capacity;
+    ExpressionWalkFrame inline_frames[EXPR_WALK_INLINE_FRAMES];
+} ExpressionWalkStack;
+
+void expr_walk_init(ExpressionWalkStack *stack);
+void expr_walk_push(ExpressionWalkStack *stack, ExpressionNode *node, int state);
+void expr_walk_free(ExpressionWalkStack *stack); // Releases the heap block, if any
+
+// --- AST Freeing ---
+// Releases ast_arena, which holds the whole tree (see arena.h).
+void free_ast(void);
 
 #endif // AST_H
\ No newline at end of file
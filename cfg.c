@@ -0,0 +1,880 @@
+// cfg.c
+#include "cfg.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Same growth policy as the TAC vectors: double, leave the old array behind in
+// the arena.
+static void *grow_cfg_vector(void *old, int count, int *capacity, size_t elem_size, int initial)
+{
+    int new_capacity = *capacity ? *capacity * 2 : initial;
+    void *grown = arena_alloc(&cfg_arena, (size_t)new_capacity * elem_size);
+    if (count > 0)
+        memcpy(grown, old, (size_t)count * elem_size);
+    *capacity = new_capacity;
+    return grown;
+}
+
+static int is_block_terminator(TacOpCode opcode)
+{
+    return opcode == TAC_GOTO || opcode == TAC_IF_GOTO || opcode == TAC_IF_NOT_GOTO || opcode == TAC_RETURN;
+}
+
+TacInstruction *cfg_terminator(BasicBlock *block)
+{
+    if (block->instr_count == 0 || !is_block_terminator(block->instrs[block->instr_count - 1].opcode))
+        return NULL;
+    return &block->instrs[block->instr_count - 1];
+}
+
+int cfg_new_block(Cfg *cfg, int before)
+{
+    if (cfg->block_count == cfg->block_capacity)
+        cfg->blocks = grow_cfg_vector(cfg->blocks, cfg->block_count, &cfg->block_capacity, sizeof(BasicBlock), 16);
+
+    int id = cfg->block_count++;
+    BasicBlock *block = &cfg->blocks[id];
+    memset(block, 0, sizeof(*block));
+    block->id = id;
+    block->label = -1;
+    block->rpo_index = -1;
+    block->idom = -1;
+    block->dom_child = -1;
+    block->dom_sibling = -1;
+    block->dom_pre = -1;
+    block->dom_post = -1;
+    block->loop = -1;
+
+    // Link the block into the layout
+    if (before < 0)
+    {
+        block->layout_prev = cfg->layout_tail;
+        block->layout_next = -1;
+        if (cfg->layout_tail >= 0)
+            cfg->blocks[cfg->layout_tail].layout_next = id;
+        else
+            cfg->layout_head = id;
+        cfg->layout_tail = id;
+    }
+    else
+    {
+        BasicBlock *next = &cfg->blocks[before];
+        block->layout_prev = next->layout_prev;
+        block->layout_next = before;
+        if (next->layout_prev >= 0)
+            cfg->blocks[next->layout_prev].layout_next = id;
+        else
+            cfg->layout_head = id;
+        next->layout_prev = id;
+    }
+    cfg_invalidate(cfg);
+    STATS_INC(STAT_BASIC_BLOCKS);
+    return id;
+}
+
+void cfg_append(Cfg *cfg, int block_id, const TacInstruction *instr)
+{
+    BasicBlock *block = &cfg->blocks[block_id];
+    if (block->instr_count == block->instr_capacity)
+        block->instrs = grow_cfg_vector(block->instrs, block->instr_count, &block->instr_capacity,
+                                        sizeof(TacInstruction), 8);
+    block->instrs[block->instr_count++] = *instr;
+}
+
+void cfg_insert(Cfg *cfg, int block_id, int position, const TacInstruction *instr)
+{
+    BasicBlock *block = &cfg->blocks[block_id];
+    if (block->instr_count == block->instr_capacity)
+        block->instrs = grow_cfg_vector(block->instrs, block->instr_count, &block->instr_capacity,
+                                        sizeof(TacInstruction), 8);
+    memmove(&block->instrs[position + 1], &block->instrs[position],
+            (size_t)(block->instr_count - position) * sizeof(TacInstruction));
+    block->instrs[position] = *instr;
+    block->instr_count++;
+}
+
+void cfg_remove_instr(Cfg *cfg, int block_id, int position)
+{
+    BasicBlock *block = &cfg->blocks[block_id];
+    memmove(&block->instrs[position], &block->instrs[position + 1],
+            (size_t)(block->instr_count - position - 1) * sizeof(TacInstruction));
+    block->instr_count--;
+}
+
+// Grows a block's predecessor list, keeping every phi's argument array the
+// same size.
+static void grow_preds(BasicBlock *block)
+{
+    int capacity = block->pred_capacity;
+    block->preds = grow_cfg_vector(block->preds, block->pred_count, &block->pred_capacity, sizeof(int), 4);
+    for (int i = 0; i < block->phi_count; i++)
+    {
+        int phi_capacity = capacity;
+        block->phis[i].args = grow_cfg_vector(block->phis[i].args, block->pred_count, &phi_capacity,
+                                              sizeof(TacOperand), 4);
+    }
+}
+
+CfgPhi *cfg_add_phi(Cfg *cfg, int block_id, TacOperand result)
+{
+    BasicBlock *block = &cfg->blocks[block_id];
+    if (block->phi_count == block->phi_capacity)
+        block->phis = grow_cfg_vector(block->phis, block->phi_count, &block->phi_capacity, sizeof(CfgPhi), 4);
+
+    CfgPhi *phi = &block->phis[block->phi_count++];
+    phi->result = result;
+    phi->args = (TacOperand *)arena_alloc(&cfg_arena, (size_t)(block->pred_capacity > 0 ? block->pred_capacity : 1) *
+                                                          sizeof(TacOperand));
+    for (int i = 0; i < block->pred_count; i++)
+        phi->args[i] = create_tac_none_operand();
+    STATS_INC(STAT_PHIS);
+    return phi;
+}
+
+void cfg_add_edge(Cfg *cfg, int from, int to)
+{
+    BasicBlock *source = &cfg->blocks[from];
+    if (source->succ_count == 2)
+    {
+        fprintf(stderr, "Fatal: Block B%d already has two successors.\n", from);
+        exit(EXIT_FAILURE);
+    }
+    BasicBlock *target = &cfg->blocks[to];
+    source->succ_pred_index[source->succ_count] = target->pred_count;
+    source->succs[source->succ_count++] = to;
+
+    if (target->pred_count == target->pred_capacity)
+        grow_preds(target);
+    for (int i = 0; i < target->phi_count; i++)
+        target->phis[i].args[target->pred_count] = create_tac_none_operand();
+    target->preds[target->pred_count++] = from;
+    cfg_invalidate(cfg);
+}
+
+// Removes one from->to edge. The order of the remaining successors is kept,
+// so a conditional block that loses its fall-through edge has its branch
+// target in succs[0] afterwards.
+void cfg_remove_edge(Cfg *cfg, int from, int to)
+{
+    BasicBlock *source = &cfg->blocks[from];
+    int index = -1;
+    for (int i = 0; i < source->succ_count; i++)
+    {
+        if (source->succs[i] == to)
+        {
+            index = source->succ_pred_index[i];
+            if (i == 0 && source->succ_count == 2)
+            {
+                source->succs[0] = source->succs[1];
+                source->succ_pred_index[0] = source->succ_pred_index[1];
+            }
+            source->succ_count--;
+            break;
+        }
+    }
+    if (index < 0)
+        return;
+
+    // The edges after it move down one position in the target's lists
+    BasicBlock *target = &cfg->blocks[to];
+    int after = target->pred_count - index - 1;
+    memmove(&target->preds[index], &target->preds[index + 1], (size_t)after * sizeof(int));
+    for (int p = 0; p < target->phi_count; p++)
+        memmove(&target->phis[p].args[index], &target->phis[p].args[index + 1], (size_t)after * sizeof(TacOperand));
+    target->pred_count--;
+    for (int i = index; i < target->pred_count; i++)
+    {
+        BasicBlock *pred = &cfg->blocks[target->preds[i]];
+        for (int s = 0; s < pred->succ_count; s++)
+            if (pred->succs[s] == to && pred->succ_pred_index[s] == i + 1)
+                pred->succ_pred_index[s] = i;
+    }
+    cfg_invalidate(cfg);
+}
+
+int cfg_split_edge(Cfg *cfg, int from, int to)
+{
+    // A fall-through edge keeps falling through; a jump lands just in front
+    // of its old target.
+    BasicBlock *source = &cfg->blocks[from];
+    TacInstruction *terminator = cfg_terminator(source);
+    int falls_through = source->succs[0] == to && (!terminator || terminator->opcode != TAC_GOTO);
+    int mid = cfg_new_block(cfg, falls_through ? source->layout_next : to);
+
+    source = &cfg->blocks[from]; // The block array may have moved
+    BasicBlock *target = &cfg->blocks[to];
+    BasicBlock *middle = &cfg->blocks[mid];
+    for (int i = 0; i < source->succ_count; i++)
+    {
+        if (source->succs[i] == to)
+        {
+            // The middle block takes over the edge's position in 'to'
+            int index = source->succ_pred_index[i];
+            target->preds[index] = mid;
+            middle->succs[0] = to;
+            middle->succ_pred_index[0] = index;
+            middle->succ_count = 1;
+            source->succs[i] = mid;
+            source->succ_pred_index[i] = 0;
+            break;
+        }
+    }
+    grow_preds(middle);
+    middle->preds[middle->pred_count++] = from;
+    return mid;
+}
+
+int cfg_remove_forwarder(Cfg *cfg, int block_id)
+{
+    BasicBlock *block = &cfg->blocks[block_id];
+    if (block->instr_count > 0 || block->phi_count > 0 || block->succ_count != 1 || block->pred_count != 1)
+        return 0;
+    int from = block->preds[0], to = block->succs[0];
+    BasicBlock *source = &cfg->blocks[from];
+    BasicBlock *target = &cfg->blocks[to];
+    if (to == block_id || (source->succ_count == 2 && source->succs[0] == source->succs[1]))
+        return 0;
+    for (int i = 0; i < source->succ_count; i++)
+        if (source->succs[i] == to)
+            return 0; // Would become a second edge between the same blocks
+
+    // The reverse of cfg_split_edge(): both edge positions are kept
+    int index = block->succ_pred_index[0];
+    for (int i = 0; i < source->succ_count; i++)
+    {
+        if (source->succs[i] == block_id)
+        {
+            source->succs[i] = to;
+            source->succ_pred_index[i] = index;
+        }
+    }
+    target->preds[index] = from;
+    block->succ_count = 0;
+    block->pred_count = 0;
+    cfg_invalidate(cfg);
+    return 1;
+}
+
+void cfg_invalidate(Cfg *cfg)
+{
+    cfg->dominators_valid = 0;
+    cfg->frontiers_valid = 0;
+    cfg->loops_valid = 0;
+}
+
+Cfg *cfg_build(const TacProgram *program, int begin_index, int *end_index)
+{
+    Cfg *cfg = (Cfg *)arena_calloc(&cfg_arena, sizeof(Cfg));
+    cfg->begin = program->instrs[begin_index];
+    cfg->layout_head = -1;
+    cfg->layout_tail = -1;
+
+    // Block that each label starts, filled in while splitting
+    int *label_block = (int *)arena_alloc(&cfg_arena, (size_t)(program->label_count + 1) * sizeof(int));
+    for (int i = 0; i < program->label_count; i++)
+        label_block[i] = -1;
+
+    // Split into blocks. A block starts at each label and after each jump or
+    // return. The entry block never carries a label, so it has no
+    // predecessors even when the body starts with a loop header.
+    int current = cfg_new_block(cfg, -1);
+    int ended = 0; // The current block ends in a terminator
+    int index = begin_index + 1;
+    for (; index < program->count && program->instrs[index].opcode != TAC_FUNCTION_END; index++)
+    {
+        const TacInstruction *instr = &program->instrs[index];
+        if (instr->opcode == TAC_LABEL)
+        {
+            BasicBlock *block = &cfg->blocks[current];
+            if (ended || current == 0 || block->instr_count > 0 || block->label >= 0)
+                current = cfg_new_block(cfg, -1);
+            cfg->blocks[current].label = (int)instr->result.val.id;
+            label_block[instr->result.val.id] = current;
+            ended = 0;
+            continue;
+        }
+        if (ended)
+        {
+            current = cfg_new_block(cfg, -1); // Unreachable code after a jump or return
+            ended = 0;
+        }
+        cfg_append(cfg, current, instr);
+        ended = is_block_terminator(instr->opcode);
+    }
+    cfg->end = index < program->count ? program->instrs[index] : cfg->begin;
+    if (end_index)
+        *end_index = index;
+
+    // A conditional jump at the very end still needs a fall-through block
+    BasicBlock *last = &cfg->blocks[current];
+    if (last->instr_count > 0 && (last->instrs[last->instr_count - 1].opcode == TAC_IF_GOTO ||
+                                  last->instrs[last->instr_count - 1].opcode == TAC_IF_NOT_GOTO))
+        cfg_new_block(cfg, -1);
+
+    // Connect the blocks
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        TacOpCode last_opcode = block->instr_count > 0 ? block->instrs[block->instr_count - 1].opcode : TAC_NOP;
+        int has_next = b + 1 < cfg->block_count;
+
+        if (last_opcode == TAC_GOTO)
+        {
+            cfg_add_edge(cfg, b, label_block[block->instrs[block->instr_count - 1].result.val.id]);
+        }
+        else if (last_opcode == TAC_IF_GOTO || last_opcode == TAC_IF_NOT_GOTO)
+        {
+            cfg_add_edge(cfg, b, b + 1); // Fall-through first
+            cfg_add_edge(cfg, b, label_block[block->instrs[block->instr_count - 1].result.val.id]);
+        }
+        else if (last_opcode != TAC_RETURN && has_next)
+        {
+            cfg_add_edge(cfg, b, b + 1);
+        }
+    }
+    return cfg;
+}
+
+// Path compression for the Lengauer-Tarjan eval(): points 'v' and every
+// ancestor on its path at the root of the path, and gives each the label with
+// the smallest semidominator on the way. Iterative, so deep forests are fine.
+static void compress(int v, int *ancestor, int *label, const int *semi, int *path)
+{
+    int count = 0;
+    while (ancestor[ancestor[v]] >= 0)
+    {
+        path[count++] = v;
+        v = ancestor[v];
+    }
+    // v is the last node below the root; fix up the path from the top down
+    while (count > 0)
+    {
+        int u = path[--count];
+        if (semi[label[ancestor[u]]] < semi[label[u]])
+            label[u] = label[ancestor[u]];
+        ancestor[u] = ancestor[ancestor[u]];
+    }
+}
+
+// Dominators by the algorithm of Lengauer and Tarjan ("A Fast Algorithm for
+// Finding Dominators in a Flowgraph", simple version with path compression),
+// O(E log N). The iterative intersection of Cooper, Harvey and Kennedy it
+// replaces went quadratic on the deep dominator chains that long && and ||
+// conditions build. Nodes are numbered in depth-first preorder; arrays below
+// are indexed by that number.
+void cfg_compute_dominators(Cfg *cfg)
+{
+    if (cfg->dominators_valid)
+        return;
+
+    int n = cfg->block_count;
+    for (int b = 0; b < n; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        block->rpo_index = -1;
+        block->idom = -1;
+        block->dom_depth = 0;
+        block->dom_child = -1;
+        block->dom_sibling = -1;
+        block->dom_pre = -1;
+        block->dom_post = -1;
+    }
+
+    // Iterative depth-first search for the preorder, the DFS tree and the
+    // postorder
+    int *number = (int *)arena_alloc(&cfg_arena, (size_t)n * sizeof(int)); // Preorder number per block
+    int *vertex = (int *)arena_alloc(&cfg_arena, (size_t)n * sizeof(int)); // Block per preorder number
+    int *parent = (int *)arena_alloc(&cfg_arena, (size_t)n * sizeof(int));
+    int *postorder = (int *)arena_alloc(&cfg_arena, (size_t)n * sizeof(int));
+    int *stack = (int *)arena_alloc(&cfg_arena, (size_t)n * sizeof(int));
+    int *next_succ = (int *)arena_calloc(&cfg_arena, (size_t)n * sizeof(int));
+    for (int b = 0; b < n; b++)
+        number[b] = -1;
+    int pre_count = 0, post_count = 0, depth = 0;
+    stack[depth++] = 0;
+    number[0] = pre_count;
+    vertex[pre_count] = 0;
+    parent[pre_count++] = -1;
+    while (depth > 0)
+    {
+        BasicBlock *block = &cfg->blocks[stack[depth - 1]];
+        if (next_succ[block->id] < block->succ_count)
+        {
+            int succ = block->succs[next_succ[block->id]++];
+            if (number[succ] < 0)
+            {
+                number[succ] = pre_count;
+                vertex[pre_count] = succ;
+                parent[pre_count++] = number[block->id];
+                stack[depth++] = succ;
+            }
+        }
+        else
+        {
+            postorder[post_count++] = block->id;
+            depth--;
+        }
+    }
+
+    cfg->rpo = (int *)arena_alloc(&cfg_arena, (size_t)post_count * sizeof(int));
+    cfg->rpo_count = post_count;
+    for (int i = 0; i < post_count; i++)
+    {
+        cfg->rpo[i] = postorder[post_count - 1 - i];
+        cfg->blocks[cfg->rpo[i]].rpo_index = i;
+    }
+
+    // Semidominators in reverse preorder, each node's idom settled (or
+    // deferred to the last pass) once its DFS parent has been linked
+    int count = pre_count;
+    int *semi = (int *)arena_alloc(&cfg_arena, (size_t)count * sizeof(int));
+    int *idom = (int *)arena_alloc(&cfg_arena, (size_t)count * sizeof(int));
+    int *ancestor = (int *)arena_alloc(&cfg_arena, (size_t)count * sizeof(int));
+    int *label = (int *)arena_alloc(&cfg_arena, (size_t)count * sizeof(int));
+    int *bucket = (int *)arena_alloc(&cfg_arena, (size_t)count * sizeof(int)); // First node whose semi is this one
+    int *bucket_next = (int *)arena_alloc(&cfg_arena, (size_t)count * sizeof(int));
+    int *path = stack; // The DFS is done with it
+    for (int v = 0; v < count; v++)
+    {
+        semi[v] = v;
+        idom[v] = -1;
+        ancestor[v] = -1;
+        label[v] = v;
+        bucket[v] = -1;
+    }
+    for (int w = count - 1; w > 0; w--)
+    {
+        BasicBlock *block = &cfg->blocks[vertex[w]];
+        for (int p = 0; p < block->pred_count; p++)
+        {
+            int v = number[block->preds[p]];
+            if (v < 0)
+                continue; // Unreachable
+            int u = v; // eval(v)
+            if (ancestor[v] >= 0)
+            {
+                compress(v, ancestor, label, semi, path);
+                u = label[v];
+            }
+            if (semi[u] < semi[w])
+                semi[w] = semi[u];
+        }
+        bucket_next[w] = bucket[semi[w]];
+        bucket[semi[w]] = w;
+        ancestor[w] = parent[w]; // link(parent, w)
+
+        for (int v = bucket[parent[w]]; v >= 0; v = bucket_next[v])
+        {
+            int u = v;
+            if (ancestor[v] >= 0)
+            {
+                compress(v, ancestor, label, semi, path);
+                u = label[v];
+            }
+            idom[v] = semi[u] < semi[v] ? u : parent[w];
+        }
+        bucket[parent[w]] = -1;
+    }
+    for (int w = 1; w < count; w++)
+    {
+        if (idom[w] != semi[w])
+            idom[w] = idom[idom[w]];
+        cfg->blocks[vertex[w]].idom = vertex[idom[w]];
+    }
+
+    // Depths in preorder (a dominator always comes first). Children are
+    // linked walking backwards in reverse postorder so each child list ends
+    // up in RPO order.
+    BasicBlock *blocks = cfg->blocks;
+    for (int w = 1; w < count; w++)
+    {
+        BasicBlock *block = &blocks[vertex[w]];
+        block->dom_depth = blocks[block->idom].dom_depth + 1;
+    }
+    for (int i = cfg->rpo_count - 1; i > 0; i--)
+    {
+        BasicBlock *block = &blocks[cfg->rpo[i]];
+        block->dom_sibling = blocks[block->idom].dom_child;
+        blocks[block->idom].dom_child = block->id;
+    }
+
+    // Entry and exit numbers, walking the dominator tree without recursion
+    int *last_child = (int *)arena_calloc(&cfg_arena, (size_t)n * sizeof(int)); // Child visited last, as id + 1
+    int clock = 0;
+    depth = 0;
+    stack[depth++] = 0;
+    blocks[0].dom_pre = clock++;
+    while (depth > 0)
+    {
+        BasicBlock *block = &blocks[stack[depth - 1]];
+        int last = last_child[block->id];
+        int child = last == 0 ? block->dom_child : blocks[last - 1].dom_sibling;
+        if (child >= 0)
+        {
+            last_child[block->id] = child + 1;
+            blocks[child].dom_pre = clock++;
+            stack[depth++] = child;
+        }
+        else
+        {
+            block->dom_post = clock++;
+            depth--;
+        }
+    }
+    cfg->dominators_valid = 1;
+}
+
+// Dominance frontiers as in Cooper, Harvey and Kennedy: for each join point,
+// walk up from every predecessor to the join point's immediate dominator.
+void cfg_compute_frontiers(Cfg *cfg)
+{
+    if (cfg->frontiers_valid)
+        return;
+    cfg_compute_dominators(cfg);
+
+    int *capacity = (int *)arena_calloc(&cfg_arena, (size_t)cfg->block_count * sizeof(int));
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        cfg->blocks[b].frontier = NULL;
+        cfg->blocks[b].frontier_count = 0;
+    }
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *join = &cfg->blocks[b];
+        if (join->pred_count < 2 || join->rpo_index < 0)
+            continue;
+        for (int p = 0; p < join->pred_count; p++)
+        {
+            int runner = join->preds[p];
+            if (cfg->blocks[runner].rpo_index < 0)
+                continue;
+            while (runner != join->idom)
+            {
+                BasicBlock *block = &cfg->blocks[runner];
+                // Each join point is handled completely before the next, so a
+                // duplicate can only be the last entry. Finding one means an
+                // earlier walk went from here to the idom already.
+                if (block->frontier_count > 0 && block->frontier[block->frontier_count - 1] == b)
+                    break;
+                if (block->frontier_count == capacity[runner])
+                    block->frontier = grow_cfg_vector(block->frontier, block->frontier_count, &capacity[runner],
+                                                      sizeof(int), 4);
+                block->frontier[block->frontier_count++] = b;
+                runner = block->idom;
+            }
+        }
+    }
+    cfg->frontiers_valid = 1;
+}
+
+int cfg_dominates(Cfg *cfg, int a, int b)
+{
+    cfg_compute_dominators(cfg);
+    if (cfg->blocks[a].rpo_index < 0 || cfg->blocks[b].rpo_index < 0)
+        return a == b;
+    return cfg->blocks[a].dom_pre <= cfg->blocks[b].dom_pre && cfg->blocks[b].dom_post <= cfg->blocks[a].dom_post;
+}
+
+// Natural loops from back edges (an edge whose target dominates its source).
+// Headers are visited in reverse postorder, so an enclosing loop is always
+// created before the loops nested in it, and each block's 'loop' ends up as
+// the innermost loop containing it.
+void cfg_compute_loops(Cfg *cfg)
+{
+    if (cfg->loops_valid)
+        return;
+    cfg_compute_dominators(cfg);
+
+    int n = cfg->block_count;
+    for (int b = 0; b < n; b++)
+        cfg->blocks[b].loop = -1;
+
+    int loop_capacity = 0;
+    cfg->loops = NULL;
+    cfg->loop_count = 0;
+
+    int *in_loop = (int *)arena_alloc(&cfg_arena, (size_t)n * sizeof(int)); // Loop being collected, per block
+    int *worklist = (int *)arena_alloc(&cfg_arena, (size_t)n * sizeof(int));
+    for (int b = 0; b < n; b++)
+        in_loop[b] = -1;
+
+    for (int i = 0; i < cfg->rpo_count; i++)
+    {
+        BasicBlock *header = &cfg->blocks[cfg->rpo[i]];
+        int latch_count = 0;
+        for (int p = 0; p < header->pred_count; p++)
+            if (cfg_dominates(cfg, header->id, header->preds[p]))
+                latch_count++;
+        if (latch_count == 0)
+            continue;
+
+        if (cfg->loop_count == loop_capacity)
+            cfg->loops = grow_cfg_vector(cfg->loops, cfg->loop_count, &loop_capacity, sizeof(CfgLoop), 4);
+        int id = cfg->loop_count++;
+        CfgLoop *loop = &cfg->loops[id];
+        loop->header = header->id;
+        loop->parent = header->loop; // Innermost loop found so far that contains the header
+        loop->depth = loop->parent < 0 ? 1 : cfg->loops[loop->parent].depth + 1;
+        loop->latches = (int *)arena_alloc(&cfg_arena, (size_t)latch_count * sizeof(int));
+        loop->latch_count = 0;
+
+        // Walk backwards from the latches; the header stops the walk
+        int pending = 0;
+        in_loop[header->id] = id;
+        for (int p = 0; p < header->pred_count; p++)
+        {
+            int pred = header->preds[p];
+            if (!cfg_dominates(cfg, header->id, pred))
+                continue;
+            loop->latches[loop->latch_count++] = pred;
+            if (in_loop[pred] != id)
+            {
+                in_loop[pred] = id;
+                worklist[pending++] = pred;
+            }
+        }
+        int body_count = 1;
+        while (pending > 0)
+        {
+            BasicBlock *block = &cfg->blocks[worklist[--pending]];
+            body_count++;
+            for (int p = 0; p < block->pred_count; p++)
+            {
+                int pred = block->preds[p];
+                if (in_loop[pred] != id && cfg->blocks[pred].rpo_index >= 0)
+                {
+                    in_loop[pred] = id;
+                    worklist[pending++] = pred;
+                }
+            }
+        }
+
+        loop->blocks = (int *)arena_alloc(&cfg_arena, (size_t)body_count * sizeof(int));
+        loop->block_count = 0;
+        for (int r = 0; r < cfg->rpo_count; r++) // Keep the body in reverse postorder
+        {
+            int b = cfg->rpo[r];
+            if (in_loop[b] == id)
+            {
+                loop->blocks[loop->block_count++] = b;
+                cfg->blocks[b].loop = id;
+            }
+        }
+    }
+    cfg->loops_valid = 1;
+}
+
+int cfg_loop_contains(Cfg *cfg, int loop, int block)
+{
+    cfg_compute_loops(cfg);
+    for (int l = cfg->blocks[block].loop; l >= 0; l = cfg->loops[l].parent)
+        if (l == loop)
+            return 1;
+    return 0;
+}
+
+int *cfg_make_preheaders(Cfg *cfg)
+{
+    // Splitting edges invalidates the loop forest, so collect the headers
+    // first; new blocks only sit on edges, which keeps the loop numbering
+    cfg_compute_loops(cfg);
+    int loop_count = cfg->loop_count;
+    int *preheaders = (int *)arena_alloc(&cfg_arena, (size_t)(loop_count > 0 ? loop_count : 1) * sizeof(int));
+    for (int l = 0; l < loop_count; l++)
+        preheaders[l] = cfg->loops[l].header;
+
+    for (int l = 0; l < loop_count; l++)
+    {
+        int header = preheaders[l];
+        cfg_compute_dominators(cfg);
+        BasicBlock *block = &cfg->blocks[header];
+        int outside = -1, count = 0;
+        for (int p = 0; p < block->pred_count; p++)
+        {
+            int pred = block->preds[p];
+            if (cfg->blocks[pred].rpo_index < 0 || cfg_dominates(cfg, header, pred))
+                continue; // Unreachable, or a back edge
+            outside = pred;
+            count++;
+        }
+        if (count != 1)
+            preheaders[l] = -1;
+        else if (cfg->blocks[outside].succ_count > 1)
+            preheaders[l] = cfg_split_edge(cfg, outside, header);
+        else
+            preheaders[l] = outside;
+    }
+    cfg_compute_loops(cfg);
+    return preheaders;
+}
+
+// Emits a jump to 'target', allocating a label for it if it has none.
+static void emit_jump(Cfg *cfg, TacOpCode opcode, TacOperand condition, int target, int line_number)
+{
+    BasicBlock *block = &cfg->blocks[target];
+    if (block->label < 0)
+        block->label = new_tac_label();
+    emit_tac(opcode, create_tac_label_operand(block->label), condition, create_tac_none_operand(), line_number);
+}
+
+void cfg_emit_tac(Cfg *cfg)
+{
+    cfg_compute_dominators(cfg); // For reachability
+
+    // Reachable blocks in layout order
+    int *order = (int *)arena_alloc(&cfg_arena, (size_t)cfg->block_count * sizeof(int));
+    char *jumped_to = (char *)arena_calloc(&cfg_arena, (size_t)cfg->block_count);
+    int count = 0;
+    for (int b = cfg->layout_head; b >= 0; b = cfg->blocks[b].layout_next)
+        if (cfg->blocks[b].rpo_index >= 0)
+            order[count++] = b;
+
+    // Find the blocks that need a label
+    for (int i = 0; i < count; i++)
+    {
+        BasicBlock *block = &cfg->blocks[order[i]];
+        int next = i + 1 < count ? order[i + 1] : -1;
+        TacInstruction *terminator = cfg_terminator(block);
+        if (block->phi_count > 0)
+        {
+            fprintf(stderr, "Fatal: Block B%d still has phis at TAC emission.\n", block->id);
+            exit(EXIT_FAILURE);
+        }
+        if (terminator && (terminator->opcode == TAC_IF_GOTO || terminator->opcode == TAC_IF_NOT_GOTO))
+        {
+            if (block->succ_count != 2)
+            {
+                fprintf(stderr, "Fatal: Conditional block B%d has %d successors.\n", block->id, block->succ_count);
+                exit(EXIT_FAILURE);
+            }
+            jumped_to[block->succs[1]] = 1;
+            if (block->succs[0] != next)
+                jumped_to[block->succs[0]] = 1;
+        }
+        else if (block->succ_count == 1 && block->succs[0] != next)
+        {
+            jumped_to[block->succs[0]] = 1;
+        }
+    }
+
+    emit_tac(cfg->begin.opcode, cfg->begin.result, cfg->begin.op1, cfg->begin.op2, cfg->begin.line_number);
+    for (int i = 0; i < count; i++)
+    {
+        BasicBlock *block = &cfg->blocks[order[i]];
+        int next = i + 1 < count ? order[i + 1] : -1;
+        TacInstruction *terminator = cfg_terminator(block);
+        int body_count = terminator ? block->instr_count - 1 : block->instr_count;
+        int line = block->instr_count > 0 ? block->instrs[block->instr_count - 1].line_number : cfg->begin.line_number;
+
+        if (jumped_to[block->id])
+        {
+            if (block->label < 0)
+                block->label = new_tac_label();
+            emit_tac(TAC_LABEL, create_tac_label_operand(block->label), create_tac_none_operand(),
+                     create_tac_none_operand(), block->instr_count > 0 ? block->instrs[0].line_number : line);
+        }
+        for (int k = 0; k < body_count; k++)
+        {
+            const TacInstruction *instr = &block->instrs[k];
+            emit_tac(instr->opcode, instr->result, instr->op1, instr->op2, instr->line_number);
+        }
+
+        // Rebuild the jumps from the edges
+        if (terminator && terminator->opcode == TAC_RETURN)
+        {
+            emit_tac(TAC_RETURN, terminator->result, terminator->op1, terminator->op2, line);
+        }
+        else if (terminator && terminator->opcode != TAC_GOTO)
+        {
+            emit_jump(cfg, terminator->opcode, terminator->op1, block->succs[1], line);
+            if (block->succs[0] != next)
+                emit_jump(cfg, TAC_GOTO, create_tac_none_operand(), block->succs[0], line);
+        }
+        else if (block->succ_count == 1 && block->succs[0] != next)
+        {
+            emit_jump(cfg, TAC_GOTO, create_tac_none_operand(), block->succs[0], line);
+        }
+        else if (block->succ_count == 0 && next >= 0)
+        {
+            // Falls off the end of the function but is no longer laid out last
+            emit_tac(TAC_RETURN, create_tac_none_operand(), create_tac_none_operand(), create_tac_none_operand(), line);
+        }
+    }
+    emit_tac(cfg->end.opcode, cfg->end.result, cfg->end.op1, cfg->end.op2, cfg->end.line_number);
+}
+
+static void print_block_list(FILE *out, const int *ids, int count)
+{
+    if (count == 0)
+        fprintf(out, " -");
+    for (int i = 0; i < count; i++)
+        fprintf(out, " B%d", ids[i]);
+}
+
+void cfg_print(FILE *out, Cfg *cfg, const char *title)
+{
+    char name[64];
+    cfg_compute_loops(cfg);
+
+    fprintf(out, "\n--- %s: %s (%d blocks, %d loops) ---\n", title,
+            tac_label_name((int)cfg->begin.op1.val.id, name, sizeof(name)), cfg->block_count, cfg->loop_count);
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        fprintf(out, "B%d", b);
+        if (block->label >= 0)
+            fprintf(out, " (%s)", tac_label_name(block->label, name, sizeof(name)));
+        fprintf(out, ": preds");
+        print_block_list(out, block->preds, block->pred_count);
+        fprintf(out, "; succs");
+        print_block_list(out, block->succs, block->succ_count);
+        if (block->rpo_index < 0)
+            fprintf(out, "; unreachable");
+        else if (block->idom >= 0)
+            fprintf(out, "; idom B%d", block->idom);
+        if (block->loop >= 0)
+            fprintf(out, "; loop %d", block->loop);
+        fprintf(out, "\n");
+        for (int i = 0; i < block->phi_count; i++)
+        {
+            CfgPhi *phi = &block->phis[i];
+            fprintf(out, "    ");
+            print_tac_operand(out, phi->result);
+            fprintf(out, " = PHI(");
+            for (int p = 0; p < block->pred_count; p++)
+            {
+                fprintf(out, p ? ", " : "");
+                print_tac_operand(out, phi->args[p]);
+                fprintf(out, " B%d", block->preds[p]);
+            }
+            fprintf(out, ")\n");
+        }
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            fprintf(out, "    ");
+            print_tac_instruction(out, &block->instrs[i]);
+            fprintf(out, "\n");
+        }
+    }
+    for (int l = 0; l < cfg->loop_count; l++)
+    {
+        CfgLoop *loop = &cfg->loops[l];
+        fprintf(out, "Loop %d: header B%d, depth %d", l, loop->header, loop->depth);
+        if (loop->parent >= 0)
+            fprintf(out, ", inside loop %d", loop->parent);
+        fprintf(out, "; latches");
+        print_block_list(out, loop->latches, loop->latch_count);
+        fprintf(out, "; blocks");
+        print_block_list(out, loop->blocks, loop->block_count);
+        fprintf(out, "\n");
+    }
+    fprintf(out, "------------------------------------------\n");
+}
+
+void free_cfgs(void)
+{
+    arena_release(&cfg_arena);
+}
@@ -0,0 +1,171 @@
+// cfg.h
+#ifndef CFG_H
+#define CFG_H
+
+#include "tac.h"
+#include <stdio.h>
+
+// Control-flow graph of one function (the TAC between TAC_FUNCTION_BEGIN and
+// TAC_FUNCTION_END), with dominator tree and natural-loop forest computed on
+// demand. Everything lives in cfg_arena and is released by free_cfgs().
+//
+// Blocks refer to each other by index into Cfg::blocks. A block owns a copy of
+// its instructions, so passes can rewrite a block without touching the
+// TacProgram it was built from.
+
+// A phi function at the top of a block (SSA form only). args[i] is the value
+// arriving from the block's i-th predecessor, so the argument arrays are kept
+// in step with BasicBlock::preds by the edge editing functions below.
+typedef struct CfgPhi
+{
+    TacOperand result;
+    TacOperand *args;
+} CfgPhi;
+
+// One basic block. A TAC_LABEL never appears in 'instrs': the label that
+// started the block is kept in 'label'. A jump, conditional jump or return can
+// only be the last instruction.
+//
+// The edges are authoritative: cfg_emit_tac() rebuilds the target of every
+// jump from 'succs', so passes retarget a jump by editing edges only.
+typedef struct BasicBlock
+{
+    int id;                 // Index in Cfg::blocks
+    int label;              // Label ID defined at the top of the block, -1 if none
+    TacInstruction *instrs; // Body of the block, terminator last
+    int instr_count;
+    int instr_capacity;
+    CfgPhi *phis;
+    int phi_count;
+    int phi_capacity;
+    int layout_prev; // Neighbours in emission order, -1 at either end
+    int layout_next;
+
+    // succs[0] is where control goes when the last instruction does not jump
+    // (fall-through), or the target of a TAC_GOTO. succs[1] is the target of a
+    // taken TAC_IF_GOTO / TAC_IF_NOT_GOTO. Returns and the last block have no
+    // successors.
+    int succs[2];
+    int succ_count;
+    int succ_pred_index[2]; // This block's position in succs[i]'s preds (and phi arguments)
+    int *preds;
+    int pred_count;
+    int pred_capacity;
+
+    // Set by cfg_compute_dominators()
+    int rpo_index;   // Position in reverse postorder, -1 if unreachable
+    int idom;        // Immediate dominator, -1 for the entry and unreachable blocks
+    int dom_depth;   // Depth in the dominator tree (entry = 0)
+    int dom_child;   // First child in the dominator tree, -1 if none
+    int dom_sibling; // Next child of the same dominator, -1 if none
+    int dom_pre;     // Entry and exit numbers of a walk over the dominator
+    int dom_post;    // tree: a dominates b iff a's range encloses b's
+    int *frontier;   // Dominance frontier, set by cfg_compute_frontiers()
+    int frontier_count;
+
+    // Set by cfg_compute_loops()
+    int loop; // Innermost loop containing the block, -1 if none
+} BasicBlock;
+
+// A natural loop: the header plus every block that reaches a back edge into
+// the header without passing through it. Back edges sharing a header form one
+// loop. An enclosing loop always comes before the loops nested in it.
+typedef struct CfgLoop
+{
+    int header;
+    int parent;  // Enclosing loop, -1 for a top-level loop
+    int depth;   // 1 for a top-level loop
+    int *blocks; // Every block of the loop, nested loops included
+    int block_count;
+    int *latches; // Sources of the back edges
+    int latch_count;
+} CfgLoop;
+
+typedef struct Cfg
+{
+    TacInstruction begin; // The TAC_FUNCTION_BEGIN / TAC_FUNCTION_END pair
+    TacInstruction end;
+    BasicBlock *blocks; // blocks[0] is the entry; blocks are in program order
+    int block_count;
+    int block_capacity;
+    int layout_head; // First block in emission order (always the entry)
+    int layout_tail;
+
+    int *rpo; // Reachable blocks in reverse postorder
+    int rpo_count;
+    int dominators_valid;
+    int frontiers_valid;
+
+    CfgLoop *loops;
+    int loop_count;
+    int loops_valid;
+
+    // Set by ssa_construct(): ssa_base[v] is the value index (see dataflow.h)
+    // that version v renames. Values from ssa_base_count on map to themselves.
+    uint32_t *ssa_base;
+    uint32_t ssa_base_count;
+    uint32_t ssa_base_capacity;
+} Cfg;
+
+// Builds the CFG of the function whose TAC_FUNCTION_BEGIN is at
+// 'begin_index'. '*end_index' receives the index of its TAC_FUNCTION_END.
+Cfg *cfg_build(const TacProgram *program, int begin_index, int *end_index);
+
+// Analyses are cached in the Cfg. A pass that adds or removes edges or blocks
+// calls cfg_invalidate(); the next query recomputes what it needs.
+void cfg_compute_dominators(Cfg *cfg);
+void cfg_compute_frontiers(Cfg *cfg); // Also computes dominators
+void cfg_compute_loops(Cfg *cfg); // Also computes dominators
+void cfg_invalidate(Cfg *cfg);
+
+// Returns 1 if block 'a' dominates block 'b' (every block dominates itself).
+int cfg_dominates(Cfg *cfg, int a, int b);
+
+// Returns 1 if 'block' belongs to loop 'loop' (directly or through a nested loop).
+int cfg_loop_contains(Cfg *cfg, int loop, int block);
+
+// Gives every loop a preheader: the one block outside the loop that enters
+// its header, split off the entering edge when that block also leads
+// elsewhere. Returns an array (in cfg_arena) holding the preheader of each
+// loop, or -1 for a header entered from several blocks. The loop forest is
+// recomputed with the same numbering. A preheader that ends up empty can be
+// dropped again with cfg_remove_forwarder().
+int *cfg_make_preheaders(Cfg *cfg);
+
+// Edge and block editing; all of them invalidate cached analyses.
+// A new block is placed in the layout just before 'before' (-1: at the end).
+int cfg_new_block(Cfg *cfg, int before);
+void cfg_add_edge(Cfg *cfg, int from, int to); // Phis of 'to' get an argument slot
+void cfg_remove_edge(Cfg *cfg, int from, int to); // Drops the matching phi argument
+// Puts a new block on the from->to edge, keeping the edge's position in both
+// lists so phi arguments stay attached to it. Returns the new block.
+int cfg_split_edge(Cfg *cfg, int from, int to);
+// Undoes cfg_split_edge(): if 'block' is empty and sits on a single edge, its
+// predecessor is connected straight to its successor and 1 is returned. The
+// block is left unreachable.
+int cfg_remove_forwarder(Cfg *cfg, int block);
+
+// Instruction and phi editing.
+void cfg_append(Cfg *cfg, int block, const TacInstruction *instr);
+void cfg_insert(Cfg *cfg, int block, int position, const TacInstruction *instr);
+void cfg_remove_instr(Cfg *cfg, int block, int position);
+CfgPhi *cfg_add_phi(Cfg *cfg, int block, TacOperand result); // Arguments start as OP_NONE
+
+// The block's terminator (jump, conditional jump or return), or NULL if it
+// falls through.
+TacInstruction *cfg_terminator(BasicBlock *block);
+
+// Appends the function to tac_program with emit_tac(): its TAC_FUNCTION_BEGIN,
+// the blocks in layout order and its TAC_FUNCTION_END. Unreachable blocks are
+// dropped, jumps to the next block are omitted and labels are only emitted
+// for blocks that are jumped to. The CFG must not contain phis.
+void cfg_emit_tac(Cfg *cfg);
+
+// Dumps blocks, phis, edges, dominators and loops under a heading made of
+// 'title' and the function name (used by --trace=cfg and --trace=opt).
+void cfg_print(FILE *out, Cfg *cfg, const char *title);
+
+// Releases every CFG built so far (cfg_arena).
+void free_cfgs(void);
+
+#endif // CFG_H
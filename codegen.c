@@ -1,5 +1,13 @@
 // codegen.c
 #include "codegen.h"
+#include "trace.h"
+#include "arena.h" // Per-function frame layouts, string table and labels live in codegen_arena
+#include "stats.h"
+#include "dataflow.h" // tac_value_index() for register allocation lookups
+#include "cfg.h"      // free_cfgs() after register allocation
+#include "isel.h"
+#include "mir.h"
+#include "peephole.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,37 +19,41 @@ static FunctionContext *current_function_ctx = NULL;
 static StringLiteral *global_string_literals_head = NULL; // For all strings
 static int string_literal_counter = 0;
 static int unique_label_counter = 0; // For unique labels for comparisons etc.
+static int codegen_optimization_level = 0; // -O<n>; registers are allocated from 1 on
+static int codegen_peephole_level = 0;     // Level of peephole_function(), 0 with --no-peephole
+static MirFunction function_code; // Machine code of the function being generated
+static const X86Operand no_operand = {.kind = X86_OPERAND_NONE, .reg = X86_NO_REG, .index = X86_NO_REG};
 
 // --- Helper Function Prototypes ---
-static void emit_prologue(FILE *out, const char *function_name, int stack_size);
-static void emit_epilogue(FILE *out, const char *function_name);
-static void emit_comment(FILE *out, const char *comment);
+static void emit_prologue(const char *function_name, int stack_size);
+static void emit_epilogue(const char *function_name);
+static void emit_note(const char *comment);
+static void emit(X86Opcode opcode, X86Operand dst, X86Operand src);
+static void emit_jump(X86Opcode opcode, X86Cond cond, Atom label);
+static void emit_setcc(X86Cond cond, X86Reg reg);
+static void emit_label(Atom label, int spaced);
+static void emit_tac_comment(int index);
 static const char *operand_to_string(TacOperand op, char *buffer, size_t buffer_size);
-static void load_operand_to_register(FILE *out, TacOperand op, const char *reg);
-static void store_register_to_operand(FILE *out, const char *reg, TacOperand dest_op);
-static const char *get_var_stack_location(const char *var_name);
-static void add_local_var_or_temp(const char *name, TypeKind type);
+static void load_operand_to_register(TacOperand op, X86Reg reg);
+static void store_register_to_operand(X86Reg reg, TacOperand dest_op);
+static X86Operand operand_in_register(TacOperand op, X86Reg scratch);
+static int var_frame_operand(TacOperand var_op, X86Operand *operand);
+static void add_local_var_or_temp(TacOperand var_op);
 static int get_type_size(TypeKind type);
-static void pre_scan_function_locals(TacInstruction *start_instr, TacInstruction *end_instr);
-static const char *add_string_literal(const char *str_val);
+static void pre_scan_function_locals(const TacProgram *program, int start_index, int end_index);
+static const char *add_string_literal(Atom str_val);
 static void emit_data_section(FILE *out);
-static void free_string_literals();
-static void free_var_offsets(VarOffset *head);
-static void free_function_context();
-static char *generate_unique_asm_label(const char *prefix);
+static void reset_string_literals();
+static void end_function_context();
+static Atom generate_unique_asm_label(const char *prefix);
 
 // --- Helper Function Implementations ---
 
-char *generate_unique_asm_label(const char *prefix)
+Atom generate_unique_asm_label(const char *prefix)
 {
-    char *buf = malloc(32); // Allocate memory for the label
-    if (!buf)
-    {
-        perror("Failed to allocate memory for unique label");
-        exit(EXIT_FAILURE);
-    }
-    sprintf(buf, ".%s%d", prefix, unique_label_counter++);
-    return buf; // Caller must free this memory
+    char buf[32];
+    snprintf(buf, sizeof(buf), ".%s%d", prefix, unique_label_counter++);
+    return intern_cstr(buf);
 }
 
 int get_type_size(TypeKind type)
@@ -64,103 +76,282 @@ int get_type_size(TypeKind type)
     }
 }
 
-// Adds a variable or temporary to the current function's context if not already present.
-// Assigns a stack offset.
-static void add_local_var_or_temp(const char *name, TypeKind type)
+// Returns the frame slot record of a variable or temp operand, or NULL if the
+// operand is not one or its ID is outside the current function's tables.
+static VarOffset *find_var_slot(TacOperand var_op)
 {
-    if (!current_function_ctx || !name)
-        return;
+    if (!current_function_ctx)
+        return NULL;
+    if (var_op.type == OP_VAR && var_op.val.id < (uint32_t)current_function_ctx->var_slot_count)
+        return &current_function_ctx->var_slots[var_op.val.id];
+    if (var_op.type == OP_TEMP && var_op.val.id < (uint32_t)current_function_ctx->temp_slot_count)
+        return &current_function_ctx->temp_slots[var_op.val.id];
+    return NULL;
+}
 
-    // Check if it already exists
-    for (VarOffset *curr = current_function_ctx->locals_head; curr; curr = curr->next)
+// Returns 1 if the comparison at 'index' only feeds the conditional jump right
+// after it. The pair is then emitted as cmp + jcc, branching on the flags
+// without materializing the 0/1 result, so the temp needs no frame slot.
+static int is_fused_compare(const TacProgram *program, int index)
+{
+    const TacInstruction *compare = &program->instrs[index];
+    switch (compare->opcode)
     {
-        if (strcmp(curr->name, name) == 0)
-            return;
+    case TAC_LT: case TAC_GT: case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
+        break;
+    default:
+        return 0;
     }
+    if (index + 1 >= program->count || compare->result.type != OP_TEMP ||
+        compare->result.val.id >= (uint32_t)current_function_ctx->temp_slot_count)
+        return 0;
+    const TacInstruction *branch = &program->instrs[index + 1];
+    if (branch->opcode != TAC_IF_GOTO && branch->opcode != TAC_IF_NOT_GOTO)
+        return 0;
+    return branch->op1.type == OP_TEMP && branch->op1.val.id == compare->result.val.id &&
+           current_function_ctx->temp_reads[compare->result.val.id] == 1;
+}
 
-    VarOffset *new_var = (VarOffset *)malloc(sizeof(VarOffset));
-    if (!new_var) { perror("Failed to allocate VarOffset"); exit(EXIT_FAILURE); }
-    new_var->name = strdup(name);
-    if (!new_var->name) { perror("Failed to strdup name for VarOffset"); free(new_var); exit(EXIT_FAILURE); }
-    new_var->type = type;
-    int size = get_type_size(type);
+// Returns the register the allocator gave a variable or temp, X86_NO_REG if
+// the value lives in its frame slot (or is not a variable or temp).
+static X86Reg value_register(TacOperand op)
+{
+    if (!current_function_ctx || (op.type != OP_VAR && op.type != OP_TEMP))
+        return X86_NO_REG;
+    uint32_t value = tac_value_index(op);
+    if (value >= current_function_ctx->regs.value_count)
+        return X86_NO_REG;
+    return (X86Reg)current_function_ctx->regs.reg[value];
+}
+
+// Returns the literal a rematerialized value reads as, or NULL if the value
+// is not rematerialized.
+static const TacOperand *value_constant(TacOperand op)
+{
+    if (!current_function_ctx || (op.type != OP_VAR && op.type != OP_TEMP))
+        return NULL;
+    uint32_t value = tac_value_index(op);
+    if (value >= current_function_ctx->regs.value_count || current_function_ctx->regs.constant[value].type == OP_NONE)
+        return NULL;
+    return &current_function_ctx->regs.constant[value];
+}
 
-    // Simple stack alignment to 4-byte boundary for values larger than a byte, or if offset is not aligned
-    if (size > 1 && current_function_ctx->current_stack_offset % size != 0) {
-         current_function_ctx->current_stack_offset -= (current_function_ctx->current_stack_offset % size);
-    } else if (current_function_ctx->current_stack_offset % 4 != 0 && size == 4) { // Ensure dwords are aligned
-         current_function_ctx->current_stack_offset = (current_function_ctx->current_stack_offset / 4) * 4;
+// Describes where a TAC operand lives for instruction selection: literals and
+// rematerialized values as immediates, allocated values as their virtual
+// register, the others as their DWORD frame slot. Returns 0 for an operand the selector
+// does not handle (chars in memory, strings), which takes the generic path.
+static int describe_operand(TacOperand op, X86Operand *operand)
+{
+    const TacOperand *constant = value_constant(op);
+    if (constant)
+        op = *constant;
+    switch (op.type)
+    {
+    case OP_NONE:
+        *operand = no_operand;
+        return 1;
+    case OP_LIT_INT:
+    case OP_LIT_BOOL:
+        *operand = x86_imm_operand(op.val.int_val);
+        return 1;
+    case OP_LIT_CHAR:
+        *operand = x86_imm_operand((int)op.val.char_val);
+        return 1;
+    case OP_VAR:
+    case OP_TEMP:
+    {
+        X86Reg reg = value_register(op);
+        if (reg != X86_NO_REG)
+        {
+            *operand = x86_vreg_operand(tac_value_index(op), reg);
+            return 1;
+        }
+        VarOffset *slot = find_var_slot(op);
+        if (!slot || slot->offset == 0 || op.data_type == TYPE_CHAR)
+            return 0;
+        *operand = x86_frame_operand(slot->offset, 4);
+        return 1;
     }
+    default:
+        return 0;
+    }
+}
 
+// Emits the code isel_select() picks for 'instr'. Comparisons and
+// conditional jumps only get their flags set (the result operand is left
+// out). Returns 0, having emitted nothing, when the selector has no pattern
+// for the operands.
+static int emit_selected(const TacInstruction *instr, int *swapped)
+{
+    X86Operand result, left, right;
+    X86Instr code[ISEL_MAX_INSTRS];
+    TacOperand result_op = instr->result;
+    switch (instr->opcode)
+    {
+    case TAC_LT: case TAC_GT: case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
+    case TAC_IF_GOTO: case TAC_IF_NOT_GOTO:
+        result_op.type = OP_NONE;
+        break;
+    default:
+        // Registers hold chars zero-extended: only a char may be copied into one
+        if (result_op.data_type == TYPE_CHAR && (instr->opcode != TAC_ASSIGN || instr->op1.data_type != TYPE_CHAR))
+            return 0;
+        break;
+    }
+    if (!describe_operand(result_op, &result) || !describe_operand(instr->op1, &left) ||
+        !describe_operand(instr->op2, &right))
+        return 0;
+    int count = isel_select(instr->opcode, &result, &left, &right, code, swapped);
+    for (int i = 0; i < count; i++)
+        mir_append(&function_code, &code[i]);
+    return count >= 0;
+}
 
-    current_function_ctx->current_stack_offset -= size; // Allocate space
-    new_var->offset = current_function_ctx->current_stack_offset;
+// Adds a variable or temporary to the current function's context if not already present.
+// Assigns a stack offset.
+static void add_local_var_or_temp(TacOperand var_op)
+{
+    VarOffset *new_var = find_var_slot(var_op);
+    if (!new_var || new_var->offset != 0)
+        return; // Not a variable/temp, or it already has a slot
+    if (value_register(var_op) != X86_NO_REG || value_constant(var_op))
+        return; // Kept in a register, or rematerialized at each use
 
-    new_var->next = current_function_ctx->locals_head;
-    current_function_ctx->locals_head = new_var;
+    TypeKind type = (TypeKind)var_op.data_type;
+    new_var->type = type;
+    if (current_function_ctx->slot_offsets)
+    {
+        // The allocator chose a slot, possibly shared with other values
+        int slot = current_function_ctx->regs.slot[tac_value_index(var_op)];
+        if (slot >= 0)
+        {
+            new_var->offset = current_function_ctx->slot_offsets[slot];
+            current_function_ctx->locals_count++;
+            return;
+        }
+    }
+    int size = get_type_size(type);
+
+    // Allocate below the current offset, rounded down to a multiple of the size
+    // (the offsets are negative, so C's '%' is made non-negative first)
+    current_function_ctx->current_stack_offset -= size;
+    current_function_ctx->current_stack_offset -= ((current_function_ctx->current_stack_offset % size) + size) % size;
+    new_var->offset = current_function_ctx->current_stack_offset;
+    current_function_ctx->locals_count++;
     // total_stack_size will be calculated at the end of pre_scan_function_locals based on min offset
 }
 
+// Orders shared slots by decreasing use weight, dwords before bytes on a tie
+static int compare_slots_by_weight(const void *a, const void *b)
+{
+    const RegAllocation *regs = &current_function_ctx->regs;
+    int x = *(const int *)a, y = *(const int *)b;
+    if (regs->slot_weight[x] != regs->slot_weight[y])
+        return regs->slot_weight[x] > regs->slot_weight[y] ? -1 : 1;
+    if (regs->slot_size[x] != regs->slot_size[y])
+        return regs->slot_size[x] > regs->slot_size[y] ? -1 : 1;
+    return x - y;
+}
+
+// Places the allocator's shared slots in the frame, most used first, so the
+// hottest ones sit closest to EBP and are reached with a one-byte
+// displacement ([ebp-128] is the last such address).
+static void layout_shared_slots(void)
+{
+    const RegAllocation *regs = &current_function_ctx->regs;
+    int *order = (int *)arena_alloc(&codegen_arena, (size_t)(regs->slot_count + 1) * sizeof(int));
+    current_function_ctx->slot_offsets = (int *)arena_alloc(&codegen_arena, (size_t)(regs->slot_count + 1) * sizeof(int));
+    for (int s = 0; s < regs->slot_count; s++)
+        order[s] = s;
+    qsort(order, (size_t)regs->slot_count, sizeof(int), compare_slots_by_weight);
+
+    int offset = 0;
+    for (int i = 0; i < regs->slot_count; i++)
+    {
+        int size = regs->slot_size[order[i]];
+        offset -= size;
+        offset -= ((offset % size) + size) % size; // Align down to the slot size
+        current_function_ctx->slot_offsets[order[i]] = offset;
+    }
+    current_function_ctx->current_stack_offset = offset;
+}
+
 // Scans TAC for a function to identify all local variables, temporaries, and string literals.
-static void pre_scan_function_locals(TacInstruction *start_instr, TacInstruction *end_instr)
+static void pre_scan_function_locals(const TacProgram *program, int start_index, int end_index)
 {
     if (!current_function_ctx)
         return;
     
-    // Free existing locals if any (e.g. if this function is called multiple times for different functions)
-    free_var_offsets(current_function_ctx->locals_head);
-    current_function_ctx->locals_head = NULL;
+    // Fresh, zeroed slot tables sized for every ID in the program (any old tables are
+    // reclaimed with codegen_arena)
+    current_function_ctx->var_slot_count = program->var_count;
+    current_function_ctx->temp_slot_count = program->temp_count;
+    current_function_ctx->var_slots = (VarOffset *)arena_calloc(&codegen_arena, (size_t)program->var_count * sizeof(VarOffset));
+    current_function_ctx->temp_slots = (VarOffset *)arena_calloc(&codegen_arena, (size_t)program->temp_count * sizeof(VarOffset));
+    current_function_ctx->temp_reads = (int *)arena_calloc(&codegen_arena, (size_t)program->temp_count * sizeof(int));
+    current_function_ctx->locals_count = 0;
     current_function_ctx->current_stack_offset = 0; // Start allocating from [ebp-0], going negative
     current_function_ctx->total_stack_size = 0;
+    current_function_ctx->slot_offsets = NULL;
+    if (current_function_ctx->regs.value_count > 0)
+        layout_shared_slots();
 
 
-    TacInstruction *current = start_instr;
-    // First pass: Add all explicitly declared variables (from symbol table if available)
-    // For now, we rely on them appearing as results in TAC
+    // First pass: Count the reads of every temp, so comparisons feeding only a
+    // branch can be fused with it. Explicitly declared variables are not
+    // collected here; we rely on them appearing as results in TAC
+    for (int i = start_index; i <= end_index && i < program->count; i++)
+    {
+        const TacInstruction *current = &program->instrs[i];
+        if (current->op1.type == OP_TEMP && current->op1.val.id < (uint32_t)program->temp_count)
+            current_function_ctx->temp_reads[current->op1.val.id]++;
+        if (current->op2.type == OP_TEMP && current->op2.val.id < (uint32_t)program->temp_count)
+            current_function_ctx->temp_reads[current->op2.val.id]++;
+        if (current->opcode == TAC_ARRAY_STORE && current->result.type == OP_TEMP &&
+            current->result.val.id < (uint32_t)program->temp_count)
+            current_function_ctx->temp_reads[current->result.val.id]++; // result[op1] = op2 reads the array
+    }
     
     // Second pass: Add all temporaries and variables that appear as results
-    current = start_instr;
-    while (current)
+    for (int i = start_index; i <= end_index && i < program->count; i++)
     {
-        if (current->result.type == OP_VAR || current->result.type == OP_TEMP)
+        const TacInstruction *current = &program->instrs[i];
+        if ((current->result.type == OP_VAR || current->result.type == OP_TEMP) && !is_fused_compare(program, i))
         {
             // Ensure data_type is set for the result operand during TAC generation
-            // if(current->result.data_type == TYPE_UNKNOWN && current->result.val.name) {
+            // if(current->result.data_type == TYPE_UNKNOWN) {
             //     // Attempt to infer type, or default. This should ideally be set in TAC phase.
             //     // For simplicity here, we'll assume non-char types are int/dword if not specified.
             //     // A better compiler would have type information from semantic analysis propagated to TAC.
-            //     // fprintf(stderr, "Warning: Result operand %s has unknown type, defaulting to TYPE_INT for stack allocation.\n", current->result.val.name);
+            //     // fprintf(stderr, "Warning: Result operand %s has unknown type, defaulting to TYPE_INT for stack allocation.\n", atom_name(current->result.val.id));
             //     // current->result.data_type = TYPE_INT; // Defaulting, improve this
             // }
-            add_local_var_or_temp(current->result.val.name, current->result.data_type);
+            add_local_var_or_temp(current->result);
         }
          if (current->op1.type == OP_VAR) { // Also consider operands if they are not defined yet (e.g. function params)
             // This part might be more complex depending on how parameters are handled.
             // For simplicity, we assume params are also assigned to via TAC or handled elsewhere.
-            // add_local_var_or_temp(current->op1.val.name, current->op1.data_type);
+            // add_local_var_or_temp(current->op1);
         }
         if (current->op2.type == OP_VAR) {
-            // add_local_var_or_temp(current->op2.val.name, current->op2.data_type);
+            // add_local_var_or_temp(current->op2);
         }
 
 
         // Add string literals to the global list
-        if (current->op1.type == OP_STRING_LIT && current->op1.val.name)
+        if (current->op1.type == OP_STRING_LIT)
         {
-            add_string_literal(current->op1.val.name);
+            add_string_literal(current->op1.val.id);
         }
-        if (current->op2.type == OP_STRING_LIT && current->op2.val.name)
+        if (current->op2.type == OP_STRING_LIT)
         {
-            add_string_literal(current->op2.val.name);
+            add_string_literal(current->op2.val.id);
         }
-        if (current->result.type == OP_STRING_LIT && current->result.val.name)
+        if (current->result.type == OP_STRING_LIT)
         {
-            add_string_literal(current->result.val.name);
+            add_string_literal(current->result.val.id);
         }
 
-        if (current == end_instr)
-            break;
-        current = current->next;
     }
     // Calculate total stack size needed based on the lowest offset reached
     current_function_ctx->total_stack_size = abs(current_function_ctx->current_stack_offset);
@@ -171,94 +362,135 @@ static void pre_scan_function_locals(TacInstruction *start_instr, TacInstruction
     {
         current_function_ctx->total_stack_size = (current_function_ctx->total_stack_size / 4 + 1) * 4;
     }
-    if (current_function_ctx->total_stack_size == 0 && current_function_ctx->locals_head != NULL) {
+    if (current_function_ctx->total_stack_size == 0 && current_function_ctx->locals_count > 0) {
         // If there are locals but stack size is 0 (e.g. only one char), ensure some minimal allocation.
         // However, this should be covered by the previous alignment.
         // Or, if only one char, current_stack_offset is -1, abs is 1, aligned to 4.
     }
+    STATS_ADD(STAT_FRAME_BYTES, current_function_ctx->total_stack_size);
 }
 
-static const char *get_var_stack_location(const char *var_name)
+// Sets 'operand' to the frame slot of a variable or temp. Returns 0 after
+// reporting the error when the operand has no slot.
+static int var_frame_operand(TacOperand var_op, X86Operand *operand)
 {
-    static char buffer[40]; 
-
-    if (!current_function_ctx || !var_name) {
-        snprintf(buffer, sizeof(buffer), "INVALID_VAR_NAME");
-        return buffer;
-    }
-    
-
-    for (VarOffset *curr = current_function_ctx->locals_head; curr; curr = curr->next)
+    VarOffset *slot = current_function_ctx && (var_op.type == OP_VAR || var_op.type == OP_TEMP)
+                          ? find_var_slot(var_op) : NULL;
+    if (slot && slot->offset != 0)
     {
-        if (strcmp(curr->name, var_name) == 0)
-        {
-            // NASM syntax does not use "PTR". The size specifier (BYTE, DWORD) is sufficient.
-            const char *size_specifier = (curr->type == TYPE_CHAR) ? "BYTE" : "DWORD";
-            sprintf(buffer, "%s [ebp%+d]", size_specifier, curr->offset);
-            return buffer;
-        }
+        *operand = x86_frame_operand(slot->offset, slot->type == TYPE_CHAR ? 1 : 4);
+        return 1;
     }
 
-    fprintf(stderr, "Codegen Error: Variable '%s' not found in current function context. Stack location unknown.\n", var_name);
-    sprintf(buffer, "[%s_UNDEFINED_IN_CTX]", var_name);
-    return buffer;
+    char name[64], note[128];
+    operand_to_string(var_op, name, sizeof(name));
+    fprintf(stderr, "Codegen Error: Variable '%s' not found in current function context. Stack location unknown.\n", name);
+    snprintf(note, sizeof(note), "ERROR: %.40s has no stack location", name);
+    emit_note(note);
+    return 0;
 }
 
-static const char *add_string_literal(const char *str_val)
+static const char *add_string_literal(Atom str_val)
 {
-    if (!str_val)
-        return NULL;
-
     for (StringLiteral *curr = global_string_literals_head; curr; curr = curr->next)
     {
-        if (strcmp(curr->value, str_val) == 0)
+        if (curr->value == str_val)
             return curr->label;
     }
 
-    StringLiteral *new_lit = (StringLiteral *)malloc(sizeof(StringLiteral));
-    if (!new_lit) { perror("Failed to allocate StringLiteral"); exit(EXIT_FAILURE); }
+    StringLiteral *new_lit = (StringLiteral *)arena_alloc(&codegen_arena, sizeof(StringLiteral));
     char label_buf[20];
     sprintf(label_buf, "_str%d", string_literal_counter++);
-    new_lit->label = strdup(label_buf);
-    if (!new_lit->label) { perror("Failed to strdup label for StringLiteral"); free(new_lit); exit(EXIT_FAILURE); }
-    new_lit->value = strdup(str_val);
-    if (!new_lit->value) { perror("Failed to strdup value for StringLiteral"); free(new_lit->label); free(new_lit); exit(EXIT_FAILURE); }
+    new_lit->label = arena_strdup(&codegen_arena, label_buf);
+    new_lit->value = str_val;
     
     new_lit->next = global_string_literals_head;
     global_string_literals_head = new_lit;
     return new_lit->label;
 }
 
-static void emit_prologue(FILE *out, const char *function_name, int stack_size)
+// Returns 1 if 'reg' must be preserved for the caller and the current
+// function keeps values in it
+static int is_callee_saved_in_use(X86Reg reg)
+{
+    if (reg != X86_EBX && reg != X86_ESI && reg != X86_EDI)
+        return 0;
+    return current_function_ctx && (current_function_ctx->regs.used_regs & (1u << reg)) != 0;
+}
+
+static void emit_prologue(const char *function_name, int stack_size)
 {
-    fprintf(out, "\n%s:\n", function_name);
-    emit_comment(out, "Function prologue");
-    fprintf(out, "    push ebp\n");
-    fprintf(out, "    mov ebp, esp\n");
+    emit_label(intern_cstr(function_name), 1);
+    emit_note("Function prologue");
+    emit(X86_PUSH, x86_reg_operand(X86_EBP), no_operand);
+    emit(X86_MOV, x86_reg_operand(X86_EBP), x86_reg_operand(X86_ESP));
     if (stack_size > 0)
     {
-        fprintf(out, "    sub esp, %d\n", stack_size);
+        emit(X86_SUB, x86_reg_operand(X86_ESP), x86_imm_operand(stack_size));
     }
+    // Callee-saved registers the allocator handed out are saved below the frame
+    for (int reg = 0; reg < X86_REG_COUNT; reg++)
+        if (is_callee_saved_in_use((X86Reg)reg))
+            emit(X86_PUSH, x86_reg_operand((X86Reg)reg), no_operand);
+}
+
+// ".epilogue_<function>", where returns jump to
+static Atom epilogue_label(const char *function_name)
+{
+    char label[160];
+    snprintf(label, sizeof(label), ".epilogue_%s", function_name);
+    return intern_cstr(label);
 }
 
-static void emit_epilogue(FILE *out, const char *function_name)
+static void emit_epilogue(const char *function_name)
 {
     // Ensure function_name is not NULL, though it should be set if prologue was emitted
     const char* name_to_use = function_name ? function_name : "unknown_function_epilogue";
-    fprintf(out, "\n.epilogue_%s:\n", name_to_use); 
-    emit_comment(out, "Function epilogue");
-    fprintf(out, "    mov esp, ebp\n");
-    fprintf(out, "    pop ebp\n");
-    fprintf(out, "    ret\n");
+    emit_label(epilogue_label(name_to_use), 1);
+    emit_note("Function epilogue");
+    for (int reg = X86_REG_COUNT - 1; reg >= 0; reg--)
+        if (is_callee_saved_in_use((X86Reg)reg))
+            emit(X86_POP, x86_reg_operand((X86Reg)reg), no_operand);
+    emit(X86_MOV, x86_reg_operand(X86_ESP), x86_reg_operand(X86_EBP));
+    emit(X86_POP, x86_reg_operand(X86_EBP), no_operand);
+    emit(X86_RET, no_operand, no_operand);
 }
 
-static void emit_comment(FILE *out, const char *comment)
+// Appends an instruction to the current function's machine code. Nothing is
+// written until the function is complete (see finish_function()).
+static void emit(X86Opcode opcode, X86Operand dst, X86Operand src)
 {
-    if (comment && strlen(comment) > 0) {
-        fprintf(out, "    ; %s\n", comment);
-    } else {
-        fprintf(out, "    ;\n");
-    }
+    X86Instr instr = {.opcode = opcode, .dst = dst, .src = src};
+    mir_append(&function_code, &instr);
+}
+
+static void emit_jump(X86Opcode opcode, X86Cond cond, Atom label)
+{
+    X86Instr instr = {.opcode = opcode, .cond = cond, .dst = x86_symbol_operand(label), .src = no_operand};
+    mir_append(&function_code, &instr);
+}
+
+static void emit_setcc(X86Cond cond, X86Reg reg)
+{
+    X86Instr instr = {.opcode = X86_SETCC, .cond = cond, .dst = x86_byte_reg_operand(reg), .src = no_operand};
+    mir_append(&function_code, &instr);
+}
+
+// 'spaced' puts a blank line before the label in the listing
+static void emit_label(Atom label, int spaced)
+{
+    emit(X86_LABEL, x86_symbol_operand(label), spaced ? x86_imm_operand(1) : no_operand);
+}
+
+// The listing's comment for the TAC instruction at 'index'
+static void emit_tac_comment(int index)
+{
+    emit(X86_COMMENT, x86_imm_operand(index), no_operand);
+}
+
+static void emit_note(const char *comment)
+{
+    emit(X86_COMMENT, x86_symbol_operand(intern_cstr(comment ? comment : "")), no_operand);
 }
 
 static const char *operand_to_string(TacOperand op, char *buffer, size_t buffer_size)
@@ -270,13 +502,16 @@ static const char *operand_to_string(TacOperand op, char *buffer, size_t buffer_
         snprintf(buffer, buffer_size, "_");
         break;
     case OP_VAR:
+        snprintf(buffer, buffer_size, "%s", atom_name(tac_program.var_names[op.val.id]));
+        break;
     case OP_TEMP:
-    case OP_LABEL: // Labels are just names
-        snprintf(buffer, buffer_size, "%s", op.val.name ? op.val.name : "NULL_OP_NAME");
+        snprintf(buffer, buffer_size, "_t%u", op.val.id);
+        break;
+    case OP_LABEL: // Generated labels are printed as L<id>
+        tac_label_name(op.val.id, buffer, buffer_size);
         break;
     case OP_STRING_LIT:
-        // Ensure op.val.name is not NULL before trying to use it
-        snprintf(buffer, buffer_size, "\"%s\"", op.val.name ? op.val.name : "NULL_STR_LIT");
+        snprintf(buffer, buffer_size, "\"%s\"", atom_name(op.val.id));
         break;
     case OP_LIT_INT:
         snprintf(buffer, buffer_size, "%d", op.val.int_val);
@@ -302,86 +537,124 @@ static const char *operand_to_string(TacOperand op, char *buffer, size_t buffer_
     return buffer;
 }
 
-static void load_operand_to_register(FILE *out, TacOperand op, const char *reg)
+// The virtual register of a value the allocator kept in a register
+static X86Operand value_vreg(TacOperand op)
+{
+    return x86_vreg_operand(tac_value_index(op), value_register(op));
+}
+
+static void load_operand_to_register(TacOperand op, X86Reg reg)
 {
     char temp_buf[128];
-    const char* op_loc_str;
+    X86Operand location;
+    X86Reg value_reg = value_register(op);
+    const TacOperand *constant = value_constant(op);
+    if (value_reg != X86_NO_REG)
+    {
+        // Registers hold chars zero-extended already. A copy into the value's
+        // own register disappears with mir_assign_registers().
+        emit(X86_MOV, x86_reg_operand(reg), value_vreg(op));
+        return;
+    }
+    if (constant)
+        op = *constant; // Rematerialized: load the literal again
     switch (op.type)
     {
     case OP_VAR:
     case OP_TEMP:
-        op_loc_str = get_var_stack_location(op.val.name);
+        if (!var_frame_operand(op, &location))
+            break;
         if (op.data_type == TYPE_CHAR)
         {
             // For char, ensure we are loading into a full register if needed (e.g. eax, not al directly if using full reg name)
             // movzx (move with zero extend) is good for this.
-            fprintf(out, "    movzx %s, %s\n", reg, op_loc_str);
+            emit(X86_MOVZX, x86_reg_operand(reg), location);
         }
         else
         {
-            fprintf(out, "    mov %s, %s\n", reg, op_loc_str);
+            emit(X86_MOV, x86_reg_operand(reg), location);
         }
         break;
     case OP_LIT_INT:
     case OP_LIT_BOOL: // Booleans are 0 or 1, handled as ints
-        fprintf(out, "    mov %s, %d\n", reg, op.val.int_val);
+        emit(X86_MOV, x86_reg_operand(reg), x86_imm_operand(op.val.int_val));
         break;
     case OP_LIT_CHAR:
-        fprintf(out, "    mov %s, %d\n", reg, (int)op.val.char_val); // Load ASCII value
+        emit(X86_MOV, x86_reg_operand(reg), x86_imm_operand((int)op.val.char_val)); // Load ASCII value
         break;
     case OP_STRING_LIT: // Load address of string literal
-        fprintf(out, "    mov %s, %s\n", reg, add_string_literal(op.val.name));
+        emit(X86_MOV, x86_reg_operand(reg), x86_symbol_operand(intern_cstr(add_string_literal(op.val.id))));
         break;
-    // Add OP_LABEL if you intend to load addresses of labels, though usually labels are targets for jumps.
-    // case OP_LABEL:
-    //    fprintf(out, "    mov %s, %s\n", reg, op.val.name);
-    //    break;
     default:
+    {
+        char note[192];
         operand_to_string(op, temp_buf, sizeof(temp_buf));
-        fprintf(stderr, "Codegen Error: Cannot load operand %s (type %d, value %s) to register %s.\n", 
-                temp_buf, op.type, op.val.name ? op.val.name : "N/A", reg);
-        fprintf(out, "    ; ERROR: Cannot load operand %s to %s\n", temp_buf, reg);
+        fprintf(stderr, "Codegen Error: Cannot load operand %s (type %d) to register %s.\n", 
+                temp_buf, op.type, x86_reg_name(reg));
+        snprintf(note, sizeof(note), "ERROR: Cannot load operand %s to %s", temp_buf, x86_reg_name(reg));
+        emit_note(note);
         break;
     }
+    }
 }
 
-static void store_register_to_operand(FILE *out, const char *reg, TacOperand dest_op)
+// Returns the register holding 'op': its own register if the allocator gave
+// it one, otherwise 'scratch' after loading it there.
+static X86Operand operand_in_register(TacOperand op, X86Reg scratch)
+{
+    if (value_register(op) != X86_NO_REG)
+        return value_vreg(op);
+    load_operand_to_register(op, scratch);
+    return x86_reg_operand(scratch);
+}
+
+static void store_register_to_operand(X86Reg reg, TacOperand dest_op)
 {
     if (dest_op.type != OP_VAR && dest_op.type != OP_TEMP)
     {
-        char temp_buf[128];
+        char temp_buf[128], note[192];
         operand_to_string(dest_op, temp_buf, sizeof(temp_buf));
-        fprintf(stderr, "Codegen Error: Cannot store register %s to operand %s (type %d).\n", reg, temp_buf, dest_op.type);
-        fprintf(out, "    ; ERROR: Cannot store register %s to %s (invalid dest type)\n", reg, temp_buf);
+        fprintf(stderr, "Codegen Error: Cannot store register %s to operand %s (type %d).\n", x86_reg_name(reg), temp_buf, dest_op.type);
+        snprintf(note, sizeof(note), "ERROR: Cannot store register %s to %s (invalid dest type)", x86_reg_name(reg), temp_buf);
+        emit_note(note);
         return;
     }
     
-    const char *dest_loc = get_var_stack_location(dest_op.val.name);
+    if (value_register(dest_op) != X86_NO_REG)
+    {
+        if (dest_op.data_type == TYPE_CHAR && x86_reg_byte_name(reg))
+        {
+            // Truncate to a byte as a store to a BYTE slot would
+            emit(X86_MOVZX, value_vreg(dest_op), x86_byte_reg_operand(reg));
+            return;
+        }
+        emit(X86_MOV, value_vreg(dest_op), x86_reg_operand(reg));
+        return;
+    }
+    if (value_constant(dest_op))
+        return; // Its only definition assigns the literal each use reads
+
+    X86Operand dest_loc;
+    if (!var_frame_operand(dest_op, &dest_loc))
+        return;
     if (dest_op.data_type == TYPE_CHAR)
     {
-        const char *byte_reg = NULL;
-        // Ensure 'reg' is one of the general purpose registers that have an 8-bit part
-        if (strcmp(reg, "eax") == 0) byte_reg = "al";
-        else if (strcmp(reg, "ebx") == 0) byte_reg = "bl";
-        else if (strcmp(reg, "ecx") == 0) byte_reg = "cl";
-        else if (strcmp(reg, "edx") == 0) byte_reg = "dl";
-        // Add esi, edi if you use their byte parts (sil, dil) - less common for this
-        
-        if (byte_reg)
+        // Only eax, ebx, ecx and edx have an 8-bit part
+        if (x86_reg_byte_name(reg))
         {
-            fprintf(out, "    mov %s, %s\n", dest_loc, byte_reg);
+            emit(X86_MOV, dest_loc, x86_byte_reg_operand(reg));
         }
         else
         {
-            // This case implies 'reg' was not eax, ebx, ecx, or edx, or was already a byte reg string.
-            // If 'reg' could be "al", "bl", etc. directly, handle that. For simplicity, assume full reg name.
-            fprintf(stderr, "Codegen Error: Cannot get byte-part of register %s for char store to %s.\n", reg, dest_op.val.name);
-            fprintf(out, "    ; ERROR: Cannot get byte-part of register %s for char store\n", reg);
+            char note[128];
+            fprintf(stderr, "Codegen Error: Cannot get byte-part of register %s for char store.\n", x86_reg_name(reg));
+            snprintf(note, sizeof(note), "ERROR: Cannot get byte-part of register %s for char store", x86_reg_name(reg));
+            emit_note(note);
         }
     }
     else // For DWORD types (int, bool, pointers)
     {
-        fprintf(out, "    mov %s, %s\n", dest_loc, reg);
+        emit(X86_MOV, dest_loc, x86_reg_operand(reg));
     }
 }
 
@@ -404,15 +677,16 @@ static void emit_data_section(FILE *out)
     while (curr)
     {
         fprintf(out, "    %s db ", curr->label);
+        const char *value = atom_name(curr->value);
         // Print string as comma-separated hex bytes, then null terminator
-        for (int i = 0; curr->value[i] != '\0'; ++i)
+        for (int i = 0; value[i] != '\0'; ++i)
         {
-            fprintf(out, "0x%02x, ", (unsigned char)curr->value[i]);
+            fprintf(out, "0x%02x, ", (unsigned char)value[i]);
         }
         fprintf(out, "0x00 ; \"");
         // Print original string in comment, escaping special chars for the comment
-        for (int i = 0; curr->value[i] != '\0'; ++i) {
-            char c = curr->value[i];
+        for (int i = 0; value[i] != '\0'; ++i) {
+            char c = value[i];
             if (c == '"') fprintf(out, "\\\"");
             else if (c == '\\') fprintf(out, "\\\\");
             else if (isprint(c)) fprintf(out, "%c", c);
@@ -423,47 +697,120 @@ static void emit_data_section(FILE *out)
     }
 }
 
-static void free_string_literals()
+// The literal nodes themselves are reclaimed with codegen_arena.
+static void reset_string_literals()
 {
-    StringLiteral *curr = global_string_literals_head;
-    while (curr)
-    {
-        StringLiteral *next = curr->next;
-        free(curr->label);
-        free(curr->value);
-        free(curr);
-        curr = next;
-    }
     global_string_literals_head = NULL;
     string_literal_counter = 0; // Reset for potential multiple compilations in one run (if tool supports it)
 }
 
-static void free_var_offsets(VarOffset *head)
+static void end_function_context()
 {
-    VarOffset *curr = head;
-    while (curr)
+    // The context and its locals stay in codegen_arena until the file is done.
+    current_function_ctx = NULL;
+}
+
+// --- Listing ---
+
+// Writes the comment line that stands for a TAC instruction in the listing
+static void print_tac_comment(FILE *out, const TacInstruction *current)
+{
+    char res[128], op1[128], op2[128];
+    operand_to_string(current->result, res, sizeof(res));
+    operand_to_string(current->op1, op1, sizeof(op1));
+    operand_to_string(current->op2, op2, sizeof(op2));
+    switch (current->opcode)
     {
-        VarOffset *next = curr->next;
-        free(curr->name);
-        free(curr);
-        curr = next;
+    case TAC_FUNCTION_BEGIN: fprintf(out, "\n    ; TAC: FUNCTION_BEGIN %s\n", op1); break; // op1 is function name
+    case TAC_FUNCTION_END:
+        fprintf(out, "    ; TAC: FUNCTION_END %s\n", current_function_ctx ? current_function_ctx->name : "UNKNOWN_FUNCTION");
+        break;
+    case TAC_ASSIGN: fprintf(out, "    ; TAC: %s = %s\n", res, op1); break;
+    case TAC_ADD: fprintf(out, "    ; TAC: %s = %s + %s\n", res, op1, op2); break;
+    case TAC_SUB: fprintf(out, "    ; TAC: %s = %s - %s\n", res, op1, op2); break;
+    case TAC_MUL: fprintf(out, "    ; TAC: %s = %s * %s\n", res, op1, op2); break;
+    case TAC_DIV: fprintf(out, "    ; TAC: %s = %s / %s\n", res, op1, op2); break;
+    case TAC_MOD: fprintf(out, "    ; TAC: %s = %s %% %s\n", res, op1, op2); break;
+    case TAC_AND: fprintf(out, "    ; TAC: %s = %s && %s\n", res, op1, op2); break;
+    case TAC_OR: fprintf(out, "    ; TAC: %s = %s || %s\n", res, op1, op2); break;
+    case TAC_UMINUS: fprintf(out, "    ; TAC: %s = -%s\n", res, op1); break;
+    case TAC_NOT: fprintf(out, "    ; TAC: %s = NOT %s\n", res, op1); break;
+    case TAC_LT: fprintf(out, "    ; TAC: %s = %s < %s\n", res, op1, op2); break;
+    case TAC_GT: fprintf(out, "    ; TAC: %s = %s > %s\n", res, op1, op2); break;
+    case TAC_LEQ: fprintf(out, "    ; TAC: %s = %s <= %s\n", res, op1, op2); break;
+    case TAC_GEQ: fprintf(out, "    ; TAC: %s = %s >= %s\n", res, op1, op2); break;
+    case TAC_EQ: fprintf(out, "    ; TAC: %s = %s == %s\n", res, op1, op2); break;
+    case TAC_NEQ: fprintf(out, "    ; TAC: %s = %s != %s\n", res, op1, op2); break;
+    case TAC_LABEL: fprintf(out, "    ; TAC: LABEL %s:\n", res); break; // result operand holds the label name
+    case TAC_GOTO: fprintf(out, "    ; TAC: GOTO %s\n", res); break;
+    case TAC_IF_GOTO: fprintf(out, "    ; TAC: IF %s GOTO %s\n", op1, res); break;
+    case TAC_IF_NOT_GOTO: fprintf(out, "    ; TAC: IF_NOT %s GOTO %s\n", op1, res); break;
+    case TAC_PRINT: fprintf(out, "    ; TAC: PRINT %s\n", op1); break;
+    case TAC_RETURN: fprintf(out, "    ; TAC: RETURN %s\n", op1); break;
+    case TAC_PARAM: fprintf(out, "    ; TAC: PARAM %s\n", op1); break;
+    case TAC_CALL: fprintf(out, "    ; TAC: %s = CALL %s, (args: %s)\n", res, op1, op2); break;
+    case TAC_NEW_ARRAY: fprintf(out, "    ; TAC: %s = NEW_ARRAY elements: %s\n", res, op1); break;
+    case TAC_ARRAY_LOAD: fprintf(out, "    ; TAC: %s = %s[%s]\n", res, op1, op2); break;
+    case TAC_ARRAY_STORE: fprintf(out, "    ; TAC: %s[%s] = %s\n", res, op1, op2); break;
+    case TAC_NOP: fprintf(out, "    ; TAC: NOP\n"); break;
+    default:
+        fprintf(out, "    ; ERROR: Unhandled TAC Opcode: %d (%s = %s op %s)\n", current->opcode, res, op1, op2);
+        break;
     }
 }
 
-static void free_function_context()
+// The final printer: writes the current function's machine code as NASM
+// text. Only real instructions count towards --stats.
+static void print_function_code(FILE *out, const TacProgram *program)
 {
-    if (current_function_ctx)
+    for (int i = 0; i < function_code.count; i++)
     {
-        free(current_function_ctx->name); // strdup'd
-        free_var_offsets(current_function_ctx->locals_head);
-        current_function_ctx->locals_head = NULL; // Avoid double free if called again
-        free(current_function_ctx);
-        current_function_ctx = NULL;
+        const X86Instr *instr = &function_code.instrs[i];
+        if (instr->opcode == X86_COMMENT)
+        {
+            if (instr->dst.kind == X86_OPERAND_IMM)
+                print_tac_comment(out, &program->instrs[instr->dst.disp]);
+            else if (atom_length(instr->dst.symbol) > 0)
+                fprintf(out, "    ; %s\n", atom_name(instr->dst.symbol));
+            else
+                fprintf(out, "    ;\n");
+            continue;
+        }
+        x86_print_instr(out, instr);
+        if (instr->opcode != X86_LABEL)
+            STATS_INC(STAT_ASM_INSTRUCTIONS);
+    }
+}
+
+// Takes the function's machine code from virtual to physical registers,
+// runs the peephole optimizer over it and prints it. --trace=asm:3 shows the
+// code and its blocks before that.
+static void finish_function(FILE *out, const TacProgram *program)
+{
+    if (TRACE_ENABLED(TRACE_ASM, 3))
+    {
+        mir_build_blocks(&function_code);
+        printf("--- Machine code of %s ---\n", current_function_ctx ? current_function_ctx->name : "?");
+        mir_dump(&function_code, stdout);
     }
+    if (current_function_ctx)
+        mir_assign_registers(&function_code, &current_function_ctx->regs);
+    peephole_function(&function_code, codegen_peephole_level);
+    print_function_code(out, program);
+    mir_reset(&function_code);
+}
+
+// The label an OP_LABEL operand names, "L<id>"
+static Atom tac_label_atom(TacOperand label)
+{
+    char name[32];
+    tac_label_name(label.val.id, name, sizeof(name));
+    return intern_cstr(name);
 }
 
 // --- Main Generation Function ---
-void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename)
+void generate_x86_assembly(const TacProgram *program, const char *output_filename, int optimization_level,
+                           int peephole_level)
 {
     FILE *out = fopen(output_filename, "w");
     if (!out)
@@ -473,8 +820,11 @@ void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename
     }
 
     // Reset global state for this generation pass
-    free_string_literals(); // Clear any previous literals
+    reset_string_literals(); // Clear any previous literals
     unique_label_counter = 0; // Reset unique label counter for this assembly file
+    codegen_optimization_level = optimization_level;
+    codegen_peephole_level = peephole_level;
+    mir_reset(&function_code);
 
 
     fprintf(out, "bits 32\n");
@@ -486,213 +836,230 @@ void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename
 
     fprintf(out, "\nsection .text\n");
 
-    TacInstruction *current = tac_list;
-    char tac_buf_res[128], tac_buf_op1[128], tac_buf_op2[128];
+    char name_buf[128];
 
-    while (current)
+    for (int index = 0; index < program->count; index++)
     {
-        // Generate string representations of TAC operands for comments
-        operand_to_string(current->result, tac_buf_res, sizeof(tac_buf_res));
-        operand_to_string(current->op1, tac_buf_op1, sizeof(tac_buf_op1));
-        operand_to_string(current->op2, tac_buf_op2, sizeof(tac_buf_op2));
+        const TacInstruction *current = &program->instrs[index];
+        int swapped; // Operands swapped by the instruction selector (see isel_select())
 
-        // Emit TAC as comment
-        // You might want a more structured way to print the TAC instruction itself as a comment
-        // For now, a simple switch or if/else for formatting the comment:
-        // Example: fprintf(out, "    ; TAC: %s = %s op %s\n", tac_buf_res, tac_buf_op1, tac_buf_op2);
+        // Every TAC instruction is listed as a comment above its code
+        emit_tac_comment(index);
 
         switch (current->opcode)
         {
         case TAC_FUNCTION_BEGIN:
-            fprintf(out, "\n    ; TAC: FUNCTION_BEGIN %s\n", tac_buf_op1); // op1 is function name
+            operand_to_string(current->op1, name_buf, sizeof(name_buf)); // op1 is function name
             if (current_function_ctx) { // Should not happen if TAC_FUNCTION_END was processed
                 fprintf(stderr, "Warning: Overwriting active function context for %s with %s\n", 
-                        current_function_ctx->name, current->op1.val.name);
-                free_function_context();
+                        current_function_ctx->name, name_buf);
+                end_function_context();
             }
-            current_function_ctx = (FunctionContext *)calloc(1, sizeof(FunctionContext));
-            if (!current_function_ctx) { perror("Failed to allocate FunctionContext"); exit(EXIT_FAILURE); }
-            current_function_ctx->name = strdup(current->op1.val.name);
-            if (!current_function_ctx->name) { perror("Failed to strdup function name"); free(current_function_ctx); current_function_ctx = NULL; exit(EXIT_FAILURE); }
+            current_function_ctx = (FunctionContext *)arena_calloc(&codegen_arena, sizeof(FunctionContext));
+            current_function_ctx->name = arena_strdup(&codegen_arena, name_buf);
 
 
             // Find the end of the function to scan all its locals and temporaries
-            TacInstruction *func_end_node = current->next; // Start scan from instruction after BEGIN
-            while (func_end_node && func_end_node->opcode != TAC_FUNCTION_END)
+            int func_end_index = index + 1; // Start scan from instruction after BEGIN
+            while (func_end_index < program->count && program->instrs[func_end_index].opcode != TAC_FUNCTION_END)
             {
                 // Also check that we don't run into another FUNCTION_BEGIN
-                if (func_end_node->opcode == TAC_FUNCTION_BEGIN) {
+                if (program->instrs[func_end_index].opcode == TAC_FUNCTION_BEGIN) {
                     fprintf(stderr, "Error: Nested TAC_FUNCTION_BEGIN without TAC_FUNCTION_END for %s.\n", current_function_ctx->name);
                     // Handle error: maybe stop, or just scan up to here
                     break; 
                 }
-                func_end_node = func_end_node->next;
+                func_end_index++;
+            }
+            // If func_end_index reached program->count, TAC_FUNCTION_END was not found for this function
+            // and the scan runs to the end of the program.
+            // pre_scan from current (BEGIN) up to func_end_index (END), both inclusive
+            if (codegen_optimization_level >= 1)
+            {
+                regalloc_function(program, index, &current_function_ctx->regs);
+                free_cfgs();
             }
-            // If func_end_node is NULL here, it means TAC_FUNCTION_END was not found for this function.
-            // pre_scan_function_locals expects the end_instr to be the TAC_FUNCTION_END itself or NULL if it's the last func.
-            // If func_end_node is NULL, it implies scanning till the end of TAC list.
-            // The pre_scan_function_locals was modified to handle 'current' up to 'end_instr' (inclusive of start, exclusive of end for scan range logic)
-            // Let's adjust: pre_scan from current (BEGIN) up to func_end_node (END)
-            pre_scan_function_locals(current, func_end_node); 
-            emit_prologue(out, current_function_ctx->name, current_function_ctx->total_stack_size);
+            pre_scan_function_locals(program, index, func_end_index); 
+            emit_prologue(current_function_ctx->name, current_function_ctx->total_stack_size);
             break;
 
         case TAC_FUNCTION_END:
-            fprintf(out, "    ; TAC: FUNCTION_END %s\n", current_function_ctx ? current_function_ctx->name : "UNKNOWN_FUNCTION");
             if (current_function_ctx)
             {
-                // Make sure the name matches if op1 is used for function name in TAC_FUNCTION_END
-                // if (current->op1.type == OP_LABEL && strcmp(current_function_ctx->name, current->op1.val.name) != 0) {
-                //    fprintf(stderr, "Warning: TAC_FUNCTION_END for %s does not match current context %s\n", current->op1.val.name, current_function_ctx->name);
-                // }
-                emit_epilogue(out, current_function_ctx->name);
-                free_function_context(); // Free context for this function
+                emit_epilogue(current_function_ctx->name);
+                finish_function(out, program);
+                end_function_context(); // Done with this function
             } else {
                  fprintf(stderr, "Warning: TAC_FUNCTION_END encountered without active function context.\n");
-                 // emit_epilogue(out, "orphaned_function_end"); // Or some default
             }
             break;
 
         case TAC_ASSIGN:
-            fprintf(out, "    ; TAC: %s = %s\n", tac_buf_res, tac_buf_op1);
-            load_operand_to_register(out, current->op1, "eax");
-            store_register_to_operand(out, "eax", current->result);
+            if (value_constant(current->result))
+                break; // Rematerialized: every use loads the literal itself
+            if (emit_selected(current, &swapped))
+                break;
+            load_operand_to_register(current->op1, X86_EAX);
+            store_register_to_operand(X86_EAX, current->result);
             break;
 
         case TAC_ADD:
         case TAC_SUB:
         case TAC_MUL:
-            // For comments
+            if (emit_selected(current, &swapped))
+                break;
             {
-                const char *op_symbol = "";
-                if(current->opcode == TAC_ADD) op_symbol = "+";
-                else if(current->opcode == TAC_SUB) op_symbol = "-";
-                else if(current->opcode == TAC_MUL) op_symbol = "*";
-                fprintf(out, "    ; TAC: %s = %s %s %s\n", tac_buf_res, tac_buf_op1, op_symbol, tac_buf_op2);
+                load_operand_to_register(current->op1, X86_EAX);
+                X86Operand source = operand_in_register(current->op2, X86_EDX);
+                if (current->opcode == TAC_ADD)
+                    emit(X86_ADD, x86_reg_operand(X86_EAX), source);
+                else if (current->opcode == TAC_SUB)
+                    emit(X86_SUB, x86_reg_operand(X86_EAX), source);
+                else // TAC_MUL
+                    emit(X86_IMUL, x86_reg_operand(X86_EAX), source); // Signed multiply
             }
-            load_operand_to_register(out, current->op1, "eax");
-            load_operand_to_register(out, current->op2, "ebx");
-            if (current->opcode == TAC_ADD)
-                fprintf(out, "    add eax, ebx\n");
-            else if (current->opcode == TAC_SUB)
-                fprintf(out, "    sub eax, ebx\n");
-            else // TAC_MUL
-                fprintf(out, "    imul eax, ebx\n"); // Signed multiply
-            store_register_to_operand(out, "eax", current->result);
+            store_register_to_operand(X86_EAX, current->result);
+            break;
+
+        case TAC_AND: // Booleans are 0 or 1, so the bitwise form is the logical one
+        case TAC_OR:
+            if (emit_selected(current, &swapped))
+                break;
+            load_operand_to_register(current->op1, X86_EAX);
+            emit(current->opcode == TAC_AND ? X86_AND : X86_OR, x86_reg_operand(X86_EAX),
+                 operand_in_register(current->op2, X86_EDX));
+            store_register_to_operand(X86_EAX, current->result);
             break;
 
         case TAC_DIV:
         case TAC_MOD:
-             {
-                const char *op_symbol = (current->opcode == TAC_DIV) ? "/" : "%%";
-                fprintf(out, "    ; TAC: %s = %s %s %s\n", tac_buf_res, tac_buf_op1, op_symbol, tac_buf_op2);
+            load_operand_to_register(current->op1, X86_EAX); // Dividend
+            {
+                X86Operand divisor = operand_in_register(current->op2, X86_ECX); // Not EDX: cdq overwrites it
+                emit(X86_CDQ, no_operand, no_operand);    // Sign-extend EAX into EDX:EAX
+                emit(X86_IDIV, divisor, no_operand);      // Quotient in EAX, Remainder in EDX
             }
-            load_operand_to_register(out, current->op1, "eax"); // Dividend
-            load_operand_to_register(out, current->op2, "ebx"); // Divisor
-            fprintf(out, "    cdq\n");                     // Sign-extend EAX into EDX:EAX
-            fprintf(out, "    idiv ebx\n");                  // Quotient in EAX, Remainder in EDX
-            store_register_to_operand(out, (current->opcode == TAC_DIV) ? "eax" : "edx", current->result);
+            store_register_to_operand((current->opcode == TAC_DIV) ? X86_EAX : X86_EDX, current->result);
             break;
 
         case TAC_UMINUS: // Unary minus
-            fprintf(out, "    ; TAC: %s = -%s\n", tac_buf_res, tac_buf_op1);
-            load_operand_to_register(out, current->op1, "eax");
-            fprintf(out, "    neg eax\n");
-            store_register_to_operand(out, "eax", current->result);
+            if (emit_selected(current, &swapped))
+                break;
+            load_operand_to_register(current->op1, X86_EAX);
+            emit(X86_NEG, x86_reg_operand(X86_EAX), no_operand);
+            store_register_to_operand(X86_EAX, current->result);
             break;
 
         case TAC_LABEL:
             // result operand holds the label name
-            fprintf(out, "    ; TAC: LABEL %s:\n", tac_buf_res);
-            fprintf(out, "%s:\n", current->result.val.name);
+            emit_label(tac_label_atom(current->result), 0);
             break;
 
         case TAC_GOTO:
             // result operand holds the target label name
-            fprintf(out, "    ; TAC: GOTO %s\n", tac_buf_res);
-            fprintf(out, "    jmp %s\n", current->result.val.name);
+            emit_jump(X86_JMP, X86_CC_E, tac_label_atom(current->result));
             break;
         
         // Comparison operators: result = op1 CMP_OP op2
         case TAC_LT: case TAC_GT: case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
         {
-            const char *op_str = "?"; const char *set_instr = "INVALID_SET_INSTR";
+            X86Cond cc = X86_CC_E; // Condition that holds when the comparison is true
             switch (current->opcode) {
-                case TAC_LT:  op_str = "<";  set_instr = "setl";  break; // Set if Less
-                case TAC_GT:  op_str = ">";  set_instr = "setg";  break; // Set if Greater
-                case TAC_LEQ: op_str = "<="; set_instr = "setle"; break; // Set if Less or Equal
-                case TAC_GEQ: op_str = ">="; set_instr = "setge"; break; // Set if Greater or Equal
-                case TAC_EQ:  op_str = "=="; set_instr = "sete";  break; // Set if Equal
-                case TAC_NEQ: op_str = "!="; set_instr = "setne"; break; // Set if Not Equal
+                case TAC_LT:  cc = X86_CC_L;  break;
+                case TAC_GT:  cc = X86_CC_G;  break;
+                case TAC_LEQ: cc = X86_CC_LE; break;
+                case TAC_GEQ: cc = X86_CC_GE; break;
+                case TAC_EQ:  cc = X86_CC_E;  break;
+                case TAC_NEQ: cc = X86_CC_NE; break;
                 default: break; // Should not happen
             }
-            fprintf(out, "    ; TAC: %s = %s %s %s\n", tac_buf_res, tac_buf_op1, op_str, tac_buf_op2);
-            load_operand_to_register(out, current->op1, "eax");
-            load_operand_to_register(out, current->op2, "ebx");
-            fprintf(out, "    cmp eax, ebx\n");
-            fprintf(out, "    %s al\n", set_instr);      // Set AL (8-bit) based on comparison
-            fprintf(out, "    movzx eax, al\n");         // Zero-extend AL to EAX (result is 0 or 1)
-            store_register_to_operand(out, "eax", current->result);
+            int fused = is_fused_compare(program, index);
+            if (fused)
+                emit_tac_comment(index + 1); // The IF's comment goes before the cmp so the jcc directly follows it
+            if (emit_selected(current, &swapped))
+            {
+                if (swapped)
+                    cc = x86_cond_mirror(cc);
+            }
+            else
+            {
+                load_operand_to_register(current->op1, X86_EAX);
+                emit(X86_CMP, x86_reg_operand(X86_EAX), operand_in_register(current->op2, X86_EDX));
+            }
+            if (fused)
+            {
+                // The result only feeds the next IF: jump on the flags directly. The
+                // jcc follows the cmp with nothing in between, so the pair macro-fuses.
+                const TacInstruction *branch = &program->instrs[++index];
+                if (branch->opcode == TAC_IF_NOT_GOTO)
+                    cc = x86_cond_negate(cc);
+                emit_jump(X86_JCC, cc, tac_label_atom(branch->result));
+                STATS_INC(STAT_FUSED_BRANCHES);
+                break;
+            }
+            emit_setcc(cc, X86_EAX); // Set AL (8-bit) based on comparison
+            if (value_register(current->result) != X86_NO_REG)
+            {
+                emit(X86_MOVZX, value_vreg(current->result), x86_byte_reg_operand(X86_EAX)); // 0 or 1, straight into place
+                break;
+            }
+            emit(X86_MOVZX, x86_reg_operand(X86_EAX), x86_byte_reg_operand(X86_EAX)); // Zero-extend AL to EAX (result is 0 or 1)
+            store_register_to_operand(X86_EAX, current->result);
             break;
         }
 
         case TAC_IF_GOTO: // IF op1 GOTO result(label)
-            fprintf(out, "    ; TAC: IF %s GOTO %s\n", tac_buf_op1, tac_buf_res);
-            load_operand_to_register(out, current->op1, "eax"); // Load boolean condition
-            fprintf(out, "    cmp eax, 0\n");           // Compare with false (0)
-            fprintf(out, "    jne %s\n", current->result.val.name); // Jump if Not Equal (i.e., if true)
-            break;
-
         case TAC_IF_NOT_GOTO: // IF NOT op1 GOTO result(label)
-            fprintf(out, "    ; TAC: IF_NOT %s GOTO %s\n", tac_buf_op1, tac_buf_res);
-            load_operand_to_register(out, current->op1, "eax"); // Load boolean condition
-            fprintf(out, "    cmp eax, 0\n");            // Compare with false (0)
-            fprintf(out, "    je %s\n", current->result.val.name);  // Jump if Equal (i.e., if false)
+            if (!emit_selected(current, &swapped))
+            {
+                load_operand_to_register(current->op1, X86_EAX); // Load boolean condition
+                emit(X86_CMP, x86_reg_operand(X86_EAX), x86_imm_operand(0)); // Compare with false (0)
+            }
+            // Jump if true (not equal to 0), or for IF_NOT if false
+            emit_jump(X86_JCC, current->opcode == TAC_IF_GOTO ? X86_CC_NE : X86_CC_E, tac_label_atom(current->result));
             break;
 
         case TAC_NOT: // result = !op1
-            fprintf(out, "    ; TAC: %s = NOT %s\n", tac_buf_res, tac_buf_op1);
-            load_operand_to_register(out, current->op1, "eax");
-            fprintf(out, "    cmp eax, 0\n");   // Check if eax is 0 (false)
-            fprintf(out, "    sete al\n");      // Set AL to 1 if eax was 0, else 0
-            fprintf(out, "    movzx eax, al\n"); // Zero-extend AL to EAX
-            store_register_to_operand(out, "eax", current->result);
+            if (emit_selected(current, &swapped))
+                break;
+            load_operand_to_register(current->op1, X86_EAX);
+            emit(X86_CMP, x86_reg_operand(X86_EAX), x86_imm_operand(0)); // Check if eax is 0 (false)
+            emit_setcc(X86_CC_E, X86_EAX);                                // Set AL to 1 if eax was 0, else 0
+            emit(X86_MOVZX, x86_reg_operand(X86_EAX), x86_byte_reg_operand(X86_EAX)); // Zero-extend AL to EAX
+            store_register_to_operand(X86_EAX, current->result);
             break;
 
         case TAC_PRINT:
         {
-            fprintf(out, "    ; TAC: PRINT %s\n", tac_buf_op1);
             const char *fmt_str_label = NULL;
             int args_to_clean = 8; // Default: format string + 1 value = 2 * 4 bytes
 
             if (current->op1.data_type == TYPE_BOOLEAN) {
                 // For boolean, print "true" or "false" string
-                char *true_branch_label = generate_unique_asm_label("print_true");
-                char *end_print_bool_label = generate_unique_asm_label("print_bool_end");
+                Atom true_branch_label = generate_unique_asm_label("print_true");
+                Atom end_print_bool_label = generate_unique_asm_label("print_bool_end");
                 
-                load_operand_to_register(out, current->op1, "eax");
-                fprintf(out, "    cmp eax, 0\n");
-                fprintf(out, "    jne %s\n", true_branch_label); // If not 0 (true), jump to print "true"
+                load_operand_to_register(current->op1, X86_EAX);
+                emit(X86_CMP, x86_reg_operand(X86_EAX), x86_imm_operand(0));
+                emit_jump(X86_JCC, X86_CC_NE, true_branch_label); // If not 0 (true), jump to print "true"
                 // False case:
-                fprintf(out, "    push DWORD _false_str\n");
-                fprintf(out, "    jmp %s\n", end_print_bool_label);
+                emit(X86_PUSH, x86_symbol_operand(intern_cstr("_false_str")), no_operand);
+                emit_jump(X86_JMP, X86_CC_E, end_print_bool_label);
                 // True case:
-                fprintf(out, "%s:\n", true_branch_label);
-                fprintf(out, "    push DWORD _true_str\n");
+                emit_label(true_branch_label, 0);
+                emit(X86_PUSH, x86_symbol_operand(intern_cstr("_true_str")), no_operand);
                 // End of conditional push:
-                fprintf(out, "%s:\n", end_print_bool_label);
+                emit_label(end_print_bool_label, 0);
                 
                 fmt_str_label = "_str_nl_fmt"; // Use string format for "true"/"false"
-                // free(true_branch_label); // Freed after use
-                // free(end_print_bool_label);
             } else if (current->op1.data_type == TYPE_STRING) {
                 // If operand is already a string (e.g. string variable/literal)
-                load_operand_to_register(out, current->op1, "eax"); // Loads address of string
-                fprintf(out, "    push eax\n");
+                load_operand_to_register(current->op1, X86_EAX); // Loads address of string
+                emit(X86_PUSH, x86_reg_operand(X86_EAX), no_operand);
                 fmt_str_label = "_str_nl_fmt";
             } else { // Int, Char
-                load_operand_to_register(out, current->op1, "eax");
-                fprintf(out, "    push eax\n"); // Push the value
+                load_operand_to_register(current->op1, X86_EAX);
+                emit(X86_PUSH, x86_reg_operand(X86_EAX), no_operand); // Push the value
                 if (current->op1.data_type == TYPE_CHAR) {
                     fmt_str_label = "_char_fmt";
                 } else { // TYPE_INT or unknown defaults to int
@@ -700,60 +1067,57 @@ void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename
                 }
             }
             
-            fprintf(out, "    push DWORD %s\n", fmt_str_label); // Push format string address
-            fprintf(out, "    call printf\n");
-            fprintf(out, "    add esp, %d\n", args_to_clean); // Clean up stack (2 DWORDs pushed)
+            emit(X86_PUSH, x86_symbol_operand(intern_cstr(fmt_str_label)), no_operand); // Push format string address
+            emit(X86_CALL, x86_symbol_operand(intern_cstr("printf")), no_operand);
+            emit(X86_ADD, x86_reg_operand(X86_ESP), x86_imm_operand(args_to_clean)); // Clean up stack (2 DWORDs pushed)
             break;
         }
 
 
         case TAC_RETURN: // RETURN op1 (op1 can be OP_NONE)
-            fprintf(out, "    ; TAC: RETURN %s\n", tac_buf_op1);
             if (current->op1.type != OP_NONE) {
-                load_operand_to_register(out, current->op1, "eax"); // Return value in EAX
+                load_operand_to_register(current->op1, X86_EAX); // Return value in EAX
             }
 
             // Special handling for return from 'main' -> call exit
             if (current_function_ctx && strcmp(current_function_ctx->name, "main") == 0) {
                 if (current->op1.type == OP_NONE) { // Implicit return 0 from main if no value specified
-                    fprintf(out, "    mov eax, 0\n");
+                    emit(X86_MOV, x86_reg_operand(X86_EAX), x86_imm_operand(0));
                 }
                 // For main, we typically call exit with the return code
-                fprintf(out, "    push eax\n");    // Push return code as argument to exit
-                fprintf(out, "    call exit\n");   // exit() does not return
+                emit(X86_PUSH, x86_reg_operand(X86_EAX), no_operand); // Push return code as argument to exit
+                emit(X86_CALL, x86_symbol_operand(intern_cstr("exit")), no_operand); // exit() does not return
                 // No jmp to epilogue needed here as exit terminates.
             } else if (current_function_ctx) { // For other functions, jump to epilogue
-                fprintf(out, "    jmp .epilogue_%s\n", current_function_ctx->name);
+                emit_jump(X86_JMP, X86_CC_E, epilogue_label(current_function_ctx->name));
             } else {
-                 fprintf(out, "    ; Warning: RETURN in unknown function context, emitting direct ret\n");
-                 fprintf(out, "    ret\n");
+                 emit_note("Warning: RETURN in unknown function context, emitting direct ret");
+                 emit(X86_RET, no_operand, no_operand);
             }
             break;
 
         case TAC_PARAM: // PARAM op1
-            fprintf(out, "    ; TAC: PARAM %s\n", tac_buf_op1);
-            load_operand_to_register(out, current->op1, "eax");
-            fprintf(out, "    push eax\n"); // Push parameter onto stack
+            load_operand_to_register(current->op1, X86_EAX);
+            emit(X86_PUSH, x86_reg_operand(X86_EAX), no_operand); // Push parameter onto stack
             break;
 
         case TAC_CALL: // result = CALL op1 (function_name), op2 (num_args_as_lit_int)
-            fprintf(out, "    ; TAC: %s = CALL %s, (args: %s)\n", tac_buf_res, tac_buf_op1, tac_buf_op2);
-            fprintf(out, "    call %s\n", current->op1.val.name); // op1.val.name is function label
+            operand_to_string(current->op1, name_buf, sizeof(name_buf)); // op1 is the function label
+            emit(X86_CALL, x86_symbol_operand(intern_cstr(name_buf)), no_operand);
             
             // Clean up parameters from stack if op2 specifies num_args
             if (current->op2.type == OP_LIT_INT && current->op2.val.int_val > 0) {
-                fprintf(out, "    add esp, %d\n", current->op2.val.int_val * 4); // Each param is 4 bytes
+                emit(X86_ADD, x86_reg_operand(X86_ESP), x86_imm_operand(current->op2.val.int_val * 4)); // Each param is 4 bytes
             }
             
             if (current->result.type != OP_NONE) { // If call has a return value to store
-                store_register_to_operand(out, "eax", current->result); // Return value in EAX
+                store_register_to_operand(X86_EAX, current->result); // Return value in EAX
             }
             break;
         
         case TAC_NEW_ARRAY: // result = NEW_ARRAY op1 (size in elements)
         {
             // Assuming op1 is number of elements, result.data_type is e.g. TYPE_INT_ARRAY
-            fprintf(out, "    ; TAC: %s = NEW_ARRAY elements: %s\n", tac_buf_res, tac_buf_op1);
             // Determine element size based on result's array type
             TypeKind element_type_kind = TYPE_INT; // Default
             if (current->result.data_type == TYPE_INT_ARRAY) element_type_kind = TYPE_INT;
@@ -761,20 +1125,19 @@ void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename
             
             int element_size_bytes = get_type_size(element_type_kind);
             
-            load_operand_to_register(out, current->op1, "eax"); // Number of elements in eax
+            load_operand_to_register(current->op1, X86_EAX); // Number of elements in eax
             if (element_size_bytes > 1) { // Multiply by element size to get total bytes
-                fprintf(out, "    imul eax, %d\n", element_size_bytes);
+                emit(X86_IMUL, x86_reg_operand(X86_EAX), x86_imm_operand(element_size_bytes));
             }
-            fprintf(out, "    push eax\n");    // Push size in bytes as argument to malloc
-            fprintf(out, "    call malloc\n");
-            fprintf(out, "    add esp, 4\n");    // Clean up argument from stack
-            store_register_to_operand(out, "eax", current->result); // Store allocated pointer in result
+            emit(X86_PUSH, x86_reg_operand(X86_EAX), no_operand); // Push size in bytes as argument to malloc
+            emit(X86_CALL, x86_symbol_operand(intern_cstr("malloc")), no_operand);
+            emit(X86_ADD, x86_reg_operand(X86_ESP), x86_imm_operand(4)); // Clean up argument from stack
+            store_register_to_operand(X86_EAX, current->result); // Store allocated pointer in result
             break;
         }
 
         case TAC_ARRAY_LOAD: // result = op1[op2]  (op1=base_addr, op2=index)
         {
-            fprintf(out, "    ; TAC: %s = %s[%s]\n", tac_buf_res, tac_buf_op1, tac_buf_op2);
             // Determine element type from op1 (the array variable)
             TypeKind element_type_kind = TYPE_INT; // Default, should be derived from op1.data_type
             if (current->op1.data_type == TYPE_INT_ARRAY) element_type_kind = TYPE_INT;
@@ -782,54 +1145,51 @@ void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename
 
             int element_size_bytes = get_type_size(element_type_kind);
 
-            load_operand_to_register(out, current->op1, "ebx"); // Base address of array into EBX
-            load_operand_to_register(out, current->op2, "ecx"); // Index into ECX
+            load_operand_to_register(current->op1, X86_EAX); // Base address of array into EAX
+            load_operand_to_register(current->op2, X86_EDX); // Index into EDX
             
-            // Address calculation: ebx + ecx * element_size_bytes
+            // Address calculation: eax + edx * element_size_bytes
+            X86Operand element = x86_mem_operand(X86_EAX, X86_EDX, element_size_bytes, element_size_bytes);
             if (element_type_kind == TYPE_CHAR) {
                 // For movzx, the source (memory) is byte, destination (eax) is dword
-                fprintf(out, "    movzx eax, BYTE [ebx + ecx*%d]\n", element_size_bytes);
+                emit(X86_MOVZX, x86_reg_operand(X86_EAX), element);
             } else { // DWORD elements
-                fprintf(out, "    mov eax, DWORD [ebx + ecx*%d]\n", element_size_bytes);
+                emit(X86_MOV, x86_reg_operand(X86_EAX), element);
             }
-            store_register_to_operand(out, "eax", current->result);
+            store_register_to_operand(X86_EAX, current->result);
             break;
         }
 
         case TAC_ARRAY_STORE: // result[op1] = op2 (result=base_addr, op1=index, op2=value)
         {
-            fprintf(out, "    ; TAC: %s[%s] = %s\n", tac_buf_res, tac_buf_op1, tac_buf_op2);
             TypeKind element_type_kind = TYPE_INT; // Default, should be derived from result.data_type
             if (current->result.data_type == TYPE_INT_ARRAY) element_type_kind = TYPE_INT;
             // else if (current->result.data_type == TYPE_CHAR_ARRAY) element_type_kind = TYPE_CHAR;
 
             int element_size_bytes = get_type_size(element_type_kind);
 
-            load_operand_to_register(out, current->result, "ebx"); // Base address into EBX
-            load_operand_to_register(out, current->op1, "ecx");    // Index into ECX
-            load_operand_to_register(out, current->op2, "edx");    // Value to store into EDX
+            load_operand_to_register(current->result, X86_EAX); // Base address into EAX
+            load_operand_to_register(current->op1, X86_EDX);    // Index into EDX
+            load_operand_to_register(current->op2, X86_ECX);    // Value to store into ECX
             
+            X86Operand element = x86_mem_operand(X86_EAX, X86_EDX, element_size_bytes, element_size_bytes);
             if (element_type_kind == TYPE_CHAR) {
-                // Storing a byte (dl) into memory
-                fprintf(out, "    mov BYTE [ebx + ecx*%d], dl\n", element_size_bytes);
+                // Storing a byte (cl) into memory
+                emit(X86_MOV, element, x86_byte_reg_operand(X86_ECX));
             } else { // DWORD elements
-                fprintf(out, "    mov DWORD [ebx + ecx*%d], edx\n", element_size_bytes);
+                emit(X86_MOV, element, x86_reg_operand(X86_ECX));
             }
             break;
         }
         
         case TAC_NOP:
-            fprintf(out, "    ; TAC: NOP\n");
-            fprintf(out, "    nop\n");
+            emit(X86_NOP, no_operand, no_operand);
             break;
 
         default:
-            fprintf(out, "    ; ERROR: Unhandled TAC Opcode: %d (%s = %s op %s)\n", 
-                current->opcode, tac_buf_res, tac_buf_op1, tac_buf_op2);
-            // You might want to exit or throw an error for unhandled opcodes
+            // The comment above already reports the unhandled opcode
             break;
         }
-        current = current->next;
     }
 
     // If the last function didn't have an explicit TAC_FUNCTION_END,
@@ -837,17 +1197,25 @@ void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename
     if (current_function_ctx)
     {
         fprintf(stderr, "Warning: Active function context for %s at end of TAC list without TAC_FUNCTION_END.\n", current_function_ctx->name);
-        emit_epilogue(out, current_function_ctx->name);
-        free_function_context();
+        emit_epilogue(current_function_ctx->name);
+        finish_function(out, program);
+        end_function_context();
     }
+    else if (function_code.count > 0)
+        finish_function(out, program); // Code outside any function
 
     emit_data_section(out);
 
     fclose(out);
-    printf("X86 assembly generated and saved to: %s\n", output_filename);
+    free_mir(&function_code);
+    arena_release(&codegen_arena);
+    TRACE(TRACE_PHASE, "X86 assembly generated and saved to: %s\n", output_filename);
 
-    // --- Read the generated file and print to terminal ---
+    // --- Read the generated file and print to terminal (--trace=asm only) ---
     // This part is for convenience during development/debugging
+    if (!TRACE_ENABLED(TRACE_ASM, 1))
+        return;
+
     printf("\n--- Generated X86 Assembly (%s) ---\n", output_filename);
     FILE *asm_file_to_read = fopen(output_filename, "r");
     if (asm_file_to_read)
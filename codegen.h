@@ -3,36 +3,48 @@
 #define CODEGEN_H
 
 #include "tac.h"
+#include "regalloc.h"
 #include <stdio.h>
 
 // Manages string literals to be placed in .data section
 typedef struct StringLiteral
 {
     char *label; // e.g., _str0
-    char *value; // The actual string content
+    Atom value;  // The actual string content (interned, so equal strings share one atom)
     struct StringLiteral *next;
 } StringLiteral;
 
-// Manages local variable/temporary stack offsets within a function
+// Stack slot of one local variable or temporary within a function
 typedef struct VarOffset
 {
-    char *name;
-    int offset;    // Offset from EBP (e.g., -4, -8)
+    int offset;    // Offset from EBP (e.g., -4, -8); 0 means no slot has been assigned
     TypeKind type; // To know the size (e.g. char is 1 byte, int is 4)
-    struct VarOffset *next;
 } VarOffset;
 
+// Frame slots are stored in two arrays indexed directly by TAC operand ID,
+// so finding the slot of a variable or temp is a single array access.
 typedef struct FunctionContext
 {
-    char *name;
-    VarOffset *locals_head;
+    const char *name;       // Function label (copied into codegen_arena)
+    VarOffset *var_slots;   // var_slots[id] for OP_VAR operands (var_slot_count entries)
+    VarOffset *temp_slots;  // temp_slots[id] for OP_TEMP operands (temp_slot_count entries)
+    int *temp_reads;        // temp_reads[id]: instructions of the function that read the temp
+    RegAllocation regs;     // Values kept in registers (value_count 0 at -O0: everything in the frame)
+    int *slot_offsets;      // EBP offset of each shared frame slot in regs, NULL at -O0
+    int var_slot_count;
+    int temp_slot_count;
+    int locals_count;       // Number of slots assigned so far
     int current_stack_offset;              // Keeps track of next available stack slot, negative from EBP
     int total_stack_size;                  // Total bytes allocated for locals/temps for this function
     StringLiteral *strings_head;           // List of string literals used in this function (or globally)
     struct FunctionContext *next_function; // If handling multiple functions
 } FunctionContext;
 
-// Main function to generate x86 assembly from TAC
-void generate_x86_assembly(TacInstruction *tac_list, const char *output_filename);
+// Main function to generate x86 assembly from TAC. From optimization level 1
+// on, temps and variables are kept in registers where possible (regalloc.h).
+// peephole_level is the level handed to peephole_function() (peephole.h),
+// normally the optimization level, 0 to leave the selected code alone.
+void generate_x86_assembly(const TacProgram *program, const char *output_filename, int optimization_level,
+                           int peephole_level);
 
 #endif // CODEGEN_H
\ No newline at end of file
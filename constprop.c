@@ -0,0 +1,466 @@
+// constprop.c
+#include "constprop.h"
+#include "dataflow.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Evaluation with the target's semantics ---
+
+int tac_fold(TacOpCode opcode, int32_t op1, int32_t op2, int32_t *result)
+{
+    // Wrapping arithmetic is done on unsigned values to stay clear of C's
+    // signed overflow rules.
+    uint32_t a = (uint32_t)op1, b = (uint32_t)op2;
+    switch (opcode)
+    {
+    case TAC_ADD:    *result = (int32_t)(a + b); return 1;
+    case TAC_SUB:    *result = (int32_t)(a - b); return 1;
+    case TAC_MUL:    *result = (int32_t)(a * b); return 1;
+    case TAC_UMINUS: *result = (int32_t)(0u - a); return 1;
+    case TAC_DIV:
+    case TAC_MOD:
+        if (op2 == 0 || (op1 == INT32_MIN && op2 == -1))
+            return 0; // idiv raises #DE
+        *result = opcode == TAC_DIV ? op1 / op2 : op1 % op2; // C99 truncates like idiv
+        return 1;
+    case TAC_LT:  *result = op1 < op2;  return 1;
+    case TAC_GT:  *result = op1 > op2;  return 1;
+    case TAC_LEQ: *result = op1 <= op2; return 1;
+    case TAC_GEQ: *result = op1 >= op2; return 1;
+    case TAC_EQ:  *result = op1 == op2; return 1;
+    case TAC_NEQ: *result = op1 != op2; return 1;
+    case TAC_AND: *result = op1 != 0 && op2 != 0; return 1;
+    case TAC_OR:  *result = op1 != 0 || op2 != 0; return 1;
+    case TAC_NOT: *result = op1 == 0; return 1;
+    case TAC_ASSIGN: *result = op1; return 1;
+    default:
+        return 0;
+    }
+}
+
+int32_t tac_normalize(int8_t type, int32_t value)
+{
+    return type == TYPE_CHAR ? (int32_t)(uint8_t)value : value;
+}
+
+TacOperand tac_constant_operand(int8_t type, int32_t value)
+{
+    TacOperand op;
+    if (type == TYPE_BOOLEAN)
+        op = create_tac_bool_literal_operand(value);
+    else if (type == TYPE_CHAR && value >= 0 && value <= 127)
+        op = create_tac_char_literal_operand((char)value); // Loaded sign-extended
+    else
+        op = create_tac_int_literal_operand(value);
+    op.data_type = type; // PRINT picks its format from the operand type
+    return op;
+}
+
+int tac_literal_value(TacOperand op, int32_t *value)
+{
+    switch (op.type)
+    {
+    case OP_LIT_INT:
+    case OP_LIT_BOOL:
+        *value = op.val.int_val;
+        return 1;
+    case OP_LIT_CHAR:
+        *value = (int32_t)op.val.char_val; // As codegen loads it
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Only integer-like values are tracked; floats, strings and arrays never
+// become constants.
+static int is_foldable_type(int8_t type)
+{
+    return type == TYPE_INT || type == TYPE_BOOLEAN || type == TYPE_CHAR;
+}
+
+// --- Sparse conditional constant propagation ---
+
+typedef enum LatticeState
+{
+    LATTICE_TOP,      // No definition seen executing yet
+    LATTICE_CONSTANT, // Always the same value
+    LATTICE_BOTTOM    // Varies (or unknown)
+} LatticeState;
+
+typedef struct LatticeValue
+{
+    uint8_t state;
+    int32_t constant;
+} LatticeValue;
+
+// A use site: the instruction 'index' of block 'block', or phi -(index + 1)
+typedef struct UseSite
+{
+    int block;
+    int index;
+} UseSite;
+
+typedef struct PropagationState
+{
+    Cfg *cfg;
+    uint32_t value_count;
+    LatticeValue *lattice;
+    int *use_start; // Uses of value v are uses[use_start[v] .. use_start[v + 1])
+    UseSite *uses;
+    char *visited;       // Blocks reached by an executable edge
+    char *edge_executable; // [block * 2 + successor index]
+    int *edge_worklist;    // Entries are block * 2 + successor index
+    int edge_pending;
+    uint32_t *value_worklist;
+    int value_pending;
+} PropagationState;
+
+static LatticeValue operand_lattice(PropagationState *state, TacOperand op)
+{
+    LatticeValue result = {LATTICE_BOTTOM, 0};
+    int32_t literal;
+    if (tac_literal_value(op, &literal))
+    {
+        result.state = LATTICE_CONSTANT;
+        result.constant = literal;
+    }
+    else if (tac_is_value(op) && is_foldable_type(op.data_type))
+    {
+        result = state->lattice[tac_value_index(op)];
+    }
+    return result;
+}
+
+// Lowers the lattice value of 'def' to the meet of its old value and 'value'
+static void lower_value(PropagationState *state, TacOperand def, LatticeValue value)
+{
+    uint32_t index = tac_value_index(def);
+    LatticeValue *old = &state->lattice[index];
+    if (value.state == LATTICE_CONSTANT)
+    {
+        if (!is_foldable_type(def.data_type))
+            value.state = LATTICE_BOTTOM;
+        else
+            value.constant = tac_normalize(def.data_type, value.constant);
+    }
+    if (old->state == LATTICE_CONSTANT && value.state == LATTICE_CONSTANT && old->constant != value.constant)
+        value.state = LATTICE_BOTTOM;
+    if (value.state <= old->state)
+        return;
+    *old = value;
+    state->value_worklist[state->value_pending++] = index;
+}
+
+static void mark_edge(PropagationState *state, int block, int successor)
+{
+    int edge = block * 2 + successor;
+    if (state->edge_executable[edge])
+        return;
+    state->edge_executable[edge] = 1;
+    state->edge_worklist[state->edge_pending++] = edge;
+}
+
+// Returns 1 if control can arrive in 'block' from 'pred'
+static int edge_from_executable(PropagationState *state, int pred, int block)
+{
+    BasicBlock *source = &state->cfg->blocks[pred];
+    for (int s = 0; s < source->succ_count; s++)
+        if (source->succs[s] == block && state->edge_executable[pred * 2 + s])
+            return 1;
+    return 0;
+}
+
+static void visit_phi(PropagationState *state, BasicBlock *block, CfgPhi *phi)
+{
+    LatticeValue meet = {LATTICE_TOP, 0};
+    for (int a = 0; a < block->pred_count && meet.state != LATTICE_BOTTOM; a++)
+    {
+        if (!edge_from_executable(state, block->preds[a], block->id))
+            continue;
+        LatticeValue arg = operand_lattice(state, phi->args[a]);
+        if (phi->args[a].type == OP_NONE)
+            arg.state = LATTICE_BOTTOM;
+        if (arg.state == LATTICE_TOP)
+            continue;
+        if (meet.state == LATTICE_TOP || (arg.state == LATTICE_CONSTANT && arg.constant == meet.constant))
+            meet = arg;
+        else
+            meet.state = LATTICE_BOTTOM;
+    }
+    lower_value(state, phi->result, meet);
+}
+
+static int is_constant(LatticeValue value, int32_t constant)
+{
+    return value.state == LATTICE_CONSTANT && value.constant == constant;
+}
+
+static void visit_instruction(PropagationState *state, BasicBlock *block, TacInstruction *instr)
+{
+    if (instr->opcode == TAC_IF_GOTO || instr->opcode == TAC_IF_NOT_GOTO)
+    {
+        LatticeValue cond = operand_lattice(state, instr->op1);
+        if (cond.state == LATTICE_BOTTOM)
+        {
+            mark_edge(state, block->id, 0);
+            mark_edge(state, block->id, 1);
+        }
+        else if (cond.state == LATTICE_CONSTANT)
+        {
+            int taken = (cond.constant != 0) == (instr->opcode == TAC_IF_GOTO);
+            mark_edge(state, block->id, taken ? 1 : 0);
+        }
+        return;
+    }
+
+    TacOperand *def = tac_def(instr);
+    if (!def)
+        return;
+    LatticeValue result = {LATTICE_BOTTOM, 0};
+    int32_t value;
+    switch (instr->opcode)
+    {
+    case TAC_ARRAY_LOAD: case TAC_NEW_ARRAY: case TAC_CALL:
+        break;
+    case TAC_NOT: case TAC_UMINUS: case TAC_ASSIGN:
+    {
+        LatticeValue a = operand_lattice(state, instr->op1);
+        if (a.state == LATTICE_CONSTANT && tac_fold(instr->opcode, a.constant, 0, &value))
+        {
+            result.state = LATTICE_CONSTANT;
+            result.constant = value;
+        }
+        else if (a.state == LATTICE_TOP)
+        {
+            result.state = LATTICE_TOP;
+        }
+        break;
+    }
+    default:
+    {
+        LatticeValue a = operand_lattice(state, instr->op1);
+        LatticeValue b = operand_lattice(state, instr->op2);
+        if (a.state == LATTICE_CONSTANT && b.state == LATTICE_CONSTANT)
+        {
+            if (tac_fold(instr->opcode, a.constant, b.constant, &value))
+            {
+                result.state = LATTICE_CONSTANT;
+                result.constant = value;
+            }
+        }
+        else if (a.state == LATTICE_TOP || b.state == LATTICE_TOP)
+        {
+            result.state = LATTICE_TOP;
+        }
+        else if ((instr->opcode == TAC_MUL || instr->opcode == TAC_AND) && (is_constant(a, 0) || is_constant(b, 0)))
+        {
+            result.state = LATTICE_CONSTANT; // x * 0, x && false
+            result.constant = 0;
+        }
+        else if (instr->opcode == TAC_OR && (is_constant(a, 1) || is_constant(b, 1)))
+        {
+            result.state = LATTICE_CONSTANT; // x || true
+            result.constant = 1;
+        }
+        break;
+    }
+    }
+    if (instr->op1.data_type == TYPE_FLOAT || instr->op2.data_type == TYPE_FLOAT)
+        result.state = LATTICE_BOTTOM;
+    lower_value(state, *def, result);
+}
+
+static void visit_block(PropagationState *state, int block_id)
+{
+    BasicBlock *block = &state->cfg->blocks[block_id];
+    for (int p = 0; p < block->phi_count; p++)
+        visit_phi(state, block, &block->phis[p]);
+    if (state->visited[block_id])
+        return; // Instructions only depend on values, handled through the uses
+    state->visited[block_id] = 1;
+    for (int i = 0; i < block->instr_count; i++)
+        visit_instruction(state, block, &block->instrs[i]);
+
+    TacInstruction *terminator = cfg_terminator(block);
+    if (block->succ_count > 0 && (!terminator || terminator->opcode == TAC_GOTO))
+        mark_edge(state, block_id, 0);
+}
+
+// Def-use chains over every block, as a CSR array
+static void build_uses(PropagationState *state)
+{
+    Cfg *cfg = state->cfg;
+    state->use_start = (int *)arena_calloc(&cfg_arena, ((size_t)state->value_count + 1) * sizeof(int));
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int *fill = NULL;
+        if (pass == 1)
+        {
+            for (uint32_t v = 0; v < state->value_count; v++)
+                state->use_start[v + 1] += state->use_start[v];
+            state->uses = (UseSite *)arena_alloc(&cfg_arena, (size_t)(state->use_start[state->value_count] + 1) * sizeof(UseSite));
+            fill = (int *)arena_alloc(&cfg_arena, ((size_t)state->value_count + 1) * sizeof(int));
+            memcpy(fill, state->use_start, (size_t)state->value_count * sizeof(int));
+        }
+        for (int b = 0; b < cfg->block_count; b++)
+        {
+            BasicBlock *block = &cfg->blocks[b];
+            for (int p = 0; p < block->phi_count; p++)
+            {
+                for (int a = 0; a < block->pred_count; a++)
+                {
+                    if (!tac_is_value(block->phis[p].args[a]))
+                        continue;
+                    uint32_t value = tac_value_index(block->phis[p].args[a]);
+                    if (pass == 0)
+                        state->use_start[value + 1]++;
+                    else
+                        state->uses[fill[value]++] = (UseSite){b, -(p + 1)};
+                }
+            }
+            for (int i = 0; i < block->instr_count; i++)
+            {
+                TacOperand *uses[3];
+                int use_count = tac_uses(&block->instrs[i], uses);
+                for (int u = 0; u < use_count; u++)
+                {
+                    uint32_t value = tac_value_index(*uses[u]);
+                    if (pass == 0)
+                        state->use_start[value + 1]++;
+                    else
+                        state->uses[fill[value]++] = (UseSite){b, i};
+                }
+            }
+        }
+    }
+}
+
+// Replaces a read of a constant value by a literal
+static int substitute(PropagationState *state, TacOperand *use)
+{
+    if (!tac_is_value(*use))
+        return 0;
+    LatticeValue value = state->lattice[tac_value_index(*use)];
+    if (value.state != LATTICE_CONSTANT)
+        return 0;
+    *use = tac_constant_operand(use->data_type, value.constant);
+    STATS_INC(STAT_CONSTANTS_PROPAGATED);
+    return 1;
+}
+
+// Applies the solution: substitutes constants, deletes the definitions they
+// came from and removes the edges that never execute.
+static void rewrite(PropagationState *state)
+{
+    Cfg *cfg = state->cfg;
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        if (!state->visited[b])
+        {
+            while (block->succ_count > 0)
+                cfg_remove_edge(cfg, b, block->succs[block->succ_count - 1]);
+            continue;
+        }
+
+        int kept = 0;
+        for (int p = 0; p < block->phi_count; p++)
+        {
+            CfgPhi *phi = &block->phis[p];
+            if (state->lattice[tac_value_index(phi->result)].state == LATTICE_CONSTANT)
+                continue;
+            for (int a = 0; a < block->pred_count; a++)
+                substitute(state, &phi->args[a]);
+            block->phis[kept++] = *phi;
+        }
+        block->phi_count = kept;
+
+        kept = 0;
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            TacOperand *def = tac_def(instr);
+            if (def && state->lattice[tac_value_index(*def)].state == LATTICE_CONSTANT)
+                continue; // Every use now reads the literal
+            TacOperand *uses[3];
+            int use_count = tac_uses(instr, uses);
+            for (int u = 0; u < use_count; u++)
+                substitute(state, uses[u]);
+            block->instrs[kept++] = *instr;
+        }
+        block->instr_count = kept;
+
+        // A branch that only ever goes one way becomes a plain edge
+        TacInstruction *terminator = cfg_terminator(block);
+        if (terminator && (terminator->opcode == TAC_IF_GOTO || terminator->opcode == TAC_IF_NOT_GOTO) &&
+            state->edge_executable[b * 2] != state->edge_executable[b * 2 + 1])
+        {
+            block->instr_count--;
+            cfg_remove_edge(cfg, b, block->succs[state->edge_executable[b * 2] ? 1 : 0]);
+            STATS_INC(STAT_BRANCHES_FOLDED);
+        }
+    }
+}
+
+void constprop_run(Cfg *cfg)
+{
+    PropagationState state;
+    memset(&state, 0, sizeof(state));
+    state.cfg = cfg;
+    state.value_count = tac_value_count();
+    state.lattice = (LatticeValue *)arena_calloc(&cfg_arena, (size_t)state.value_count * sizeof(LatticeValue));
+    state.visited = (char *)arena_calloc(&cfg_arena, (size_t)cfg->block_count);
+    state.edge_executable = (char *)arena_calloc(&cfg_arena, (size_t)cfg->block_count * 2);
+    state.edge_worklist = (int *)arena_alloc(&cfg_arena, (size_t)cfg->block_count * 2 * sizeof(int));
+    state.value_worklist = (uint32_t *)arena_alloc(&cfg_arena, (size_t)state.value_count * 2 * sizeof(uint32_t));
+    build_uses(&state);
+
+    // Values never defined in the function hold whatever was in their slot
+    char *defined = (char *)arena_calloc(&cfg_arena, (size_t)state.value_count);
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        for (int p = 0; p < block->phi_count; p++)
+            defined[tac_value_index(block->phis[p].result)] = 1;
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (def)
+                defined[tac_value_index(*def)] = 1;
+        }
+    }
+    for (uint32_t v = 0; v < state.value_count; v++)
+        if (!defined[v])
+            state.lattice[v].state = LATTICE_BOTTOM;
+
+    visit_block(&state, 0);
+    while (state.edge_pending > 0 || state.value_pending > 0)
+    {
+        while (state.edge_pending > 0)
+        {
+            int edge = state.edge_worklist[--state.edge_pending];
+            visit_block(&state, cfg->blocks[edge / 2].succs[edge % 2]);
+        }
+        while (state.value_pending > 0 && state.edge_pending == 0)
+        {
+            uint32_t value = state.value_worklist[--state.value_pending];
+            for (int u = state.use_start[value]; u < state.use_start[value + 1]; u++)
+            {
+                UseSite site = state.uses[u];
+                if (!state.visited[site.block])
+                    continue;
+                BasicBlock *block = &cfg->blocks[site.block];
+                if (site.index < 0)
+                    visit_phi(&state, block, &block->phis[-site.index - 1]);
+                else
+                    visit_instruction(&state, block, &block->instrs[site.index]);
+            }
+        }
+    }
+
+    rewrite(&state);
+}
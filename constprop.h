@@ -0,0 +1,31 @@
+// constprop.h
+#ifndef CONSTPROP_H
+#define CONSTPROP_H
+
+#include "cfg.h"
+#include <stdint.h>
+
+// Sparse conditional constant propagation (Wegman-Zadeck) over a function in
+// SSA form. Values proven constant are substituted into every use, their
+// definitions are deleted, and a conditional jump on a constant becomes a
+// plain edge; blocks only reachable through the edge not taken are cut off.
+void constprop_run(Cfg *cfg);
+
+// Evaluates 'op1 <opcode> op2' (op2 ignored for unary opcodes) the way the
+// generated x86 code does: 32-bit two's complement arithmetic, signed
+// comparisons, booleans as 0/1. Returns 0 when the result is not known at
+// compile time, including a division that would trap (by zero, or INT_MIN by
+// -1), so the trap still happens at run time.
+int tac_fold(TacOpCode opcode, int32_t op1, int32_t op2, int32_t *result);
+
+// Clips a value to what a variable of 'type' holds once stored and reloaded
+// (a char lives in one byte and is zero-extended).
+int32_t tac_normalize(int8_t type, int32_t value);
+
+// Literal operand standing for 'value' where an operand of 'type' was read.
+TacOperand tac_constant_operand(int8_t type, int32_t value);
+
+// Returns 1 and the value if 'op' is an integer, boolean or char literal.
+int tac_literal_value(TacOperand op, int32_t *value);
+
+#endif // CONSTPROP_H
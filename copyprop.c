@@ -0,0 +1,188 @@
+// copyprop.c
+#include "copyprop.h"
+#include "dataflow.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Where a value is defined: instruction 'index' of 'block', or -1 for a phi
+typedef struct DefSite
+{
+    int block;
+    int index;
+} DefSite;
+
+// Follows the replacement chain of a value to the value that stands for it
+static uint32_t resolve(uint32_t *replacement, uint32_t value)
+{
+    uint32_t root = value;
+    while (replacement[root] != root)
+        root = replacement[root];
+    while (replacement[value] != root)
+    {
+        uint32_t next = replacement[value];
+        replacement[value] = root;
+        value = next;
+    }
+    return root;
+}
+
+static void replace_use(uint32_t *replacement, TacOperand *use)
+{
+    if (!tac_is_value(*use))
+        return;
+    uint32_t value = resolve(replacement, tac_value_index(*use));
+    use->type = (value & 1) ? OP_TEMP : OP_VAR;
+    use->val.id = value >> 1;
+}
+
+void copyprop_run(Cfg *cfg)
+{
+    cfg_compute_dominators(cfg);
+    uint32_t value_count = tac_value_count();
+    int *use_count = (int *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    DefSite *def_site = (DefSite *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(DefSite));
+    uint32_t *replacement = (uint32_t *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(uint32_t));
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        def_site[v].block = -1;
+        replacement[v] = v;
+    }
+
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        for (int p = 0; p < block->phi_count; p++)
+        {
+            def_site[tac_value_index(block->phis[p].result)] = (DefSite){block->id, -1};
+            for (int a = 0; a < block->pred_count; a++)
+                if (tac_is_value(block->phis[p].args[a]))
+                    use_count[tac_value_index(block->phis[p].args[a])]++;
+        }
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *uses[3];
+            int count = tac_uses(&block->instrs[i], uses);
+            for (int u = 0; u < count; u++)
+                use_count[tac_value_index(*uses[u])]++;
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (def)
+                def_site[tac_value_index(*def)] = (DefSite){block->id, i};
+        }
+    }
+
+    // Copies, in dominator-compatible order so chains collapse in one pass.
+    // A removed copy is turned into a TAC_NOP and swept up at the end.
+    int removed = 0;
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacInstruction *copy = &block->instrs[i];
+            if (copy->opcode != TAC_ASSIGN || !tac_is_value(copy->op1) || copy->result.data_type != copy->op1.data_type)
+                continue;
+            uint32_t dest = tac_value_index(copy->result);
+            uint32_t source = resolve(replacement, tac_value_index(copy->op1));
+            if (dest == source)
+            {
+                copy->opcode = TAC_NOP;
+                removed++;
+                continue;
+            }
+
+            DefSite site = def_site[source];
+            if (replacement[tac_value_index(copy->op1)] == tac_value_index(copy->op1) && use_count[source] == 1 &&
+                site.block >= 0 && site.index >= 0)
+            {
+                // Coalesce: the source's definition writes the destination
+                TacInstruction *producer = &cfg->blocks[site.block].instrs[site.index];
+                producer->result.type = copy->result.type;
+                producer->result.val.id = copy->result.val.id;
+                def_site[dest] = site;
+                def_site[source].block = -1;
+            }
+            else
+            {
+                replacement[dest] = source;
+            }
+            copy->opcode = TAC_NOP;
+            removed++;
+        }
+    }
+
+    // Phis that merge a single value (besides themselves), repeated because
+    // removing one can make another trivial
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int r = 0; r < cfg->rpo_count; r++)
+        {
+            BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+            for (int p = 0; p < block->phi_count; p++)
+            {
+                CfgPhi *phi = &block->phis[p];
+                uint32_t result = tac_value_index(phi->result);
+                if (replacement[result] != result)
+                    continue;
+                uint32_t same = UINT32_MAX;
+                int trivial = 1;
+                for (int a = 0; a < block->pred_count && trivial; a++)
+                {
+                    if (!tac_is_value(phi->args[a]) || phi->args[a].data_type != phi->result.data_type)
+                    {
+                        trivial = 0;
+                        break;
+                    }
+                    uint32_t arg = resolve(replacement, tac_value_index(phi->args[a]));
+                    if (arg == result || arg == same)
+                        continue;
+                    if (same != UINT32_MAX)
+                        trivial = 0;
+                    same = arg;
+                }
+                if (trivial && same != UINT32_MAX)
+                {
+                    replacement[result] = same;
+                    changed = 1;
+                    removed++;
+                }
+            }
+        }
+    }
+
+    // Rewrite every use and drop the removed copies and phis
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        int kept = 0;
+        for (int p = 0; p < block->phi_count; p++)
+        {
+            CfgPhi *phi = &block->phis[p];
+            if (resolve(replacement, tac_value_index(phi->result)) != tac_value_index(phi->result))
+                continue;
+            for (int a = 0; a < block->pred_count; a++)
+                replace_use(replacement, &phi->args[a]);
+            block->phis[kept++] = *phi;
+        }
+        block->phi_count = kept;
+
+        kept = 0;
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            if (instr->opcode == TAC_NOP)
+                continue;
+            TacOperand *uses[3];
+            int count = tac_uses(instr, uses);
+            for (int u = 0; u < count; u++)
+                replace_use(replacement, uses[u]);
+            block->instrs[kept++] = *instr;
+        }
+        block->instr_count = kept;
+    }
+    STATS_ADD(STAT_COPIES_REMOVED, removed);
+}
@@ -0,0 +1,15 @@
+// copyprop.h
+#ifndef COPYPROP_H
+#define COPYPROP_H
+
+#include "cfg.h"
+
+// Removes the copies of a function in SSA form. A copy 'v = w' whose source
+// is read nowhere else is coalesced: the instruction that computed w writes
+// v directly (so 't = a + b; x = t' becomes 'x = a + b'). Any other copy, and
+// any phi whose arguments all name one value, is propagated: its uses read
+// the source instead. Only copies between operands of the same type are
+// touched, since the type decides how a slot is loaded and printed.
+void copyprop_run(Cfg *cfg);
+
+#endif // COPYPROP_H
@@ -0,0 +1,212 @@
+// dataflow.c
+#include "dataflow.h"
+#include "arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t tac_value_count(void)
+{
+    uint32_t vars = (uint32_t)tac_program.var_count, temps = (uint32_t)tac_program.temp_count;
+    return 2 * (vars > temps ? vars : temps) + 2;
+}
+
+TacOperand *tac_def(TacInstruction *instr)
+{
+    switch (instr->opcode)
+    {
+    case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD:
+    case TAC_LT:  case TAC_GT:  case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
+    case TAC_AND: case TAC_OR:  case TAC_NOT: case TAC_UMINUS:
+    case TAC_ASSIGN: case TAC_ARRAY_LOAD: case TAC_NEW_ARRAY: case TAC_CALL:
+        return tac_is_value(instr->result) ? &instr->result : NULL;
+    default:
+        return NULL;
+    }
+}
+
+int tac_uses(TacInstruction *instr, TacOperand **uses)
+{
+    int count = 0;
+    switch (instr->opcode)
+    {
+    case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD:
+    case TAC_LT:  case TAC_GT:  case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
+    case TAC_AND: case TAC_OR:  case TAC_ARRAY_LOAD:
+        if (tac_is_value(instr->op1))
+            uses[count++] = &instr->op1;
+        if (tac_is_value(instr->op2))
+            uses[count++] = &instr->op2;
+        break;
+    case TAC_ASSIGN: case TAC_NOT: case TAC_UMINUS: case TAC_PRINT: case TAC_RETURN:
+    case TAC_PARAM:  case TAC_IF_GOTO: case TAC_IF_NOT_GOTO: case TAC_NEW_ARRAY:
+        if (tac_is_value(instr->op1))
+            uses[count++] = &instr->op1;
+        break;
+    case TAC_ARRAY_STORE: // result[op1] = op2: the array pointer is read
+        if (tac_is_value(instr->result))
+            uses[count++] = &instr->result;
+        if (tac_is_value(instr->op1))
+            uses[count++] = &instr->op1;
+        if (tac_is_value(instr->op2))
+            uses[count++] = &instr->op2;
+        break;
+    default:
+        break;
+    }
+    return count;
+}
+
+#define SET_BIT(set, bit) ((set)[(bit) >> 6] |= (uint64_t)1 << ((bit) & 63))
+#define CLEAR_BIT(set, bit) ((set)[(bit) >> 6] &= ~((uint64_t)1 << ((bit) & 63)))
+#define TEST_BIT(set, bit) (((set)[(bit) >> 6] >> ((bit) & 63)) & 1)
+
+// Gives 'value' a bit if it does not have one yet
+static void make_global(Liveness *live, uint32_t value, int *capacity)
+{
+    if (live->bit_of[value] >= 0)
+        return;
+    if (live->bit_count == *capacity)
+    {
+        int new_capacity = *capacity ? *capacity * 2 : 64;
+        uint32_t *grown = (uint32_t *)arena_alloc(&cfg_arena, (size_t)new_capacity * sizeof(uint32_t));
+        if (live->bit_count > 0)
+            memcpy(grown, live->value_of, (size_t)live->bit_count * sizeof(uint32_t));
+        live->value_of = grown;
+        *capacity = new_capacity;
+    }
+    live->bit_of[value] = live->bit_count;
+    live->value_of[live->bit_count++] = value;
+}
+
+void liveness_compute(Cfg *cfg, Liveness *live)
+{
+    cfg_compute_dominators(cfg); // Reachability and reverse postorder
+
+    uint32_t value_count = tac_value_count();
+    live->value_count = value_count;
+    live->bit_of = (int *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    for (uint32_t v = 0; v < value_count; v++)
+        live->bit_of[v] = -1;
+    live->value_of = NULL;
+    live->bit_count = 0;
+    int capacity = 0;
+
+    // Pass 1: find the values that cross block boundaries. defined_in[v] is
+    // the block (plus one) that most recently wrote v during the scan.
+    int *defined_in = (int *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        for (int p = 0; p < block->phi_count; p++)
+        {
+            make_global(live, tac_value_index(block->phis[p].result), &capacity);
+            for (int a = 0; a < block->pred_count; a++)
+                if (tac_is_value(block->phis[p].args[a]))
+                    make_global(live, tac_value_index(block->phis[p].args[a]), &capacity);
+        }
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *uses[3];
+            int use_count = tac_uses(&block->instrs[i], uses);
+            for (int u = 0; u < use_count; u++)
+            {
+                uint32_t value = tac_value_index(*uses[u]);
+                if (defined_in[value] != block->id + 1)
+                    make_global(live, value, &capacity);
+            }
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (def)
+                defined_in[tac_value_index(*def)] = block->id + 1;
+        }
+    }
+
+    // Pass 2: per-block upward-exposed uses, kills and phi results over the
+    // global bits
+    int words = (live->bit_count + 63) / 64;
+    if (words == 0)
+        words = 1;
+    live->words = words;
+    size_t set_bytes = (size_t)cfg->block_count * words * sizeof(uint64_t);
+    uint64_t *gen = (uint64_t *)arena_calloc(&cfg_arena, set_bytes);
+    uint64_t *kill = (uint64_t *)arena_calloc(&cfg_arena, set_bytes);
+    uint64_t *phi_results = (uint64_t *)arena_calloc(&cfg_arena, set_bytes);
+    live->live_in = (uint64_t *)arena_calloc(&cfg_arena, set_bytes);
+    live->live_out = (uint64_t *)arena_calloc(&cfg_arena, set_bytes);
+
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        uint64_t *block_gen = gen + (size_t)block->id * words;
+        uint64_t *block_kill = kill + (size_t)block->id * words;
+        for (int p = 0; p < block->phi_count; p++)
+        {
+            int bit = live->bit_of[tac_value_index(block->phis[p].result)];
+            SET_BIT(block_kill, bit);
+            SET_BIT(phi_results + (size_t)block->id * words, bit);
+        }
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *uses[3];
+            int use_count = tac_uses(&block->instrs[i], uses);
+            for (int u = 0; u < use_count; u++)
+            {
+                int bit = live->bit_of[tac_value_index(*uses[u])];
+                if (bit >= 0 && !TEST_BIT(block_kill, bit))
+                    SET_BIT(block_gen, bit);
+            }
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (def && live->bit_of[tac_value_index(*def)] >= 0)
+                SET_BIT(block_kill, live->bit_of[tac_value_index(*def)]);
+        }
+    }
+
+    // Pass 3: iterate to a fixed point, visiting blocks in postorder
+    //   out(B) = union over successors S of (in(S) - phi results of S)
+    //            + the arguments S's phis take from B
+    //   in(B)  = gen(B) + (out(B) - kill(B)) + phi results of B
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int r = cfg->rpo_count - 1; r >= 0; r--)
+        {
+            BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+            uint64_t *out = live->live_out + (size_t)block->id * words;
+            uint64_t *in = live->live_in + (size_t)block->id * words;
+
+            for (int s = 0; s < block->succ_count; s++)
+            {
+                BasicBlock *succ = &cfg->blocks[block->succs[s]];
+                uint64_t *succ_in = live->live_in + (size_t)succ->id * words;
+                uint64_t *succ_phis = phi_results + (size_t)succ->id * words;
+                for (int w = 0; w < words; w++)
+                    out[w] |= succ_in[w] & ~succ_phis[w];
+                int a = block->succ_pred_index[s];
+                for (int p = 0; p < succ->phi_count; p++)
+                    if (tac_is_value(succ->phis[p].args[a]))
+                        SET_BIT(out, live->bit_of[tac_value_index(succ->phis[p].args[a])]);
+            }
+
+            uint64_t *block_gen = gen + (size_t)block->id * words;
+            uint64_t *block_kill = kill + (size_t)block->id * words;
+            uint64_t *block_phis = phi_results + (size_t)block->id * words;
+            for (int w = 0; w < words; w++)
+            {
+                uint64_t new_in = block_gen[w] | (out[w] & ~block_kill[w]) | block_phis[w];
+                if (new_in != in[w])
+                {
+                    in[w] = new_in;
+                    changed = 1;
+                }
+            }
+        }
+    }
+}
+
+int liveness_live_out(const Liveness *live, int block, uint32_t value)
+{
+    if (value >= live->value_count || live->bit_of[value] < 0)
+        return 0;
+    return (int)TEST_BIT(live->live_out + (size_t)block * live->words, live->bit_of[value]);
+}
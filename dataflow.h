@@ -0,0 +1,59 @@
+// dataflow.h
+#ifndef DATAFLOW_H
+#define DATAFLOW_H
+
+#include "cfg.h"
+#include <stdint.h>
+
+// Values are the OP_VAR and OP_TEMP operands of the program. Each gets a
+// dense index so analyses can use plain arrays and bitsets: variable v is 2v,
+// temp t is 2t+1. The index space grows as passes create variables or temps.
+static inline int tac_is_value(TacOperand op)
+{
+    return op.type == OP_VAR || op.type == OP_TEMP;
+}
+
+static inline uint32_t tac_value_index(TacOperand op)
+{
+    return op.type == OP_VAR ? op.val.id * 2 : op.val.id * 2 + 1;
+}
+
+static inline int tac_same_value(TacOperand a, TacOperand b)
+{
+    return tac_is_value(a) && a.type == b.type && a.val.id == b.val.id;
+}
+
+// Current size of the value index space.
+uint32_t tac_value_count(void);
+
+// The value written by an instruction, or NULL. TAC_ARRAY_STORE writes
+// memory, not its 'result' operand, so it has no def.
+TacOperand *tac_def(TacInstruction *instr);
+
+// Stores pointers to the value operands an instruction reads into 'uses'
+// (room for 3) and returns how many there are.
+int tac_uses(TacInstruction *instr, TacOperand **uses);
+
+// Block-level liveness. Only values that are live across a block boundary
+// (read in some block before being written there, or used by a phi) get a
+// bit; values that live and die inside one block, which is almost every
+// temp, never appear in the sets. Phi results are live into their block and
+// phi arguments are live out of the matching predecessor.
+typedef struct Liveness
+{
+    uint32_t value_count; // tac_value_count() when computed
+    int *bit_of;          // bit_of[value]: position in the sets, -1 if block-local
+    uint32_t *value_of;   // value_of[bit]: inverse of bit_of
+    int bit_count;
+    int words;            // 64-bit words per set
+    uint64_t *live_in;    // Block b's set starts at live_in[b * words]
+    uint64_t *live_out;
+} Liveness;
+
+// Computes liveness for the reachable blocks of 'cfg' (arrays in cfg_arena).
+void liveness_compute(Cfg *cfg, Liveness *live);
+
+// Returns 1 if 'value' is live on exit from block 'block'.
+int liveness_live_out(const Liveness *live, int block, uint32_t value);
+
+#endif // DATAFLOW_H
@@ -0,0 +1,217 @@
+// dce.c
+#include "dce.h"
+#include "dataflow.h"
+#include "constprop.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Returns 1 if the instruction must stay even when its result is unused
+static int has_effect(const TacInstruction *instr)
+{
+    int32_t divisor;
+    switch (instr->opcode)
+    {
+    case TAC_PRINT: case TAC_RETURN: case TAC_ARRAY_STORE: case TAC_CALL: case TAC_PARAM:
+    case TAC_GOTO: case TAC_IF_GOTO: case TAC_IF_NOT_GOTO:
+        return 1;
+    case TAC_DIV:
+    case TAC_MOD:
+        // idiv faults on a zero divisor, and on INT_MIN / -1
+        return !tac_literal_value(instr->op2, &divisor) || divisor == 0 || divisor == -1;
+    default:
+        return 0;
+    }
+}
+
+// Empties the blocks that cannot be reached and drops their outgoing edges,
+// so the phis they fed lose those arguments. Returns the number removed.
+static int remove_unreachable(Cfg *cfg)
+{
+    cfg_compute_dominators(cfg);
+    int removed = 0;
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        if (block->rpo_index >= 0 || (block->succ_count == 0 && block->instr_count == 0 && block->phi_count == 0))
+            continue;
+        while (block->succ_count > 0)
+            cfg_remove_edge(cfg, b, block->succs[block->succ_count - 1]);
+        block->instr_count = 0;
+        block->phi_count = 0;
+        removed++;
+    }
+    STATS_ADD(STAT_UNREACHABLE_BLOCKS, removed);
+    return removed;
+}
+
+// Mark and sweep over the SSA values. Returns the number of instructions and
+// phis deleted.
+static int remove_dead_values(Cfg *cfg)
+{
+    cfg_compute_dominators(cfg);
+    uint32_t value_count = tac_value_count();
+    char *live = (char *)arena_calloc(&cfg_arena, (size_t)value_count);
+    uint32_t *worklist = (uint32_t *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(uint32_t));
+    int pending = 0;
+
+    // Where each value is defined: a block and an instruction index, or the
+    // phi -(index + 1)
+    int *def_block = (int *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    int *def_index = (int *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    for (uint32_t v = 0; v < value_count; v++)
+        def_block[v] = -1;
+
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        for (int p = 0; p < block->phi_count; p++)
+        {
+            uint32_t value = tac_value_index(block->phis[p].result);
+            def_block[value] = block->id;
+            def_index[value] = -(p + 1);
+        }
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            TacOperand *def = tac_def(instr);
+            if (def)
+            {
+                def_block[tac_value_index(*def)] = block->id;
+                def_index[tac_value_index(*def)] = i;
+            }
+            if (!has_effect(instr))
+                continue;
+            if (def && !live[tac_value_index(*def)])
+            {
+                live[tac_value_index(*def)] = 1; // Its definition is kept anyway
+                worklist[pending++] = tac_value_index(*def);
+            }
+            TacOperand *uses[3];
+            int count = tac_uses(instr, uses);
+            for (int u = 0; u < count; u++)
+            {
+                uint32_t value = tac_value_index(*uses[u]);
+                if (!live[value])
+                {
+                    live[value] = 1;
+                    worklist[pending++] = value;
+                }
+            }
+        }
+    }
+
+    // Whatever a live value is computed from is live too
+    while (pending > 0)
+    {
+        uint32_t value = worklist[--pending];
+        if (def_block[value] < 0)
+            continue; // Entry value
+        BasicBlock *block = &cfg->blocks[def_block[value]];
+        TacOperand *uses[3];
+        int count = 0;
+        if (def_index[value] < 0)
+        {
+            CfgPhi *phi = &block->phis[-def_index[value] - 1];
+            for (int a = 0; a < block->pred_count; a++)
+            {
+                if (!tac_is_value(phi->args[a]) || live[tac_value_index(phi->args[a])])
+                    continue;
+                live[tac_value_index(phi->args[a])] = 1;
+                worklist[pending++] = tac_value_index(phi->args[a]);
+            }
+            continue;
+        }
+        count = tac_uses(&block->instrs[def_index[value]], uses);
+        for (int u = 0; u < count; u++)
+        {
+            uint32_t used = tac_value_index(*uses[u]);
+            if (!live[used])
+            {
+                live[used] = 1;
+                worklist[pending++] = used;
+            }
+        }
+    }
+
+    // Sweep
+    int removed = 0;
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        int kept = 0;
+        for (int p = 0; p < block->phi_count; p++)
+            if (live[tac_value_index(block->phis[p].result)])
+                block->phis[kept++] = block->phis[p];
+        removed += block->phi_count - kept;
+        block->phi_count = kept;
+
+        kept = 0;
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            TacOperand *def = tac_def(instr);
+            if (instr->opcode == TAC_NOP || (!has_effect(instr) && (!def || !live[tac_value_index(*def)])))
+                continue;
+            block->instrs[kept++] = *instr;
+        }
+        removed += block->instr_count - kept;
+        block->instr_count = kept;
+    }
+    STATS_ADD(STAT_DEAD_INSTRUCTIONS, removed);
+    return removed;
+}
+
+// Follows a chain of empty blocks that only pass control on
+static int skip_empty(Cfg *cfg, int block_id)
+{
+    for (int steps = 0; steps < cfg->block_count; steps++)
+    {
+        BasicBlock *block = &cfg->blocks[block_id];
+        if (block->instr_count > 0 || block->phi_count > 0 || block->succ_count != 1)
+            break;
+        block_id = block->succs[0];
+    }
+    return block_id;
+}
+
+// Removes conditional jumps whose two edges lead, through empty blocks
+// only, to the same block (the branches of an if whose arms were emptied).
+// Returns the number removed.
+static int remove_useless_branches(Cfg *cfg)
+{
+    int removed = 0;
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        TacInstruction *terminator = cfg_terminator(block);
+        if (!terminator || (terminator->opcode != TAC_IF_GOTO && terminator->opcode != TAC_IF_NOT_GOTO) ||
+            block->succ_count != 2)
+            continue;
+        int target = skip_empty(cfg, block->succs[0]);
+        if (target != skip_empty(cfg, block->succs[1]) || cfg->blocks[target].phi_count > 0)
+            continue;
+        block->instr_count--;
+        cfg_remove_edge(cfg, b, block->succs[1]);
+        removed++;
+    }
+    STATS_ADD(STAT_BRANCHES_FOLDED, removed);
+    return removed;
+}
+
+void dce_run(Cfg *cfg)
+{
+    int changed = 1;
+    while (changed)
+    {
+        changed = remove_unreachable(cfg);
+        changed += remove_dead_values(cfg);
+        changed += remove_useless_branches(cfg);
+    }
+
+    // Empty blocks left on a single edge
+    for (int b = 1; b < cfg->block_count; b++)
+        cfg_remove_forwarder(cfg, b);
+}
@@ -0,0 +1,17 @@
+// dce.h
+#ifndef DCE_H
+#define DCE_H
+
+#include "cfg.h"
+
+// Dead code elimination for a function in SSA form. A value is live when it
+// can reach an instruction with an effect (PRINT, RETURN, an array store, a
+// call, a branch or a division that may trap); everything computing a value
+// that is not live is deleted, which covers unused temps, initializers that
+// are overwritten before being read and values that only feed themselves
+// around a loop. A branch whose two ways end up in the same place without
+// doing anything is removed, and blocks that can no longer be reached are
+// cut out of the graph.
+void dce_run(Cfg *cfg);
+
+#endif // DCE_H
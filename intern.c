@@ -0,0 +1,187 @@
+// intern.c
+#include "intern.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Spellings are copied into large character blocks so that atom_name()
+// pointers never move when the table grows.
+#define INTERN_BLOCK_SIZE 65536
+
+typedef struct InternBlock
+{
+    struct InternBlock *next;
+    size_t used;
+    char data[]; // INTERN_BLOCK_SIZE bytes, or more for a single huge spelling
+} InternBlock;
+
+typedef struct AtomEntry
+{
+    const char *text; // NUL terminated, stored in an InternBlock
+    uint32_t length;
+    uint32_t hash;
+} AtomEntry;
+
+static InternBlock *blocks = NULL;
+
+// entries[atom] describes an atom; entries[0] is the unused ATOM_NONE slot.
+static AtomEntry *entries = NULL;
+static uint32_t entry_count = 0;
+static uint32_t entry_capacity = 0;
+
+// Open addressing hash table of atoms (0 = empty), linear probing.
+// Its size is a power of two and it is kept at most half full.
+static Atom *buckets = NULL;
+static uint32_t bucket_mask = 0;
+
+static void *intern_alloc_or_die(size_t size)
+{
+    void *p = malloc(size);
+    if (!p)
+    {
+        fprintf(stderr, "Fatal: Memory allocation failed for intern table.\n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+// FNV-1a
+static uint32_t hash_bytes(const char *text, size_t length)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        h ^= (unsigned char)text[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static const char *store_spelling(const char *text, size_t length)
+{
+    if (!blocks || blocks->used + length + 1 > INTERN_BLOCK_SIZE)
+    {
+        size_t size = length + 1 > INTERN_BLOCK_SIZE ? length + 1 : INTERN_BLOCK_SIZE;
+        InternBlock *block = intern_alloc_or_die(sizeof(InternBlock) + size);
+        block->used = 0;
+        block->next = blocks;
+        blocks = block;
+    }
+    char *copy = blocks->data + blocks->used;
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    blocks->used += length + 1;
+    return copy;
+}
+
+static void grow_buckets(void)
+{
+    uint32_t new_size = bucket_mask ? (bucket_mask + 1) * 2 : 1024;
+    Atom *new_buckets = calloc(new_size, sizeof(Atom));
+    if (!new_buckets)
+    {
+        fprintf(stderr, "Fatal: Memory allocation failed for intern table.\n");
+        exit(EXIT_FAILURE);
+    }
+    uint32_t new_mask = new_size - 1;
+
+    // Rehash using the stored hashes; spellings are not touched.
+    for (Atom a = 1; a < entry_count; a++)
+    {
+        uint32_t i = entries[a].hash & new_mask;
+        while (new_buckets[i] != ATOM_NONE)
+            i = (i + 1) & new_mask;
+        new_buckets[i] = a;
+    }
+
+    free(buckets);
+    buckets = new_buckets;
+    bucket_mask = new_mask;
+}
+
+void init_intern_table(void)
+{
+    if (entries)
+        free_intern_table();
+
+    entry_capacity = 256;
+    entries = intern_alloc_or_die(entry_capacity * sizeof(AtomEntry));
+    entries[0].text = "";
+    entries[0].length = 0;
+    entries[0].hash = 0;
+    entry_count = 1;
+    grow_buckets();
+}
+
+void free_intern_table(void)
+{
+    while (blocks)
+    {
+        InternBlock *next = blocks->next;
+        free(blocks);
+        blocks = next;
+    }
+    free(entries);
+    free(buckets);
+    entries = NULL;
+    buckets = NULL;
+    entry_count = 0;
+    entry_capacity = 0;
+    bucket_mask = 0;
+}
+
+Atom intern(const char *text, size_t length)
+{
+    uint32_t hash = hash_bytes(text, length);
+    uint32_t i = hash & bucket_mask;
+
+    for (Atom a; (a = buckets[i]) != ATOM_NONE; i = (i + 1) & bucket_mask)
+    {
+        if (entries[a].hash == hash && entries[a].length == length && memcmp(entries[a].text, text, length) == 0)
+            return a;
+    }
+
+    // Not found: add a new atom in the empty bucket the probe stopped at.
+    if (entry_count == entry_capacity)
+    {
+        entry_capacity *= 2;
+        AtomEntry *grown = realloc(entries, entry_capacity * sizeof(AtomEntry));
+        if (!grown)
+        {
+            fprintf(stderr, "Fatal: Memory allocation failed for intern table.\n");
+            exit(EXIT_FAILURE);
+        }
+        entries = grown;
+    }
+    Atom atom = entry_count++;
+    entries[atom].text = store_spelling(text, length);
+    entries[atom].length = (uint32_t)length;
+    entries[atom].hash = hash;
+    buckets[i] = atom;
+
+    if (entry_count * 2 > bucket_mask + 1)
+        grow_buckets();
+    return atom;
+}
+
+Atom intern_cstr(const char *text)
+{
+    return intern(text, strlen(text));
+}
+
+const char *atom_name(Atom atom)
+{
+    if (atom >= entry_count)
+        return "<invalid_atom>";
+    return entries[atom].text;
+}
+
+size_t atom_length(Atom atom)
+{
+    return atom < entry_count ? entries[atom].length : 0;
+}
+
+uint32_t intern_count(void)
+{
+    return entry_count ? entry_count - 1 : 0;
+}
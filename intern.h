@@ -0,0 +1,34 @@
+// intern.h
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// An interned string. Every distinct spelling is stored once and gets a small
+// integer ID, so two names are equal exactly when their atoms are equal.
+// Atoms are handed out densely starting at 1; ATOM_NONE (0) means "no name".
+typedef uint32_t Atom;
+#define ATOM_NONE 0
+
+// Sets up an empty table. Must be called before any other intern function.
+void init_intern_table(void);
+
+// Releases the table and every spelling stored in it. All atom_name()
+// pointers become invalid.
+void free_intern_table(void);
+
+// Returns the atom for the given bytes, adding them to the table on first use.
+// The text does not need to be NUL terminated.
+Atom intern(const char *text, size_t length);
+Atom intern_cstr(const char *text);
+
+// Returns the NUL terminated spelling of an atom. The pointer stays valid
+// until free_intern_table().
+const char *atom_name(Atom atom);
+size_t atom_length(Atom atom);
+
+// Number of distinct spellings interned so far (the largest atom handed out).
+uint32_t intern_count(void);
+
+#endif // INTERN_H
@@ -1,6 +1,6 @@
 #include "ir_generator.h"
 #include "tac.h"
-#include "symbol_table.h" // For lookup_symbol and current_scope
+#include "symbol_table.h" // SymbolTableEntry, bound to identifiers by semantic analysis
 #include "ast.h"          // For AST node structures
 #include "miniJava.tab.h" // For TOKEN_ definitions (ensure this path is correct)
 #include <stdio.h>
@@ -19,6 +19,13 @@ void generate_ir_for_print_statement(PrintStatementNode *print_stmt_node);
 void generate_ir_for_return_statement(ReturnStatementNode *return_stmt_node);
 void generate_ir_for_block_statement(BlockStatementNode *block_stmt_node);
 
+// Identifiers were resolved by semantic analysis (IdentifierNode::symbol), so
+// IR generation never consults scopes. The symbol's index is the variable ID.
+static TacOperand create_var_operand_for_symbol(SymbolTableEntry *entry)
+{
+    return create_tac_var_operand(entry->index, entry->atom, entry->type);
+}
+
 void generate_ir(ProgramNode *program_root)
 {
     if (!program_root)
@@ -36,40 +43,15 @@ void generate_ir(ProgramNode *program_root)
     init_tac_generator(); // Initialize TAC list and counters
 
     ClassDeclarationNode *class_decl = program_root->class_decl;
-    Scope *original_scope_before_ir = current_scope;
-
-    if (class_decl->associated_scope)
-    {
-        current_scope = class_decl->associated_scope;
-    }
-    else
-    {
-        fprintf(stderr, "IR Gen Warning: Class '%s' has no associated scope. Assuming global scope.\n",
-                class_decl->name ? class_decl->name->name : "UnnamedClass");
-        // If no class scope, operations might resolve to global or fail if they expect class members.
-    }
 
     if (class_decl->main_method)
     {
         MainMethodNode *main_method = class_decl->main_method;
-        Scope *scope_before_main = current_scope; // This would be the class scope (or global if class had no scope)
 
-        TacOperand main_label_op = create_tac_label_operand(main_method->name ? main_method->name->name : "main");
+        TacOperand main_label_op = create_tac_label_operand(new_tac_named_label(main_method->name ? main_method->name->atom : intern_cstr("main")));
         // Use TAC_FUNCTION_BEGIN for clarity, or TAC_LABEL if preferred
         emit_tac(TAC_FUNCTION_BEGIN, create_tac_none_operand(), main_label_op, create_tac_none_operand(), main_method->base.line_number);
-        // Note: create_tac_label_operand strdup's the name, so if main_label_op is not used elsewhere,
-        // its name would be freed by free_tac_code. If main_label_op itself needs freeing, do it after all uses.
-
-        if (main_method->associated_scope)
-        {
-            current_scope = main_method->associated_scope;
-        }
-        else
-        {
-            fprintf(stderr, "IR Gen Error: Main method in class '%s' has no associated scope. Using enclosing scope.\n",
-                    class_decl->name ? class_decl->name->name : "UnnamedClass");
-            // IR generation will use scope_before_main for lookups if main has no distinct scope.
-        }
+        // The operand only holds the label ID, so main_label_op can be reused for TAC_FUNCTION_END below.
 
         if (main_method->body)
         {
@@ -79,27 +61,158 @@ void generate_ir(ProgramNode *program_root)
         // Emit an explicit return for main if not already present, or handle in TAC_FUNCTION_END
         // emit_tac(TAC_RETURN, create_tac_none_operand(), create_tac_none_operand(), create_tac_none_operand(), main_method->base.line_number);
         emit_tac(TAC_FUNCTION_END, create_tac_none_operand(), main_label_op, create_tac_none_operand(), main_method->base.line_number);
-
-        current_scope = scope_before_main; // Restore to class scope (or whatever was before main)
     }
     else
     {
         fprintf(stderr, "IR Gen Error: No main method found in class '%s'.\n",
                 class_decl->name ? class_decl->name->name : "UnnamedClass");
     }
+}
 
-    current_scope = original_scope_before_ir; // Restore original scope
+// Results of finished subexpressions, consumed by their parent expression.
+// Like ExpressionWalkStack, it starts inline and spills to the heap.
+typedef struct OperandStack
+{
+    TacOperand *items;
+    int count;
+    int capacity;
+    TacOperand inline_items[EXPR_WALK_INLINE_FRAMES];
+} OperandStack;
+
+static void push_operand(OperandStack *stack, TacOperand op)
+{
+    if (stack->count == stack->capacity)
+    {
+        int new_capacity = stack->capacity * 2;
+        TacOperand *grown;
+        if (stack->items == stack->inline_items)
+        {
+            grown = (TacOperand *)malloc((size_t)new_capacity * sizeof(TacOperand));
+            if (grown)
+                memcpy(grown, stack->inline_items, sizeof(stack->inline_items));
+        }
+        else
+        {
+            grown = (TacOperand *)realloc(stack->items, (size_t)new_capacity * sizeof(TacOperand));
+        }
+        if (!grown)
+        {
+            fprintf(stderr, "Fatal: Memory allocation failed for IR operand stack.\n");
+            exit(EXIT_FAILURE);
+        }
+        stack->items = grown;
+        stack->capacity = new_capacity;
+    }
+    stack->items[stack->count++] = op;
 }
 
-TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
+// Returns the array entry an array access reads, or NULL if it is not a
+// usable array (in which case no code is generated for the index).
+static SymbolTableEntry *array_access_entry(ExpressionNode *expr_node)
 {
-    TacOperand result_op = create_tac_none_operand();
+    IdentifierNode *array_id_node = expr_node->data.array_access_expr.array_name_ident;
+    if (!array_id_node || array_id_node->atom == ATOM_NONE || !expr_node->data.array_access_expr.index_expr)
+        return NULL;
+    SymbolTableEntry *array_entry = array_id_node->symbol;
+    if (!array_entry || array_entry->type != TYPE_INT_ARRAY)
+        return NULL;
+    return array_entry;
+}
 
-    if (!expr_node)
+// Most nodes an operand of && or || may have for both sides to be evaluated
+// unconditionally (see is_cheap_expression)
+#define CHEAP_OPERAND_NODES 5
+
+static int is_short_circuit(ExpressionNode *expr_node)
+{
+    return expr_node->kind == EXPR_BINARY && expr_node->data.binary_expr.left && expr_node->data.binary_expr.right &&
+           (expr_node->data.binary_expr.op_token == TOKEN_AND || expr_node->data.binary_expr.op_token == TOKEN_OR);
+}
+
+// Returns 1 if 'expr_node' takes at most '*budget' nodes and none of them can
+// fault (a division, an array access). The budget also bounds the recursion.
+static int is_cheap_expression(ExpressionNode *expr_node, int *budget)
+{
+    if (!expr_node || --*budget < 0)
+        return 0;
+    switch (expr_node->kind)
     {
-        fprintf(stderr, "IR Gen Error: NULL expression node encountered.\n");
-        return result_op; // Return a 'none' operand to signify error or absence
+    case EXPR_LITERAL: case EXPR_BOOLEAN_TRUE: case EXPR_BOOLEAN_FALSE: case EXPR_IDENTIFIER:
+        return 1;
+    case EXPR_PARENTHESIZED:
+        return is_cheap_expression(expr_node->data.parenthesized_expr_val, budget);
+    case EXPR_UNARY:
+        return is_cheap_expression(expr_node->data.unary_expr.operand, budget);
+    case EXPR_BINARY:
+        if (expr_node->data.binary_expr.op_token == TOKEN_DIVIDE || expr_node->data.binary_expr.op_token == TOKEN_MOD)
+            return 0;
+        return is_cheap_expression(expr_node->data.binary_expr.left, budget) &&
+               is_cheap_expression(expr_node->data.binary_expr.right, budget);
+    default:
+        return 0;
     }
+}
+
+// Returns 1 if a && or || in a value context needs a jump around its right
+// operand. When both operands are cheap and cannot fault, evaluating both
+// and combining them with TAC_AND / TAC_OR is faster than branching.
+static int needs_short_circuit_jump(ExpressionNode *expr_node)
+{
+    if (!is_short_circuit(expr_node))
+        return 0;
+    int left_budget = CHEAP_OPERAND_NODES, right_budget = CHEAP_OPERAND_NODES;
+    return !is_cheap_expression(expr_node->data.binary_expr.left, &left_budget) ||
+           !is_cheap_expression(expr_node->data.binary_expr.right, &right_budget);
+}
+
+// Schedules the operands of 'expr_node' ahead of it (see generate_ir_for_expression).
+// Returns 0 if the node has no operands to generate first.
+static int push_ir_operands(ExpressionWalkStack *stack, ExpressionNode *expr_node)
+{
+    ExpressionNode *first = NULL, *second = NULL;
+    switch (expr_node->kind)
+    {
+    case EXPR_BINARY:
+        first = expr_node->data.binary_expr.left;
+        second = expr_node->data.binary_expr.right;
+        if (!second)
+            return 0;
+        if (needs_short_circuit_jump(expr_node))
+        {
+            // The right operand is scheduled once the jump over it is emitted
+            expr_walk_push(stack, expr_node, 2);
+            expr_walk_push(stack, first, 0);
+            return 1;
+        }
+        break;
+    case EXPR_UNARY:
+        first = expr_node->data.unary_expr.operand;
+        break;
+    case EXPR_PARENTHESIZED:
+        first = expr_node->data.parenthesized_expr_val;
+        break;
+    case EXPR_ARRAY_ACCESS:
+        if (array_access_entry(expr_node))
+            first = expr_node->data.array_access_expr.index_expr;
+        break;
+    default:
+        break;
+    }
+    if (!first)
+        return 0; // A leaf, or malformed (reported when the node itself is generated)
+
+    expr_walk_push(stack, expr_node, 1);
+    if (second)
+        expr_walk_push(stack, second, 0);
+    expr_walk_push(stack, first, 0); // Popped first: operands are generated left to right
+    return 1;
+}
+
+// Generates the code for one expression node whose operands (if any) are
+// already generated; their results are on top of 'values', last operand on top.
+static TacOperand generate_ir_for_expression_node(ExpressionNode *expr_node, OperandStack *values)
+{
+    TacOperand result_op = create_tac_none_operand();
 
     // Use the resolved_type from semantic analysis for new temporaries
     TypeKind current_expr_type = expr_node->resolved_type;
@@ -149,20 +262,20 @@ TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
     case EXPR_IDENTIFIER:
     {
         IdentifierNode *id_node = expr_node->data.identifier_expr;
-        if (!id_node || !id_node->name)
+        if (!id_node || id_node->atom == ATOM_NONE)
         {
             fprintf(stderr, "IR Gen Error: Malformed identifier expression at line %d.\n", expr_node->base.line_number);
             return create_tac_none_operand();
         }
-        SymbolTableEntry *entry = lookup_symbol(id_node->name);
+        SymbolTableEntry *entry = id_node->symbol;
         if (!entry)
         {
             fprintf(stderr, "IR Gen Error: Identifier '%s' not found (line %d). Semantic analysis should catch this.\n", id_node->name, expr_node->base.line_number);
             // To prevent crashes, return a dummy or error operand.
             // This indicates a severe issue if semantic analysis passed.
-            return create_tac_var_operand(id_node->name, TYPE_ERROR); // Mark as error type
+            return create_tac_temp_operand(TYPE_ERROR); // Mark as error type
         }
-        result_op = create_tac_var_operand(entry->name, entry->type);
+        result_op = create_var_operand_for_symbol(entry);
         break;
     }
     case EXPR_BINARY:
@@ -172,8 +285,18 @@ TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
             fprintf(stderr, "IR Gen Error: Malformed binary expression at line %d.\n", expr_node->base.line_number);
             return create_tac_temp_operand(TYPE_ERROR);
         }
-        TacOperand left_op = generate_ir_for_expression(expr_node->data.binary_expr.left);
-        TacOperand right_op = generate_ir_for_expression(expr_node->data.binary_expr.right);
+        TacOperand right_op = values->items[--values->count];
+        if (needs_short_circuit_jump(expr_node))
+        {
+            // See generate_short_circuit_jump(): the result temp and the label
+            // jumped to when the left operand decided are under the right operand
+            TacOperand end_label = values->items[--values->count];
+            result_op = values->items[--values->count];
+            emit_tac(TAC_ASSIGN, result_op, right_op, create_tac_none_operand(), expr_node->base.line_number);
+            emit_tac(TAC_LABEL, end_label, create_tac_none_operand(), create_tac_none_operand(), expr_node->base.line_number);
+            break;
+        }
+        TacOperand left_op = values->items[--values->count];
         TacOperand temp_res = create_tac_temp_operand(current_expr_type); // Use resolved type
         TacOpCode tac_op;
 
@@ -233,7 +356,7 @@ TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
             fprintf(stderr, "IR Gen Error: Malformed unary expression at line %d.\n", expr_node->base.line_number);
             return create_tac_temp_operand(TYPE_ERROR);
         }
-        TacOperand operand_op = generate_ir_for_expression(expr_node->data.unary_expr.operand);
+        TacOperand operand_op = values->items[--values->count];
         TacOperand temp_res = create_tac_temp_operand(current_expr_type); // Use resolved type
         TacOpCode tac_op;
         switch (expr_node->data.unary_expr.op_token)
@@ -259,7 +382,7 @@ TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
             fprintf(stderr, "IR Gen Error: Malformed parenthesized expression at line %d.\n", expr_node->base.line_number);
             return create_tac_none_operand();
         }
-        result_op = generate_ir_for_expression(expr_node->data.parenthesized_expr_val);
+        result_op = values->items[--values->count];
         break;
     }
     case EXPR_ARRAY_ACCESS:
@@ -267,21 +390,21 @@ TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
         IdentifierNode *array_id_node = expr_node->data.array_access_expr.array_name_ident;
         ExpressionNode *index_expr_node = expr_node->data.array_access_expr.index_expr;
 
-        if (!array_id_node || !array_id_node->name || !index_expr_node)
+        if (!array_id_node || array_id_node->atom == ATOM_NONE || !index_expr_node)
         {
             fprintf(stderr, "IR Gen Error: Malformed array access at line %d.\n", expr_node->base.line_number);
             return create_tac_temp_operand(TYPE_ERROR);
         }
 
-        SymbolTableEntry *array_entry = lookup_symbol(array_id_node->name);
+        SymbolTableEntry *array_entry = array_id_node->symbol;
         if (!array_entry || array_entry->type != TYPE_INT_ARRAY)
         {
             fprintf(stderr, "IR Gen Error: Identifier '%s' is not a recognized array type or not declared (line %d).\n", array_id_node->name, expr_node->base.line_number);
             return create_tac_temp_operand(TYPE_ERROR);
         }
 
-        TacOperand array_op = create_tac_var_operand(array_id_node->name, array_entry->type);
-        TacOperand index_op = generate_ir_for_expression(index_expr_node);
+        TacOperand array_op = create_var_operand_for_symbol(array_entry);
+        TacOperand index_op = values->items[--values->count];
 
         result_op = create_tac_temp_operand(current_expr_type);                               // Element type
         emit_tac(TAC_ARRAY_LOAD, result_op, array_op, index_op, expr_node->base.line_number); // Pass line
@@ -295,6 +418,180 @@ TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
     return result_op;
 }
 
+// Called once the left operand of a short-circuit && or || is generated:
+// copies it to the result temp and jumps to the end if it decides the
+// result (false for &&, true for ||). The temp and the end label are left
+// on 'values' for generate_ir_for_expression_node(), and the right operand
+// is scheduled.
+static void generate_short_circuit_jump(ExpressionWalkStack *stack, ExpressionNode *expr_node, OperandStack *values)
+{
+    int line_number = expr_node->base.line_number;
+    TacOperand left_op = values->items[--values->count];
+    TacOperand result_op = create_tac_temp_operand(TYPE_BOOLEAN);
+    TacOperand end_label = create_tac_label_operand(new_tac_label());
+    emit_tac(TAC_ASSIGN, result_op, left_op, create_tac_none_operand(), line_number);
+    emit_tac(expr_node->data.binary_expr.op_token == TOKEN_AND ? TAC_IF_NOT_GOTO : TAC_IF_GOTO, end_label, result_op,
+             create_tac_none_operand(), line_number);
+    push_operand(values, result_op);
+    push_operand(values, end_label);
+    expr_walk_push(stack, expr_node, 1);
+    expr_walk_push(stack, expr_node->data.binary_expr.right, 0);
+}
+
+// Generates code for an expression tree in post-order using an explicit
+// stack, so very deep expressions cannot overflow the C stack. Returns the
+// operand holding the expression's value.
+TacOperand generate_ir_for_expression(ExpressionNode *expr_node)
+{
+    if (!expr_node)
+    {
+        fprintf(stderr, "IR Gen Error: NULL expression node encountered.\n");
+        return create_tac_none_operand(); // Return a 'none' operand to signify error or absence
+    }
+
+    ExpressionWalkStack stack;
+    OperandStack values;
+    expr_walk_init(&stack);
+    values.items = values.inline_items;
+    values.count = 0;
+    values.capacity = EXPR_WALK_INLINE_FRAMES;
+
+    expr_walk_push(&stack, expr_node, 0);
+    while (stack.count > 0)
+    {
+        ExpressionWalkFrame frame = stack.frames[--stack.count];
+        if (frame.state == 0 && push_ir_operands(&stack, frame.node))
+            continue; // Revisited once its operands are generated
+        if (frame.state == 2)
+        {
+            generate_short_circuit_jump(&stack, frame.node, &values);
+            continue;
+        }
+        push_operand(&values, generate_ir_for_expression_node(frame.node, &values));
+    }
+
+    TacOperand result_op = values.items[0];
+    expr_walk_free(&stack);
+    if (values.items != values.inline_items)
+        free(values.items);
+    return result_op;
+}
+
+// Pending work of generate_ir_for_condition(): jump to 'label' if 'node'
+// evaluates to 'jump_if', or, when 'node' is NULL, define 'label' here
+typedef struct BranchItem
+{
+    ExpressionNode *node;
+    int jump_if;
+    TacOperand label;
+} BranchItem;
+
+typedef struct BranchStack
+{
+    BranchItem *items;
+    int count;
+    int capacity;
+    BranchItem inline_items[EXPR_WALK_INLINE_FRAMES];
+} BranchStack;
+
+static void push_branch(BranchStack *stack, ExpressionNode *node, int jump_if, TacOperand label)
+{
+    if (stack->count == stack->capacity)
+    {
+        int new_capacity = stack->capacity * 2;
+        BranchItem *grown;
+        if (stack->items == stack->inline_items)
+        {
+            grown = (BranchItem *)malloc((size_t)new_capacity * sizeof(BranchItem));
+            if (grown)
+                memcpy(grown, stack->inline_items, sizeof(stack->inline_items));
+        }
+        else
+        {
+            grown = (BranchItem *)realloc(stack->items, (size_t)new_capacity * sizeof(BranchItem));
+        }
+        if (!grown)
+        {
+            fprintf(stderr, "Fatal: Memory allocation failed for IR branch stack.\n");
+            exit(EXIT_FAILURE);
+        }
+        stack->items = grown;
+        stack->capacity = new_capacity;
+    }
+    stack->items[stack->count++] = (BranchItem){node, jump_if, label};
+}
+
+// Generates jumping code for a condition: control goes to 'target' when
+// 'cond' evaluates to 'jump_if' and falls through otherwise. && and || only
+// evaluate their right operand when the left one does not decide, and !
+// swaps the sense of the jump instead of computing a value.
+static void generate_ir_for_condition(ExpressionNode *cond, int jump_if, TacOperand target)
+{
+    BranchStack stack;
+    stack.items = stack.inline_items;
+    stack.count = 0;
+    stack.capacity = EXPR_WALK_INLINE_FRAMES;
+    push_branch(&stack, cond, jump_if, target);
+
+    while (stack.count > 0)
+    {
+        BranchItem item = stack.items[--stack.count];
+        ExpressionNode *node = item.node;
+        if (!node)
+        {
+            emit_tac(TAC_LABEL, item.label, create_tac_none_operand(), create_tac_none_operand(), cond->base.line_number);
+            continue;
+        }
+
+        if (is_short_circuit(node))
+        {
+            ExpressionNode *left = node->data.binary_expr.left, *right = node->data.binary_expr.right;
+            int is_and = node->data.binary_expr.op_token == TOKEN_AND;
+            if (item.jump_if != is_and)
+            {
+                // 'a && b' jumping when false, 'a || b' jumping when true:
+                // either operand alone may take the jump
+                push_branch(&stack, right, item.jump_if, item.label);
+                push_branch(&stack, left, item.jump_if, item.label);
+            }
+            else
+            {
+                // Otherwise a left operand that decides the other way skips
+                // the right one
+                TacOperand skip = create_tac_label_operand(new_tac_label());
+                push_branch(&stack, NULL, 0, skip);
+                push_branch(&stack, right, item.jump_if, item.label);
+                push_branch(&stack, left, !item.jump_if, skip);
+            }
+            continue;
+        }
+        if (node->kind == EXPR_PARENTHESIZED && node->data.parenthesized_expr_val)
+        {
+            push_branch(&stack, node->data.parenthesized_expr_val, item.jump_if, item.label);
+            continue;
+        }
+        if (node->kind == EXPR_UNARY && node->data.unary_expr.op_token == TOKEN_NOT && node->data.unary_expr.operand)
+        {
+            push_branch(&stack, node->data.unary_expr.operand, !item.jump_if, item.label);
+            continue;
+        }
+        if (node->kind == EXPR_BOOLEAN_TRUE || node->kind == EXPR_BOOLEAN_FALSE)
+        {
+            if ((node->kind == EXPR_BOOLEAN_TRUE) == item.jump_if)
+                emit_tac(TAC_GOTO, item.label, create_tac_none_operand(), create_tac_none_operand(), node->base.line_number);
+            continue;
+        }
+
+        TacOperand cond_op = generate_ir_for_expression(node);
+        // For TAC_IF_GOTO / TAC_IF_NOT_GOTO: result=target_label, op1=condition
+        emit_tac(item.jump_if ? TAC_IF_GOTO : TAC_IF_NOT_GOTO, item.label, cond_op, create_tac_none_operand(),
+                 node->base.line_number);
+    }
+
+    if (stack.items != stack.inline_items)
+        free(stack.items);
+}
+
 void generate_ir_for_statement(StatementNode *stmt_node)
 {
     if (!stmt_node)
@@ -360,7 +657,7 @@ void generate_ir_for_statement_list(StatementListNode *stmt_list_node)
 
 void generate_ir_for_variable_declaration(VariableDeclarationNode *var_decl_node)
 {
-    if (!var_decl_node || !var_decl_node->identifier || !var_decl_node->identifier->name || !var_decl_node->var_type)
+    if (!var_decl_node || !var_decl_node->identifier || var_decl_node->identifier->atom == ATOM_NONE || !var_decl_node->var_type)
     {
         fprintf(stderr, "IR Gen Error: Malformed variable declaration node at line %d.\n", var_decl_node ? var_decl_node->base.line_number : -1);
         return;
@@ -368,14 +665,14 @@ void generate_ir_for_variable_declaration(VariableDeclarationNode *var_decl_node
 
     if (var_decl_node->initializer)
     {
-        SymbolTableEntry *entry = lookup_symbol(var_decl_node->identifier->name);
+        SymbolTableEntry *entry = var_decl_node->identifier->symbol;
         if (!entry)
         { // Should be caught by semantic analysis
             fprintf(stderr, "IR Gen Error: Variable '%s' (line %d) not found in symbol table during IR gen for initializer.\n",
                     var_decl_node->identifier->name, var_decl_node->base.line_number);
             return;
         }
-        TacOperand var_op = create_tac_var_operand(entry->name, entry->type);
+        TacOperand var_op = create_var_operand_for_symbol(entry);
         TacOperand initializer_op = generate_ir_for_expression(var_decl_node->initializer);
         emit_tac(TAC_ASSIGN, var_op, initializer_op, create_tac_none_operand(), var_decl_node->base.line_number);
     }
@@ -383,7 +680,7 @@ void generate_ir_for_variable_declaration(VariableDeclarationNode *var_decl_node
 
 void generate_ir_for_assignment(AssignmentNode *assign_node)
 {
-    if (!assign_node || !assign_node->target_identifier || !assign_node->target_identifier->name || !assign_node->value)
+    if (!assign_node || !assign_node->target_identifier || assign_node->target_identifier->atom == ATOM_NONE || !assign_node->value)
     {
         fprintf(stderr, "IR Gen Error: Malformed assignment node at line %d.\n", assign_node ? assign_node->base.line_number : -1);
         return;
@@ -396,12 +693,12 @@ void generate_ir_for_assignment(AssignmentNode *assign_node)
         IdentifierNode *array_id_node = assign_node->target_identifier;
         ExpressionNode *index_expr_node = assign_node->array_index;
 
-        if (!array_id_node->name || !index_expr_node)
+        if (array_id_node->atom == ATOM_NONE || !index_expr_node)
         { // Added null check for name
             fprintf(stderr, "IR Gen Error: Malformed array assignment (missing array name or index) at line %d.\n", assign_node->base.line_number);
             return;
         }
-        SymbolTableEntry *array_entry = lookup_symbol(array_id_node->name);
+        SymbolTableEntry *array_entry = array_id_node->symbol;
         if (!array_entry || (array_entry->type != TYPE_INT_ARRAY /* && other array types */))
         {
             fprintf(stderr, "IR Gen Error: Identifier '%s' for array assignment is not an array or not declared (line %d).\n",
@@ -409,21 +706,21 @@ void generate_ir_for_assignment(AssignmentNode *assign_node)
             return;
         }
 
-        TacOperand array_op = create_tac_var_operand(array_id_node->name, array_entry->type);
+        TacOperand array_op = create_var_operand_for_symbol(array_entry);
         TacOperand index_op = generate_ir_for_expression(index_expr_node);
         // For TAC_ARRAY_STORE: result=array_base, op1=index, op2=value_to_store
         emit_tac(TAC_ARRAY_STORE, array_op, index_op, value_op, assign_node->base.line_number);
     }
     else
     {
-        SymbolTableEntry *entry = lookup_symbol(assign_node->target_identifier->name);
+        SymbolTableEntry *entry = assign_node->target_identifier->symbol;
         if (!entry)
         { // Should be caught by semantic analysis
             fprintf(stderr, "IR Gen Error: Target identifier '%s' not found for assignment (line %d).\n",
                     assign_node->target_identifier->name, assign_node->base.line_number);
             return;
         }
-        TacOperand target_op = create_tac_var_operand(entry->name, entry->type);
+        TacOperand target_op = create_var_operand_for_symbol(entry);
         emit_tac(TAC_ASSIGN, target_op, value_op, create_tac_none_operand(), assign_node->base.line_number);
     }
 }
@@ -436,22 +733,15 @@ void generate_ir_for_if_statement(IfStatementNode *if_stmt_node)
         return;
     }
 
-    TacOperand cond_op = generate_ir_for_expression(if_stmt_node->condition);
-
-    char *else_label_str = generate_new_label_name();
-    TacOperand else_label = create_tac_label_operand(else_label_str); // else_label_str is now owned by else_label.val.name
-
-    char *end_if_label_str = NULL;
+    TacOperand else_label = create_tac_label_operand(new_tac_label());
     TacOperand end_if_label = create_tac_none_operand();
 
     if (if_stmt_node->else_branch)
     {
-        end_if_label_str = generate_new_label_name();
-        end_if_label = create_tac_label_operand(end_if_label_str); // end_if_label_str owned by end_if_label.val.name
+        end_if_label = create_tac_label_operand(new_tac_label());
     }
 
-    // For TAC_IF_NOT_GOTO: result=target_label, op1=condition
-    emit_tac(TAC_IF_NOT_GOTO, else_label, cond_op, create_tac_none_operand(), if_stmt_node->condition->base.line_number);
+    generate_ir_for_condition(if_stmt_node->condition, 0, else_label);
 
     generate_ir_for_statement(if_stmt_node->then_branch);
 
@@ -463,14 +753,11 @@ void generate_ir_for_if_statement(IfStatementNode *if_stmt_node)
 
     // For TAC_LABEL: result=label_name
     emit_tac(TAC_LABEL, else_label, create_tac_none_operand(), create_tac_none_operand(), if_stmt_node->base.line_number); // Line of the if/else transition
-    // Do NOT free else_label_str here, its memory is managed by the TacOperand's val.name
-    // It will be freed by free_tac_code().
 
     if (if_stmt_node->else_branch)
     {
         generate_ir_for_statement(if_stmt_node->else_branch);
         emit_tac(TAC_LABEL, end_if_label, create_tac_none_operand(), create_tac_none_operand(), if_stmt_node->else_branch->base.line_number);
-        // Do NOT free end_if_label_str here.
     }
 }
 
@@ -482,19 +769,13 @@ void generate_ir_for_while_statement(WhileStatementNode *while_stmt_node)
         return;
     }
 
-    char *loop_start_label_str = generate_new_label_name();
-    TacOperand loop_start_label = create_tac_label_operand(loop_start_label_str);
-
-    char *loop_end_label_str = generate_new_label_name();
-    TacOperand loop_end_label = create_tac_label_operand(loop_end_label_str);
+    TacOperand loop_start_label = create_tac_label_operand(new_tac_label());
+    TacOperand loop_end_label = create_tac_label_operand(new_tac_label());
 
     // For TAC_LABEL: result=label_name
     emit_tac(TAC_LABEL, loop_start_label, create_tac_none_operand(), create_tac_none_operand(), while_stmt_node->base.line_number);
-    // Do NOT free loop_start_label_str.
 
-    TacOperand cond_op = generate_ir_for_expression(while_stmt_node->condition);
-    // For TAC_IF_NOT_GOTO: result=target_label, op1=condition
-    emit_tac(TAC_IF_NOT_GOTO, loop_end_label, cond_op, create_tac_none_operand(), while_stmt_node->condition->base.line_number);
+    generate_ir_for_condition(while_stmt_node->condition, 0, loop_end_label);
 
     generate_ir_for_statement(while_stmt_node->body);
 
@@ -502,7 +783,6 @@ void generate_ir_for_while_statement(WhileStatementNode *while_stmt_node)
     emit_tac(TAC_GOTO, loop_start_label, create_tac_none_operand(), create_tac_none_operand(), while_stmt_node->body->base.line_number);
 
     emit_tac(TAC_LABEL, loop_end_label, create_tac_none_operand(), create_tac_none_operand(), while_stmt_node->base.line_number); // Line for end of loop
-    // Do NOT free loop_end_label_str.
 }
 
 void generate_ir_for_print_statement(PrintStatementNode *print_stmt_node)
@@ -558,19 +838,5 @@ void generate_ir_for_block_statement(BlockStatementNode *block_stmt_node)
         return;
     }
 
-    Scope *scope_before_block = current_scope;
-
-    if (block_stmt_node->associated_scope)
-    {
-        current_scope = block_stmt_node->associated_scope;
-    }
-    else
-    {
-        fprintf(stderr, "IR Gen Warning: Block statement at line %d has no associated scope. Using enclosing scope.\n",
-                block_stmt_node->base.line_number);
-    }
-
     generate_ir_for_statement_list(block_stmt_node->statements);
-
-    current_scope = scope_before_block;
 }
\ No newline at end of file
@@ -0,0 +1,298 @@
+// isel.c
+#include "isel.h"
+#include <limits.h>
+
+// Operand shapes (bit masks). An immediate has S_IMM plus whichever of
+// S_ONE and S_LEA apply to its value.
+#define S_NONE 0x01
+#define S_REG  0x02
+#define S_MEM  0x04
+#define S_IMM  0x08
+#define S_ONE  0x10 // The immediate 1
+#define S_LEA  0x20 // The immediate 2, 3, 5 or 9: x * k is [x + x*(k-1)]
+#define S_RM   (S_REG | S_MEM)
+#define S_RI   (S_REG | S_IMM)
+#define S_ANY  (S_REG | S_MEM | S_IMM)
+
+// Constraints between operands
+#define K_SAME_RL     0x01 // The result is in the same register or slot as op1
+#define K_R_NOT_RIGHT 0x02 // The result is not where op2 is (it is written before op2 is read)
+
+// Where an instruction of a pattern takes each operand from
+typedef enum IselRef
+{
+    R_NONE,
+    R_RESULT,
+    R_LEFT,
+    R_RIGHT,
+    R_EAX,
+    R_ZERO,         // Immediate 0
+    R_ONE,          // Immediate 1
+    R_SUM,          // Address [left + right], both registers
+    R_OFFSET,       // Address [left + right], right an immediate
+    R_NEG_OFFSET,   // Address [left - right], right an immediate
+    R_SCALED        // Address [left + left*(right-1)], right in S_LEA
+} IselRef;
+
+typedef struct IselTemplate
+{
+    X86Opcode opcode;
+    uint8_t dst, src, src2; // IselRef; src2 is the multiplier of a three-operand imul
+} IselTemplate;
+
+typedef struct IselPattern
+{
+    TacOpCode opcode; // Comparisons all use the TAC_LT entries, IF_NOT_GOTO the IF_GOTO ones
+    uint8_t result, left, right; // Shapes accepted
+    uint8_t constraints;
+    int length;
+    IselTemplate code[ISEL_MAX_INSTRS];
+} IselPattern;
+
+// The machine description. Patterns for one opcode go from the most
+// specific to the generic one that goes through eax; on equal cost the
+// earlier pattern wins.
+static const IselPattern patterns[] = {
+    // result = op1
+    {TAC_ASSIGN, S_RM, S_RM, S_NONE, K_SAME_RL, 0, {{0}}},
+    {TAC_ASSIGN, S_REG, S_ANY, S_NONE, 0, 1, {{X86_MOV, R_RESULT, R_LEFT}}},
+    {TAC_ASSIGN, S_MEM, S_RI, S_NONE, 0, 1, {{X86_MOV, R_RESULT, R_LEFT}}},
+    {TAC_ASSIGN, S_MEM, S_MEM, S_NONE, 0, 2, {{X86_MOV, R_EAX, R_LEFT}, {X86_MOV, R_RESULT, R_EAX}}},
+
+    // result = op1 + op2
+    {TAC_ADD, S_RM, S_RM, S_ONE, K_SAME_RL, 1, {{X86_INC, R_RESULT}}},
+    {TAC_ADD, S_REG, S_REG, S_ANY, K_SAME_RL, 1, {{X86_ADD, R_RESULT, R_RIGHT}}},
+    {TAC_ADD, S_MEM, S_MEM, S_RI, K_SAME_RL, 1, {{X86_ADD, R_RESULT, R_RIGHT}}},
+    {TAC_ADD, S_REG, S_REG, S_REG, 0, 1, {{X86_LEA, R_RESULT, R_SUM}}},
+    {TAC_ADD, S_REG, S_REG, S_IMM, 0, 1, {{X86_LEA, R_RESULT, R_OFFSET}}},
+    {TAC_ADD, S_REG, S_ANY, S_ANY, K_R_NOT_RIGHT, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_ADD, R_RESULT, R_RIGHT}}},
+    {TAC_ADD, S_RM, S_ANY, S_ANY, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_ADD, R_EAX, R_RIGHT}, {X86_MOV, R_RESULT, R_EAX}}},
+
+    // result = op1 - op2
+    {TAC_SUB, S_RM, S_RM, S_ONE, K_SAME_RL, 1, {{X86_DEC, R_RESULT}}},
+    {TAC_SUB, S_REG, S_REG, S_ANY, K_SAME_RL, 1, {{X86_SUB, R_RESULT, R_RIGHT}}},
+    {TAC_SUB, S_MEM, S_MEM, S_RI, K_SAME_RL, 1, {{X86_SUB, R_RESULT, R_RIGHT}}},
+    {TAC_SUB, S_REG, S_REG, S_IMM, 0, 1, {{X86_LEA, R_RESULT, R_NEG_OFFSET}}},
+    {TAC_SUB, S_REG, S_ANY, S_ANY, K_R_NOT_RIGHT, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_SUB, R_RESULT, R_RIGHT}}},
+    {TAC_SUB, S_RM, S_ANY, S_ANY, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_SUB, R_EAX, R_RIGHT}, {X86_MOV, R_RESULT, R_EAX}}},
+
+    // result = op1 * op2
+    {TAC_MUL, S_REG, S_REG, S_LEA, 0, 1, {{X86_LEA, R_RESULT, R_SCALED}}},
+    {TAC_MUL, S_REG, S_RM, S_IMM, 0, 1, {{X86_IMUL, R_RESULT, R_LEFT, R_RIGHT}}},
+    {TAC_MUL, S_REG, S_REG, S_RM, K_SAME_RL, 1, {{X86_IMUL, R_RESULT, R_RIGHT}}},
+    {TAC_MUL, S_REG, S_ANY, S_RM, K_R_NOT_RIGHT, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_IMUL, R_RESULT, R_RIGHT}}},
+    {TAC_MUL, S_RM, S_RM, S_IMM, 0, 2, {{X86_IMUL, R_EAX, R_LEFT, R_RIGHT}, {X86_MOV, R_RESULT, R_EAX}}},
+    {TAC_MUL, S_REG, S_IMM, S_IMM, 0, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_IMUL, R_RESULT, R_RESULT, R_RIGHT}}},
+    {TAC_MUL, S_RM, S_ANY, S_RM, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_IMUL, R_EAX, R_RIGHT}, {X86_MOV, R_RESULT, R_EAX}}},
+    {TAC_MUL, S_RM, S_IMM, S_IMM, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_IMUL, R_EAX, R_EAX, R_RIGHT}, {X86_MOV, R_RESULT, R_EAX}}},
+
+    // result = op1 && op2, result = op1 || op2 (booleans are 0 or 1)
+    {TAC_AND, S_REG, S_REG, S_ANY, K_SAME_RL, 1, {{X86_AND, R_RESULT, R_RIGHT}}},
+    {TAC_AND, S_MEM, S_MEM, S_RI, K_SAME_RL, 1, {{X86_AND, R_RESULT, R_RIGHT}}},
+    {TAC_AND, S_REG, S_ANY, S_ANY, K_R_NOT_RIGHT, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_AND, R_RESULT, R_RIGHT}}},
+    {TAC_AND, S_RM, S_ANY, S_ANY, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_AND, R_EAX, R_RIGHT}, {X86_MOV, R_RESULT, R_EAX}}},
+    {TAC_OR, S_REG, S_REG, S_ANY, K_SAME_RL, 1, {{X86_OR, R_RESULT, R_RIGHT}}},
+    {TAC_OR, S_MEM, S_MEM, S_RI, K_SAME_RL, 1, {{X86_OR, R_RESULT, R_RIGHT}}},
+    {TAC_OR, S_REG, S_ANY, S_ANY, K_R_NOT_RIGHT, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_OR, R_RESULT, R_RIGHT}}},
+    {TAC_OR, S_RM, S_ANY, S_ANY, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_OR, R_EAX, R_RIGHT}, {X86_MOV, R_RESULT, R_EAX}}},
+
+    // result = -op1
+    {TAC_UMINUS, S_RM, S_RM, S_NONE, K_SAME_RL, 1, {{X86_NEG, R_RESULT}}},
+    {TAC_UMINUS, S_REG, S_ANY, S_NONE, 0, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_NEG, R_RESULT}}},
+    {TAC_UMINUS, S_MEM, S_ANY, S_NONE, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_NEG, R_EAX}, {X86_MOV, R_RESULT, R_EAX}}},
+
+    // result = !op1: flip the low bit of a 0/1 boolean
+    {TAC_NOT, S_RM, S_RM, S_NONE, K_SAME_RL, 1, {{X86_XOR, R_RESULT, R_ONE}}},
+    {TAC_NOT, S_REG, S_ANY, S_NONE, 0, 2, {{X86_MOV, R_RESULT, R_LEFT}, {X86_XOR, R_RESULT, R_ONE}}},
+    {TAC_NOT, S_MEM, S_ANY, S_NONE, 0, 3, {{X86_MOV, R_EAX, R_LEFT}, {X86_XOR, R_EAX, R_ONE}, {X86_MOV, R_RESULT, R_EAX}}},
+
+    // Comparisons: flags only
+    {TAC_LT, S_NONE, S_RM, S_RI, 0, 1, {{X86_CMP, R_LEFT, R_RIGHT}}},
+    {TAC_LT, S_NONE, S_REG, S_MEM, 0, 1, {{X86_CMP, R_LEFT, R_RIGHT}}},
+    {TAC_LT, S_NONE, S_ANY, S_ANY, 0, 2, {{X86_MOV, R_EAX, R_LEFT}, {X86_CMP, R_EAX, R_RIGHT}}},
+
+    // IF op1 GOTO / IF_NOT op1 GOTO: flags of op1 against 0
+    {TAC_IF_GOTO, S_NONE, S_RM, S_NONE, 0, 1, {{X86_CMP, R_LEFT, R_ZERO}}},
+    {TAC_IF_GOTO, S_NONE, S_IMM, S_NONE, 0, 2, {{X86_MOV, R_EAX, R_LEFT}, {X86_CMP, R_EAX, R_ZERO}}},
+};
+
+#define PATTERN_COUNT ((int)(sizeof(patterns) / sizeof(patterns[0])))
+
+// The opcode whose patterns cover 'opcode'
+static TacOpCode pattern_opcode(TacOpCode opcode)
+{
+    switch (opcode)
+    {
+    case TAC_LT: case TAC_GT: case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
+        return TAC_LT;
+    case TAC_IF_NOT_GOTO:
+        return TAC_IF_GOTO;
+    default:
+        return opcode;
+    }
+}
+
+static int is_swappable(TacOpCode opcode)
+{
+    switch (pattern_opcode(opcode))
+    {
+    case TAC_ADD: case TAC_MUL: case TAC_AND: case TAC_OR: case TAC_LT:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int shape_of(const X86Operand *operand)
+{
+    switch ((X86OperandKind)operand->kind)
+    {
+    case X86_OPERAND_NONE:
+        return S_NONE;
+    case X86_OPERAND_REG:
+        return S_REG;
+    case X86_OPERAND_MEM:
+        return S_MEM;
+    case X86_OPERAND_IMM:
+    {
+        int32_t value = operand->disp;
+        return S_IMM | (value == 1 ? S_ONE : 0) |
+               (value == 2 || value == 3 || value == 5 || value == 9 ? S_LEA : 0);
+    }
+    default:
+        return 0;
+    }
+}
+
+// Register an operand ends up in: two values the allocator put in the same
+// register are one location, even while their virtual registers differ
+static int32_t final_register(const X86Operand *operand)
+{
+    return X86_IS_VREG(operand->reg) && operand->assigned != X86_NO_REG ? operand->assigned : operand->reg;
+}
+
+static int same_location(const X86Operand *a, const X86Operand *b)
+{
+    if (a->kind != b->kind)
+        return 0;
+    if (a->kind == X86_OPERAND_REG)
+        return final_register(a) == final_register(b);
+    if (a->kind == X86_OPERAND_MEM)
+        return a->reg == b->reg && a->disp == b->disp;
+    return 0;
+}
+
+// 'shapes' holds the shapes of result, left and right
+static int matches(const IselPattern *pattern, const int *shapes, const X86Operand *result, const X86Operand *left,
+                   const X86Operand *right)
+{
+    if (!(shapes[0] & pattern->result) || !(shapes[1] & pattern->left) || !(shapes[2] & pattern->right))
+        return 0;
+    if ((pattern->constraints & K_SAME_RL) && !same_location(result, left))
+        return 0;
+    if ((pattern->constraints & K_R_NOT_RIGHT) && same_location(result, right))
+        return 0;
+    return 1;
+}
+
+static X86Operand resolve(IselRef ref, const X86Operand *result, const X86Operand *left, const X86Operand *right)
+{
+    X86Operand address = {.kind = X86_OPERAND_ADDR, .size = 4, .scale = 1, .reg = left->reg, .index = X86_NO_REG};
+    switch (ref)
+    {
+    case R_RESULT:
+        return *result;
+    case R_LEFT:
+        return *left;
+    case R_RIGHT:
+        return *right;
+    case R_EAX:
+        return x86_reg_operand(X86_EAX);
+    case R_ZERO:
+        return x86_imm_operand(0);
+    case R_ONE:
+        return x86_imm_operand(1);
+    case R_SUM:
+        address.index = right->reg;
+        return address;
+    case R_OFFSET:
+        address.disp = right->disp;
+        return address;
+    case R_NEG_OFFSET:
+        address.disp = (int32_t)(0u - (uint32_t)right->disp); // Wraps like the subtraction
+        return address;
+    case R_SCALED:
+        address.index = left->reg;
+        address.scale = right->disp - 1;
+        return address;
+    default:
+    {
+        X86Operand none = {.kind = X86_OPERAND_NONE, .reg = X86_NO_REG, .index = X86_NO_REG};
+        return none;
+    }
+    }
+}
+
+// Expands 'pattern' into 'code' and returns its cost
+static int expand(const IselPattern *pattern, const X86Operand *result, const X86Operand *left,
+                  const X86Operand *right, X86Instr *code)
+{
+    int cost = 0;
+    for (int i = 0; i < pattern->length; i++)
+    {
+        const IselTemplate *template = &pattern->code[i];
+        code[i].opcode = template->opcode;
+        code[i].cond = X86_CC_E;
+        code[i].dst = resolve((IselRef)template->dst, result, left, right);
+        code[i].src = resolve((IselRef)template->src, result, left, right);
+        code[i].has_multiplier = template->src2 != R_NONE; // Always an immediate
+        code[i].multiplier = code[i].has_multiplier ? resolve((IselRef)template->src2, result, left, right).disp : 0;
+        cost += x86_instr_cost(&code[i]);
+    }
+    return cost;
+}
+
+int isel_select(TacOpCode opcode, const X86Operand *result, const X86Operand *left, const X86Operand *right,
+                X86Instr *code, int *swapped)
+{
+    TacOpCode key = pattern_opcode(opcode);
+    int best_cost = INT_MAX, best_length = -1;
+    X86Instr candidate[ISEL_MAX_INSTRS];
+    *swapped = 0;
+    for (int order = 0; order < (is_swappable(opcode) ? 2 : 1); order++)
+    {
+        const X86Operand *first = order ? right : left;
+        const X86Operand *second = order ? left : right;
+        int shapes[3] = {shape_of(result), shape_of(first), shape_of(second)};
+        // An opcode's patterns are contiguous in the table
+        int p = 0;
+        while (p < PATTERN_COUNT && patterns[p].opcode != key)
+            p++;
+        for (; p < PATTERN_COUNT && patterns[p].opcode == key; p++)
+        {
+            const IselPattern *pattern = &patterns[p];
+            if (!matches(pattern, shapes, result, first, second))
+                continue;
+            int cost = expand(pattern, result, first, second, candidate);
+            if (cost < best_cost)
+            {
+                int length = 0;
+                best_cost = cost;
+                *swapped = order;
+                // Two values sharing a register: the two-address form updates
+                // op1's register in place. The copy between their virtual
+                // registers keeps the code right before registers are
+                // assigned and disappears after.
+                if ((pattern->constraints & K_SAME_RL) && result->kind == X86_OPERAND_REG && result->reg != first->reg)
+                {
+                    X86Instr copy = {.opcode = X86_MOV, .cond = X86_CC_E, .dst = *result, .src = *first};
+                    code[length++] = copy;
+                }
+                for (int i = 0; i < pattern->length; i++)
+                    code[length++] = candidate[i];
+                best_length = length;
+            }
+        }
+    }
+    return best_length;
+}
@@ -0,0 +1,34 @@
+// isel.h
+#ifndef ISEL_H
+#define ISEL_H
+
+#include "tac.h"
+#include "x86.h"
+
+// Most instructions a pattern expands to
+#define ISEL_MAX_INSTRS 3
+
+// Instruction selection for one TAC instruction. 'result', 'left' and
+// 'right' say where the instruction's result, op1 and op2 live: a register
+// (physical or virtual), a dword frame slot or an immediate,
+// X86_OPERAND_NONE when absent. Virtual registers are compared by the
+// register they are assigned, so a two-address form is never picked when
+// the result's register still holds op2. The
+// machine description in isel.c lists, per TAC opcode, x86 instruction
+// sequences together with the operand shapes each one accepts (register,
+// memory, any immediate, the immediate 1, a lea-able multiplier) and the
+// constraints between operands (result in the same place as op1, result not
+// where op2 is). Every pattern that matches is costed with x86_instr_cost()
+// and the cheapest is expanded into 'code'. Commutative operations and
+// comparisons are also tried with their operands swapped; '*swapped' reports
+// it, and a comparison's condition must then be mirrored.
+//
+// Comparisons, TAC_IF_GOTO and TAC_IF_NOT_GOTO only set the flags (the
+// latter two compare op1 with 0); the caller adds the setcc or jcc.
+//
+// Returns the number of instructions in 'code', or -1 when no pattern
+// applies and the caller falls back to its generic expansion.
+int isel_select(TacOpCode opcode, const X86Operand *result, const X86Operand *left, const X86Operand *right,
+                X86Instr *code, int *swapped);
+
+#endif // ISEL_H
@@ -0,0 +1,387 @@
+// ivopt.c
+#include "ivopt.h"
+#include "dataflow.h"
+#include "ssa.h"
+#include "constprop.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A basic induction variable: header phi 'phi' is 'init' on entry and grows
+// by 'step' on every trip
+typedef struct Induction
+{
+    uint32_t phi;
+    TacOperand init;
+    int32_t step;
+} Induction;
+
+// A strength-reduced product: header phi 'phi' always holds 'iv * factor'
+typedef struct Reduced
+{
+    uint32_t iv;
+    TacOperand factor;
+    TacOperand phi;
+} Reduced;
+
+typedef struct IvState
+{
+    // Per value: defining block (-1 for values entering the function),
+    // instruction index (-1 for a phi) and number of uses. Grown as the pass
+    // creates temps.
+    int *def_block;
+    int *def_index;
+    int *use_count;
+    uint32_t capacity;
+    Induction *ivs;
+    int iv_count;
+    Reduced *reduced;
+    int reduced_count;
+    int reduced_capacity;
+} IvState;
+
+static void reserve_values(IvState *state)
+{
+    uint32_t count = tac_value_count();
+    if (count <= state->capacity)
+        return;
+    uint32_t capacity = count * 2;
+    int *def_block = (int *)arena_alloc(&cfg_arena, (size_t)capacity * sizeof(int));
+    int *def_index = (int *)arena_alloc(&cfg_arena, (size_t)capacity * sizeof(int));
+    int *use_count = (int *)arena_calloc(&cfg_arena, (size_t)capacity * sizeof(int));
+    for (uint32_t v = 0; v < capacity; v++)
+        def_block[v] = -1;
+    if (state->capacity > 0)
+    {
+        memcpy(def_block, state->def_block, (size_t)state->capacity * sizeof(int));
+        memcpy(def_index, state->def_index, (size_t)state->capacity * sizeof(int));
+        memcpy(use_count, state->use_count, (size_t)state->capacity * sizeof(int));
+    }
+    state->def_block = def_block;
+    state->def_index = def_index;
+    state->use_count = use_count;
+    state->capacity = capacity;
+}
+
+static TacOperand new_value(IvState *state)
+{
+    TacOperand temp = create_tac_temp_operand(TYPE_INT);
+    reserve_values(state);
+    return temp;
+}
+
+// Inserts 'result = op1 <opcode> op2' before the terminator of 'block'
+static void insert_before_terminator(Cfg *cfg, IvState *state, int block_id, TacOpCode opcode, TacOperand result,
+                                     TacOperand op1, TacOperand op2, int line_number)
+{
+    BasicBlock *block = &cfg->blocks[block_id];
+    int position = block->instr_count - (cfg_terminator(block) ? 1 : 0);
+    TacInstruction instr = {opcode, result, op1, op2, line_number};
+    cfg_insert(cfg, block_id, position, &instr);
+    state->def_block[tac_value_index(result)] = block_id;
+    state->def_index[tac_value_index(result)] = position;
+    TacOperand *uses[3];
+    int count = tac_uses(&instr, uses);
+    for (int u = 0; u < count; u++)
+        state->use_count[tac_value_index(*uses[u])]++;
+}
+
+static int is_invariant(Cfg *cfg, IvState *state, int loop, TacOperand op)
+{
+    int32_t value;
+    if (tac_literal_value(op, &value))
+        return 1;
+    if (!tac_is_value(op))
+        return 0;
+    int block = state->def_block[tac_value_index(op)];
+    return block < 0 || !cfg_loop_contains(cfg, loop, block);
+}
+
+static Induction *find_induction(IvState *state, TacOperand op)
+{
+    if (!tac_is_value(op))
+        return NULL;
+    for (int i = 0; i < state->iv_count; i++)
+        if (state->ivs[i].phi == tac_value_index(op))
+            return &state->ivs[i];
+    return NULL;
+}
+
+static int same_operand(TacOperand a, TacOperand b)
+{
+    int32_t x, y;
+    if (tac_literal_value(a, &x) && tac_literal_value(b, &y))
+        return x == y;
+    return tac_same_value(a, b);
+}
+
+// Collects the basic induction variables of a loop: header phis whose value
+// from the back edge is the phi plus or minus a constant
+static void find_inductions(Cfg *cfg, IvState *state, BasicBlock *header, int pre_slot, int latch_slot)
+{
+    state->ivs = (Induction *)arena_alloc(&cfg_arena, (size_t)(header->phi_count + 1) * sizeof(Induction));
+    state->iv_count = 0;
+    for (int p = 0; p < header->phi_count; p++)
+    {
+        CfgPhi *phi = &header->phis[p];
+        TacOperand next = phi->args[latch_slot];
+        if (phi->result.data_type != TYPE_INT || !tac_is_value(next))
+            continue;
+        uint32_t value = tac_value_index(next);
+        if (state->def_block[value] < 0 || state->def_index[value] < 0)
+            continue;
+        TacInstruction *update = &cfg->blocks[state->def_block[value]].instrs[state->def_index[value]];
+        int32_t step;
+        if (update->opcode == TAC_ADD && tac_same_value(update->op1, phi->result) &&
+            tac_literal_value(update->op2, &step))
+            ;
+        else if (update->opcode == TAC_ADD && tac_same_value(update->op2, phi->result) &&
+                 tac_literal_value(update->op1, &step))
+            ;
+        else if (update->opcode == TAC_SUB && tac_same_value(update->op1, phi->result) &&
+                 tac_literal_value(update->op2, &step) && step != INT32_MIN)
+            step = -step;
+        else
+            continue;
+        state->ivs[state->iv_count++] = (Induction){tac_value_index(phi->result), phi->args[pre_slot], step};
+    }
+}
+
+// Returns the header phi holding 'iv * factor', creating it on first use
+static TacOperand reduce(Cfg *cfg, IvState *state, CfgLoop *loop, int preheader, int pre_slot, int latch_slot,
+                         Induction *iv, TacOperand factor, int line_number)
+{
+    for (int r = 0; r < state->reduced_count; r++)
+        if (state->reduced[r].iv == iv->phi && same_operand(state->reduced[r].factor, factor))
+            return state->reduced[r].phi;
+
+    // Three versions of one new variable, so leaving SSA form can keep
+    // them in one place
+    TacOperand phi_value = new_value(state);
+    TacOperand start = new_value(state);
+    TacOperand next = new_value(state);
+    ssa_record_version(cfg, start, phi_value);
+    ssa_record_version(cfg, next, phi_value);
+
+    // The start value and the step are computed in the preheader (a
+    // constant step is folded here)
+    insert_before_terminator(cfg, state, preheader, TAC_MUL, start, iv->init, factor, line_number);
+    TacOperand step = factor;
+    int32_t constant, product;
+    if (tac_literal_value(factor, &constant))
+    {
+        tac_fold(TAC_MUL, constant, iv->step, &product);
+        step = create_tac_int_literal_operand(product);
+    }
+    else if (iv->step != 1)
+    {
+        step = new_value(state);
+        insert_before_terminator(cfg, state, preheader, TAC_MUL, step, factor,
+                                 create_tac_int_literal_operand(iv->step), line_number);
+    }
+    insert_before_terminator(cfg, state, loop->latches[0], TAC_ADD, next, phi_value, step, line_number);
+
+    CfgPhi *phi = cfg_add_phi(cfg, loop->header, phi_value);
+    phi->args[pre_slot] = start;
+    phi->args[latch_slot] = next;
+    state->def_block[tac_value_index(phi_value)] = loop->header;
+    state->def_index[tac_value_index(phi_value)] = -1;
+    state->use_count[tac_value_index(start)]++;
+    state->use_count[tac_value_index(next)]++;
+
+    if (state->reduced_count == state->reduced_capacity)
+    {
+        int capacity = state->reduced_capacity ? state->reduced_capacity * 2 : 8;
+        Reduced *grown = (Reduced *)arena_alloc(&cfg_arena, (size_t)capacity * sizeof(Reduced));
+        if (state->reduced_count > 0)
+            memcpy(grown, state->reduced, (size_t)state->reduced_count * sizeof(Reduced));
+        state->reduced = grown;
+        state->reduced_capacity = capacity;
+    }
+    state->reduced[state->reduced_count++] = (Reduced){iv->phi, factor, phi_value};
+    return phi_value;
+}
+
+static int fits_int32(int64_t value)
+{
+    return value >= INT32_MIN && value <= INT32_MAX;
+}
+
+// Rewrites the loop test 'i < n' as 'i * c < n * c' over a reduced variable,
+// when the counter is used by nothing but its own update and the test
+static void replace_test(Cfg *cfg, IvState *state, CfgLoop *loop)
+{
+    BasicBlock *header = &cfg->blocks[loop->header];
+    TacInstruction *branch = cfg_terminator(header);
+    if (!branch || (branch->opcode != TAC_IF_GOTO && branch->opcode != TAC_IF_NOT_GOTO) ||
+        !tac_is_value(branch->op1))
+        return;
+    uint32_t condition = tac_value_index(branch->op1);
+    if (state->def_block[condition] != loop->header || state->def_index[condition] < 0)
+        return;
+    TacInstruction *test = &header->instrs[state->def_index[condition]];
+
+    // Put the counter on the left
+    TacOpCode opcode = test->opcode;
+    TacOperand counter = test->op1, bound = test->op2;
+    if (!find_induction(state, counter))
+    {
+        counter = test->op2;
+        bound = test->op1;
+        switch (opcode)
+        {
+        case TAC_LT:  opcode = TAC_GT; break;
+        case TAC_GT:  opcode = TAC_LT; break;
+        case TAC_LEQ: opcode = TAC_GEQ; break;
+        case TAC_GEQ: opcode = TAC_LEQ; break;
+        default:      return;
+        }
+    }
+    Induction *iv = find_induction(state, counter);
+    int32_t limit, start;
+    if (!iv || !tac_literal_value(bound, &limit) || !tac_literal_value(iv->init, &start))
+        return;
+
+    // The counter must move towards the bound, and be read by its update and
+    // this test only
+    if (!((iv->step > 0 && (opcode == TAC_LT || opcode == TAC_LEQ)) ||
+          (iv->step < 0 && (opcode == TAC_GT || opcode == TAC_GEQ))))
+        return;
+    if (state->use_count[iv->phi] != 2)
+        return;
+
+    Reduced *reduced = NULL;
+    int32_t factor = 0;
+    for (int r = 0; r < state->reduced_count && !reduced; r++)
+        if (state->reduced[r].iv == iv->phi && tac_literal_value(state->reduced[r].factor, &factor) && factor != 0)
+            reduced = &state->reduced[r];
+    if (!reduced)
+        return;
+
+    // The test sees values from 'start' up to 'limit + step' at most; all of
+    // them, scaled, must fit so that the scaled comparison agrees
+    int64_t last = (int64_t)limit + iv->step;
+    if (!fits_int32(last) || !fits_int32((int64_t)start * factor) || !fits_int32(last * factor) ||
+        !fits_int32((int64_t)limit * factor))
+        return;
+    if (factor < 0)
+    {
+        switch (opcode)
+        {
+        case TAC_LT:  opcode = TAC_GT; break;
+        case TAC_GT:  opcode = TAC_LT; break;
+        case TAC_LEQ: opcode = TAC_GEQ; break;
+        default:      opcode = TAC_LEQ; break;
+        }
+    }
+
+    state->use_count[iv->phi]--;
+    state->use_count[tac_value_index(reduced->phi)]++;
+    test->opcode = opcode;
+    test->op1 = reduced->phi;
+    test->op2 = create_tac_int_literal_operand(limit * factor);
+    STATS_INC(STAT_IV_TESTS_REPLACED);
+}
+
+static void optimize_loop(Cfg *cfg, IvState *state, int loop_id, int preheader)
+{
+    CfgLoop *loop = &cfg->loops[loop_id];
+    BasicBlock *header = &cfg->blocks[loop->header];
+    if (loop->latch_count != 1 || header->pred_count != 2)
+        return;
+    int pre_slot = header->preds[0] == preheader ? 0 : 1;
+    int latch_slot = 1 - pre_slot;
+    if (header->preds[pre_slot] != preheader || header->preds[latch_slot] != loop->latches[0])
+        return;
+
+    find_inductions(cfg, state, header, pre_slot, latch_slot);
+    if (state->iv_count == 0)
+        return;
+    state->reduced_count = 0;
+
+    for (int i = 0; i < loop->block_count; i++)
+    {
+        int b = loop->blocks[i];
+        for (int j = 0; j < cfg->blocks[b].instr_count; j++)
+        {
+            TacInstruction *instr = &cfg->blocks[b].instrs[j];
+            if (instr->opcode != TAC_MUL || instr->result.data_type != TYPE_INT)
+                continue;
+            Induction *iv = find_induction(state, instr->op1);
+            TacOperand factor = instr->op2;
+            if (!iv || !is_invariant(cfg, state, loop_id, factor))
+            {
+                iv = find_induction(state, instr->op2);
+                factor = instr->op1;
+                if (!iv || !is_invariant(cfg, state, loop_id, factor))
+                    continue;
+            }
+            TacOperand phi = reduce(cfg, state, loop, preheader, pre_slot, latch_slot, iv, factor,
+                                    instr->line_number);
+
+            // The product becomes a copy of the reduced variable
+            instr = &cfg->blocks[b].instrs[j];
+            TacOperand *uses[3];
+            int count = tac_uses(instr, uses);
+            for (int u = 0; u < count; u++)
+                state->use_count[tac_value_index(*uses[u])]--;
+            instr->opcode = TAC_ASSIGN;
+            instr->op1 = phi;
+            instr->op2 = create_tac_none_operand();
+            state->use_count[tac_value_index(phi)]++;
+            STATS_INC(STAT_IV_REDUCED);
+        }
+    }
+    replace_test(cfg, state, loop);
+}
+
+void ivopt_run(Cfg *cfg)
+{
+    int *preheaders = cfg_make_preheaders(cfg);
+    int loop_count = cfg->loop_count;
+    if (loop_count == 0)
+        return;
+
+    IvState state;
+    memset(&state, 0, sizeof(state));
+    reserve_values(&state);
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        if (block->rpo_index < 0)
+            continue;
+        for (int p = 0; p < block->phi_count; p++)
+        {
+            state.def_block[tac_value_index(block->phis[p].result)] = b;
+            state.def_index[tac_value_index(block->phis[p].result)] = -1;
+            for (int a = 0; a < block->pred_count; a++)
+                if (tac_is_value(block->phis[p].args[a]))
+                    state.use_count[tac_value_index(block->phis[p].args[a])]++;
+        }
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *uses[3];
+            int count = tac_uses(&block->instrs[i], uses);
+            for (int u = 0; u < count; u++)
+                state.use_count[tac_value_index(*uses[u])]++;
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (def)
+            {
+                state.def_block[tac_value_index(*def)] = b;
+                state.def_index[tac_value_index(*def)] = i;
+            }
+        }
+    }
+
+    // Innermost loops first: a product of an outer counter that LICM left
+    // in an inner preheader is reduced when the outer loop's turn comes
+    for (int l = loop_count - 1; l >= 0; l--)
+        if (preheaders[l] >= 0)
+            optimize_loop(cfg, &state, l, preheaders[l]);
+
+    for (int l = 0; l < loop_count; l++)
+        if (preheaders[l] >= 0)
+            cfg_remove_forwarder(cfg, preheaders[l]);
+}
@@ -0,0 +1,19 @@
+// ivopt.h
+#ifndef IVOPT_H
+#define IVOPT_H
+
+#include "cfg.h"
+
+// Induction variable optimization for a function in SSA form. A basic
+// induction variable is a header phi stepped by a constant on the loop's
+// back edge ('i = i + 1'); a product 'i * k' with k loop-invariant is a
+// derived one. Each product is strength-reduced: it gets its own header
+// phi, started at 'init * k' in the preheader and advanced by 'step * k' on
+// the back edge, so the multiplication inside the loop becomes an addition.
+// When the loop test compares the counter with a constant, it is rewritten
+// onto a reduced variable (linear-function test replacement) if no value the
+// counter takes can overflow once scaled; a counter used for nothing else
+// is then left to dead code elimination.
+void ivopt_run(Cfg *cfg);
+
+#endif // IVOPT_H
@@ -554,14 +554,20 @@ char *yytext;
 #line 2 "miniJava.l"
 #include "ast.h"
 #include "miniJava.tab.h" // Contains TOKEN_... definitions and YYSTYPE
+#include "trace.h"         // Token printing is gated behind --trace=lex
+#include "source_buffer.h" // The scanner runs in place over the source buffer
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <string.h> // For strdup
+#include <string.h>
 
 // Declare yylval to be of type YYSTYPE, as defined in miniJava.tab.h
 extern YYSTYPE yylval;
 
+// Identifiers and string literals are passed to the parser as slices of the
+// source buffer; yytext always points into that buffer.
+#define MAKE_SLICE(start, len) ((SourceSlice){(uint32_t)((start) - source_data()), (uint32_t)(len)})
+
 // Helper function to convert token code to string for printing
 // YOU MUST POPULATE THIS WITH ALL YOUR TOKEN_... DEFINES FROM miniJava.tab.h
 const char* lexer_token_to_string(int token_code) {
@@ -620,10 +626,10 @@ const char* lexer_token_to_string(int token_code) {
     }
 }
 
-#line 624 "lex.yy.c"
+#line 630 "lex.yy.c"
 /* Flex Options */
 #define YY_NO_INPUT 1
-#line 627 "lex.yy.c"
+#line 633 "lex.yy.c"
 
 #define INITIAL 0
 
@@ -842,7 +848,7 @@ YY_DECL
 
 
 
-#line 846 "lex.yy.c"
+#line 852 "lex.yy.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -911,132 +917,132 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 82 "miniJava.l"
+#line 88 "miniJava.l"
 { /* Ignore spaces, tabs, carriage returns */ }
 	YY_BREAK
 case 2:
 /* rule 2 can match eol */
 YY_RULE_SETUP
-#line 83 "miniJava.l"
+#line 89 "miniJava.l"
 { /* yylineno is incremented automatically by %option yylineno */ }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 84 "miniJava.l"
+#line 90 "miniJava.l"
 { /* Single-line comments */ }
 	YY_BREAK
 case 4:
 /* rule 4 can match eol */
 YY_RULE_SETUP
-#line 85 "miniJava.l"
+#line 91 "miniJava.l"
 { /* Multi-line comments, non-greedy */ }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 89 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_CLASS), yytext, yylineno); return TOKEN_CLASS; }
+#line 95 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_CLASS), yytext, yylineno); return TOKEN_CLASS; }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 90 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_PUBLIC), yytext, yylineno); return TOKEN_PUBLIC; }
+#line 96 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_PUBLIC), yytext, yylineno); return TOKEN_PUBLIC; }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 91 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_STATIC), yytext, yylineno); return TOKEN_STATIC; }
+#line 97 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_STATIC), yytext, yylineno); return TOKEN_STATIC; }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 92 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_VOID), yytext, yylineno); return TOKEN_VOID; }
+#line 98 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_VOID), yytext, yylineno); return TOKEN_VOID; }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 93 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_INT), yytext, yylineno); return TOKEN_INT; }
+#line 99 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_INT), yytext, yylineno); return TOKEN_INT; }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 94 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_CHAR), yytext, yylineno); return TOKEN_CHAR; }
+#line 100 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_CHAR), yytext, yylineno); return TOKEN_CHAR; }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 95 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_BOOLEAN), yytext, yylineno); return TOKEN_BOOLEAN; }
+#line 101 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_BOOLEAN), yytext, yylineno); return TOKEN_BOOLEAN; }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 96 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_IF), yytext, yylineno); return TOKEN_IF; }
+#line 102 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_IF), yytext, yylineno); return TOKEN_IF; }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 97 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_ELSE), yytext, yylineno); return TOKEN_ELSE; }
+#line 103 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_ELSE), yytext, yylineno); return TOKEN_ELSE; }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 98 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_WHILE), yytext, yylineno); return TOKEN_WHILE; }
+#line 104 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_WHILE), yytext, yylineno); return TOKEN_WHILE; }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 99 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RETURN), yytext, yylineno); return TOKEN_RETURN; }
+#line 105 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RETURN), yytext, yylineno); return TOKEN_RETURN; }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 100 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Value: true, Line: %d\n", lexer_token_to_string(TOKEN_TRUE), yytext, yylineno); return TOKEN_TRUE; }
+#line 106 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Value: true, Line: %d\n", lexer_token_to_string(TOKEN_TRUE), yytext, yylineno); return TOKEN_TRUE; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 101 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Value: false, Line: %d\n", lexer_token_to_string(TOKEN_FALSE), yytext, yylineno); return TOKEN_FALSE; }
+#line 107 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Value: false, Line: %d\n", lexer_token_to_string(TOKEN_FALSE), yytext, yylineno); return TOKEN_FALSE; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 102 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_FINAL), yytext, yylineno); return TOKEN_FINAL; }
+#line 108 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_FINAL), yytext, yylineno); return TOKEN_FINAL; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 103 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_PRINT), yytext, yylineno); return TOKEN_PRINT; }
+#line 109 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_PRINT), yytext, yylineno); return TOKEN_PRINT; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 106 "miniJava.l"
+#line 112 "miniJava.l"
 { 
-                            yylval.string_val = strdup(yytext); 
-                            printf("TOKEN: %s, Lexeme: '%s', Value: \"%s\", Line: %d\n", lexer_token_to_string(TOKEN_ID), yytext, yylval.string_val, yylineno); 
+                            yylval.slice_val = MAKE_SLICE(yytext, yyleng);
+                            TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Value: \"%s\", Line: %d\n", lexer_token_to_string(TOKEN_ID), yytext, yytext, yylineno); 
                             return TOKEN_ID; 
                         }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 113 "miniJava.l"
+#line 119 "miniJava.l"
 { 
                             yylval.int_val = atoi(yytext); 
-                            printf("TOKEN: %s, Lexeme: '%s', Value: %d, Line: %d\n", lexer_token_to_string(TOKEN_INT_LIT), yytext, yylval.int_val, yylineno); 
+                            TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Value: %d, Line: %d\n", lexer_token_to_string(TOKEN_INT_LIT), yytext, yylval.int_val, yylineno); 
                             return TOKEN_INT_LIT; 
                         }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 118 "miniJava.l"
+#line 124 "miniJava.l"
 { 
                             yylval.float_val = atof(yytext); 
-                            printf("TOKEN: %s, Lexeme: '%s', Value: %f, Line: %d\n", lexer_token_to_string(TOKEN_FLOAT_LIT), yytext, yylval.float_val, yylineno); 
+                            TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Value: %f, Line: %d\n", lexer_token_to_string(TOKEN_FLOAT_LIT), yytext, yylval.float_val, yylineno); 
                             return TOKEN_FLOAT_LIT; 
                         }
 	YY_BREAK
 case 23:
 /* rule 23 can match eol */
 YY_RULE_SETUP
-#line 125 "miniJava.l"
+#line 131 "miniJava.l"
 {
                             char actual_char;
                             if (yytext[1] == '\\') { // Check for escape sequence
@@ -1056,179 +1062,145 @@ YY_RULE_SETUP
                                 actual_char = yytext[1]; // Not an escape, just the character
                             }
                             yylval.char_val = actual_char;
-                            printf("TOKEN: %s, Lexeme: '%s', Value: '%c' (ASCII: %d), Line: %d\n", lexer_token_to_string(TOKEN_CHAR_LIT), yytext, yylval.char_val, yylval.char_val, yylineno);
+                            TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Value: '%c' (ASCII: %d), Line: %d\n", lexer_token_to_string(TOKEN_CHAR_LIT), yytext, yylval.char_val, yylval.char_val, yylineno);
                             return TOKEN_CHAR_LIT;
                         }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 149 "miniJava.l"
+#line 155 "miniJava.l"
 { /* Start of string literal rule */
-                                    char buffer[1024]; // Assuming max string length
-                                    int i = 0, j = 0;
-                                    // This loop needs to be inside a Flex "start condition" or handled differently
-                                    // because yytext will only contain the opening quote initially.
-                                    // For a simple string rule, Flex matches the whole string at once.
-                                    // The provided rule for string literals is problematic for standard Flex.
-                                    // A more typical Flex rule for strings (that handles escapes):
-                                    // \"([^"\\]|\\.)*\" 
-                                    //
-                                    // Let's assume your original string literal rule was intended to be something like:
-                                    // \"(\\.|[^"\\])*\" 
-                                    // which matches a complete string literal.
-                                    // If so, the processing logic for escapes would be applied to the *entire* yytext.
-                                    // For now, I'll adapt your existing logic to assume yytext contains the *full* string (including quotes).
-                                    
-                                    // Corrected logic for processing yytext which should contain the full string literal
-                                    // including opening and closing quotes if the regex was like \"(\\.|[^"\\])*\"
-                                    int len = strlen(yytext);
-                                    for (i = 1; i < len - 1 && j < sizeof(buffer) - 1; i++) { // Start after opening ", end before closing "
-                                        if (yytext[i] == '\\') {
-                                            i++; // Skip backslash, process next char
-                                            if (i < len -1) { // Ensure there's a char to escape
-                                                switch (yytext[i]) {
-                                                    case 'n': buffer[j++] = '\n'; break;
-                                                    case 't': buffer[j++] = '\t'; break;
-                                                    case 'r': buffer[j++] = '\r'; break;
-                                                    case '"': buffer[j++] = '"'; break;
-                                                    case '\\': buffer[j++] = '\\'; break;
-                                                    // Add other escapes if needed: 'f', 'b', 'v', 'a'
-                                                    default: buffer[j++] = yytext[i]; // Store unrecognized escaped char as is
-                                                }
-                                            } else { /* Dangling backslash at end of string */ break; }
-                                        } else {
-                                            buffer[j++] = yytext[i];
-                                        }
-                                    }
-                                    buffer[j] = '\0';
-                                    yylval.string_val = strdup(buffer);
-                                    printf("TOKEN: %s, Lexeme: %s, Value: \"%s\", Line: %d\n", lexer_token_to_string(TOKEN_STRING_LIT), yytext, yylval.string_val, yylineno);
+                                    // The slice covers the text between the quotes of the matched
+                                    // literal; escape sequences are decoded when the AST node is
+                                    // built (see source_slice_unescape()).
+                                    yylval.slice_val = yyleng >= 2 ? MAKE_SLICE(yytext + 1, yyleng - 2) : MAKE_SLICE(yytext + yyleng, 0);
+                                    TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: %s, Value: \"%.*s\", Line: %d\n", lexer_token_to_string(TOKEN_STRING_LIT), yytext, (int)yylval.slice_val.length, source_slice_ptr(yylval.slice_val), yylineno);
                                     return TOKEN_STRING_LIT;
                                 }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 193 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_PLUS), yytext, yylineno); return TOKEN_PLUS; }
+#line 165 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_PLUS), yytext, yylineno); return TOKEN_PLUS; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 194 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_MINUS), yytext, yylineno); return TOKEN_MINUS; }
+#line 166 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_MINUS), yytext, yylineno); return TOKEN_MINUS; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 195 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_MULTIPLY), yytext, yylineno); return TOKEN_MULTIPLY; }
+#line 167 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_MULTIPLY), yytext, yylineno); return TOKEN_MULTIPLY; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 196 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_DIVIDE), yytext, yylineno); return TOKEN_DIVIDE; }
+#line 168 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_DIVIDE), yytext, yylineno); return TOKEN_DIVIDE; }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 197 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_MOD), yytext, yylineno); return TOKEN_MOD; }
+#line 169 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_MOD), yytext, yylineno); return TOKEN_MOD; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 198 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_EQ), yytext, yylineno); return TOKEN_EQ; }
+#line 170 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_EQ), yytext, yylineno); return TOKEN_EQ; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 199 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_NEQ), yytext, yylineno); return TOKEN_NEQ; }
+#line 171 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_NEQ), yytext, yylineno); return TOKEN_NEQ; }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 200 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LT), yytext, yylineno); return TOKEN_LT; }
+#line 172 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LT), yytext, yylineno); return TOKEN_LT; }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 201 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_GT), yytext, yylineno); return TOKEN_GT; }
+#line 173 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_GT), yytext, yylineno); return TOKEN_GT; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 202 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LEQ), yytext, yylineno); return TOKEN_LEQ; }
+#line 174 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LEQ), yytext, yylineno); return TOKEN_LEQ; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 203 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_GEQ), yytext, yylineno); return TOKEN_GEQ; }
+#line 175 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_GEQ), yytext, yylineno); return TOKEN_GEQ; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 204 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_AND), yytext, yylineno); return TOKEN_AND; }
+#line 176 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_AND), yytext, yylineno); return TOKEN_AND; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 205 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_OR), yytext, yylineno); return TOKEN_OR; }
+#line 177 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_OR), yytext, yylineno); return TOKEN_OR; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 206 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_NOT), yytext, yylineno); return TOKEN_NOT; }
+#line 178 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_NOT), yytext, yylineno); return TOKEN_NOT; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 207 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_ASSIGN), yytext, yylineno); return TOKEN_ASSIGN; }
+#line 179 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_ASSIGN), yytext, yylineno); return TOKEN_ASSIGN; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 210 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LPAREN), yytext, yylineno); return TOKEN_LPAREN; }
+#line 182 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LPAREN), yytext, yylineno); return TOKEN_LPAREN; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 211 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RPAREN), yytext, yylineno); return TOKEN_RPAREN; }
+#line 183 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RPAREN), yytext, yylineno); return TOKEN_RPAREN; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 212 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LBRACE), yytext, yylineno); return TOKEN_LBRACE; }
+#line 184 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LBRACE), yytext, yylineno); return TOKEN_LBRACE; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 213 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RBRACE), yytext, yylineno); return TOKEN_RBRACE; }
+#line 185 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RBRACE), yytext, yylineno); return TOKEN_RBRACE; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 214 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LBRACKET), yytext, yylineno); return TOKEN_LBRACKET; }
+#line 186 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_LBRACKET), yytext, yylineno); return TOKEN_LBRACKET; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 215 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RBRACKET), yytext, yylineno); return TOKEN_RBRACKET; }
+#line 187 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_RBRACKET), yytext, yylineno); return TOKEN_RBRACKET; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 216 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_SEMICOLON), yytext, yylineno); return TOKEN_SEMICOLON; }
+#line 188 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_SEMICOLON), yytext, yylineno); return TOKEN_SEMICOLON; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 217 "miniJava.l"
-{ printf("TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_COMMA), yytext, yylineno); return TOKEN_COMMA; }
+#line 189 "miniJava.l"
+{ TRACE(TRACE_LEX, "TOKEN: %s, Lexeme: '%s', Line: %d\n", lexer_token_to_string(TOKEN_COMMA), yytext, yylineno); return TOKEN_COMMA; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 219 "miniJava.l"
+#line 191 "miniJava.l"
 {
                             // The original code exited here. For continuous token printing for debugging,
                             // you might just print the error and return an error token or skip.
                             // For now, let's just print and let it potentially be handled by the parser.
-                            printf("LEXICAL_ERROR: Unexpected character '%s' at line %d\n", yytext, yylineno);
+                            fprintf(stderr, "LEXICAL_ERROR: Unexpected character '%s' at line %d\n", yytext, yylineno);
                             // To allow parsing to continue (and potentially report more errors from parser):
                             // return TOKEN_ERROR; // (Define TOKEN_ERROR in your .y file)
                             // Or, to stick to the original behavior of exiting on first lexical error:
@@ -1241,10 +1213,10 @@ YY_RULE_SETUP
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 234 "miniJava.l"
+#line 206 "miniJava.l"
 ECHO;
 	YY_BREAK
-#line 1248 "lex.yy.c"
+#line 1220 "lex.yy.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2220,5 +2192,24 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 234 "miniJava.l"
+#line 206 "miniJava.l"
+
+// Points the scanner at the buffer opened with source_open(). The buffer is
+// scanned in place: flex does not copy it into buffers of its own.
+int lexer_scan_source(void)
+{
+    YY_BUFFER_STATE buffer = yy_scan_buffer(source_data(), source_length() + 2);
+    if (!buffer)
+    {
+        fprintf(stderr, "Could not set up the scanner over the source buffer\n");
+        return 0;
+    }
+    return 1;
+}
+
+// Frees the scanner state. The source buffer itself belongs to source_buffer.c.
+void lexer_release_source(void)
+{
+    yylex_destroy();
+}
 
@@ -0,0 +1,146 @@
+// licm.c
+#include "licm.h"
+#include "dataflow.h"
+#include "constprop.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Returns 1 for the instructions that only compute their result from their
+// operands, which are the ones that may be moved
+static int is_movable(const TacInstruction *instr)
+{
+    switch (instr->opcode)
+    {
+    case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD: case TAC_ASSIGN:
+    case TAC_LT: case TAC_GT: case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
+    case TAC_AND: case TAC_OR: case TAC_NOT: case TAC_UMINUS:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Returns 1 if executing the instruction can fault
+static int may_trap(const TacInstruction *instr)
+{
+    int32_t divisor;
+    switch (instr->opcode)
+    {
+    case TAC_DIV:
+    case TAC_MOD:
+        // idiv faults on a zero divisor, and on INT_MIN / -1
+        return !tac_literal_value(instr->op2, &divisor) || divisor == 0 || divisor == -1;
+    case TAC_ARRAY_LOAD: case TAC_ARRAY_STORE: case TAC_NEW_ARRAY:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Returns 1 if the instruction does something the program can observe
+// (besides faulting)
+static int has_effect(const TacInstruction *instr)
+{
+    switch (instr->opcode)
+    {
+    case TAC_PRINT: case TAC_RETURN: case TAC_ARRAY_STORE: case TAC_CALL: case TAC_PARAM:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Returns 1 if every operand of the instruction is defined outside loop 'loop'
+static int is_invariant(Cfg *cfg, int loop, const int *def_block, TacInstruction *instr)
+{
+    TacOperand *uses[3];
+    int count = tac_uses(instr, uses);
+    for (int u = 0; u < count; u++)
+    {
+        int block = def_block[tac_value_index(*uses[u])];
+        if (block >= 0 && cfg_loop_contains(cfg, loop, block))
+            return 0;
+    }
+    return 1;
+}
+
+// Moves the invariant instructions of one loop to the end of its preheader.
+// Returns the number moved.
+static int hoist_loop(Cfg *cfg, int loop_id, int preheader, int *def_block)
+{
+    CfgLoop *loop = &cfg->loops[loop_id];
+    int moved = 0;
+    for (int i = 0; i < loop->block_count; i++)
+    {
+        int b = loop->blocks[i];
+        BasicBlock *block = &cfg->blocks[b];
+        // The header runs every time the preheader does, so an instruction
+        // that may fault can be moved out of it as long as nothing before it
+        // in the header could be observed first
+        int guarded = b == loop->header;
+        int kept = 0;
+        for (int j = 0; j < block->instr_count; j++)
+        {
+            TacInstruction instr = block->instrs[j];
+            TacOperand *def = tac_def(&instr);
+            int trap = may_trap(&instr);
+            if (def && is_movable(&instr) && (guarded || !trap) && is_invariant(cfg, loop_id, def_block, &instr))
+            {
+                BasicBlock *target = &cfg->blocks[preheader];
+                int position = target->instr_count - (cfg_terminator(target) ? 1 : 0);
+                cfg_insert(cfg, preheader, position, &instr);
+                def_block[tac_value_index(*def)] = preheader;
+                moved++;
+                continue;
+            }
+            if (trap || has_effect(&instr))
+                guarded = 0;
+            block->instrs[kept++] = instr;
+        }
+        block->instr_count = kept;
+    }
+    return moved;
+}
+
+void licm_run(Cfg *cfg)
+{
+    int *preheaders = cfg_make_preheaders(cfg);
+    int loop_count = cfg->loop_count;
+    if (loop_count == 0)
+        return;
+
+    // Where each value is defined, -1 for values that enter the function
+    uint32_t value_count = tac_value_count();
+    int *def_block = (int *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    for (uint32_t v = 0; v < value_count; v++)
+        def_block[v] = -1;
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        for (int p = 0; p < block->phi_count; p++)
+            def_block[tac_value_index(block->phis[p].result)] = b;
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (def)
+                def_block[tac_value_index(*def)] = b;
+        }
+    }
+
+    // Innermost loops first: nested loops come after the loop holding them,
+    // and an inner preheader belongs to the enclosing loop, so whatever is
+    // moved there gets another chance one level up
+    int moved = 0;
+    for (int l = loop_count - 1; l >= 0; l--)
+        if (preheaders[l] >= 0)
+            moved += hoist_loop(cfg, l, preheaders[l], def_block);
+
+    // Preheaders that received nothing are taken out again
+    for (int l = 0; l < loop_count; l++)
+        if (preheaders[l] >= 0)
+            cfg_remove_forwarder(cfg, preheaders[l]);
+    STATS_ADD(STAT_LICM_HOISTED, moved);
+}
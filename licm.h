@@ -0,0 +1,18 @@
+// licm.h
+#ifndef LICM_H
+#define LICM_H
+
+#include "cfg.h"
+
+// Loop-invariant code motion for a function in SSA form. Every loop gets a
+// preheader (the header's only predecessor from outside the loop, split off
+// its edge when it also leads elsewhere), and an instruction whose operands
+// are all defined outside the loop, or by instructions already moved, is
+// moved there. Loops are processed innermost first, so an expression climbs
+// out of as many loops as it is invariant in. Only instructions that cannot
+// fault are moved freely; a division that may trap is moved only from the
+// loop header when nothing before it in the header has an effect, since the
+// header runs whenever the preheader does. Array loads stay in place.
+void licm_run(Cfg *cfg);
+
+#endif // LICM_H
@@ -0,0 +1,420 @@
+// lvn.c
+#include "lvn.h"
+#include "dataflow.h"
+#include "constprop.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// An expression as seen by the hash table. Operands are either values
+// (kind 1, 'bits' is the value index) or integer constants (kind 2).
+typedef struct ExpressionKey
+{
+    int opcode;
+    int8_t type;     // Result type: the same expression stored as a char is a different value
+    uint8_t kind[2];
+    int32_t bits[2];
+    uint32_t memory; // Array stores seen before a load (loads only)
+} ExpressionKey;
+
+typedef struct ExpressionEntry
+{
+    ExpressionKey key;
+    TacOperand result;
+    int stamp; // Block (plus one) that filled the entry; other stamps are empty
+} ExpressionEntry;
+
+// What an instruction defining a value computed, for rewriting '!!x' and
+// '!(a < b)' (any block: SSA values never change)
+typedef struct ValueDef
+{
+    int opcode;
+    TacOperand op1;
+    TacOperand op2;
+} ValueDef;
+
+typedef struct NumberingState
+{
+    ExpressionEntry *table;
+    uint32_t mask;
+    int stamp;
+    uint32_t memory;
+    uint32_t *replacement;
+    ValueDef *defs;
+    char *is_constant; // Values set to a literal in an earlier instruction
+    int32_t *constant;
+} NumberingState;
+
+static uint32_t resolve(uint32_t *replacement, uint32_t value)
+{
+    while (replacement[value] != value)
+        value = replacement[value];
+    return value;
+}
+
+static void replace_use(NumberingState *state, TacOperand *use)
+{
+    if (!tac_is_value(*use))
+        return;
+    uint32_t value = resolve(state->replacement, tac_value_index(*use));
+    if (state->is_constant[value])
+    {
+        *use = tac_constant_operand(use->data_type, state->constant[value]);
+        return;
+    }
+    use->type = (value & 1) ? OP_TEMP : OP_VAR;
+    use->val.id = value >> 1;
+}
+
+static int is_literal(TacOperand op, int32_t constant)
+{
+    int32_t value;
+    return tac_literal_value(op, &value) && value == constant;
+}
+
+// Total order on operands used to canonicalize: values by index, then
+// constants (so a constant always ends up second)
+static int operand_rank(TacOperand op, uint64_t *rank)
+{
+    int32_t value;
+    if (tac_is_value(op))
+        *rank = tac_value_index(op);
+    else if (tac_literal_value(op, &value))
+        *rank = ((uint64_t)1 << 32) + (uint32_t)value;
+    else
+        return 0;
+    return 1;
+}
+
+static TacOpCode mirrored(TacOpCode opcode)
+{
+    switch (opcode)
+    {
+    case TAC_LT:  return TAC_GT;
+    case TAC_GT:  return TAC_LT;
+    case TAC_LEQ: return TAC_GEQ;
+    case TAC_GEQ: return TAC_LEQ;
+    default:      return opcode; // EQ, NEQ and the commutative operators
+    }
+}
+
+static TacOpCode inverted(TacOpCode opcode)
+{
+    switch (opcode)
+    {
+    case TAC_LT:  return TAC_GEQ;
+    case TAC_GEQ: return TAC_LT;
+    case TAC_GT:  return TAC_LEQ;
+    case TAC_LEQ: return TAC_GT;
+    case TAC_EQ:  return TAC_NEQ;
+    case TAC_NEQ: return TAC_EQ;
+    default:      return opcode;
+    }
+}
+
+static int is_comparison(TacOpCode opcode)
+{
+    return opcode >= TAC_LT && opcode <= TAC_NEQ;
+}
+
+static int is_symmetric(TacOpCode opcode)
+{
+    return opcode == TAC_ADD || opcode == TAC_MUL || opcode == TAC_AND || opcode == TAC_OR || is_comparison(opcode);
+}
+
+// Turns the instruction into 'result = value' if that keeps the value
+// (same type, or a char widened to an int). Returns 1 on success.
+static int become_copy(TacInstruction *instr, TacOperand value)
+{
+    if (value.data_type != instr->result.data_type &&
+        !(value.data_type == TYPE_CHAR && instr->result.data_type == TYPE_INT))
+        return 0;
+    instr->opcode = TAC_ASSIGN;
+    instr->op1 = value;
+    instr->op2 = create_tac_none_operand();
+    STATS_INC(STAT_ALGEBRAIC_SIMPLIFIED);
+    return 1;
+}
+
+static int become_constant(TacInstruction *instr, int32_t value)
+{
+    instr->opcode = TAC_ASSIGN;
+    instr->op1 = tac_constant_operand(instr->result.data_type, tac_normalize(instr->result.data_type, value));
+    instr->op2 = create_tac_none_operand();
+    STATS_INC(STAT_ALGEBRAIC_SIMPLIFIED);
+    return 1;
+}
+
+// Folds constants and applies algebraic identities in place
+static void simplify(NumberingState *state, TacInstruction *instr)
+{
+    TacOperand a = instr->op1, b = instr->op2;
+    int32_t x, y, folded;
+    int unary = instr->opcode == TAC_NOT || instr->opcode == TAC_UMINUS;
+    if (tac_literal_value(a, &x) && (unary || tac_literal_value(b, &y)) && instr->result.data_type != TYPE_FLOAT &&
+        tac_fold(instr->opcode, x, unary ? 0 : y, &folded))
+    {
+        become_constant(instr, folded);
+        return;
+    }
+    int same = tac_same_value(a, b);
+
+    switch (instr->opcode)
+    {
+    case TAC_ADD:
+        if (is_literal(b, 0))
+            become_copy(instr, a);
+        else if (is_literal(a, 0))
+            become_copy(instr, b);
+        break;
+    case TAC_SUB:
+        if (is_literal(b, 0))
+            become_copy(instr, a);
+        else if (same)
+            become_constant(instr, 0);
+        break;
+    case TAC_MUL:
+        if (is_literal(a, 0) || is_literal(b, 0))
+            become_constant(instr, 0);
+        else if (is_literal(b, 1))
+            become_copy(instr, a);
+        else if (is_literal(a, 1))
+            become_copy(instr, b);
+        else if (is_literal(b, -1))
+        {
+            instr->opcode = TAC_UMINUS;
+            instr->op2 = create_tac_none_operand();
+            STATS_INC(STAT_ALGEBRAIC_SIMPLIFIED);
+        }
+        break;
+    case TAC_DIV:
+        if (is_literal(b, 1))
+            become_copy(instr, a);
+        break;
+    case TAC_MOD:
+        if (is_literal(b, 1))
+            become_constant(instr, 0);
+        break;
+    case TAC_EQ: case TAC_LEQ: case TAC_GEQ:
+        if (same)
+            become_constant(instr, 1);
+        break;
+    case TAC_NEQ: case TAC_LT: case TAC_GT:
+        if (same)
+            become_constant(instr, 0);
+        break;
+    case TAC_AND:
+    case TAC_OR:
+        // Booleans are 0 or 1, so these only hold for boolean operands
+        if (a.data_type != TYPE_BOOLEAN || b.data_type != TYPE_BOOLEAN)
+            break;
+        if (same || is_literal(b, instr->opcode == TAC_AND))
+            become_copy(instr, a);
+        else if (is_literal(a, instr->opcode == TAC_AND))
+            become_copy(instr, b);
+        break;
+    case TAC_NOT:
+    case TAC_UMINUS:
+    {
+        if (!tac_is_value(a))
+            break;
+        ValueDef *inner = &state->defs[tac_value_index(a)];
+        if (inner->opcode == (int)instr->opcode && (instr->opcode == TAC_UMINUS || inner->op1.data_type == TYPE_BOOLEAN))
+        {
+            become_copy(instr, inner->op1); // --x, !!x
+        }
+        else if (instr->opcode == TAC_NOT && is_comparison((TacOpCode)inner->opcode))
+        {
+            instr->opcode = inverted((TacOpCode)inner->opcode); // !(a < b) is a >= b
+            instr->op1 = inner->op1;
+            instr->op2 = inner->op2;
+            STATS_INC(STAT_ALGEBRAIC_SIMPLIFIED);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// Builds the hash key of an expression instruction, putting the operands of
+// symmetric operators in canonical order first. Returns 0 if the
+// instruction is not an expression that can be reused.
+static int make_key(NumberingState *state, TacInstruction *instr, ExpressionKey *key)
+{
+    switch (instr->opcode)
+    {
+    case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD:
+    case TAC_LT:  case TAC_GT:  case TAC_LEQ: case TAC_GEQ: case TAC_EQ: case TAC_NEQ:
+    case TAC_AND: case TAC_OR:  case TAC_NOT: case TAC_UMINUS: case TAC_ARRAY_LOAD:
+        break;
+    default:
+        return 0;
+    }
+    if (instr->result.data_type == TYPE_FLOAT || instr->op1.data_type == TYPE_FLOAT || instr->op2.data_type == TYPE_FLOAT)
+        return 0;
+
+    int unary = instr->opcode == TAC_NOT || instr->opcode == TAC_UMINUS;
+    uint64_t rank_a, rank_b = 0;
+    if (!operand_rank(instr->op1, &rank_a) || (!unary && !operand_rank(instr->op2, &rank_b)))
+        return 0;
+    if (!unary && is_symmetric(instr->opcode) && rank_b < rank_a)
+    {
+        TacOperand swap = instr->op1;
+        instr->op1 = instr->op2;
+        instr->op2 = swap;
+        instr->opcode = mirrored(instr->opcode);
+    }
+
+    memset(key, 0, sizeof(*key));
+    key->opcode = instr->opcode;
+    key->type = instr->result.data_type;
+    TacOperand operands[2] = {instr->op1, instr->op2};
+    for (int k = 0; k < (unary ? 1 : 2); k++)
+    {
+        if (tac_is_value(operands[k]))
+        {
+            key->kind[k] = 1;
+            key->bits[k] = (int32_t)tac_value_index(operands[k]);
+        }
+        else
+        {
+            key->kind[k] = 2;
+            tac_literal_value(operands[k], &key->bits[k]);
+        }
+    }
+    if (instr->opcode == TAC_ARRAY_LOAD)
+        key->memory = state->memory;
+    return 1;
+}
+
+static uint32_t hash_key(const ExpressionKey *key)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t parts[6] = {(uint32_t)key->opcode, (uint32_t)key->type, (uint32_t)key->bits[0] * 2 + key->kind[0],
+                         (uint32_t)key->bits[1] * 2 + key->kind[1], key->memory, 0};
+    for (int i = 0; i < 5; i++)
+        hash = (hash ^ parts[i]) * 16777619u;
+    return hash;
+}
+
+static int same_key(const ExpressionKey *a, const ExpressionKey *b)
+{
+    return a->opcode == b->opcode && a->type == b->type && a->kind[0] == b->kind[0] && a->kind[1] == b->kind[1] &&
+           a->bits[0] == b->bits[0] && a->bits[1] == b->bits[1] && a->memory == b->memory;
+}
+
+// Returns the entry holding 'key', or the empty slot where it belongs
+static ExpressionEntry *find_entry(NumberingState *state, const ExpressionKey *key)
+{
+    uint32_t slot = hash_key(key) & state->mask;
+    while (state->table[slot].stamp == state->stamp && !same_key(&state->table[slot].key, key))
+        slot = (slot + 1) & state->mask;
+    return &state->table[slot];
+}
+
+static void number_block(NumberingState *state, BasicBlock *block)
+{
+    state->stamp = block->id + 1;
+    state->memory = 0;
+    for (int i = 0; i < block->instr_count; i++)
+    {
+        TacInstruction *instr = &block->instrs[i];
+        TacOperand *uses[3];
+        int count = tac_uses(instr, uses);
+        for (int u = 0; u < count; u++)
+            replace_use(state, uses[u]);
+
+        if (instr->opcode == TAC_ARRAY_STORE || instr->opcode == TAC_CALL)
+            state->memory++;
+        TacOperand *def = tac_def(instr);
+        if (!def)
+            continue;
+        simplify(state, instr);
+
+        uint32_t result = tac_value_index(instr->result);
+        int32_t literal;
+        if (instr->opcode == TAC_ASSIGN)
+        {
+            if (tac_is_value(instr->op1) && instr->op1.data_type == instr->result.data_type)
+            {
+                state->replacement[result] = tac_value_index(instr->op1);
+                instr->opcode = TAC_NOP;
+            }
+            else if (tac_literal_value(instr->op1, &literal) && instr->result.data_type != TYPE_FLOAT)
+            {
+                state->is_constant[result] = 1;
+                state->constant[result] = tac_normalize(instr->result.data_type, literal);
+            }
+            continue;
+        }
+
+        ExpressionKey key;
+        if (!make_key(state, instr, &key))
+            continue;
+        ExpressionEntry *entry = find_entry(state, &key);
+        if (entry->stamp == state->stamp)
+        {
+            state->replacement[result] = tac_value_index(entry->result);
+            instr->opcode = TAC_NOP;
+            STATS_INC(STAT_CSE_ELIMINATED);
+            continue;
+        }
+        entry->key = key;
+        entry->result = instr->result;
+        entry->stamp = state->stamp;
+        state->defs[result].opcode = instr->opcode;
+        state->defs[result].op1 = instr->op1;
+        state->defs[result].op2 = instr->op2;
+    }
+}
+
+void lvn_run(Cfg *cfg)
+{
+    cfg_compute_dominators(cfg);
+    uint32_t value_count = tac_value_count();
+    int longest = 0;
+    for (int b = 0; b < cfg->block_count; b++)
+        if (cfg->blocks[b].instr_count > longest)
+            longest = cfg->blocks[b].instr_count;
+
+    NumberingState state;
+    memset(&state, 0, sizeof(state));
+    uint32_t capacity = 16;
+    while (capacity < (uint32_t)longest * 2)
+        capacity *= 2;
+    state.table = (ExpressionEntry *)arena_calloc(&cfg_arena, (size_t)capacity * sizeof(ExpressionEntry));
+    state.mask = capacity - 1;
+    state.replacement = (uint32_t *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(uint32_t));
+    state.defs = (ValueDef *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(ValueDef));
+    state.is_constant = (char *)arena_calloc(&cfg_arena, (size_t)value_count);
+    state.constant = (int32_t *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int32_t));
+    for (uint32_t v = 0; v < value_count; v++)
+        state.replacement[v] = v;
+
+    // Dominators first, so a value is replaced before any block reads it
+    for (int r = 0; r < cfg->rpo_count; r++)
+        number_block(&state, &cfg->blocks[cfg->rpo[r]]);
+
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        for (int p = 0; p < block->phi_count; p++)
+            for (int a = 0; a < block->pred_count; a++)
+                replace_use(&state, &block->phis[p].args[a]);
+        int kept = 0;
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            if (block->instrs[i].opcode == TAC_NOP)
+                continue;
+            TacOperand *uses[3];
+            int count = tac_uses(&block->instrs[i], uses);
+            for (int u = 0; u < count; u++)
+                replace_use(&state, uses[u]);
+            block->instrs[kept++] = block->instrs[i];
+        }
+        block->instr_count = kept;
+    }
+}
@@ -0,0 +1,16 @@
+// lvn.h
+#ifndef LVN_H
+#define LVN_H
+
+#include "cfg.h"
+
+// Local value numbering over each basic block of a function in SSA form.
+// Operands of commutative operators are put in a fixed order and 'a > b' is
+// written as 'b < a', so equal expressions get equal keys; an expression
+// already computed in the block is replaced by its earlier result. Array
+// loads are reused until the next array store. Algebraic identities are
+// applied on the way ('x + 0', 'x * 1', 'x - x', '!!x', '!(a < b)' and
+// friends).
+void lvn_run(Cfg *cfg);
+
+#endif // LVN_H
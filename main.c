@@ -10,20 +10,21 @@
 #include "ir_generator.h"      // Include IR generator header
 #include "tac.h"               // TAC definitions and functions
 #include "codegen.h"           // X86 Code generator declarations
+#include "trace.h"             // --trace=<channels> diagnostic output
+#include "source_buffer.h"     // Memory-mapped input file
+#include "intern.h"            // Identifier interning (atoms)
+#include "stats.h"             // --stats / --stats-json reports
+#include "cfg.h"               // Control-flow graphs (--trace=cfg)
+#include "optimizer.h"         // -O<n>
 
-// This needs to be declared as extern because it's defined in lexer.yy.c
-extern FILE *yyin;
+// These are defined in the user code section of miniJava.l
+extern int lexer_scan_source(void);
+extern void lexer_release_source(void);
 extern ProgramNode *root_ast_node; // This is the variable that holds your AST root
 
 // Declare the global semantic error count as extern
 extern int semantic_error_count;
 
-// Global TAC list head (defined in tac.c)
-extern TacInstruction *tac_head;
-
-// If your lexer has a yylex_destroy function (common with Flex)
-// extern int yylex_destroy(void);
-
 // Helper function to derive output assembly filename
 // from input filename (e.g., "input.java" -> "input.s")
 char *get_output_asm_filename(const char *input_filename)
@@ -55,41 +56,126 @@ char *get_output_asm_filename(const char *input_filename)
     return output_filename;
 }
 
+static void print_usage(const char *program_name)
+{
+    fprintf(stderr, "Usage: %s [-O<n>] [--no-peephole] [--trace=<channels>] [--stats] [--stats-json=<file>] <input_minijava_file>\n", program_name);
+    fprintf(stderr, "  -O<n>               Optimization level (default 0: no optimization).\n");
+    fprintf(stderr, "  --no-peephole       Skip the peephole optimizer at any -O level.\n");
+    fprintf(stderr, "  --trace=<channels>  Comma separated list of phase,lex,ast,tac,cfg,opt,asm,mem (or all).\n");
+    fprintf(stderr, "                      Append :<level> to a channel to raise its verbosity.\n");
+    fprintf(stderr, "  --stats             Print per-phase time, memory and counters to stderr.\n");
+    fprintf(stderr, "  --stats-json=<file> Write the same report as JSON ('-' for stdout).\n");
+}
+
+// -O<n>; 0 leaves the TAC as the IR generator produced it.
+static int optimization_level = 0;
+
+// --no-peephole; emits the machine code as selected, for comparing with and
+// without peephole.c.
+static int peephole_enabled = 1;
+
+// Report options; both may be given.
+static int stats_text = 0;
+static const char *stats_json_path = NULL;
+
+// Emits the requested reports. Called on every exit after parsing started,
+// so failed compilations are measured too.
+static void report_stats(const char *input_filename)
+{
+    if (stats_text)
+        stats_print_text(stderr, input_filename);
+    if (stats_json_path)
+        stats_write_json(stats_json_path, input_filename);
+}
+
 int main(int argc, char *argv[])
 {
-    if (argc < 2)
+    const char *input_filename = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--trace=", 8) == 0)
+        {
+            if (!trace_configure(argv[i] + 8))
+                return 1;
+        }
+        else if (strcmp(argv[i], "--no-peephole") == 0)
+        {
+            peephole_enabled = 0;
+        }
+        else if (strcmp(argv[i], "--stats") == 0)
+        {
+            stats_text = 1;
+            stats_enable();
+        }
+        else if (strncmp(argv[i], "--stats-json=", 13) == 0 && argv[i][13] != '\0')
+        {
+            stats_json_path = argv[i] + 13;
+            stats_enable();
+        }
+        else if (argv[i][0] == '-' && argv[i][1] == 'O')
+        {
+            char *end;
+            long level = argv[i][2] ? strtol(argv[i] + 2, &end, 10) : 1;
+            if (argv[i][2] && (*end != '\0' || level < 0 || level > 9))
+            {
+                fprintf(stderr, "Invalid optimization level '%s'.\n", argv[i]);
+                print_usage(argv[0]);
+                return 1;
+            }
+            optimization_level = (int)level;
+        }
+        else if (argv[i][0] == '-' && argv[i][1] == '-')
+        {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            print_usage(argv[0]);
+            return 1;
+        }
+        else if (!input_filename)
+        {
+            input_filename = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "Only one input file is supported ('%s' given after '%s').\n", argv[i], input_filename);
+            return 1;
+        }
+    }
+
+    if (!input_filename)
     {
-        fprintf(stderr, "Usage: %s <input_minijava_file>\n", argv[0]);
+        print_usage(argv[0]);
         return 1; // Indicate error
     }
 
-    const char *input_filename = argv[1];
+    // Every identifier is interned once, while the AST is built
+    init_intern_table();
 
-    // Open the input file for lexer/parser
-    yyin = fopen(input_filename, "r");
-    if (!yyin)
-    {
-        perror("Could not open input file");
+    stats_phase_begin(STATS_PHASE_PARSE);
+
+    // Map the input file; the lexer scans it in place
+    if (!source_open(input_filename))
         return 1; // Indicate error
+    if (!lexer_scan_source())
+    {
+        source_close();
+        return 1;
     }
 
-    printf("Lexing and parsing started for: %s\n", input_filename);
+    TRACE(TRACE_PHASE, "Lexing and parsing started for: %s\n", input_filename);
     // Call the parser. It will internally call the lexer.
-    printf("Printing Tokens and Lexemes: \n");
+    TRACE(TRACE_LEX, "Printing Tokens and Lexemes: \n");
     int parse_result = yyparse();
 
-    // Close yyin
-    fclose(yyin);
-    yyin = NULL; // Good practice to nullify closed FILE*
-
-    // If yylex_destroy exists and is needed (check your lexer.l or lexer.yy.c)
-    // if (yylex_destroy) {
-    //     yylex_destroy();
-    // }
+    // Names now live in the intern table and string literals in the AST, so
+    // the source text is no longer needed once parsing is done.
+    lexer_release_source();
+    source_close();
+    stats_phase_end(STATS_PHASE_PARSE);
 
     if (parse_result == 0)
     {
-        printf("Parsing successful!\n");
+        TRACE(TRACE_PHASE, "Parsing successful!\n");
 
         if (root_ast_node == NULL)
         {
@@ -97,36 +183,74 @@ int main(int argc, char *argv[])
             return 1;
         }
 
-        printf("Printing AST: ");
-
-        print_ast (root_ast_node, 0);
+        if (TRACE_ENABLED(TRACE_AST, 1))
+        {
+            printf("Printing AST: ");
+            print_ast(root_ast_node, 0);
+        }
 
         init_symbol_table();
         init_tac_generator(); // Initialize TAC generator state
 
-        printf("Starting semantic analysis...\n");
+        TRACE(TRACE_PHASE, "Starting semantic analysis...\n");
+        stats_phase_begin(STATS_PHASE_SEMANTIC);
         analyze_semantics(root_ast_node);
+        stats_phase_end(STATS_PHASE_SEMANTIC);
 
         if (semantic_error_count == 0)
         {
-            printf("Semantic analysis successful! No errors found.\n");
+            TRACE(TRACE_PHASE, "Semantic analysis successful! No errors found.\n");
 
             // --- Intermediate Representation (IR) Generation Phase ---
-            printf("Starting IR generation...\n");
-            generate_ir(root_ast_node); // Populates global tac_head
+            TRACE(TRACE_PHASE, "Starting IR generation...\n");
+            stats_phase_begin(STATS_PHASE_IR);
+            generate_ir(root_ast_node); // Populates global tac_program
+            stats_phase_end(STATS_PHASE_IR);
+            STATS_ADD(STAT_TAC_INSTRUCTIONS, tac_program.count);
+            STATS_ADD(STAT_TAC_TEMPS, tac_program.temp_count);
+            STATS_ADD(STAT_TAC_LABELS, tac_program.label_count);
+
+            // The AST and the scopes it points to are not read after IR
+            // generation; release both arenas before code generation starts.
+            free_ast();
+            root_ast_node = NULL;
+            free_symbol_table();
 
-            if (tac_head != NULL)
+            if (tac_program.count > 0)
             {
-                printf("IR generation successful! Generated Three-Address Code:\n");
-                print_tac_code();
+                TRACE(TRACE_PHASE, "IR generation successful!\n");
+                if (TRACE_ENABLED(TRACE_TAC, 1))
+                    print_tac_code();
+                if (TRACE_ENABLED(TRACE_CFG, 1))
+                {
+                    for (int i = 0; i < tac_program.count; i++)
+                        if (tac_program.instrs[i].opcode == TAC_FUNCTION_BEGIN)
+                            cfg_print(stdout, cfg_build(&tac_program, i, &i), "Control-flow graph");
+                    free_cfgs();
+                }
+
+                // --- Optimization Phase (-O<n>) ---
+                if (optimization_level > 0)
+                {
+                    TRACE(TRACE_PHASE, "Optimizing at -O%d...\n", optimization_level);
+                    stats_phase_begin(STATS_PHASE_OPT);
+                    optimize_tac(optimization_level);
+                    stats_phase_end(STATS_PHASE_OPT);
+                    STATS_ADD(STAT_OPT_TAC_INSTRUCTIONS, tac_program.count);
+                    if (TRACE_ENABLED(TRACE_OPT, 1))
+                        print_tac_code();
+                }
 
                 // --- Code Generation Phase (x86 Assembly) ---
-                printf("Starting x86 code generation...\n");
+                TRACE(TRACE_PHASE, "Starting x86 code generation...\n");
                 char *output_asm_filename = get_output_asm_filename(input_filename);
                 if (output_asm_filename)
                 {
-                    generate_x86_assembly(tac_head, output_asm_filename);
-                    printf("Assembly output should be in: %s\n", output_asm_filename);
+                    stats_phase_begin(STATS_PHASE_CODEGEN);
+                    generate_x86_assembly(&tac_program, output_asm_filename, optimization_level,
+                                          peephole_enabled ? optimization_level : 0);
+                    stats_phase_end(STATS_PHASE_CODEGEN);
+                    TRACE(TRACE_PHASE, "Assembly output should be in: %s\n", output_asm_filename);
                     free(output_asm_filename); // Free the allocated filename string
                 }
                 else
@@ -144,47 +268,36 @@ int main(int argc, char *argv[])
         {
             fprintf(stderr, "Semantic analysis found %d error(s). Compiler front-end failed.\n", semantic_error_count);
             // Free resources before exiting due to semantic errors
-            if (root_ast_node != NULL)
-                free_ast(root_ast_node);
-            if (tac_head != NULL)
-                free_tac_code();
+            free_ast();
             free_symbol_table();
+            free_intern_table();
+            report_stats(input_filename);
             return 1; // Indicate semantic errors
         }
     }
     else
     {
         fprintf(stderr, "Parsing failed! Syntax errors detected. Compiler front-end failed.\n");
-        // Resources like root_ast_node might not be fully formed or null
-        // If AST partial creation happens, it should be freed.
-        // For simplicity here, assuming parser failure means minimal resource allocation beyond lexer.
-        if (root_ast_node != NULL)
-            free_ast(root_ast_node); // Attempt to free if it got partially built
+        // Any partially built AST is in ast_arena and is released with it.
+        free_ast();
         // TAC wouldn't be generated yet
         // Symbol table might have partial entries, depends on your init/failure handling
         // init_symbol_table might have been called even before parse_result is checked.
         // Consider where init_symbol_table is called. If before yyparse, then free_symbol_table here.
         // Based on current structure, init_symbol_table is after parse success, so not needed here.
+        free_intern_table();
+        report_stats(input_filename);
         return 1; // Indicate parsing failure
     }
 
     // --- Resource Cleanup ---
-    if (root_ast_node != NULL)
-    {
-        printf("Freeing AST memory...\n");
-        free_ast(root_ast_node);
-        root_ast_node = NULL;
-    }
-
-    if (tac_head != NULL)
-    {
-        printf("Freeing TAC memory...\n");
-        free_tac_code(); // tac_head will be set to NULL inside this function
-    }
-
-    printf("Freeing symbol table...\n");
-    free_symbol_table();
+    // The AST and symbol table arenas were released after IR generation and
+    // the codegen arena at the end of generate_x86_assembly().
+    TRACE(TRACE_PHASE, "Freeing TAC memory...\n");
+    free_tac_code(); // Resets tac_program
+    free_intern_table(); // Last: every phase above refers to atoms
+    report_stats(input_filename);
 
-    printf("Compilation process finished.\n");
+    TRACE(TRACE_PHASE, "Compilation process finished.\n");
     return 0; // Indicate overall success
 }
\ No newline at end of file
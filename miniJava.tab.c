@@ -74,6 +74,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "stats.h" // Token count for --stats
 
 // Externs for Flex variables that Bison needs to know about.
 // yylex() is declared later. yyerror() is defined at the bottom.
@@ -81,7 +82,13 @@ extern int yylineno;
 extern char *yytext;
 extern FILE *yyin;
 
-#line 85 "miniJava.tab.c"
+// Statement lists are left-recursive and no longer grow the parser stack, but
+// deeply nested expressions (parentheses, unary chains) still do. Bison's
+// default limit of 10000 entries is far too small for generated sources; the
+// stack is grown on demand, so a large limit costs nothing for normal input.
+#define YYMAXDEPTH 10000000
+
+#line 92 "miniJava.tab.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -190,7 +197,7 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
 /* Second part of user prologue.  */
-#line 56 "miniJava.y"
+#line 65 "miniJava.y"
 
     ProgramNode *root_ast_node = NULL; // Your global AST root - DEFINITION MOVED HERE
 
@@ -199,7 +206,15 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
     extern int yylex(void);
     void yyerror(const char *s);
 
-#line 203 "miniJava.tab.c"
+    // The parser pulls every token through here so --stats can count them.
+    static int yylex_counted(void)
+    {
+        STATS_INC(STAT_TOKENS);
+        return yylex();
+    }
+    #define yylex yylex_counted
+
+#line 218 "miniJava.tab.c"
 
 
 #ifdef short
@@ -526,7 +541,7 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  6
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   127
+#define YYLAST   131
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  47
@@ -535,7 +550,7 @@ union yyalloc
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  69
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  131
+#define YYNSTATES  130
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   301
@@ -589,13 +604,13 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   124,   124,   133,   142,   150,   162,   179,   191,   192,
-     197,   199,   201,   203,   205,   207,   209,   214,   219,   221,
-     223,   228,   230,   232,   234,   239,   241,   246,   248,   253,
-     258,   263,   265,   270,   274,   275,   279,   280,   284,   285,
-     286,   290,   291,   292,   293,   294,   298,   299,   300,   304,
-     305,   306,   307,   311,   312,   314,   319,   321,   323,   325,
-     327,   329,   331,   333,   335,   340,   347,   351,   355,   359
+       0,   141,   141,   150,   155,   163,   175,   191,   203,   204,
+     209,   211,   213,   215,   217,   219,   221,   226,   231,   233,
+     235,   240,   242,   244,   246,   251,   253,   258,   260,   265,
+     270,   275,   277,   282,   286,   287,   291,   292,   296,   297,
+     298,   302,   303,   304,   305,   306,   310,   311,   312,   316,
+     317,   318,   319,   323,   324,   326,   331,   333,   335,   337,
+     339,   341,   343,   345,   347,   352,   359,   363,   367,   371
 };
 #endif
 
@@ -641,7 +656,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-111)
+#define YYPACT_NINF (-110)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -655,20 +670,19 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int8 yypact[] =
 {
-       7,     6,    32,  -111,  -111,   -23,  -111,  -111,    17,    23,
-       2,  -111,  -111,    58,  -111,  -111,    12,     6,    38,    14,
-       6,  -111,    26,     6,  -111,    27,     1,    41,     1,  -111,
-    -111,  -111,  -111,  -111,  -111,     1,     1,     1,  -111,    46,
-      48,    -5,    29,     4,    49,  -111,  -111,    42,  -111,  -111,
-    -111,  -111,    44,  -111,  -111,  -111,    50,     1,     1,     1,
+       5,     8,    32,  -110,  -110,   -23,  -110,  -110,    17,    23,
+       2,  -110,  -110,    47,  -110,  -110,    12,     8,    38,    26,
+       8,  -110,    39,     8,  -110,    40,     1,    37,     1,  -110,
+    -110,  -110,  -110,  -110,  -110,     1,     1,     1,  -110,    35,
+      46,    -5,    52,     4,    70,  -110,  -110,    56,  -110,  -110,
+    -110,  -110,    49,  -110,  -110,  -110,    61,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,    45,  -111,    48,    -5,    29,    29,     4,     4,     4,
-       4,    49,    49,  -111,  -111,  -111,    47,    33,  -111,  -111,
-      53,    54,     1,    55,    56,    33,  -111,    51,    52,  -111,
-    -111,    57,    59,   -28,     1,     1,  -111,     1,  -111,  -111,
-    -111,  -111,  -111,  -111,     1,     1,    60,    63,    65,  -111,
-      62,    33,    33,  -111,    61,    90,  -111,     1,    33,  -111,
-    -111
+       1,    62,  -110,    46,    -5,    52,    52,     4,     4,     4,
+       4,    70,    70,  -110,  -110,  -110,    58,  -110,  -110,  -110,
+      33,    65,    66,     1,    67,  -110,  -110,  -110,    63,    64,
+    -110,  -110,    68,    69,   -28,     1,     1,  -110,     1,  -110,
+    -110,  -110,  -110,     1,     1,    71,    72,    75,  -110,    73,
+      50,    50,  -110,    78,    90,  -110,     1,    50,  -110,  -110
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -685,26 +699,25 @@ static const yytype_int8 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,    64,    35,    37,    39,    40,    42,    43,    44,
       45,    47,    48,    50,    51,    52,     0,     8,     7,    63,
-       0,     0,    31,     0,     0,     8,    16,     0,     0,    12,
-      13,     0,     0,     0,     0,     0,    32,     0,    17,     9,
-      10,    11,    14,    15,     0,     0,     0,     0,     0,    25,
-       0,     0,     0,    30,     0,    27,    29,     0,     0,    26,
-      28
+       0,     0,     0,    31,     0,    17,     9,    16,     0,     0,
+      12,    13,     0,     0,     0,     0,     0,    32,     0,    10,
+      11,    14,    15,     0,     0,     0,     0,     0,    25,     0,
+       0,     0,    30,     0,    27,    29,     0,     0,    26,    28
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-    -111,  -111,  -111,  -111,  -111,    13,  -110,    36,   101,    97,
-    -111,  -111,  -111,  -111,  -111,   -27,  -111,    66,    64,   -18,
-       5,   -13,   -33,  -111,    -1,  -111,  -111,  -111,  -111
+    -110,  -110,  -110,  -110,  -110,  -110,  -109,    51,   101,   104,
+    -110,  -110,  -110,  -110,  -110,   -27,  -110,    74,    60,   -18,
+      30,   -13,   -33,  -110,    -1,  -110,  -110,  -110,  -110
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-       0,     2,     8,     3,    15,    94,    95,    96,    97,    17,
-      98,    99,   100,   101,   102,    38,    39,    40,    41,    42,
+       0,     2,     8,     3,    15,    90,    96,    97,    98,    17,
+      99,   100,   101,   102,   103,    38,    39,    40,    41,    42,
       43,    44,    45,    46,    47,    48,    49,    50,    51
 };
 
@@ -713,36 +726,38 @@ static const yytype_int8 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
-       5,    53,    54,    55,    29,    30,    31,    32,     4,   114,
-      56,   125,   126,     4,   115,     1,    22,     7,   130,    25,
+       5,    53,    54,    55,    29,    30,    31,    32,     4,   113,
+      56,   124,   125,     1,   114,     4,    22,     7,   129,    25,
       33,    34,    27,    59,    60,    35,     9,    65,    66,    10,
       11,    12,     6,    18,    83,    84,    85,    36,    13,    37,
-       4,    75,    76,    86,    19,    10,    11,    12,    90,    23,
-      91,    92,    81,    82,    13,    93,    21,    24,    14,    61,
-      62,    63,    64,    26,    28,   106,    77,    78,    79,    80,
-      10,    11,    12,    87,    67,    68,    69,   116,   117,    52,
-     118,    57,    58,    71,    70,    87,   103,   119,   120,    72,
-      89,   104,   105,   107,   103,   110,   111,   108,   127,   121,
-     129,   112,   122,   113,   123,   124,   128,    88,   109,    16,
-      20,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     103,   103,    74,    73,     0,     0,     0,   103
+       4,    75,    76,    86,    19,    10,    11,    12,    91,    23,
+      92,    93,    81,    82,    13,    94,    21,     4,    14,    10,
+      11,    12,    10,    11,    12,    91,   107,    92,    93,    24,
+      57,    13,    94,    87,    95,    52,    26,    28,   115,   116,
+      58,   117,    61,    62,    63,    64,   118,   119,    71,   104,
+      87,    77,    78,    79,    80,    67,    68,    69,    70,   128,
+      72,    89,    87,   105,   106,   108,   127,   109,   110,    16,
+     120,   121,   111,   112,   122,   126,   123,    20,    74,   104,
+     104,     0,    88,     0,     0,     0,   104,     0,     0,     0,
+       0,    73
 };
 
-static const yytype_int16 yycheck[] =
+static const yytype_int8 yycheck[] =
 {
        1,    28,    35,    36,     3,     4,     5,     6,     7,    37,
-      37,   121,   122,     7,    42,     8,    17,    40,   128,    20,
+      37,   120,   121,     8,    42,     7,    17,    40,   127,    20,
       19,    20,    23,    28,    29,    24,     9,    23,    24,    12,
       13,    14,     0,    10,    67,    68,    69,    36,    21,    38,
        7,    59,    60,    70,    42,    12,    13,    14,    15,    11,
-      17,    18,    65,    66,    21,    22,    44,    43,    41,    30,
-      31,    32,    33,    37,    37,    92,    61,    62,    63,    64,
-      12,    13,    14,    40,    25,    26,    27,   104,   105,    38,
-     107,    35,    34,    39,    42,    40,    87,   114,   115,    39,
-      43,    38,    38,    38,    95,    44,    44,    41,    37,    39,
-     127,    44,    39,    44,    39,    43,    16,    71,    95,     8,
-      13,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     121,   122,    58,    57,    -1,    -1,    -1,   128
+      17,    18,    65,    66,    21,    22,    44,     7,    41,    12,
+      13,    14,    12,    13,    14,    15,    93,    17,    18,    43,
+      35,    21,    22,    40,    41,    38,    37,    37,   105,   106,
+      34,   108,    30,    31,    32,    33,   113,   114,    39,    90,
+      40,    61,    62,    63,    64,    25,    26,    27,    42,   126,
+      39,    43,    40,    38,    38,    38,    16,    44,    44,     8,
+      39,    39,    44,    44,    39,    37,    43,    13,    58,   120,
+     121,    -1,    71,    -1,    -1,    -1,   127,    -1,    -1,    -1,
+      -1,    57
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -758,11 +773,10 @@ static const yytype_int8 yystos[] =
       29,    30,    31,    32,    33,    23,    24,    25,    26,    27,
       42,    39,    39,    64,    65,    66,    66,    67,    67,    67,
       67,    68,    68,    69,    69,    69,    62,    40,    54,    43,
-      15,    17,    18,    22,    52,    53,    54,    55,    57,    58,
-      59,    60,    61,    71,    38,    38,    62,    38,    41,    52,
-      44,    44,    44,    44,    37,    42,    62,    62,    62,    62,
-      62,    39,    39,    39,    43,    53,    53,    37,    16,    62,
-      53
+      52,    15,    17,    18,    22,    41,    53,    54,    55,    57,
+      58,    59,    60,    61,    71,    38,    38,    62,    38,    44,
+      44,    44,    44,    37,    42,    62,    62,    62,    62,    62,
+      39,    39,    39,    43,    53,    53,    37,    16,    62,    53
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1363,30 +1377,26 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* program: class_declaration  */
-#line 125 "miniJava.y"
+#line 142 "miniJava.y"
     {
         (yyval.program_node) = create_program_node((yyvsp[0].class_decl_node), (yylsp[0]).first_line);
         root_ast_node = (yyval.program_node); // This assignment should now be type-correct
     }
-#line 1372 "miniJava.tab.c"
+#line 1386 "miniJava.tab.c"
     break;
 
   case 3: /* class_body_items: %empty  */
-#line 133 "miniJava.y"
+#line 150 "miniJava.y"
     {
-        (yyval.parsed_class_contents_ptr) = (ParsedClassContents*)calloc(1, sizeof(ParsedClassContents));
-        if (!(yyval.parsed_class_contents_ptr)) {
-            yyerror("Memory allocation failed for class contents collector");
-            YYABORT;
-        }
+        (yyval.parsed_class_contents_ptr) = (ParsedClassContents*)arena_calloc(&ast_arena, sizeof(ParsedClassContents));
         (yyval.parsed_class_contents_ptr)->main_method = NULL;
         (yyval.parsed_class_contents_ptr)->var_decls = NULL;
     }
-#line 1386 "miniJava.tab.c"
+#line 1396 "miniJava.tab.c"
     break;
 
   case 4: /* class_body_items: class_body_items variable_declaration TOKEN_SEMICOLON  */
-#line 143 "miniJava.y"
+#line 156 "miniJava.y"
     {
         (yyval.parsed_class_contents_ptr) = (yyvsp[-2].parsed_class_contents_ptr);
         (yyval.parsed_class_contents_ptr)->var_decls = create_variable_declaration_list_node((yyvsp[-1].var_decl_node), (yyval.parsed_class_contents_ptr)->var_decls);
@@ -1394,11 +1404,11 @@ yyreduce:
              yyerror("Memory allocation failed for var_decl list node"); YYABORT;
         }
     }
-#line 1398 "miniJava.tab.c"
+#line 1408 "miniJava.tab.c"
     break;
 
   case 5: /* class_body_items: class_body_items main_method_declaration  */
-#line 151 "miniJava.y"
+#line 164 "miniJava.y"
     {
         (yyval.parsed_class_contents_ptr) = (yyvsp[-1].parsed_class_contents_ptr);
         if ((yyval.parsed_class_contents_ptr)->main_method != NULL) {
@@ -1407,11 +1417,11 @@ yyreduce:
         }
         (yyval.parsed_class_contents_ptr)->main_method = (yyvsp[0].main_method_node);
     }
-#line 1411 "miniJava.tab.c"
+#line 1421 "miniJava.tab.c"
     break;
 
   case 6: /* class_declaration: TOKEN_CLASS identifier TOKEN_LBRACE class_body_items TOKEN_RBRACE  */
-#line 163 "miniJava.y"
+#line 176 "miniJava.y"
     {
         if (!(yyvsp[-1].parsed_class_contents_ptr)->main_method) {
             yyerror("Error: Class must contain a main method.");
@@ -1423,13 +1433,12 @@ yyreduce:
             (yyvsp[-1].parsed_class_contents_ptr)->var_decls,
             (yylsp[-4]).first_line
         );
-        free((yyvsp[-1].parsed_class_contents_ptr));
     }
-#line 1429 "miniJava.tab.c"
+#line 1438 "miniJava.tab.c"
     break;
 
   case 7: /* main_method_declaration: TOKEN_PUBLIC TOKEN_STATIC TOKEN_VOID identifier TOKEN_LPAREN TOKEN_RPAREN block_statement_core  */
-#line 180 "miniJava.y"
+#line 192 "miniJava.y"
     {
         // Optional: Check if $4->name is "main"
         // if (strcmp($4->name, "main") != 0) {
@@ -1437,387 +1446,387 @@ yyreduce:
         // }
         (yyval.main_method_node) = create_main_method_node((yyvsp[-3].identifier_node), (yyvsp[0].block_stmt_node), (yylsp[-6]).first_line);
     }
-#line 1441 "miniJava.tab.c"
+#line 1450 "miniJava.tab.c"
     break;
 
   case 8: /* statements: %empty  */
-#line 191 "miniJava.y"
-    { (yyval.statement_list_node) = NULL; }
-#line 1447 "miniJava.tab.c"
+#line 203 "miniJava.y"
+    { (yyval.statement_list_builder).head = NULL; (yyval.statement_list_builder).tail = NULL; }
+#line 1456 "miniJava.tab.c"
     break;
 
-  case 9: /* statements: statement statements  */
-#line 193 "miniJava.y"
-    { (yyval.statement_list_node) = create_statement_list_node((yyvsp[-1].statement_node), (yyvsp[0].statement_list_node)); }
-#line 1453 "miniJava.tab.c"
+  case 9: /* statements: statements statement  */
+#line 205 "miniJava.y"
+    { (yyval.statement_list_builder) = (yyvsp[-1].statement_list_builder); append_statement_to_list(&(yyval.statement_list_builder), (yyvsp[0].statement_node)); }
+#line 1462 "miniJava.tab.c"
     break;
 
   case 10: /* statement: variable_declaration TOKEN_SEMICOLON  */
-#line 198 "miniJava.y"
+#line 210 "miniJava.y"
     { (yyval.statement_node) = create_variable_declaration_statement((yyvsp[-1].var_decl_node), (yylsp[-1]).first_line); }
-#line 1459 "miniJava.tab.c"
+#line 1468 "miniJava.tab.c"
     break;
 
   case 11: /* statement: assignment_core TOKEN_SEMICOLON  */
-#line 200 "miniJava.y"
+#line 212 "miniJava.y"
     { (yyval.statement_node) = create_assignment_statement((yyvsp[-1].assignment_node), (yylsp[-1]).first_line); }
-#line 1465 "miniJava.tab.c"
+#line 1474 "miniJava.tab.c"
     break;
 
   case 12: /* statement: if_statement_core  */
-#line 202 "miniJava.y"
+#line 214 "miniJava.y"
     { (yyval.statement_node) = create_if_statement_wrapper_node((yyvsp[0].if_stmt_node), (yylsp[0]).first_line); }
-#line 1471 "miniJava.tab.c"
+#line 1480 "miniJava.tab.c"
     break;
 
   case 13: /* statement: while_statement_core  */
-#line 204 "miniJava.y"
+#line 216 "miniJava.y"
     { (yyval.statement_node) = create_while_statement_wrapper_node((yyvsp[0].while_stmt_node), (yylsp[0]).first_line); }
-#line 1477 "miniJava.tab.c"
+#line 1486 "miniJava.tab.c"
     break;
 
   case 14: /* statement: print_statement_core TOKEN_SEMICOLON  */
-#line 206 "miniJava.y"
+#line 218 "miniJava.y"
     { (yyval.statement_node) = create_print_statement_wrapper_node((yyvsp[-1].print_stmt_node), (yylsp[-1]).first_line); }
-#line 1483 "miniJava.tab.c"
+#line 1492 "miniJava.tab.c"
     break;
 
   case 15: /* statement: return_statement_core TOKEN_SEMICOLON  */
-#line 208 "miniJava.y"
+#line 220 "miniJava.y"
     { (yyval.statement_node) = create_return_statement_wrapper_node((yyvsp[-1].return_stmt_node), (yylsp[-1]).first_line); }
-#line 1489 "miniJava.tab.c"
+#line 1498 "miniJava.tab.c"
     break;
 
   case 16: /* statement: block_statement_core  */
-#line 210 "miniJava.y"
+#line 222 "miniJava.y"
     { (yyval.statement_node) = create_block_statement_wrapper_node((yyvsp[0].block_stmt_node), (yylsp[0]).first_line); }
-#line 1495 "miniJava.tab.c"
+#line 1504 "miniJava.tab.c"
     break;
 
   case 17: /* block_statement_core: TOKEN_LBRACE statements TOKEN_RBRACE  */
-#line 215 "miniJava.y"
-    { (yyval.block_stmt_node) = create_block_node((yyvsp[-1].statement_list_node), (yylsp[-2]).first_line); }
-#line 1501 "miniJava.tab.c"
+#line 227 "miniJava.y"
+    { (yyval.block_stmt_node) = create_block_node((yyvsp[-1].statement_list_builder).head, (yylsp[-2]).first_line); }
+#line 1510 "miniJava.tab.c"
     break;
 
   case 18: /* variable_declaration: type identifier  */
-#line 220 "miniJava.y"
+#line 232 "miniJava.y"
     { (yyval.var_decl_node) = create_variable_declaration_node((yyvsp[-1].type_node), (yyvsp[0].identifier_node), NULL, 0, (yylsp[-1]).first_line); }
-#line 1507 "miniJava.tab.c"
+#line 1516 "miniJava.tab.c"
     break;
 
   case 19: /* variable_declaration: type identifier TOKEN_ASSIGN expression  */
-#line 222 "miniJava.y"
+#line 234 "miniJava.y"
     { (yyval.var_decl_node) = create_variable_declaration_node((yyvsp[-3].type_node), (yyvsp[-2].identifier_node), (yyvsp[0].expression_node), 0, (yylsp[-3]).first_line); }
-#line 1513 "miniJava.tab.c"
+#line 1522 "miniJava.tab.c"
     break;
 
   case 20: /* variable_declaration: TOKEN_FINAL type identifier TOKEN_ASSIGN expression  */
-#line 224 "miniJava.y"
+#line 236 "miniJava.y"
     { (yyval.var_decl_node) = create_variable_declaration_node((yyvsp[-3].type_node), (yyvsp[-2].identifier_node), (yyvsp[0].expression_node), 1, (yylsp[-4]).first_line); }
-#line 1519 "miniJava.tab.c"
+#line 1528 "miniJava.tab.c"
     break;
 
   case 21: /* type: TOKEN_INT  */
-#line 229 "miniJava.y"
+#line 241 "miniJava.y"
     { (yyval.type_node) = create_type_node(TYPE_INT, (yylsp[0]).first_line); }
-#line 1525 "miniJava.tab.c"
+#line 1534 "miniJava.tab.c"
     break;
 
   case 22: /* type: TOKEN_CHAR  */
-#line 231 "miniJava.y"
+#line 243 "miniJava.y"
     { (yyval.type_node) = create_type_node(TYPE_CHAR, (yylsp[0]).first_line); }
-#line 1531 "miniJava.tab.c"
+#line 1540 "miniJava.tab.c"
     break;
 
   case 23: /* type: TOKEN_BOOLEAN  */
-#line 233 "miniJava.y"
+#line 245 "miniJava.y"
     { (yyval.type_node) = create_type_node(TYPE_BOOLEAN, (yylsp[0]).first_line); }
-#line 1537 "miniJava.tab.c"
+#line 1546 "miniJava.tab.c"
     break;
 
   case 24: /* type: TOKEN_INT TOKEN_LBRACKET TOKEN_RBRACKET  */
-#line 235 "miniJava.y"
+#line 247 "miniJava.y"
     { (yyval.type_node) = create_type_node(TYPE_INT_ARRAY, (yylsp[-2]).first_line); }
-#line 1543 "miniJava.tab.c"
+#line 1552 "miniJava.tab.c"
     break;
 
   case 25: /* assignment_core: identifier TOKEN_ASSIGN expression  */
-#line 240 "miniJava.y"
+#line 252 "miniJava.y"
     { (yyval.assignment_node) = create_assignment_node((yyvsp[-2].identifier_node), NULL, (yyvsp[0].expression_node), (yylsp[-2]).first_line); }
-#line 1549 "miniJava.tab.c"
+#line 1558 "miniJava.tab.c"
     break;
 
   case 26: /* assignment_core: identifier TOKEN_LBRACKET expression TOKEN_RBRACKET TOKEN_ASSIGN expression  */
-#line 242 "miniJava.y"
+#line 254 "miniJava.y"
     { (yyval.assignment_node) = create_assignment_node((yyvsp[-5].identifier_node), (yyvsp[-3].expression_node), (yyvsp[0].expression_node), (yylsp[-5]).first_line); }
-#line 1555 "miniJava.tab.c"
+#line 1564 "miniJava.tab.c"
     break;
 
   case 27: /* if_statement_core: TOKEN_IF TOKEN_LPAREN expression TOKEN_RPAREN statement  */
-#line 247 "miniJava.y"
+#line 259 "miniJava.y"
     { (yyval.if_stmt_node) = create_if_node((yyvsp[-2].expression_node), (yyvsp[0].statement_node), NULL, (yylsp[-4]).first_line); }
-#line 1561 "miniJava.tab.c"
+#line 1570 "miniJava.tab.c"
     break;
 
   case 28: /* if_statement_core: TOKEN_IF TOKEN_LPAREN expression TOKEN_RPAREN statement TOKEN_ELSE statement  */
-#line 249 "miniJava.y"
+#line 261 "miniJava.y"
     { (yyval.if_stmt_node) = create_if_node((yyvsp[-4].expression_node), (yyvsp[-2].statement_node), (yyvsp[0].statement_node), (yylsp[-6]).first_line); }
-#line 1567 "miniJava.tab.c"
+#line 1576 "miniJava.tab.c"
     break;
 
   case 29: /* while_statement_core: TOKEN_WHILE TOKEN_LPAREN expression TOKEN_RPAREN statement  */
-#line 254 "miniJava.y"
+#line 266 "miniJava.y"
     { (yyval.while_stmt_node) = create_while_node((yyvsp[-2].expression_node), (yyvsp[0].statement_node), (yylsp[-4]).first_line); }
-#line 1573 "miniJava.tab.c"
+#line 1582 "miniJava.tab.c"
     break;
 
   case 30: /* print_statement_core: TOKEN_PRINT TOKEN_LPAREN expression TOKEN_RPAREN  */
-#line 259 "miniJava.y"
+#line 271 "miniJava.y"
     { (yyval.print_stmt_node) = create_print_node((yyvsp[-1].expression_node), (yylsp[-3]).first_line); }
-#line 1579 "miniJava.tab.c"
+#line 1588 "miniJava.tab.c"
     break;
 
   case 31: /* return_statement_core: TOKEN_RETURN  */
-#line 264 "miniJava.y"
+#line 276 "miniJava.y"
     { (yyval.return_stmt_node) = create_return_node(NULL, (yylsp[0]).first_line); }
-#line 1585 "miniJava.tab.c"
+#line 1594 "miniJava.tab.c"
     break;
 
   case 32: /* return_statement_core: TOKEN_RETURN expression  */
-#line 266 "miniJava.y"
+#line 278 "miniJava.y"
     { (yyval.return_stmt_node) = create_return_node((yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1591 "miniJava.tab.c"
+#line 1600 "miniJava.tab.c"
     break;
 
   case 33: /* expression: logical_or_expression  */
-#line 270 "miniJava.y"
+#line 282 "miniJava.y"
                           { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1597 "miniJava.tab.c"
+#line 1606 "miniJava.tab.c"
     break;
 
   case 34: /* logical_or_expression: logical_and_expression  */
-#line 274 "miniJava.y"
+#line 286 "miniJava.y"
                            { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1603 "miniJava.tab.c"
+#line 1612 "miniJava.tab.c"
     break;
 
   case 35: /* logical_or_expression: logical_or_expression TOKEN_OR logical_and_expression  */
-#line 275 "miniJava.y"
+#line 287 "miniJava.y"
                                                           { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_OR, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1609 "miniJava.tab.c"
+#line 1618 "miniJava.tab.c"
     break;
 
   case 36: /* logical_and_expression: equality_expression  */
-#line 279 "miniJava.y"
+#line 291 "miniJava.y"
                         { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1615 "miniJava.tab.c"
+#line 1624 "miniJava.tab.c"
     break;
 
   case 37: /* logical_and_expression: logical_and_expression TOKEN_AND equality_expression  */
-#line 280 "miniJava.y"
+#line 292 "miniJava.y"
                                                          { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_AND, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1621 "miniJava.tab.c"
+#line 1630 "miniJava.tab.c"
     break;
 
   case 38: /* equality_expression: relational_expression  */
-#line 284 "miniJava.y"
+#line 296 "miniJava.y"
                           { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1627 "miniJava.tab.c"
+#line 1636 "miniJava.tab.c"
     break;
 
   case 39: /* equality_expression: equality_expression TOKEN_EQ relational_expression  */
-#line 285 "miniJava.y"
+#line 297 "miniJava.y"
                                                        { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_EQ, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1633 "miniJava.tab.c"
+#line 1642 "miniJava.tab.c"
     break;
 
   case 40: /* equality_expression: equality_expression TOKEN_NEQ relational_expression  */
-#line 286 "miniJava.y"
+#line 298 "miniJava.y"
                                                         { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_NEQ, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1639 "miniJava.tab.c"
+#line 1648 "miniJava.tab.c"
     break;
 
   case 41: /* relational_expression: additive_expression  */
-#line 290 "miniJava.y"
+#line 302 "miniJava.y"
                         { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1645 "miniJava.tab.c"
+#line 1654 "miniJava.tab.c"
     break;
 
   case 42: /* relational_expression: relational_expression TOKEN_LT additive_expression  */
-#line 291 "miniJava.y"
+#line 303 "miniJava.y"
                                                        { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_LT, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1651 "miniJava.tab.c"
+#line 1660 "miniJava.tab.c"
     break;
 
   case 43: /* relational_expression: relational_expression TOKEN_GT additive_expression  */
-#line 292 "miniJava.y"
+#line 304 "miniJava.y"
                                                        { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_GT, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1657 "miniJava.tab.c"
+#line 1666 "miniJava.tab.c"
     break;
 
   case 44: /* relational_expression: relational_expression TOKEN_LEQ additive_expression  */
-#line 293 "miniJava.y"
+#line 305 "miniJava.y"
                                                         { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_LEQ, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1663 "miniJava.tab.c"
+#line 1672 "miniJava.tab.c"
     break;
 
   case 45: /* relational_expression: relational_expression TOKEN_GEQ additive_expression  */
-#line 294 "miniJava.y"
+#line 306 "miniJava.y"
                                                         { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_GEQ, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1669 "miniJava.tab.c"
+#line 1678 "miniJava.tab.c"
     break;
 
   case 46: /* additive_expression: multiplicative_expression  */
-#line 298 "miniJava.y"
+#line 310 "miniJava.y"
                               { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1675 "miniJava.tab.c"
+#line 1684 "miniJava.tab.c"
     break;
 
   case 47: /* additive_expression: additive_expression TOKEN_PLUS multiplicative_expression  */
-#line 299 "miniJava.y"
+#line 311 "miniJava.y"
                                                              { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_PLUS, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1681 "miniJava.tab.c"
+#line 1690 "miniJava.tab.c"
     break;
 
   case 48: /* additive_expression: additive_expression TOKEN_MINUS multiplicative_expression  */
-#line 300 "miniJava.y"
+#line 312 "miniJava.y"
                                                               { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_MINUS, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1687 "miniJava.tab.c"
+#line 1696 "miniJava.tab.c"
     break;
 
   case 49: /* multiplicative_expression: unary_expression  */
-#line 304 "miniJava.y"
+#line 316 "miniJava.y"
                      { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1693 "miniJava.tab.c"
+#line 1702 "miniJava.tab.c"
     break;
 
   case 50: /* multiplicative_expression: multiplicative_expression TOKEN_MULTIPLY unary_expression  */
-#line 305 "miniJava.y"
+#line 317 "miniJava.y"
                                                               { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_MULTIPLY, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1699 "miniJava.tab.c"
+#line 1708 "miniJava.tab.c"
     break;
 
   case 51: /* multiplicative_expression: multiplicative_expression TOKEN_DIVIDE unary_expression  */
-#line 306 "miniJava.y"
+#line 318 "miniJava.y"
                                                             { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_DIVIDE, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1705 "miniJava.tab.c"
+#line 1714 "miniJava.tab.c"
     break;
 
   case 52: /* multiplicative_expression: multiplicative_expression TOKEN_MOD unary_expression  */
-#line 307 "miniJava.y"
+#line 319 "miniJava.y"
                                                          { (yyval.expression_node) = create_binary_expression_node((yyvsp[-2].expression_node), TOKEN_MOD, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1711 "miniJava.tab.c"
+#line 1720 "miniJava.tab.c"
     break;
 
   case 53: /* unary_expression: primary_expression  */
-#line 311 "miniJava.y"
+#line 323 "miniJava.y"
                        { (yyval.expression_node) = (yyvsp[0].expression_node); }
-#line 1717 "miniJava.tab.c"
+#line 1726 "miniJava.tab.c"
     break;
 
   case 54: /* unary_expression: TOKEN_MINUS unary_expression  */
-#line 313 "miniJava.y"
+#line 325 "miniJava.y"
     { (yyval.expression_node) = create_unary_expression_node(TOKEN_MINUS, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1723 "miniJava.tab.c"
+#line 1732 "miniJava.tab.c"
     break;
 
   case 55: /* unary_expression: TOKEN_NOT unary_expression  */
-#line 315 "miniJava.y"
+#line 327 "miniJava.y"
     { (yyval.expression_node) = create_unary_expression_node(TOKEN_NOT, (yyvsp[0].expression_node), (yylsp[-1]).first_line); }
-#line 1729 "miniJava.tab.c"
+#line 1738 "miniJava.tab.c"
     break;
 
   case 56: /* primary_expression: integer_literal  */
-#line 320 "miniJava.y"
+#line 332 "miniJava.y"
     { (yyval.expression_node) = create_literal_expression_node((yyvsp[0].literal_node), (yylsp[0]).first_line); }
-#line 1735 "miniJava.tab.c"
+#line 1744 "miniJava.tab.c"
     break;
 
   case 57: /* primary_expression: float_literal  */
-#line 322 "miniJava.y"
+#line 334 "miniJava.y"
     { (yyval.expression_node) = create_literal_expression_node((yyvsp[0].literal_node), (yylsp[0]).first_line); }
-#line 1741 "miniJava.tab.c"
+#line 1750 "miniJava.tab.c"
     break;
 
   case 58: /* primary_expression: char_literal  */
-#line 324 "miniJava.y"
+#line 336 "miniJava.y"
     { (yyval.expression_node) = create_literal_expression_node((yyvsp[0].literal_node), (yylsp[0]).first_line); }
-#line 1747 "miniJava.tab.c"
+#line 1756 "miniJava.tab.c"
     break;
 
   case 59: /* primary_expression: string_literal  */
-#line 326 "miniJava.y"
+#line 338 "miniJava.y"
     { (yyval.expression_node) = create_literal_expression_node((yyvsp[0].literal_node), (yylsp[0]).first_line); }
-#line 1753 "miniJava.tab.c"
+#line 1762 "miniJava.tab.c"
     break;
 
   case 60: /* primary_expression: TOKEN_TRUE  */
-#line 328 "miniJava.y"
+#line 340 "miniJava.y"
     { (yyval.expression_node) = create_boolean_literal_expression_node(1, (yylsp[0]).first_line); }
-#line 1759 "miniJava.tab.c"
+#line 1768 "miniJava.tab.c"
     break;
 
   case 61: /* primary_expression: TOKEN_FALSE  */
-#line 330 "miniJava.y"
+#line 342 "miniJava.y"
     { (yyval.expression_node) = create_boolean_literal_expression_node(0, (yylsp[0]).first_line); }
-#line 1765 "miniJava.tab.c"
+#line 1774 "miniJava.tab.c"
     break;
 
   case 62: /* primary_expression: identifier  */
-#line 332 "miniJava.y"
+#line 344 "miniJava.y"
     { (yyval.expression_node) = create_identifier_expression_node((yyvsp[0].identifier_node), (yylsp[0]).first_line); }
-#line 1771 "miniJava.tab.c"
+#line 1780 "miniJava.tab.c"
     break;
 
   case 63: /* primary_expression: identifier TOKEN_LBRACKET expression TOKEN_RBRACKET  */
-#line 334 "miniJava.y"
+#line 346 "miniJava.y"
     { (yyval.expression_node) = create_array_access_expression_node((yyvsp[-3].identifier_node), (yyvsp[-1].expression_node), (yylsp[-3]).first_line); }
-#line 1777 "miniJava.tab.c"
+#line 1786 "miniJava.tab.c"
     break;
 
   case 64: /* primary_expression: TOKEN_LPAREN expression TOKEN_RPAREN  */
-#line 336 "miniJava.y"
+#line 348 "miniJava.y"
     { (yyval.expression_node) = (yyvsp[-1].expression_node); }
-#line 1783 "miniJava.tab.c"
+#line 1792 "miniJava.tab.c"
     break;
 
   case 65: /* identifier: TOKEN_ID  */
-#line 341 "miniJava.y"
+#line 353 "miniJava.y"
     {
-        (yyval.identifier_node) = create_identifier_node((yyvsp[0].string_val), (yylsp[0]).first_line);
+        (yyval.identifier_node) = create_identifier_node((yyvsp[0].slice_val), (yylsp[0]).first_line);
     }
-#line 1791 "miniJava.tab.c"
+#line 1800 "miniJava.tab.c"
     break;
 
   case 66: /* integer_literal: TOKEN_INT_LIT  */
-#line 347 "miniJava.y"
+#line 359 "miniJava.y"
                   { (yyval.literal_node) = create_int_literal_node((yyvsp[0].int_val), (yylsp[0]).first_line); }
-#line 1797 "miniJava.tab.c"
+#line 1806 "miniJava.tab.c"
     break;
 
   case 67: /* float_literal: TOKEN_FLOAT_LIT  */
-#line 351 "miniJava.y"
+#line 363 "miniJava.y"
                     { (yyval.literal_node) = create_float_literal_node((yyvsp[0].float_val), (yylsp[0]).first_line); }
-#line 1803 "miniJava.tab.c"
+#line 1812 "miniJava.tab.c"
     break;
 
   case 68: /* char_literal: TOKEN_CHAR_LIT  */
-#line 355 "miniJava.y"
+#line 367 "miniJava.y"
                    { (yyval.literal_node) = create_char_literal_node((yyvsp[0].char_val), (yylsp[0]).first_line); }
-#line 1809 "miniJava.tab.c"
+#line 1818 "miniJava.tab.c"
     break;
 
   case 69: /* string_literal: TOKEN_STRING_LIT  */
-#line 360 "miniJava.y"
+#line 372 "miniJava.y"
     {
-        (yyval.literal_node) = create_string_literal_node((yyvsp[0].string_val), (yylsp[0]).first_line);
+        (yyval.literal_node) = create_string_literal_node((yyvsp[0].slice_val), (yylsp[0]).first_line);
     }
-#line 1817 "miniJava.tab.c"
+#line 1826 "miniJava.tab.c"
     break;
 
 
-#line 1821 "miniJava.tab.c"
+#line 1830 "miniJava.tab.c"
 
       default: break;
     }
@@ -2015,7 +2024,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 365 "miniJava.y"
+#line 377 "miniJava.y"
 
 
 // Standard Bison error reporting function
@@ -2050,7 +2059,7 @@ int main(int argc, char **argv) {
             // Here you would typically call functions for semantic analysis,
             // code generation, printing the AST, etc.
             // For example: print_ast(root_ast_node, 0);
-            // And finally, free the AST: free_ast(root_ast_node);
+            // And finally, free the AST: free_ast();
         } else {
             printf("Parsing successful, but no AST root was created (grammar issue?).\n");
         }
@@ -45,14 +45,15 @@
 extern int yydebug;
 #endif
 /* "%code requires" blocks.  */
-#line 15 "miniJava.y"
+#line 22 "miniJava.y"
 
     // This code is inserted near the top of the generated C file,
     // before YYSTYPE (the union) is defined. Ideal for #includes that define
     // types used in the %union.
     #include "ast.h" // Must define all AST node types, ProgramNode, and ParsedClassContents
+    #include "arena.h" // Parser-side allocations go to ast_arena with the nodes
 
-#line 56 "miniJava.tab.h"
+#line 57 "miniJava.tab.h"
 
 /* Token kinds.  */
 #ifndef YYTOKENTYPE
@@ -115,12 +116,12 @@ extern int yydebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 24 "miniJava.y"
+#line 32 "miniJava.y"
 
     int int_val;
     float float_val;
     char char_val;
-    char *string_val; // Assumed to be dynamically allocated (e.g., strdup) by lexer
+    SourceSlice slice_val; // Identifier or string literal text, as a slice of the source buffer
 
     // AST Node Pointers
     struct ProgramNode *program_node;
@@ -128,6 +129,7 @@ union YYSTYPE
     struct MainMethodNode *main_method_node;
     struct StatementNode *statement_node;           // Generic statement
     struct StatementListNode *statement_list_node;
+    StatementListBuilder statement_list_builder;    // 'statements' while it is being appended to
     struct VariableDeclarationNode *var_decl_node;
     struct VariableDeclarationListNode *var_decl_list_node;
     struct AssignmentNode *assignment_node;
@@ -144,7 +146,7 @@ union YYSTYPE
     // Temporary structure for parsing class body
     ParsedClassContents *parsed_class_contents_ptr;
 
-#line 148 "miniJava.tab.h"
+#line 150 "miniJava.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
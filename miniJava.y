@@ -4,12 +4,19 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "stats.h" // Token count for --stats
 
 // Externs for Flex variables that Bison needs to know about.
 // yylex() is declared later. yyerror() is defined at the bottom.
 extern int yylineno;
 extern char *yytext;
 extern FILE *yyin;
+
+// Statement lists are left-recursive and no longer grow the parser stack, but
+// deeply nested expressions (parentheses, unary chains) still do. Bison's
+// default limit of 10000 entries is far too small for generated sources; the
+// stack is grown on demand, so a large limit costs nothing for normal input.
+#define YYMAXDEPTH 10000000
 %}
 
 %code requires {
@@ -17,6 +24,7 @@ extern FILE *yyin;
     // before YYSTYPE (the union) is defined. Ideal for #includes that define
     // types used in the %union.
     #include "ast.h" // Must define all AST node types, ProgramNode, and ParsedClassContents
+    #include "arena.h" // Parser-side allocations go to ast_arena with the nodes
 }
 
 // The %union block defines the types that can be associated with grammar symbols.
@@ -25,7 +33,7 @@ extern FILE *yyin;
     int int_val;
     float float_val;
     char char_val;
-    char *string_val; // Assumed to be dynamically allocated (e.g., strdup) by lexer
+    SourceSlice slice_val; // Identifier or string literal text, as a slice of the source buffer
 
     // AST Node Pointers
     struct ProgramNode *program_node;
@@ -33,6 +41,7 @@ extern FILE *yyin;
     struct MainMethodNode *main_method_node;
     struct StatementNode *statement_node;           // Generic statement
     struct StatementListNode *statement_list_node;
+    StatementListBuilder statement_list_builder;    // 'statements' while it is being appended to
     struct VariableDeclarationNode *var_decl_node;
     struct VariableDeclarationListNode *var_decl_list_node;
     struct AssignmentNode *assignment_node;
@@ -60,14 +69,22 @@ extern FILE *yyin;
     // yyerror() is defined at the bottom of this file.
     extern int yylex(void);
     void yyerror(const char *s);
+
+    // The parser pulls every token through here so --stats can count them.
+    static int yylex_counted(void)
+    {
+        STATS_INC(STAT_TOKENS);
+        return yylex();
+    }
+    #define yylex yylex_counted
 %}
 
 // TOKEN DEFINITIONS
 %token <int_val> TOKEN_INT_LIT
 %token <float_val> TOKEN_FLOAT_LIT
 %token <char_val> TOKEN_CHAR_LIT
-%token <string_val> TOKEN_STRING_LIT
-%token <string_val> TOKEN_ID
+%token <slice_val> TOKEN_STRING_LIT
+%token <slice_val> TOKEN_ID
 
 %token TOKEN_CLASS TOKEN_PUBLIC TOKEN_STATIC TOKEN_VOID
 %token TOKEN_INT TOKEN_CHAR TOKEN_BOOLEAN TOKEN_IF
@@ -88,7 +105,7 @@ extern FILE *yyin;
 %type <main_method_node> main_method_declaration
 %type <parsed_class_contents_ptr> class_body_items
 
-%type <statement_list_node> statements
+%type <statement_list_builder> statements
 %type <statement_node> statement
 
 %type <var_decl_node> variable_declaration
@@ -131,11 +148,7 @@ program:
 class_body_items:
     /* empty */
     {
-        $$ = (ParsedClassContents*)calloc(1, sizeof(ParsedClassContents));
-        if (!$$) {
-            yyerror("Memory allocation failed for class contents collector");
-            YYABORT;
-        }
+        $$ = (ParsedClassContents*)arena_calloc(&ast_arena, sizeof(ParsedClassContents));
         $$->main_method = NULL;
         $$->var_decls = NULL;
     }
@@ -171,7 +184,6 @@ class_declaration:
             $4->var_decls,
             @1.first_line
         );
-        free($4);
     }
 ;
 
@@ -188,9 +200,9 @@ main_method_declaration:
 
 statements:
     /* Empty */
-    { $$ = NULL; }
-|   statement statements
-    { $$ = create_statement_list_node($1, $2); }
+    { $$.head = NULL; $$.tail = NULL; }
+|   statements statement
+    { $$ = $1; append_statement_to_list(&$$, $2); }
 ;
 
 statement:
@@ -212,7 +224,7 @@ statement:
 
 block_statement_core:
     TOKEN_LBRACE statements TOKEN_RBRACE
-    { $$ = create_block_node($2, @1.first_line); }
+    { $$ = create_block_node($2.head, @1.first_line); }
 ;
 
 variable_declaration:
@@ -396,7 +408,7 @@ int main(int argc, char **argv) {
             // Here you would typically call functions for semantic analysis,
             // code generation, printing the AST, etc.
             // For example: print_ast(root_ast_node, 0);
-            // And finally, free the AST: free_ast(root_ast_node);
+            // And finally, free the AST: free_ast();
         } else {
             printf("Parsing successful, but no AST root was created (grammar issue?).\n");
         }
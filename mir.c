@@ -0,0 +1,198 @@
+// mir.c
+#include "mir.h"
+#include <stdlib.h>
+
+// Block index of each label atom while blocks are built, -1 elsewhere. Kept
+// between functions and grown with the intern table.
+static int *label_blocks = NULL;
+static uint32_t label_block_capacity = 0;
+
+static void *grow_array(void *array, int *capacity, int needed, size_t element_size)
+{
+    if (needed <= *capacity)
+        return array;
+    int new_capacity = *capacity ? *capacity : 256;
+    while (new_capacity < needed)
+        new_capacity *= 2;
+    array = realloc(array, (size_t)new_capacity * element_size);
+    if (!array)
+    {
+        fprintf(stderr, "Fatal: out of memory for machine code\n");
+        exit(EXIT_FAILURE);
+    }
+    *capacity = new_capacity;
+    return array;
+}
+
+void mir_append(MirFunction *function, const X86Instr *instr)
+{
+    function->instrs = (X86Instr *)grow_array(function->instrs, &function->capacity, function->count + 1,
+                                              sizeof(X86Instr));
+    function->instrs[function->count++] = *instr;
+}
+
+void mir_reset(MirFunction *function)
+{
+    function->count = 0;
+    function->block_count = 0;
+}
+
+void free_mir(MirFunction *function)
+{
+    free(function->instrs);
+    free(function->blocks);
+    function->instrs = NULL;
+    function->blocks = NULL;
+    function->count = function->capacity = 0;
+    function->block_count = function->block_capacity = 0;
+    free(label_blocks);
+    label_blocks = NULL;
+    label_block_capacity = 0;
+}
+
+static int ends_block(const X86Instr *instr)
+{
+    return instr->opcode == X86_JMP || instr->opcode == X86_JCC || instr->opcode == X86_RET;
+}
+
+// Block that the label starts, -1 if it is not defined in this function
+static int label_block(Atom label)
+{
+    return label < label_block_capacity ? label_blocks[label] : -1;
+}
+
+void mir_build_blocks(MirFunction *function)
+{
+    uint32_t atoms = intern_count() + 1;
+    if (atoms > label_block_capacity)
+    {
+        label_blocks = (int *)realloc(label_blocks, atoms * sizeof(int));
+        if (!label_blocks)
+        {
+            fprintf(stderr, "Fatal: out of memory for machine code\n");
+            exit(EXIT_FAILURE);
+        }
+        for (uint32_t i = label_block_capacity; i < atoms; i++)
+            label_blocks[i] = -1;
+        label_block_capacity = atoms;
+    }
+
+    function->block_count = 0;
+    for (int i = 0; i < function->count;)
+    {
+        function->blocks = (MirBlock *)grow_array(function->blocks, &function->block_capacity,
+                                                  function->block_count + 1, sizeof(MirBlock));
+        MirBlock *block = &function->blocks[function->block_count];
+        block->first = i;
+        // Labels (and the comments around them) at the top belong to this
+        // block; the next label ends it
+        while (i < function->count &&
+               (function->instrs[i].opcode == X86_LABEL || function->instrs[i].opcode == X86_COMMENT))
+        {
+            if (function->instrs[i].opcode == X86_LABEL)
+                label_blocks[function->instrs[i].dst.symbol] = function->block_count;
+            i++;
+        }
+        while (i < function->count && function->instrs[i].opcode != X86_LABEL)
+            if (ends_block(&function->instrs[i++]))
+                break;
+        block->end = i;
+        function->block_count++;
+    }
+
+    for (int b = 0; b < function->block_count; b++)
+    {
+        MirBlock *block = &function->blocks[b];
+        const X86Instr *last = block->end > block->first ? &function->instrs[block->end - 1] : NULL;
+        int falls_through = b + 1 < function->block_count;
+        block->succ_count = 0;
+        if (last && last->opcode == X86_JMP)
+        {
+            falls_through = 0;
+            int target = label_block(last->dst.symbol);
+            if (target >= 0)
+                block->succs[block->succ_count++] = target;
+        }
+        else if (last && last->opcode == X86_RET)
+            falls_through = 0;
+        if (falls_through)
+            block->succs[block->succ_count++] = b + 1;
+        if (last && last->opcode == X86_JCC)
+        {
+            int target = label_block(last->dst.symbol);
+            if (target >= 0)
+                block->succs[block->succ_count++] = target;
+        }
+    }
+
+    // Leave the table clean for the next function
+    for (int i = 0; i < function->count; i++)
+        if (function->instrs[i].opcode == X86_LABEL)
+            label_blocks[function->instrs[i].dst.symbol] = -1;
+}
+
+static void assign_register(int32_t *reg, const RegAllocation *regs)
+{
+    if (!X86_IS_VREG(*reg))
+        return;
+    uint32_t value = (uint32_t)(*reg - X86_FIRST_VREG);
+    if (value >= regs->value_count || regs->reg[value] == X86_NO_REG)
+    {
+        fprintf(stderr, "Fatal: virtual register v%u has no register\n", value);
+        exit(EXIT_FAILURE);
+    }
+    *reg = regs->reg[value];
+}
+
+static void assign_operand(X86Operand *operand, const RegAllocation *regs)
+{
+    switch ((X86OperandKind)operand->kind)
+    {
+    case X86_OPERAND_REG:
+    case X86_OPERAND_MEM:
+    case X86_OPERAND_ADDR:
+        assign_register(&operand->reg, regs);
+        assign_register(&operand->index, regs);
+        operand->assigned = X86_NO_REG;
+        break;
+    default:
+        break;
+    }
+}
+
+void mir_assign_registers(MirFunction *function, const RegAllocation *regs)
+{
+    int kept = 0;
+    for (int i = 0; i < function->count; i++)
+    {
+        X86Instr *instr = &function->instrs[i];
+        assign_operand(&instr->dst, regs);
+        assign_operand(&instr->src, regs);
+        // A copy between two values that share a register
+        if (instr->opcode == X86_MOV && instr->dst.kind == X86_OPERAND_REG && instr->src.kind == X86_OPERAND_REG &&
+            instr->dst.reg == instr->src.reg && instr->dst.size == instr->src.size)
+            continue;
+        function->instrs[kept++] = *instr;
+    }
+    function->count = kept;
+    function->block_count = 0; // Positions moved
+}
+
+void mir_dump(const MirFunction *function, FILE *out)
+{
+    for (int b = 0; b < function->block_count; b++)
+    {
+        const MirBlock *block = &function->blocks[b];
+        fprintf(out, "  block %d:", b);
+        if (block->succ_count == 0)
+            fprintf(out, " (exit)");
+        else
+            fprintf(out, " ->");
+        for (int s = 0; s < block->succ_count; s++)
+            fprintf(out, " %d", block->succs[s]);
+        fprintf(out, "\n");
+        for (int i = block->first; i < block->end; i++)
+            if (function->instrs[i].opcode != X86_COMMENT)
+                x86_print_instr(out, &function->instrs[i]);
+    }
+}
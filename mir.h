@@ -0,0 +1,70 @@
+// mir.h
+#ifndef MIR_H
+#define MIR_H
+
+#include "x86.h"
+#include "regalloc.h"
+#include <stdio.h>
+
+// Machine IR: the x86 instructions selected for one function, before they
+// are printed as NASM text. Operands name physical registers, virtual
+// registers (X86_FIRST_VREG + value index, one per TAC temp or variable the
+// allocator put in a register) and frame slots. Labels and the TAC comments
+// of the listing are pseudo-instructions (X86_LABEL, X86_COMMENT), so the
+// printer writes the instructions in order and passes that run on the
+// machine code see exactly what will be printed.
+//
+// mir_build_blocks() splits the code into basic blocks at labels and after
+// jumps and returns, and links each block to its successors. Virtual
+// registers are replaced by the registers regalloc_function() chose with
+// mir_assign_registers().
+//
+// The instruction and block arrays are reused from one function to the
+// next and freed by free_mir().
+
+// A straight-line run of instructions: instrs[first .. end). A label can
+// only start a block; a jump or return can only end one.
+typedef struct MirBlock
+{
+    int first;
+    int end;
+
+    // succs[0] is where control goes when the last instruction does not jump
+    // (fall-through), or the target of a jmp. succs[1] is the target of a
+    // taken jcc. A block ending in ret, and the last block, have none.
+    int succs[2];
+    int succ_count;
+} MirBlock;
+
+typedef struct MirFunction
+{
+    X86Instr *instrs;
+    int count;
+    int capacity;
+    MirBlock *blocks; // Set by mir_build_blocks()
+    int block_count;
+    int block_capacity;
+} MirFunction;
+
+// Appends an instruction (or pseudo-instruction) to the function's code
+void mir_append(MirFunction *function, const X86Instr *instr);
+
+// Empties the function for the next one; the arrays are kept
+void mir_reset(MirFunction *function);
+
+// Frees the arrays of a function
+void free_mir(MirFunction *function);
+
+// Splits the function into blocks and computes their successors. A jump to
+// a label outside the function (a call target, exit) is not an edge.
+void mir_build_blocks(MirFunction *function);
+
+// Replaces every virtual register by the register 'regs' holds its value
+// in, then deletes the moves that became "mov r, r".
+void mir_assign_registers(MirFunction *function, const RegAllocation *regs);
+
+// Writes the blocks and their successors with one instruction per line
+// (--trace=asm:3). TAC comments are left out.
+void mir_dump(const MirFunction *function, FILE *out);
+
+#endif // MIR_H
@@ -0,0 +1,93 @@
+// optimizer.c
+#include "optimizer.h"
+#include "cfg.h"
+#include "ssa.h"
+#include "constprop.h"
+#include "copyprop.h"
+#include "dce.h"
+#include "lvn.h"
+#include "licm.h"
+#include "ivopt.h"
+#include "tac.h"
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs one pass; --trace=opt:2 shows the function after each of them.
+static void run_pass(Cfg *cfg, void (*pass)(Cfg *), const char *title)
+{
+    pass(cfg);
+    if (TRACE_ENABLED(TRACE_OPT, 2))
+        cfg_print(stdout, cfg, title);
+}
+
+// Runs the passes enabled at 'level' on one function in SSA form.
+static void optimize_function(Cfg *cfg, int level)
+{
+    ssa_construct(cfg);
+    if (TRACE_ENABLED(TRACE_OPT, 1))
+        cfg_print(stdout, cfg, "SSA form");
+
+    run_pass(cfg, constprop_run, "After constant propagation");
+    run_pass(cfg, copyprop_run, "After copy propagation");
+    run_pass(cfg, lvn_run, "After local value numbering");
+    // Value numbering exposes new constants and copies
+    run_pass(cfg, constprop_run, "After constant propagation");
+    run_pass(cfg, copyprop_run, "After copy propagation");
+    run_pass(cfg, dce_run, "After dead code elimination");
+
+    // -O2: loop optimizations
+    if (level >= 2)
+    {
+        run_pass(cfg, licm_run, "After loop-invariant code motion");
+        run_pass(cfg, ivopt_run, "After induction variable optimization");
+        // Fold the start values, forward the reduced variables and drop the
+        // counters nothing reads any more
+        run_pass(cfg, constprop_run, "After constant propagation");
+        run_pass(cfg, copyprop_run, "After copy propagation");
+        run_pass(cfg, dce_run, "After dead code elimination");
+    }
+
+    run_pass(cfg, ssa_destruct, "After SSA destruction");
+}
+
+void optimize_tac(int level)
+{
+    if (level <= 0 || tac_program.count == 0)
+        return;
+
+    // The functions are rebuilt into tac_program, so work from a copy of the
+    // original instructions. Anything outside a function is copied through.
+    int count = tac_program.count;
+    TacInstruction *original = (TacInstruction *)malloc((size_t)count * sizeof(TacInstruction));
+    if (!original)
+    {
+        fprintf(stderr, "Fatal: Memory allocation failed for optimizer input.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(original, tac_program.instrs, (size_t)count * sizeof(TacInstruction));
+
+    TacProgram source = tac_program;
+    source.instrs = original;
+    tac_program.count = 0;
+    for (int l = 0; l < tac_program.label_count; l++)
+        tac_program.labels[l].position = -1;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (original[i].opcode == TAC_FUNCTION_BEGIN)
+        {
+            Cfg *cfg = cfg_build(&source, i, &i);
+            optimize_function(cfg, level);
+            cfg_emit_tac(cfg);
+            free_cfgs();
+        }
+        else
+        {
+            const TacInstruction *instr = &original[i];
+            emit_tac(instr->opcode, instr->result, instr->op1, instr->op2, instr->line_number);
+        }
+    }
+    free(original);
+}
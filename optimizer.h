@@ -0,0 +1,11 @@
+// optimizer.h
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+// Optimizes tac_program in place at the given level (the -O<n> option).
+// Level 0 leaves the TAC exactly as the IR generator produced it. From level
+// 1 on, each function is turned into a CFG in SSA form, optimized, taken out
+// of SSA form and written back, so the code generator sees plain TAC again.
+void optimize_tac(int level);
+
+#endif // OPTIMIZER_H
@@ -0,0 +1,944 @@
+// peephole.c
+#include "peephole.h"
+#include "arena.h"
+#include "stats.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Liveness sets: bit r for register r, then one bit for the flags
+#define REG_BIT(reg) (1u << (reg))
+#define FLAGS_BIT (1u << X86_REG_COUNT)
+#define ALL_REGS ((1u << X86_REG_COUNT) - 1)
+#define FRAME_REGS (REG_BIT(X86_ESP) | REG_BIT(X86_EBP)) // Never rewritten, always live
+
+// Real instructions a store is forwarded across
+#define FORWARD_WINDOW 32
+// Jumps followed when threading a jump through jmp-only blocks
+#define THREAD_MAX_HOPS 8
+// Rounds of rewrites before giving up on reaching a fixed point
+#define MAX_ROUNDS 4
+
+// State of the function being optimized
+static MirFunction *fn;
+static uint16_t *live_after; // Registers and flags live after each instruction
+static uint8_t *removed;     // Instructions deleted in this round
+static int changed;
+
+typedef struct Effects
+{
+    unsigned uses;  // Read before the instruction writes anything
+    unsigned defs;  // Written, in full or in part
+    unsigned kills; // Written in full: the previous value is dead
+} Effects;
+
+static int is_pseudo(const X86Instr *instr)
+{
+    return instr->opcode == X86_LABEL || instr->opcode == X86_COMMENT;
+}
+
+static int is_reg(const X86Operand *operand, int size)
+{
+    return operand->kind == X86_OPERAND_REG && operand->size == size;
+}
+
+// A dword register other than esp and ebp
+static int is_plain_reg(const X86Operand *operand)
+{
+    return is_reg(operand, 4) && !(REG_BIT(operand->reg) & FRAME_REGS);
+}
+
+static int is_imm(const X86Operand *operand, int32_t value)
+{
+    return operand->kind == X86_OPERAND_IMM && operand->disp == value;
+}
+
+// [ebp + disp]
+static int is_frame_slot(const X86Operand *operand)
+{
+    return operand->kind == X86_OPERAND_MEM && operand->reg == X86_EBP && operand->index == X86_NO_REG;
+}
+
+static int same_slot(const X86Operand *a, const X86Operand *b)
+{
+    return is_frame_slot(a) && is_frame_slot(b) && a->disp == b->disp && a->size == b->size;
+}
+
+static int slots_overlap(const X86Operand *a, const X86Operand *b)
+{
+    return a->disp < b->disp + b->size && b->disp < a->disp + a->size;
+}
+
+static int is_self_move(const X86Instr *instr)
+{
+    return instr->opcode == X86_MOV && is_reg(&instr->dst, 4) && is_reg(&instr->src, 4) &&
+           instr->dst.reg == instr->src.reg;
+}
+
+// Registers an operand reads: the register itself, or those of an address
+static unsigned operand_regs(const X86Operand *operand)
+{
+    unsigned regs = 0;
+    switch ((X86OperandKind)operand->kind)
+    {
+    case X86_OPERAND_REG:
+        return REG_BIT(operand->reg);
+    case X86_OPERAND_MEM:
+    case X86_OPERAND_ADDR:
+        if (operand->reg != X86_NO_REG)
+            regs |= REG_BIT(operand->reg);
+        if (operand->index != X86_NO_REG)
+            regs |= REG_BIT(operand->index);
+        return regs;
+    default:
+        return 0;
+    }
+}
+
+// "xor r, r" only writes r
+static int is_zero_idiom(const X86Instr *instr)
+{
+    return instr->opcode == X86_XOR && is_reg(&instr->dst, 4) && is_reg(&instr->src, 4) &&
+           instr->dst.reg == instr->src.reg;
+}
+
+// Whether the instruction reads its dst operand (besides its address)
+static int reads_dst(const X86Instr *instr)
+{
+    switch ((X86Opcode)instr->opcode)
+    {
+    case X86_ADD:
+    case X86_SUB:
+    case X86_AND:
+    case X86_OR:
+    case X86_XOR:
+        return !is_zero_idiom(instr);
+    case X86_IMUL:
+        return !instr->has_multiplier;
+    case X86_NEG:
+    case X86_INC:
+    case X86_DEC:
+    case X86_CMP:
+    case X86_TEST:
+    case X86_PUSH:
+    case X86_IDIV:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Whether the instruction writes its dst operand
+static int writes_dst(const X86Instr *instr)
+{
+    switch ((X86Opcode)instr->opcode)
+    {
+    case X86_MOV:
+    case X86_MOVZX:
+    case X86_LEA:
+    case X86_ADD:
+    case X86_SUB:
+    case X86_IMUL:
+    case X86_AND:
+    case X86_OR:
+    case X86_XOR:
+    case X86_NEG:
+    case X86_INC:
+    case X86_DEC:
+    case X86_SETCC:
+    case X86_POP:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int writes_flags(const X86Instr *instr)
+{
+    switch ((X86Opcode)instr->opcode)
+    {
+    case X86_ADD:
+    case X86_SUB:
+    case X86_IMUL:
+    case X86_AND:
+    case X86_OR:
+    case X86_XOR:
+    case X86_NEG:
+    case X86_INC:
+    case X86_DEC:
+    case X86_CMP:
+    case X86_TEST:
+    case X86_IDIV:
+    case X86_CALL:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Registers read or written without being named as operands. A call may
+// clobber eax, ecx and edx (cdecl); ret hands every register back.
+static Effects implicit_effects(const X86Instr *instr)
+{
+    Effects effects = {0, 0, 0};
+    switch ((X86Opcode)instr->opcode)
+    {
+    case X86_CDQ:
+        effects.uses = REG_BIT(X86_EAX);
+        effects.defs = effects.kills = REG_BIT(X86_EDX);
+        break;
+    case X86_IDIV:
+        effects.uses = REG_BIT(X86_EAX) | REG_BIT(X86_EDX);
+        effects.defs = effects.kills = REG_BIT(X86_EAX) | REG_BIT(X86_EDX);
+        break;
+    case X86_CALL:
+        effects.defs = effects.kills = REG_BIT(X86_EAX) | REG_BIT(X86_ECX) | REG_BIT(X86_EDX);
+        break;
+    case X86_RET:
+        effects.uses = ALL_REGS;
+        break;
+    case X86_SETCC:
+    case X86_JCC:
+        effects.uses = FLAGS_BIT;
+        break;
+    default:
+        break;
+    }
+    return effects;
+}
+
+static Effects instr_effects(const X86Instr *instr)
+{
+    Effects effects = implicit_effects(instr);
+    if (is_pseudo(instr))
+        return effects;
+    effects.uses |= operand_regs(&instr->src);
+    if (instr->dst.kind == X86_OPERAND_REG)
+    {
+        unsigned reg = REG_BIT(instr->dst.reg);
+        if (reads_dst(instr))
+            effects.uses |= reg;
+        if (writes_dst(instr))
+        {
+            effects.defs |= reg;
+            if (instr->dst.size == 4)
+                effects.kills |= reg;
+            else
+                effects.uses |= reg; // A byte write keeps the rest of the register
+        }
+    }
+    else
+        effects.uses |= operand_regs(&instr->dst);
+    if (writes_flags(instr))
+        effects.defs |= FLAGS_BIT, effects.kills |= FLAGS_BIT;
+    return effects;
+}
+
+// Next instruction of the block after 'i' that emits code, -1 if none
+static int next_real(int i, int end)
+{
+    for (i++; i < end; i++)
+        if (!removed[i] && !is_pseudo(&fn->instrs[i]))
+            return i;
+    return -1;
+}
+
+static int prev_real(int i, int first)
+{
+    for (i--; i >= first; i--)
+        if (!removed[i] && !is_pseudo(&fn->instrs[i]))
+            return i;
+    return -1;
+}
+
+static void remove_instr(int i)
+{
+    removed[i] = 1;
+    changed = 1;
+}
+
+// Drops the deleted instructions from the function
+static void compact(void)
+{
+    int kept = 0;
+    for (int i = 0; i < fn->count; i++)
+        if (!removed[i])
+            fn->instrs[kept++] = fn->instrs[i];
+    fn->count = kept;
+    fn->block_count = 0;
+}
+
+// --- Liveness ---
+
+// Live registers and flags where a block leaves the function or jumps to a
+// label this function does not define: everything, as far as we know
+static unsigned block_exit_live(const MirBlock *block)
+{
+    const X86Instr *last = block->end > block->first ? &fn->instrs[block->end - 1] : NULL;
+    int expected = 1;
+    if (last && last->opcode == X86_RET)
+        return ALL_REGS;
+    if (last && last->opcode == X86_JCC)
+        expected = 2;
+    return block->succ_count < expected ? ALL_REGS | FLAGS_BIT : 0;
+}
+
+static unsigned block_transfer(const MirBlock *block, unsigned live, int record)
+{
+    for (int i = block->end - 1; i >= block->first; i--)
+    {
+        if (removed[i])
+            continue;
+        if (record)
+            live_after[i] = (uint16_t)(live | FRAME_REGS);
+        Effects effects = instr_effects(&fn->instrs[i]);
+        live = (live & ~effects.kills) | effects.uses;
+    }
+    return live;
+}
+
+static void compute_liveness(void)
+{
+    unsigned *live_in = (unsigned *)arena_calloc(&codegen_arena, (size_t)fn->block_count * sizeof(unsigned));
+    int iterate = 1;
+    while (iterate)
+    {
+        iterate = 0;
+        for (int b = fn->block_count - 1; b >= 0; b--)
+        {
+            const MirBlock *block = &fn->blocks[b];
+            unsigned live = block_exit_live(block);
+            for (int s = 0; s < block->succ_count; s++)
+                live |= live_in[block->succs[s]];
+            live = block_transfer(block, live, 0);
+            if (live != live_in[b])
+            {
+                live_in[b] = live;
+                iterate = 1;
+            }
+        }
+    }
+    for (int b = 0; b < fn->block_count; b++)
+    {
+        const MirBlock *block = &fn->blocks[b];
+        unsigned live = block_exit_live(block);
+        for (int s = 0; s < block->succ_count; s++)
+            live |= live_in[block->succs[s]];
+        block_transfer(block, live, 1);
+    }
+}
+
+static int live_after_instr(int i, unsigned bits)
+{
+    return (live_after[i] & bits) != 0;
+}
+
+// --- Jumps ---
+
+// The first real instruction of a block, -1 if it has none
+static int block_head(int b)
+{
+    const MirBlock *block = &fn->blocks[b];
+    return next_real(block->first - 1, block->end);
+}
+
+// Only labels and comments before a jmp: jumping here is jumping there
+static int is_jump_only(int b)
+{
+    int head = block_head(b);
+    return head >= 0 && fn->instrs[head].opcode == X86_JMP;
+}
+
+static int has_label(int b)
+{
+    const MirBlock *block = &fn->blocks[b];
+    for (int i = block->first; i < block->end; i++)
+        if (fn->instrs[i].opcode == X86_LABEL)
+            return 1;
+    return 0;
+}
+
+// A jump into a block holding only "jmp L" goes to L directly
+static void thread_jump(X86Instr *jump, int target)
+{
+    int hops = 0;
+    while (target >= 0 && hops < THREAD_MAX_HOPS && is_jump_only(target))
+    {
+        const MirBlock *block = &fn->blocks[target];
+        const X86Instr *next = &fn->instrs[block_head(target)];
+        if (next->dst.symbol == jump->dst.symbol)
+            break; // An empty loop
+        jump->dst = next->dst;
+        target = block->succ_count ? block->succs[0] : -1;
+        hops++;
+    }
+    if (hops)
+    {
+        changed = 1;
+        STATS_INC(STAT_PEEPHOLE_JUMPS);
+    }
+}
+
+static void rewrite_jumps(void)
+{
+    for (int b = 0; b < fn->block_count; b++)
+    {
+        const MirBlock *block = &fn->blocks[b];
+        int last_index = block->end - 1;
+        if (last_index < block->first || removed[last_index])
+            continue;
+        X86Instr *last = &fn->instrs[last_index];
+        if (last->opcode == X86_JMP && block->succ_count == 1)
+        {
+            if (block->succs[0] == b + 1)
+            {
+                remove_instr(last_index); // Falls through anyway
+                STATS_INC(STAT_PEEPHOLE_JUMPS);
+                continue;
+            }
+            thread_jump(last, block->succs[0]);
+        }
+        else if (last->opcode == X86_JCC && block->succ_count == 2)
+        {
+            if (block->succs[1] == b + 1)
+            {
+                remove_instr(last_index);
+                STATS_INC(STAT_PEEPHOLE_JUMPS);
+                continue;
+            }
+            // jcc L1; jmp L2; L1:  ->  j!cc L2; L1:
+            int skipped = b + 1;
+            if (block->succs[1] == b + 2 && is_jump_only(skipped) && !has_label(skipped))
+            {
+                int jump = block_head(skipped);
+                last->cond = (uint8_t)x86_cond_negate((X86Cond)last->cond);
+                last->dst = fn->instrs[jump].dst;
+                remove_instr(jump);
+                STATS_INC(STAT_PEEPHOLE_JUMPS);
+                continue;
+            }
+            thread_jump(last, block->succs[1]);
+        }
+    }
+}
+
+// --- Store-to-load forwarding ---
+
+// Whether 'value' (a register or an immediate) can stand in for the frame
+// slot operand 'which' (0: dst, 1: src) of 'instr'
+static int can_replace_slot(const X86Instr *instr, int which, const X86Operand *value)
+{
+    int is_value_reg = value->kind == X86_OPERAND_REG;
+    if (which == 1)
+    {
+        switch ((X86Opcode)instr->opcode)
+        {
+        case X86_MOVZX:
+            return 1; // By a byte register, or a mov of the immediate
+        case X86_IMUL:
+            return is_value_reg;
+        case X86_MOV:
+        case X86_ADD:
+        case X86_SUB:
+        case X86_AND:
+        case X86_OR:
+        case X86_XOR:
+        case X86_CMP:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+    switch ((X86Opcode)instr->opcode)
+    {
+    case X86_PUSH:
+        return value->kind == X86_OPERAND_IMM || value->size == 4;
+    case X86_CMP:
+    case X86_TEST:
+        return is_value_reg;
+    default:
+        return 0;
+    }
+}
+
+static void replace_slot(X86Instr *instr, int which, const X86Operand *value)
+{
+    if (which == 0)
+    {
+        instr->dst = *value;
+        return;
+    }
+    if (instr->opcode == X86_MOVZX && value->kind == X86_OPERAND_IMM)
+    {
+        instr->opcode = X86_MOV;
+        instr->src = x86_imm_operand(value->disp & 0xFF);
+        return;
+    }
+    instr->src = *value;
+}
+
+// "mov [ebp+d], value" at 'store': the loads of [ebp+d] that follow read
+// 'value' instead, until the slot or the register is written
+static void forward_store(int store, int end)
+{
+    const X86Instr *instr = &fn->instrs[store];
+    X86Operand slot = instr->dst;
+    X86Operand value = instr->src;
+    unsigned value_regs = operand_regs(&value);
+    int steps = 0;
+    for (int k = next_real(store, end); k >= 0 && steps < FORWARD_WINDOW; k = next_real(k, end), steps++)
+    {
+        X86Instr *use = &fn->instrs[k];
+        int which = -1;
+        if (same_slot(&use->src, &slot))
+            which = 1;
+        else if (same_slot(&use->dst, &slot) && !writes_dst(use))
+            which = 0;
+        if (which >= 0 && can_replace_slot(use, which, &value))
+        {
+            replace_slot(use, which, &value);
+            STATS_INC(STAT_PEEPHOLE_LOADS_FORWARDED);
+            changed = 1;
+            // The register now lives on to this instruction
+            for (int i = store; i < k; i++)
+                live_after[i] |= (uint16_t)value_regs;
+            if (is_self_move(use))
+            {
+                remove_instr(k);
+                continue;
+            }
+        }
+        if (use->dst.kind == X86_OPERAND_MEM && writes_dst(use) && is_frame_slot(&use->dst) &&
+            slots_overlap(&use->dst, &slot))
+            return;
+        if (instr_effects(use).defs & (value_regs | REG_BIT(X86_EBP)))
+            return;
+    }
+}
+
+// --- Moves ---
+
+static int mem_operand_count(const X86Instr *instr)
+{
+    return (instr->dst.kind == X86_OPERAND_MEM) + (instr->src.kind == X86_OPERAND_MEM);
+}
+
+// Replaces the reads of register 'reg' in 'instr' by 'value'. Returns 0 if
+// one of them cannot take it; 'instr' is then partly rewritten.
+static int substitute_reads(X86Instr *instr, int reg, const X86Operand *value)
+{
+    if (instr->dst.kind == X86_OPERAND_REG && instr->dst.reg == reg && writes_dst(instr) && reads_dst(instr))
+        return 0; // Read and written in place
+    X86Operand *operands[2] = {&instr->dst, &instr->src};
+    for (int n = 0; n < 2; n++)
+    {
+        X86Operand *operand = operands[n];
+        int is_dst = n == 0;
+        if (is_dst && operand->kind == X86_OPERAND_REG && !reads_dst(instr))
+            continue; // Only written
+        if (operand->kind == X86_OPERAND_MEM || operand->kind == X86_OPERAND_ADDR)
+        {
+            if (value->kind != X86_OPERAND_REG)
+            {
+                if (operand->reg == reg || operand->index == reg)
+                    return 0;
+                continue;
+            }
+            if (operand->reg == reg)
+                operand->reg = value->reg;
+            if (operand->index == reg)
+                operand->index = value->reg;
+            continue;
+        }
+        if (operand->kind != X86_OPERAND_REG || operand->reg != reg)
+            continue;
+        if (value->kind == X86_OPERAND_REG)
+        {
+            if (operand->size == 1 && !x86_reg_byte_name((X86Reg)value->reg))
+                return 0;
+            operand->reg = value->reg;
+            continue;
+        }
+        // An immediate or a memory operand goes where an instruction takes one
+        int fits = 0;
+        if (is_dst)
+            fits = instr->opcode == X86_PUSH || (value->kind == X86_OPERAND_MEM && (instr->opcode == X86_CMP ||
+                                                                                  instr->opcode == X86_TEST));
+        else
+        {
+            switch ((X86Opcode)instr->opcode)
+            {
+            case X86_MOV:
+            case X86_ADD:
+            case X86_SUB:
+            case X86_AND:
+            case X86_OR:
+            case X86_XOR:
+            case X86_CMP:
+                fits = 1;
+                break;
+            case X86_IMUL:
+            case X86_TEST:
+                fits = value->kind == X86_OPERAND_MEM;
+                break;
+            default:
+                break;
+            }
+        }
+        if (!fits || (value->kind == X86_OPERAND_MEM && (operand->size != 4 || mem_operand_count(instr) > 0)))
+            return 0;
+        if (value->kind == X86_OPERAND_IMM && operand->size == 1)
+        {
+            // Only a byte store takes it
+            if (instr->dst.kind != X86_OPERAND_MEM || value->disp < 0 || value->disp > 0xFF)
+                return 0;
+        }
+        if (value->kind == X86_OPERAND_IMM && operand->size == 4 && instr->dst.kind == X86_OPERAND_MEM &&
+            instr->dst.size != 4)
+            return 0;
+        *operand = *value;
+        operand->size = value->kind == X86_OPERAND_MEM ? 4 : operand->size;
+    }
+    return 1;
+}
+
+// "mov r1, x" followed by an instruction that reads r1 for the last time:
+// the instruction reads x itself
+static int fold_copy(int i, int j)
+{
+    const X86Instr *copy = &fn->instrs[i];
+    if (copy->opcode != X86_MOV || !is_plain_reg(&copy->dst))
+        return 0;
+    const X86Operand *value = &copy->src;
+    if (value->kind == X86_OPERAND_REG ? !is_plain_reg(value)
+                                       : value->kind != X86_OPERAND_IMM &&
+                                             !(value->kind == X86_OPERAND_MEM && value->size == 4))
+        return 0;
+    unsigned reg_bit = REG_BIT(copy->dst.reg);
+    Effects effects = instr_effects(&fn->instrs[j]);
+    // r1 must die at j, or be redefined there outright
+    if (!(effects.uses & reg_bit) || (effects.defs & reg_bit & ~effects.kills) ||
+        (live_after_instr(j, reg_bit) && !(effects.kills & reg_bit)))
+        return 0;
+    X86Instr rewritten = fn->instrs[j];
+    if (!substitute_reads(&rewritten, copy->dst.reg, value) || (instr_effects(&rewritten).uses & reg_bit))
+        return 0;
+    fn->instrs[j] = rewritten;
+    remove_instr(i);
+    if (is_self_move(&fn->instrs[j]))
+        remove_instr(j);
+    STATS_INC(STAT_PEEPHOLE_MOVES_REMOVED);
+    return 1;
+}
+
+// "mov r1, x; mov r2, r1" (also movzx and lea) with r1 dead after: the first
+// instruction defines r2
+static int fold_definition(int i, int j)
+{
+    X86Instr *def = &fn->instrs[i];
+    const X86Instr *copy = &fn->instrs[j];
+    if (copy->opcode != X86_MOV || !is_plain_reg(&copy->dst) || !is_plain_reg(&copy->src))
+        return 0;
+    if ((def->opcode != X86_MOV && def->opcode != X86_MOVZX && def->opcode != X86_LEA) ||
+        !is_reg(&def->dst, 4) || def->dst.reg != copy->src.reg || live_after_instr(j, REG_BIT(copy->src.reg)))
+        return 0;
+    def->dst.reg = copy->dst.reg;
+    remove_instr(j);
+    if (is_self_move(def))
+        remove_instr(i);
+    STATS_INC(STAT_PEEPHOLE_MOVES_REMOVED);
+    return 1;
+}
+
+// --- movzx ---
+
+// Whether the instruction leaves 'reg' holding a value below 256
+static int zero_extends(const X86Instr *instr, int reg)
+{
+    if (!is_reg(&instr->dst, 4) || instr->dst.reg != reg)
+        return 0;
+    if (instr->opcode == X86_MOVZX || is_zero_idiom(instr))
+        return 1;
+    return instr->opcode == X86_MOV && instr->src.kind == X86_OPERAND_IMM && instr->src.disp >= 0 &&
+           instr->src.disp <= 0xFF;
+}
+
+// Whether 'instr' reads 'reg' only through its low byte and never writes it
+static int reads_low_byte_only(const X86Instr *instr, int reg)
+{
+    Effects effects = instr_effects(instr);
+    if ((effects.defs & REG_BIT(reg)) || (implicit_effects(instr).uses & REG_BIT(reg)))
+        return 0;
+    const X86Operand *operands[2] = {&instr->dst, &instr->src};
+    for (int n = 0; n < 2; n++)
+    {
+        if (operands[n]->kind == X86_OPERAND_REG && operands[n]->reg == reg && operands[n]->size != 1)
+            return 0;
+        if ((operands[n]->kind == X86_OPERAND_MEM || operands[n]->kind == X86_OPERAND_ADDR) &&
+            (operands[n]->reg == reg || operands[n]->index == reg))
+            return 0;
+    }
+    return 1;
+}
+
+// "movzx r, r8" after an instruction that zero-extended r already, or
+// before one that reads r8 alone as r dies
+static int drop_movzx(int i, int first, int end)
+{
+    const X86Instr *instr = &fn->instrs[i];
+    if (instr->opcode != X86_MOVZX || !is_reg(&instr->dst, 4) || !is_reg(&instr->src, 1) ||
+        instr->dst.reg != instr->src.reg)
+        return 0;
+    int reg = instr->dst.reg;
+    int prev = prev_real(i, first);
+    int next = next_real(i, end);
+    if ((prev >= 0 && zero_extends(&fn->instrs[prev], reg)) ||
+        (next >= 0 && reads_low_byte_only(&fn->instrs[next], reg) && !live_after_instr(next, REG_BIT(reg))))
+    {
+        remove_instr(i);
+        STATS_INC(STAT_PEEPHOLE_MOVZX_REMOVED);
+        return 1;
+    }
+    return 0;
+}
+
+// --- Dead stores (-O2) ---
+
+// Frame slots, each a distinct [ebp + disp] of one size, numbered for the
+// liveness bitsets. slot_at[disp - slot_low] is the slot starting there.
+static int *slot_at;
+static int slot_low;
+static int slot_count;
+static int slot_words;
+
+// Numbers the frame slots. Returns 0 if the frame is reached some other way
+// or two slots overlap: then no store can be proven dead.
+static int number_slots(void)
+{
+    int low = 0, high = 0;
+    for (int i = 0; i < fn->count; i++)
+    {
+        const X86Instr *instr = &fn->instrs[i];
+        const X86Operand *operands[2] = {&instr->dst, &instr->src};
+        for (int n = 0; n < 2; n++)
+        {
+            const X86Operand *operand = operands[n];
+            if (operand->kind != X86_OPERAND_MEM && operand->kind != X86_OPERAND_ADDR)
+                continue;
+            if (operand->reg == X86_ESP || operand->index == X86_EBP || operand->index == X86_ESP ||
+                (operand->kind == X86_OPERAND_ADDR && operand->reg == X86_EBP))
+                return 0;
+            if (is_frame_slot(operand))
+            {
+                if (operand->disp < low)
+                    low = operand->disp;
+                if (operand->disp + operand->size > high)
+                    high = operand->disp + operand->size;
+            }
+        }
+    }
+    if (high == low)
+        return 0;
+
+    // owner[byte]: slot covering the byte, -1 if none
+    int *owner = (int *)arena_alloc(&codegen_arena, (size_t)(high - low) * sizeof(int));
+    slot_at = (int *)arena_alloc(&codegen_arena, (size_t)(high - low) * sizeof(int));
+    int *slot_size = (int *)arena_alloc(&codegen_arena, (size_t)(high - low) * sizeof(int));
+    for (int byte = 0; byte < high - low; byte++)
+        owner[byte] = slot_at[byte] = -1;
+    slot_low = low;
+    slot_count = 0;
+    for (int i = 0; i < fn->count; i++)
+    {
+        const X86Instr *instr = &fn->instrs[i];
+        const X86Operand *operands[2] = {&instr->dst, &instr->src};
+        for (int n = 0; n < 2; n++)
+        {
+            const X86Operand *operand = operands[n];
+            if (!is_frame_slot(operand))
+                continue;
+            int start = operand->disp - low;
+            if (slot_at[start] >= 0 && slot_size[slot_at[start]] == operand->size)
+                continue;
+            for (int byte = start; byte < start + operand->size; byte++)
+            {
+                if (owner[byte] >= 0)
+                    return 0;
+                owner[byte] = slot_count;
+            }
+            slot_size[slot_count] = operand->size;
+            slot_at[start] = slot_count++;
+        }
+    }
+    slot_words = (slot_count + 63) / 64;
+    return 1;
+}
+
+static int slot_of(const X86Operand *operand)
+{
+    return is_frame_slot(operand) ? slot_at[operand->disp - slot_low] : -1;
+}
+
+static int slot_live(const uint64_t *live, int slot)
+{
+    return (live[slot / 64] >> (slot % 64)) & 1;
+}
+
+// Steps 'live' back over the instruction: the slot it overwrites is dead
+// before it, the slots it reads are live
+static void slot_transfer(const X86Instr *instr, uint64_t *live)
+{
+    if (is_pseudo(instr))
+        return;
+    int slot = slot_of(&instr->dst);
+    if (slot >= 0 && writes_dst(instr) && !reads_dst(instr))
+        live[slot / 64] &= ~(1ull << (slot % 64));
+    if (slot >= 0 && reads_dst(instr))
+        live[slot / 64] |= 1ull << (slot % 64);
+    slot = slot_of(&instr->src);
+    if (slot >= 0)
+        live[slot / 64] |= 1ull << (slot % 64);
+}
+
+// Slots live where the block ends: none after ret, every one where it jumps
+// out of what this function knows, otherwise those its successors read
+static void slots_live_out(const MirBlock *block, const uint64_t *live_in, uint64_t *live)
+{
+    unsigned exit = block_exit_live(block);
+    for (int w = 0; w < slot_words; w++)
+        live[w] = (exit & FLAGS_BIT) ? ~0ull : 0;
+    for (int s = 0; s < block->succ_count; s++)
+        for (int w = 0; w < slot_words; w++)
+            live[w] |= live_in[(size_t)block->succs[s] * slot_words + w];
+}
+
+// Stores to frame slots that no path reads before the slot is written again
+// or the function returns. Shared slots (regalloc.h) make this a per-slot
+// question: another value may read the slot, just not this one.
+static void remove_dead_stores(void)
+{
+    if (!number_slots())
+        return;
+    uint64_t *live_in = (uint64_t *)arena_calloc(&codegen_arena, (size_t)fn->block_count * slot_words * sizeof(uint64_t));
+    uint64_t *live = (uint64_t *)arena_alloc(&codegen_arena, (size_t)slot_words * sizeof(uint64_t));
+    int iterate = 1;
+    while (iterate)
+    {
+        iterate = 0;
+        for (int b = fn->block_count - 1; b >= 0; b--)
+        {
+            const MirBlock *block = &fn->blocks[b];
+            slots_live_out(block, live_in, live);
+            for (int i = block->end - 1; i >= block->first; i--)
+                slot_transfer(&fn->instrs[i], live);
+            uint64_t *in = &live_in[(size_t)b * slot_words];
+            if (memcmp(in, live, (size_t)slot_words * sizeof(uint64_t)) != 0)
+            {
+                memcpy(in, live, (size_t)slot_words * sizeof(uint64_t));
+                iterate = 1;
+            }
+        }
+    }
+    for (int b = 0; b < fn->block_count; b++)
+    {
+        const MirBlock *block = &fn->blocks[b];
+        slots_live_out(block, live_in, live);
+        for (int i = block->end - 1; i >= block->first; i--)
+        {
+            const X86Instr *instr = &fn->instrs[i];
+            int slot = instr->opcode == X86_MOV ? slot_of(&instr->dst) : -1;
+            if (slot >= 0 && !slot_live(live, slot))
+            {
+                remove_instr(i);
+                STATS_INC(STAT_PEEPHOLE_DEAD_STORES);
+                continue;
+            }
+            slot_transfer(instr, live);
+        }
+    }
+}
+
+// --- Driver ---
+
+static void begin_round(void)
+{
+    removed = (uint8_t *)arena_calloc(&codegen_arena, (size_t)fn->count + 1);
+    mir_build_blocks(fn);
+}
+
+static void rewrite_block(const MirBlock *block)
+{
+    for (int i = next_real(block->first - 1, block->end); i >= 0; i = next_real(i, block->end))
+    {
+        if (removed[i])
+            continue;
+        const X86Instr *instr = &fn->instrs[i];
+        if (instr->opcode == X86_MOV && is_frame_slot(&instr->dst) &&
+            (instr->src.kind == X86_OPERAND_REG || instr->src.kind == X86_OPERAND_IMM))
+            forward_store(i, block->end);
+        if (drop_movzx(i, block->first, block->end))
+            continue;
+        int j = next_real(i, block->end);
+        if (j >= 0 && !fold_copy(i, j))
+            fold_definition(i, j);
+    }
+}
+
+// "cmp r, 0" -> "test r, r" always; "mov r, 0" -> "xor r, r" when nothing
+// reads the flags before they are set again
+static void apply_zero_idioms(void)
+{
+    for (int i = 0; i < fn->count; i++)
+    {
+        X86Instr *instr = &fn->instrs[i];
+        if (instr->opcode == X86_CMP && instr->dst.kind == X86_OPERAND_REG && is_imm(&instr->src, 0))
+        {
+            instr->opcode = X86_TEST;
+            instr->src = instr->dst;
+            STATS_INC(STAT_PEEPHOLE_ZERO_IDIOMS);
+        }
+        else if (instr->opcode == X86_MOV && is_plain_reg(&instr->dst) && is_imm(&instr->src, 0) &&
+                 !live_after_instr(i, FLAGS_BIT))
+        {
+            instr->opcode = X86_XOR;
+            instr->src = instr->dst;
+            STATS_INC(STAT_PEEPHOLE_ZERO_IDIOMS);
+        }
+    }
+}
+
+void peephole_function(MirFunction *function, int level)
+{
+    if (level <= 0 || function->count == 0)
+        return;
+    fn = function;
+
+    for (int round = 0; round < MAX_ROUNDS; round++)
+    {
+        changed = 0;
+        begin_round();
+        rewrite_jumps();
+        compact();
+        if (level >= 2)
+        {
+            begin_round();
+            remove_dead_stores();
+            compact();
+        }
+
+        begin_round();
+        live_after = (uint16_t *)arena_alloc(&codegen_arena, ((size_t)fn->count + 1) * sizeof(uint16_t));
+        compute_liveness();
+        for (int b = 0; b < fn->block_count; b++)
+            rewrite_block(&fn->blocks[b]);
+        compact();
+        if (!changed)
+            break;
+    }
+
+    begin_round();
+    live_after = (uint16_t *)arena_alloc(&codegen_arena, ((size_t)fn->count + 1) * sizeof(uint16_t));
+    compute_liveness();
+    apply_zero_idioms();
+    fn->block_count = 0;
+    fn = NULL;
+}
@@ -0,0 +1,34 @@
+// peephole.h
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include "mir.h"
+
+// Peephole optimization of one function's machine code, run once its
+// virtual registers have been replaced (mir_assign_registers()) and before
+// it is printed. Each rewrite looks at an instruction and the few real
+// instructions after it in the same basic block; register and flag liveness
+// over the function's blocks says which values a rewrite may drop.
+//
+// At level 1 (-O1):
+//   - a load from a frame slot a few instructions after a store to it reads
+//     the stored register or constant instead (store-to-load forwarding)
+//   - "mov r1, x" whose r1 is only read by the next instruction is folded
+//     into it, and "op r1, x; mov r2, r1" defines r2 directly
+//   - "movzx r, r8" is dropped when r is already zero-extended or only its
+//     low byte is read before r dies
+//   - a jump to the next block is deleted, "jcc L1; jmp L2; L1:" becomes a
+//     single inverted jcc, and a jump to a block holding only a jmp goes
+//     straight to that jmp's target
+//   - "cmp r, 0" becomes "test r, r", and "mov r, 0" becomes "xor r, r"
+//     where the flags are dead
+// Level 2 (-O2) also deletes a store to a frame slot that no path reads
+// before the slot is written again or the function returns. Liveness is
+// tracked per slot, because spilled values share slots (regalloc.h). Level 0
+// (-O0, or --no-peephole) leaves the code as selected.
+//
+// Every rewrite is counted in the STAT_PEEPHOLE_* counters. Scratch arrays
+// live in codegen_arena.
+void peephole_function(MirFunction *function, int level);
+
+#endif // PEEPHOLE_H
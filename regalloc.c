@@ -0,0 +1,399 @@
+// regalloc.c
+#include "regalloc.h"
+#include "cfg.h"
+#include "dataflow.h"
+#include "constprop.h"
+#include "arena.h"
+#include "stats.h"
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Registers handed out, in order of preference: ecx first, since using it
+// costs no save and restore in the prologue and epilogue
+static const X86Reg allocatable_regs[] = {X86_ECX, X86_EBX, X86_ESI, X86_EDI};
+#define ALLOCATABLE_COUNT ((int)(sizeof(allocatable_regs) / sizeof(allocatable_regs[0])))
+
+// Live interval of one value, in instruction positions
+typedef struct Interval
+{
+    uint32_t value;
+    int start;
+    int end;
+    double cost;  // Spill cost per position covered, negative when rematerializable
+    int no_ecx;   // Something inside the interval clobbers ecx
+} Interval;
+
+// Per-value facts gathered in one walk over the function
+typedef struct ValueInfo
+{
+    int start; // First position the value is live at, -1 if it never appears
+    int end;
+    double weight;       // Uses and definitions, weighted by loop depth
+    int def_count;
+    TacOperand literal;  // The literal assigned by the only definition, OP_NONE otherwise
+    TacOperand operand;  // The value as it appears in the TAC (for --trace=asm:2)
+} ValueInfo;
+
+// Returns 1 if the code generator uses or clobbers ecx for the instruction:
+// calls (printf, malloc) clobber it, idiv takes a divisor held in it and an
+// array store holds the stored value in it
+static int clobbers_ecx(TacOpCode opcode)
+{
+    switch (opcode)
+    {
+    case TAC_PRINT: case TAC_CALL: case TAC_NEW_ARRAY:
+    case TAC_DIV: case TAC_MOD: case TAC_ARRAY_STORE:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static void extend(ValueInfo *info, int position)
+{
+    if (info->start < 0 || position < info->start)
+        info->start = position;
+    if (position > info->end)
+        info->end = position;
+}
+
+static int compare_intervals(const void *a, const void *b)
+{
+    const Interval *x = (const Interval *)a, *y = (const Interval *)b;
+    if (x->start != y->start)
+        return x->start < y->start ? -1 : 1;
+    return x->value < y->value ? -1 : x->value > y->value;
+}
+
+// Returns 1 if a position in 'clobbers' (ascending) lies strictly inside (start, end)
+static int clobbered_inside(const int *clobbers, int count, int start, int end)
+{
+    int low = 0, high = count;
+    while (low < high) // First clobber after 'start'
+    {
+        int middle = (low + high) / 2;
+        if (clobbers[middle] <= start)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low < count && clobbers[low] < end;
+}
+
+// Adds each value of the bitset to the interval of its value, at 'position'
+static void extend_over_set(ValueInfo *info, const Liveness *live, const uint64_t *set, int position)
+{
+    for (int w = 0; w < live->words; w++)
+    {
+        uint64_t bits = set[w];
+        while (bits)
+        {
+            int bit = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            extend(&info[live->value_of[bit]], position);
+        }
+    }
+}
+
+// Stack-slot coloring: the values left in memory are scanned in order of
+// interval start, and each takes a free slot of its size (a byte for chars, a
+// dword otherwise) whose previous occupants have all ended, or a new slot.
+// Returns the number of values that share a slot with an earlier one.
+static int assign_slots(const Interval *intervals, int interval_count, const ValueInfo *info, RegAllocation *result)
+{
+    result->slot = (int *)arena_alloc(&codegen_arena, (size_t)result->value_count * sizeof(int));
+    for (uint32_t v = 0; v < result->value_count; v++)
+        result->slot[v] = -1;
+    result->slot_size = (int *)arena_alloc(&codegen_arena, (size_t)(interval_count + 1) * sizeof(int));
+    result->slot_weight = (double *)arena_alloc(&codegen_arena, (size_t)(interval_count + 1) * sizeof(double));
+    result->slot_count = 0;
+
+    // Occupied slots in a binary min-heap on the end of their current
+    // interval, and a stack of free slots per size
+    int *heap = (int *)arena_alloc(&cfg_arena, (size_t)(interval_count + 1) * sizeof(int));
+    int *heap_end = (int *)arena_alloc(&cfg_arena, (size_t)(interval_count + 1) * sizeof(int));
+    int *free_bytes = (int *)arena_alloc(&cfg_arena, (size_t)(interval_count + 1) * sizeof(int));
+    int *free_dwords = (int *)arena_alloc(&cfg_arena, (size_t)(interval_count + 1) * sizeof(int));
+    int heap_count = 0, free_byte_count = 0, free_dword_count = 0, shared = 0;
+
+    for (int i = 0; i < interval_count; i++)
+    {
+        const Interval *interval = &intervals[i];
+        uint32_t v = interval->value;
+        if (result->reg[v] != X86_NO_REG || result->constant[v].type != OP_NONE)
+            continue;
+
+        // Release the slots whose interval is over
+        while (heap_count > 0 && heap_end[0] <= interval->start)
+        {
+            int released = heap[0];
+            if (result->slot_size[released] == 1)
+                free_bytes[free_byte_count++] = released;
+            else
+                free_dwords[free_dword_count++] = released;
+            heap_count--;
+            int hole = 0;
+            for (;;) // Sift the last entry down from the root
+            {
+                int child = 2 * hole + 1;
+                if (child >= heap_count)
+                    break;
+                if (child + 1 < heap_count && heap_end[child + 1] < heap_end[child])
+                    child++;
+                if (heap_end[heap_count] <= heap_end[child])
+                    break;
+                heap[hole] = heap[child];
+                heap_end[hole] = heap_end[child];
+                hole = child;
+            }
+            heap[hole] = heap[heap_count];
+            heap_end[hole] = heap_end[heap_count];
+        }
+
+        int size = info[v].operand.data_type == TYPE_CHAR ? 1 : 4;
+        int slot;
+        if (size == 1 && free_byte_count > 0)
+            slot = free_bytes[--free_byte_count];
+        else if (size == 4 && free_dword_count > 0)
+            slot = free_dwords[--free_dword_count];
+        else
+            slot = -1;
+        if (slot >= 0)
+            shared++;
+        else
+        {
+            slot = result->slot_count++;
+            result->slot_size[slot] = size;
+            result->slot_weight[slot] = 0;
+        }
+        result->slot[v] = slot;
+        result->slot_weight[slot] += info[v].weight;
+
+        int hole = heap_count++; // Sift up
+        while (hole > 0 && heap_end[(hole - 1) / 2] > interval->end)
+        {
+            heap[hole] = heap[(hole - 1) / 2];
+            heap_end[hole] = heap_end[(hole - 1) / 2];
+            hole = (hole - 1) / 2;
+        }
+        heap[hole] = slot;
+        heap_end[hole] = interval->end;
+    }
+    return shared;
+}
+
+static void print_allocation(const TacProgram *program, int begin_index, const ValueInfo *info,
+                             const RegAllocation *result)
+{
+    printf("--- Register allocation (");
+    print_tac_operand(stdout, program->instrs[begin_index].op1);
+    printf(") ---\n");
+    for (uint32_t v = 0; v < result->value_count; v++)
+    {
+        if (info[v].start < 0)
+            continue;
+        printf("  ");
+        print_tac_operand(stdout, info[v].operand);
+        printf(" [%d, %d] ", info[v].start, info[v].end);
+        if (result->reg[v] != X86_NO_REG)
+            printf("%s\n", x86_reg_name((X86Reg)result->reg[v]));
+        else if (result->constant[v].type != OP_NONE)
+        {
+            printf("rematerialized ");
+            print_tac_operand(stdout, result->constant[v]);
+            printf("\n");
+        }
+        else
+            printf("spilled to slot %d\n", result->slot[v]);
+    }
+}
+
+void regalloc_function(const TacProgram *program, int begin_index, RegAllocation *result)
+{
+    Cfg *cfg = cfg_build(program, begin_index, NULL);
+    cfg_compute_loops(cfg);
+    Liveness live;
+    liveness_compute(cfg, &live);
+
+    uint32_t value_count = tac_value_count();
+    result->value_count = value_count;
+    result->reg = (int8_t *)arena_alloc(&codegen_arena, (size_t)value_count * sizeof(int8_t));
+    result->constant = (TacOperand *)arena_alloc(&codegen_arena, (size_t)value_count * sizeof(TacOperand));
+    result->used_regs = 0;
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        result->reg[v] = X86_NO_REG;
+        result->constant[v] = create_tac_none_operand();
+    }
+
+    // Positions number the instructions of the blocks in program order, which
+    // is the order the code generator emits them in
+    ValueInfo *info = (ValueInfo *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(ValueInfo));
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        info[v].start = -1;
+        info[v].end = -1;
+        info[v].weight = 0;
+        info[v].def_count = 0;
+        info[v].literal = create_tac_none_operand();
+        info[v].operand = create_tac_none_operand();
+    }
+    int instr_total = 0;
+    for (int b = 0; b < cfg->block_count; b++)
+        instr_total += cfg->blocks[b].instr_count;
+    int *clobbers = (int *)arena_alloc(&cfg_arena, (size_t)(instr_total + 1) * sizeof(int));
+    int clobber_count = 0;
+
+    int position = 0;
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        if (block->instr_count == 0)
+            continue;
+        double weight = 1;
+        for (int depth = block->loop >= 0 ? cfg->loops[block->loop].depth : 0; depth > 0 && weight < 10000; depth--)
+            weight *= 10;
+
+        int block_start = position;
+        for (int i = 0; i < block->instr_count; i++, position++)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            TacOperand *uses[3];
+            int use_count = tac_uses(instr, uses);
+            for (int u = 0; u < use_count; u++)
+            {
+                ValueInfo *use = &info[tac_value_index(*uses[u])];
+                extend(use, position);
+                use->weight += weight;
+                use->operand = *uses[u];
+            }
+            TacOperand *def = tac_def(instr);
+            if (def)
+            {
+                ValueInfo *target = &info[tac_value_index(*def)];
+                extend(target, position);
+                target->weight += weight;
+                target->operand = *def;
+                int32_t literal;
+                if (target->def_count++ == 0 && instr->opcode == TAC_ASSIGN && tac_literal_value(instr->op1, &literal))
+                    target->literal = instr->op1;
+                else
+                    target->literal = create_tac_none_operand();
+            }
+            if (clobbers_ecx(instr->opcode))
+                clobbers[clobber_count++] = position;
+        }
+
+        // Values live across the block's edges cover the whole block
+        if (block->rpo_index >= 0)
+        {
+            extend_over_set(info, &live, live.live_in + (size_t)b * live.words, block_start);
+            extend_over_set(info, &live, live.live_out + (size_t)b * live.words, position - 1);
+        }
+    }
+
+    // One interval per value that appears
+    Interval *intervals = (Interval *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(Interval));
+    int interval_count = 0;
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        if (info[v].start < 0)
+            continue;
+        Interval *interval = &intervals[interval_count++];
+        interval->value = v;
+        interval->start = info[v].start;
+        interval->end = info[v].end;
+        interval->cost = info[v].literal.type != OP_NONE ? -1 : info[v].weight / (info[v].end - info[v].start + 1);
+        interval->no_ecx = clobbered_inside(clobbers, clobber_count, info[v].start, info[v].end);
+    }
+    qsort(intervals, (size_t)interval_count, sizeof(Interval), compare_intervals);
+
+    // Linear scan. 'active' holds the intervals currently in a register,
+    // sorted by increasing end.
+    Interval *active[ALLOCATABLE_COUNT];
+    int active_count = 0;
+    int free_reg[X86_REG_COUNT] = {0};
+    for (int r = 0; r < ALLOCATABLE_COUNT; r++)
+        free_reg[allocatable_regs[r]] = 1;
+    int spilled = 0, rematerialized = 0, assigned = 0;
+
+    for (int i = 0; i < interval_count; i++)
+    {
+        Interval *current = &intervals[i];
+
+        // Expire the intervals that end where this one starts or earlier: every
+        // instruction reads its operands before writing its result
+        int kept = 0;
+        for (int a = 0; a < active_count; a++)
+        {
+            if (active[a]->end <= current->start)
+                free_reg[(int)result->reg[active[a]->value]] = 1;
+            else
+                active[kept++] = active[a];
+        }
+        active_count = kept;
+
+        X86Reg chosen = X86_NO_REG;
+        for (int r = 0; r < ALLOCATABLE_COUNT && chosen == X86_NO_REG; r++)
+            if (free_reg[allocatable_regs[r]] && !(allocatable_regs[r] == X86_ECX && current->no_ecx))
+                chosen = allocatable_regs[r];
+
+        if (chosen == X86_NO_REG)
+        {
+            // Spill whichever is cheapest to keep in memory: this interval or
+            // an active one whose register this interval could use
+            Interval *victim = current;
+            int victim_slot = -1;
+            for (int a = 0; a < active_count; a++)
+            {
+                if (result->reg[active[a]->value] == X86_ECX && current->no_ecx)
+                    continue;
+                if (active[a]->cost < victim->cost ||
+                    (active[a]->cost == victim->cost && active[a]->end > victim->end))
+                {
+                    victim = active[a];
+                    victim_slot = a;
+                }
+            }
+            if (victim != current)
+            {
+                chosen = (X86Reg)result->reg[victim->value];
+                result->reg[victim->value] = X86_NO_REG;
+                memmove(&active[victim_slot], &active[victim_slot + 1],
+                        (size_t)(active_count - victim_slot - 1) * sizeof(Interval *));
+                active_count--;
+                assigned--;
+            }
+            if (info[victim->value].literal.type != OP_NONE)
+            {
+                result->constant[victim->value] = info[victim->value].literal;
+                rematerialized++;
+            }
+            else
+                spilled++;
+            if (victim == current)
+                continue;
+        }
+
+        result->reg[current->value] = (int8_t)chosen;
+        result->used_regs |= 1u << chosen;
+        free_reg[chosen] = 0;
+        assigned++;
+        int at = active_count++;
+        while (at > 0 && active[at - 1]->end > current->end)
+        {
+            active[at] = active[at - 1];
+            at--;
+        }
+        active[at] = current;
+    }
+
+    STATS_ADD(STAT_VALUES_IN_REGISTERS, assigned);
+    STATS_ADD(STAT_VALUES_SPILLED, spilled);
+    STATS_ADD(STAT_VALUES_REMATERIALIZED, rematerialized);
+    STATS_ADD(STAT_FRAME_SLOTS_SHARED, assign_slots(intervals, interval_count, info, result));
+    if (TRACE_ENABLED(TRACE_ASM, 2))
+        print_allocation(program, begin_index, info, result);
+}
@@ -0,0 +1,45 @@
+// regalloc.h
+#ifndef REGALLOC_H
+#define REGALLOC_H
+
+#include "tac.h"
+#include "x86.h"
+#include <stdint.h>
+
+// Where the values of one function live, indexed by value index (see
+// dataflow.h). Arrays are in codegen_arena.
+typedef struct RegAllocation
+{
+    uint32_t value_count;
+    int8_t *reg;          // X86Reg holding the value everywhere, X86_NO_REG if it is not in a register
+    TacOperand *constant; // Literal read in place of a rematerialized value, OP_NONE for the others
+    unsigned used_regs;   // Bit (1 << reg) for every register handed out
+    int *slot;            // Frame slot of a value left in memory, -1 for the others
+    int *slot_size;       // Bytes of each slot: 1 for chars, 4 otherwise
+    double *slot_weight;  // Uses of each slot's values, weighted like spill costs
+    int slot_count;
+} RegAllocation;
+
+// Linear-scan register allocation (Poletto and Sarkar) for the temps and
+// variables of the function whose TAC_FUNCTION_BEGIN is at 'begin_index'.
+// Each value gets one live interval, from its first to its last appearance
+// in program order, stretched over every block it is live into or out of.
+//
+// eax and edx stay free as the code generator's scratch registers: idiv,
+// cdq and every call write them. ebx, esi, edi and ecx are handed out, ecx
+// only to intervals with no call, division or array store strictly inside,
+// since the code for those uses or clobbers it. When an interval finds every
+// register taken, the interval with the fewest uses per instruction covered
+// (a use inside a loop counts ten times per level) keeps its frame slot. A
+// value whose only definition assigns a literal is spilled first and at no
+// cost: it gets no slot and each use reads the literal (rematerialization).
+//
+// The values left in memory then share frame slots: two values whose
+// intervals do not overlap and that have the same size get the same slot.
+// The code generator decides where each slot goes in the frame.
+//
+// The CFG and liveness are built in cfg_arena; the caller releases them with
+// free_cfgs().
+void regalloc_function(const TacProgram *program, int begin_index, RegAllocation *result);
+
+#endif // REGALLOC_H
@@ -4,6 +4,7 @@
 #include "ast.h"          // For node structures and enums
 #include "symbol_table.h" // For symbol table operations and current_scope
 #include "miniJava.tab.h" // For TOKEN_ constants
+#include "trace.h"
 
 int semantic_error_count = 0;
 
@@ -24,11 +25,11 @@ void analyze_semantics(ProgramNode *program_root)
 
     if (semantic_error_count == 0)
     {
-        printf("Semantic analysis successful.\n");
+        TRACE(TRACE_PHASE, "Semantic analysis successful.\n");
     }
     else
     {
-        printf("Semantic analysis found %d error(s).\n", semantic_error_count);
+        TRACE(TRACE_PHASE, "Semantic analysis found %d error(s).\n", semantic_error_count);
     }
 }
 
@@ -61,7 +62,7 @@ void analyze_class_declaration_node(ClassDeclarationNode *node)
 
     if (node->main_method)
     {
-        if (!node->main_method->name || strcmp(node->main_method->name->name, "main") != 0)
+        if (!node->main_method->name || node->main_method->name->atom != intern_cstr("main"))
         {
             report_semantic_error("Main method must be named 'main'.", node->main_method ? node->main_method->base.line_number : node->base.line_number);
         }
@@ -188,16 +189,17 @@ void analyze_variable_declaration_node(VariableDeclarationNode *node)
         report_semantic_error("'final' variable must be initialized at declaration.", node->base.line_number);
     }
 
-    if (!insert_symbol(node->identifier->name, var_declared_type, node->base.line_number, node->is_final, (AstNode *)node))
+    if (!insert_symbol(node->identifier->atom, var_declared_type, node->base.line_number, node->is_final, (AstNode *)node))
     {
         // Error already reported by insert_symbol
     }
     else
     {
-        SymbolTableEntry *entry = lookup_symbol_in_current_scope(node->identifier->name);
+        SymbolTableEntry *entry = lookup_symbol_in_current_scope(node->identifier->atom);
         if (entry)
         {
             entry->is_initialized = (node->initializer != NULL);
+            node->identifier->symbol = entry; // Later phases read the binding instead of looking it up
         }
     }
 }
@@ -209,7 +211,7 @@ void analyze_assignment_node(AssignmentNode *node)
         return;
     }
 
-    SymbolTableEntry *entry = lookup_symbol(node->target_identifier->name);
+    SymbolTableEntry *entry = lookup_symbol(node->target_identifier->atom);
     if (!entry)
     {
         char error_msg[100];
@@ -218,6 +220,7 @@ void analyze_assignment_node(AssignmentNode *node)
         node->value->resolved_type = TYPE_ERROR;
         return;
     }
+    node->target_identifier->symbol = entry;
 
     if (entry->is_final)
     {
@@ -361,13 +364,70 @@ void analyze_return_statement_node(ReturnStatementNode *node, TypeKind expected_
     }
 }
 
-TypeKind analyze_expression_node(ExpressionNode *node)
+// Pushes the operands of 'node' so they are analyzed before it is revisited
+// with state 1. Array names are resolved here, before the index expression,
+// so diagnostics come out in source order; the partial result is kept in
+// node->resolved_type until the node is revisited. Returns 0 for leaves.
+static int push_expression_operands(ExpressionWalkStack *stack, ExpressionNode *node)
 {
-    if (!node)
+    ExpressionNode *first = NULL, *second = NULL;
+    switch (node->kind)
     {
-        return TYPE_ERROR;
+    case EXPR_BINARY:
+        first = node->data.binary_expr.left;
+        second = node->data.binary_expr.right;
+        break;
+    case EXPR_UNARY:
+        first = node->data.unary_expr.operand;
+        break;
+    case EXPR_PARENTHESIZED:
+        first = node->data.parenthesized_expr_val;
+        break;
+    case EXPR_ARRAY_ACCESS:
+    {
+        IdentifierNode *array_name = node->data.array_access_expr.array_name_ident;
+        if (!array_name || !array_name->name || !node->data.array_access_expr.index_expr)
+            return 0; // Reported as malformed when the node is checked
+        char error_msg[256];
+        SymbolTableEntry *array_entry = lookup_symbol(array_name->atom);
+        array_name->symbol = array_entry;
+        if (!array_entry)
+        {
+            sprintf(error_msg, "Array identifier '%s' not declared.", array_name->name);
+            report_semantic_error(error_msg, node->base.line_number);
+            node->resolved_type = TYPE_ERROR;
+        }
+        else if (array_entry->type != TYPE_INT_ARRAY)
+        { 
+            sprintf(error_msg, "Identifier '%s' is not an array type.", array_entry->name);
+            report_semantic_error(error_msg, node->base.line_number);
+            node->resolved_type = TYPE_ERROR;
+        }
+        else
+        {
+            node->resolved_type = TYPE_INT; 
+        }
+        first = node->data.array_access_expr.index_expr;
+        break;
     }
+    default:
+        return 0;
+    }
+
+    if (!first || (node->kind == EXPR_BINARY && !second))
+        return 0; // Malformed; reported when the node is checked
 
+    expr_walk_push(stack, node, 1);
+    if (second)
+        expr_walk_push(stack, second, 0);
+    expr_walk_push(stack, first, 0); // Popped first, so operands are analyzed left to right
+    return 1;
+}
+
+// Computes the type of one expression node. Its operands have already been
+// analyzed, so their types are read from their resolved_type fields.
+static TypeKind check_expression_node(ExpressionNode *node)
+{
     char error_msg[256];
     TypeKind expr_type = TYPE_ERROR; 
 
@@ -400,7 +460,7 @@ TypeKind analyze_expression_node(ExpressionNode *node)
             expr_type = TYPE_ERROR;
             break;
         }
-        SymbolTableEntry *entry = lookup_symbol(node->data.identifier_expr->name);
+        SymbolTableEntry *entry = lookup_symbol(node->data.identifier_expr->atom);
         if (!entry)
         {
             sprintf(error_msg, "Identifier '%s' not declared.", node->data.identifier_expr->name);
@@ -410,6 +470,7 @@ TypeKind analyze_expression_node(ExpressionNode *node)
         else
         {
             // if (!entry->is_initialized && entry->type != TYPE_INT_ARRAY) {} // Removed for brevity
+            node->data.identifier_expr->symbol = entry;
             expr_type = entry->type;
         }
         break;
@@ -422,26 +483,9 @@ TypeKind analyze_expression_node(ExpressionNode *node)
             expr_type = TYPE_ERROR;
             break;
         }
-        SymbolTableEntry *array_entry = lookup_symbol(node->data.array_access_expr.array_name_ident->name);
-        if (!array_entry)
-        {
-            sprintf(error_msg, "Array identifier '%s' not declared.", node->data.array_access_expr.array_name_ident->name);
-            report_semantic_error(error_msg, node->base.line_number);
-            expr_type = TYPE_ERROR;
-        }
-        else if (array_entry->type != TYPE_INT_ARRAY)
-        { 
-            sprintf(error_msg, "Identifier '%s' is not an array type.", array_entry->name);
-            report_semantic_error(error_msg, node->base.line_number);
-            expr_type = TYPE_ERROR;
-        }
-        else
-        {
-            expr_type = TYPE_INT; 
-        }
+        expr_type = node->resolved_type; // Set when the array name was resolved, before the index
 
-        TypeKind index_type = analyze_expression_node(node->data.array_access_expr.index_expr);
-        if (node->data.array_access_expr.index_expr) node->data.array_access_expr.index_expr->resolved_type = index_type;
+        TypeKind index_type = node->data.array_access_expr.index_expr->resolved_type;
         if (index_type != TYPE_INT && index_type != TYPE_ERROR)
         {
             report_semantic_error("Array index must be an integer.", node->data.array_access_expr.index_expr->base.line_number);
@@ -456,10 +500,8 @@ TypeKind analyze_expression_node(ExpressionNode *node)
             expr_type = TYPE_ERROR;
             break;
         }
-        TypeKind left_type = analyze_expression_node(node->data.binary_expr.left);
-        node->data.binary_expr.left->resolved_type = left_type;
-        TypeKind right_type = analyze_expression_node(node->data.binary_expr.right);
-        node->data.binary_expr.right->resolved_type = right_type;
+        TypeKind left_type = node->data.binary_expr.left->resolved_type;
+        TypeKind right_type = node->data.binary_expr.right->resolved_type;
 
         if (left_type == TYPE_ERROR || right_type == TYPE_ERROR)
         {
@@ -533,8 +575,7 @@ TypeKind analyze_expression_node(ExpressionNode *node)
             expr_type = TYPE_ERROR;
             break;
         }
-        TypeKind operand_type = analyze_expression_node(node->data.unary_expr.operand);
-        node->data.unary_expr.operand->resolved_type = operand_type;
+        TypeKind operand_type = node->data.unary_expr.operand->resolved_type;
         if (operand_type == TYPE_ERROR)
         {
             expr_type = TYPE_ERROR;
@@ -576,7 +617,7 @@ TypeKind analyze_expression_node(ExpressionNode *node)
             expr_type = TYPE_ERROR;
             break;
         }
-        expr_type = analyze_expression_node(node->data.parenthesized_expr_val); // CORRECTED
+        expr_type = node->data.parenthesized_expr_val->resolved_type; // CORRECTED
         break;
 
     case EXPR_BOOLEAN_TRUE: // CORRECTED
@@ -590,6 +631,30 @@ TypeKind analyze_expression_node(ExpressionNode *node)
         break;
     }
 
-    node->resolved_type = expr_type;
     return expr_type;
+}
+
+// Analyzes an expression tree bottom-up with an explicit stack, so operator
+// chains of any depth are checked without recursion.
+TypeKind analyze_expression_node(ExpressionNode *root)
+{
+    if (!root)
+    {
+        return TYPE_ERROR;
+    }
+
+    ExpressionWalkStack stack;
+    expr_walk_init(&stack);
+    expr_walk_push(&stack, root, 0);
+
+    while (stack.count > 0)
+    {
+        ExpressionWalkFrame frame = stack.frames[--stack.count];
+        if (frame.state == 0 && push_expression_operands(&stack, frame.node))
+            continue; // Revisited once its operands are done
+        frame.node->resolved_type = check_expression_node(frame.node);
+    }
+
+    expr_walk_free(&stack);
+    return root->resolved_type;
 }
\ No newline at end of file
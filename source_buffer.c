@@ -0,0 +1,192 @@
+// source_buffer.c
+#include "source_buffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// The scanner works directly on this buffer (see lexer_scan_source() in
+// miniJava.l), so there is only ever one copy of the source text.
+static char *source_base = NULL;  // First byte of the source
+static size_t source_size = 0;    // Length of the source, without the two NULs
+static size_t mapped_size = 0;    // Size of the mapping, or 0 for a heap buffer
+
+// Maps a regular file. The file is mapped MAP_PRIVATE and writable because flex
+// temporarily writes a NUL after each token; those writes never reach the file.
+// An anonymous mapping is reserved first so that the two NUL bytes after the
+// last byte of the file are always backed by memory, even when the file size is
+// an exact multiple of the page size.
+static int map_file(int fd, size_t size)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    size_t total = ((size + 2 + page_size - 1) / page_size) * page_size;
+
+    char *base = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return 0;
+
+    // Bytes past the end of the file in its last page read as zero.
+    if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(base, total);
+        return 0;
+    }
+    madvise(base, total, MADV_SEQUENTIAL);
+
+    source_base = base;
+    source_size = size;
+    mapped_size = total;
+    return 1;
+}
+
+// Fallback for inputs that cannot be mapped: reads everything into the heap.
+static int read_file(int fd)
+{
+    size_t capacity = 4096;
+    size_t size = 0;
+    char *buffer = malloc(capacity);
+    if (!buffer)
+    {
+        fprintf(stderr, "Memory allocation failed for source buffer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (;;)
+    {
+        if (capacity - size < 2 + 1)
+        {
+            capacity *= 2;
+            char *grown = realloc(buffer, capacity);
+            if (!grown)
+            {
+                fprintf(stderr, "Memory allocation failed for source buffer\n");
+                exit(EXIT_FAILURE);
+            }
+            buffer = grown;
+        }
+        ssize_t n = read(fd, buffer + size, capacity - size - 2);
+        if (n < 0)
+        {
+            perror("Could not read input file");
+            free(buffer);
+            return 0;
+        }
+        if (n == 0)
+            break;
+        size += (size_t)n;
+    }
+
+    buffer[size] = '\0';
+    buffer[size + 1] = '\0';
+    source_base = buffer;
+    source_size = size;
+    mapped_size = 0;
+    return 1;
+}
+
+int source_open(const char *filename)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        perror("Could not open input file");
+        return 0;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+    {
+        perror("Could not stat input file");
+        close(fd);
+        return 0;
+    }
+
+    // Slices use 32-bit offsets.
+    if (S_ISREG(st.st_mode) && (uint64_t)st.st_size > UINT32_MAX - 2)
+    {
+        fprintf(stderr, "Input file '%s' is too large.\n", filename);
+        close(fd);
+        return 0;
+    }
+
+    int ok = 0;
+    if (S_ISREG(st.st_mode) && st.st_size > 0)
+        ok = map_file(fd, (size_t)st.st_size);
+    if (!ok)
+        ok = read_file(fd);
+
+    close(fd); // The mapping stays valid after the descriptor is closed
+    return ok;
+}
+
+void source_close(void)
+{
+    if (!source_base)
+        return;
+    if (mapped_size)
+        munmap(source_base, mapped_size);
+    else
+        free(source_base);
+    source_base = NULL;
+    source_size = 0;
+    mapped_size = 0;
+}
+
+char *source_data(void)
+{
+    return source_base;
+}
+
+size_t source_length(void)
+{
+    return source_size;
+}
+
+const char *source_slice_ptr(SourceSlice slice)
+{
+    return source_base + slice.offset;
+}
+
+char *source_slice_dup(SourceSlice slice)
+{
+    char *copy = malloc(slice.length + 1);
+    if (!copy)
+    {
+        fprintf(stderr, "Memory allocation failed for source slice\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(copy, source_base + slice.offset, slice.length);
+    copy[slice.length] = '\0';
+    return copy;
+}
+
+size_t source_slice_unescape(SourceSlice slice, char *dest)
+{
+    const char *text = source_base + slice.offset;
+    size_t j = 0;
+
+    for (size_t i = 0; i < slice.length; i++)
+    {
+        if (text[i] != '\\')
+        {
+            dest[j++] = text[i];
+            continue;
+        }
+        if (++i == slice.length)
+            break; // Dangling backslash at end of string
+        switch (text[i])
+        {
+        case 'n': dest[j++] = '\n'; break;
+        case 't': dest[j++] = '\t'; break;
+        case 'r': dest[j++] = '\r'; break;
+        case '"': dest[j++] = '"'; break;
+        case '\\': dest[j++] = '\\'; break;
+        default: dest[j++] = text[i]; break; // Unrecognized escapes are kept as is
+        }
+    }
+    dest[j] = '\0';
+    return j;
+}
@@ -0,0 +1,42 @@
+// source_buffer.h
+#ifndef SOURCE_BUFFER_H
+#define SOURCE_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A piece of the input source, given as a byte offset and a length into the
+// buffer opened with source_open(). The lexer hands identifiers and literals
+// to the parser in this form instead of copying them.
+typedef struct SourceSlice
+{
+    uint32_t offset;
+    uint32_t length;
+} SourceSlice;
+
+// Opens the input file and makes its whole contents available in memory.
+// Regular files are memory-mapped; anything mmap cannot handle (pipes, empty
+// files) is read into a heap buffer instead. Either way the contents are
+// followed by two NUL bytes, as flex's yy_scan_buffer() requires.
+// Returns 1 on success, 0 (after printing a message) on failure.
+int source_open(const char *filename);
+
+// Releases the mapping or heap buffer. Slices are invalid afterwards.
+void source_close(void);
+
+// Start of the source text, and its length excluding the trailing NULs.
+char *source_data(void);
+size_t source_length(void);
+
+// Returns the first byte of a slice. The bytes are NOT NUL terminated.
+const char *source_slice_ptr(SourceSlice slice);
+
+// Returns a malloc'd, NUL terminated copy of a slice.
+char *source_slice_dup(SourceSlice slice);
+
+// Copies a string literal body into 'dest' with its escape sequences
+// (\n, \t, \r, \", \\) decoded, and NUL terminates it. 'dest' must have room
+// for slice.length + 1 bytes. Returns the decoded length.
+size_t source_slice_unescape(SourceSlice slice, char *dest);
+
+#endif // SOURCE_BUFFER_H
@@ -0,0 +1,650 @@
+// ssa.c
+#include "ssa.h"
+#include "dataflow.h"
+#include "arena.h"
+#include "intern.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static TacOperand value_operand(uint32_t value, int8_t data_type)
+{
+    TacOperand op;
+    op.type = (value & 1) ? OP_TEMP : OP_VAR;
+    op.data_type = data_type;
+    op.val.id = value >> 1;
+    return op;
+}
+
+static uint32_t base_of(const Cfg *cfg, uint32_t value)
+{
+    return value < cfg->ssa_base_count ? cfg->ssa_base[value] : value;
+}
+
+TacOperand ssa_original(Cfg *cfg, TacOperand op)
+{
+    if (!tac_is_value(op))
+        return op;
+    uint32_t value = tac_value_index(op);
+    uint32_t base = base_of(cfg, value);
+    return base == value ? op : value_operand(base, op.data_type);
+}
+
+// --- Construction ---
+
+typedef struct RenameLogEntry
+{
+    uint32_t value;      // Original value whose current version changed
+    TacOperand previous; // Version to restore when leaving the block
+} RenameLogEntry;
+
+typedef struct RenameState
+{
+    Cfg *cfg;
+    uint32_t original_count;  // Values that existed before construction
+    char *renamed;            // renamed[v]: definitions of v get fresh versions
+    TacOperand *current;      // Version of v reaching this point; OP_NONE means v itself
+    uint32_t *version_number; // Per original variable, for the "x.N" names
+    RenameLogEntry *log;      // Undo log, unwound when leaving a dominator subtree
+    int log_count;
+    int log_capacity;
+} RenameState;
+
+void ssa_record_version(Cfg *cfg, TacOperand version_op, TacOperand original)
+{
+    uint32_t version = tac_value_index(version_op), base = base_of(cfg, tac_value_index(original));
+    if (version >= cfg->ssa_base_capacity)
+    {
+        uint32_t capacity = cfg->ssa_base_capacity > 0 ? cfg->ssa_base_capacity * 2 : 64;
+        while (capacity <= version)
+            capacity *= 2;
+        uint32_t *grown = (uint32_t *)arena_alloc(&cfg_arena, (size_t)capacity * sizeof(uint32_t));
+        if (cfg->ssa_base_count > 0)
+            memcpy(grown, cfg->ssa_base, (size_t)cfg->ssa_base_count * sizeof(uint32_t));
+        cfg->ssa_base = grown;
+        cfg->ssa_base_capacity = capacity;
+    }
+    for (uint32_t v = cfg->ssa_base_count; v < version; v++)
+        cfg->ssa_base[v] = v; // Values created in between (e.g. temps of the other kind)
+    if (version >= cfg->ssa_base_count)
+        cfg->ssa_base_count = version + 1;
+    cfg->ssa_base[version] = base;
+}
+
+static void set_current(RenameState *state, uint32_t value, TacOperand version)
+{
+    if (state->log_count == state->log_capacity)
+    {
+        int capacity = state->log_capacity ? state->log_capacity * 2 : 64;
+        RenameLogEntry *grown = (RenameLogEntry *)arena_alloc(&cfg_arena, (size_t)capacity * sizeof(RenameLogEntry));
+        if (state->log_count > 0)
+            memcpy(grown, state->log, (size_t)state->log_count * sizeof(RenameLogEntry));
+        state->log = grown;
+        state->log_capacity = capacity;
+    }
+    state->log[state->log_count].value = value;
+    state->log[state->log_count].previous = state->current[value];
+    state->log_count++;
+    state->current[value] = version;
+}
+
+// Creates the next version of an original value and makes it current
+static TacOperand new_version(RenameState *state, TacOperand original)
+{
+    TacOperand version;
+    if (original.type == OP_VAR)
+    {
+        char name[256];
+        uint32_t number = ++state->version_number[original.val.id];
+        snprintf(name, sizeof(name), "%.200s.%u", atom_name(tac_program.var_names[original.val.id]), number);
+        version = create_tac_var_operand((uint32_t)tac_program.var_count, intern_cstr(name), original.data_type);
+    }
+    else
+    {
+        version = create_tac_temp_operand(original.data_type);
+    }
+    uint32_t value = tac_value_index(original);
+    ssa_record_version(state->cfg, version, original);
+    set_current(state, value, version);
+    return version;
+}
+
+// Replaces a use with the version of its value that reaches it
+static void rename_use(RenameState *state, TacOperand *use)
+{
+    uint32_t value = tac_value_index(*use);
+    if (value < state->original_count && state->current[value].type != OP_NONE)
+    {
+        use->type = state->current[value].type;
+        use->val.id = state->current[value].val.id;
+    }
+}
+
+static void rename_block(RenameState *state, int block_id)
+{
+    Cfg *cfg = state->cfg;
+    BasicBlock *block = &cfg->blocks[block_id];
+
+    for (int p = 0; p < block->phi_count; p++)
+        block->phis[p].result = new_version(state, block->phis[p].result);
+
+    for (int i = 0; i < block->instr_count; i++)
+    {
+        TacInstruction *instr = &block->instrs[i];
+        TacOperand *uses[3];
+        int use_count = tac_uses(instr, uses);
+        for (int u = 0; u < use_count; u++)
+            rename_use(state, uses[u]);
+        TacOperand *def = tac_def(instr);
+        if (def && state->renamed[tac_value_index(*def)])
+            *def = new_version(state, *def);
+    }
+
+    // Fill in this block's argument of every successor phi
+    for (int s = 0; s < block->succ_count; s++)
+    {
+        BasicBlock *succ = &cfg->blocks[block->succs[s]];
+        int a = block->succ_pred_index[s];
+        for (int p = 0; p < succ->phi_count; p++)
+        {
+            TacOperand arg = ssa_original(cfg, succ->phis[p].result);
+            rename_use(state, &arg);
+            succ->phis[p].args[a] = arg;
+        }
+    }
+}
+
+void ssa_construct(Cfg *cfg)
+{
+    cfg_compute_frontiers(cfg);
+
+    uint32_t value_count = tac_value_count();
+    int block_count = cfg->block_count;
+
+    // Per value: number of definitions, whether it is read in a block it was
+    // not written in first (a "global" name), its type, and the distinct
+    // blocks defining it (gathered in two passes into one array).
+    int *def_count = (int *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    int *def_block_start = (int *)arena_calloc(&cfg_arena, ((size_t)value_count + 1) * sizeof(int));
+    int *seen_in = (int *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    char *global = (char *)arena_calloc(&cfg_arena, (size_t)value_count);
+    int8_t *value_type = (int8_t *)arena_calloc(&cfg_arena, (size_t)value_count);
+
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *uses[3];
+            int use_count = tac_uses(&block->instrs[i], uses);
+            for (int u = 0; u < use_count; u++)
+                if (seen_in[tac_value_index(*uses[u])] != block->id + 1)
+                    global[tac_value_index(*uses[u])] = 1;
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (!def)
+                continue;
+            uint32_t value = tac_value_index(*def);
+            def_count[value]++;
+            value_type[value] = def->data_type;
+            if (seen_in[value] != block->id + 1)
+            {
+                seen_in[value] = block->id + 1;
+                def_block_start[value + 1]++;
+            }
+        }
+    }
+    for (uint32_t v = 0; v < value_count; v++)
+        def_block_start[v + 1] += def_block_start[v];
+    int *def_blocks = (int *)arena_alloc(&cfg_arena, (size_t)(def_block_start[value_count] + 1) * sizeof(int));
+    int *fill = (int *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    memcpy(fill, def_block_start, (size_t)value_count * sizeof(int));
+    memset(seen_in, 0, (size_t)value_count * sizeof(int));
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacOperand *def = tac_def(&block->instrs[i]);
+            if (def && seen_in[tac_value_index(*def)] != block->id + 1)
+            {
+                seen_in[tac_value_index(*def)] = block->id + 1;
+                def_blocks[fill[tac_value_index(*def)]++] = block->id;
+            }
+        }
+    }
+
+    // Phi placement on the iterated dominance frontier (Cytron et al.)
+    RenameState state;
+    memset(&state, 0, sizeof(state));
+    state.cfg = cfg;
+    state.original_count = value_count;
+    state.renamed = (char *)arena_calloc(&cfg_arena, (size_t)value_count);
+    for (uint32_t v = 0; v < value_count; v++)
+        state.renamed[v] = def_count[v] > 1;
+
+    int *has_phi = (int *)arena_calloc(&cfg_arena, (size_t)block_count * sizeof(int)); // Value + 1 last placed
+    int *queued = (int *)arena_calloc(&cfg_arena, (size_t)block_count * sizeof(int));
+    int *worklist = (int *)arena_alloc(&cfg_arena, (size_t)block_count * sizeof(int));
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        if (!global[v] || def_block_start[v] == def_block_start[v + 1])
+            continue;
+        int stamp = (int)v + 1, pending = 0;
+        for (int d = def_block_start[v]; d < def_block_start[v + 1]; d++)
+        {
+            queued[def_blocks[d]] = stamp;
+            worklist[pending++] = def_blocks[d];
+        }
+        while (pending > 0)
+        {
+            BasicBlock *block = &cfg->blocks[worklist[--pending]];
+            for (int f = 0; f < block->frontier_count; f++)
+            {
+                int join = block->frontier[f];
+                if (has_phi[join] == stamp)
+                    continue;
+                has_phi[join] = stamp;
+                cfg_add_phi(cfg, join, value_operand(v, value_type[v]));
+                state.renamed[v] = 1;
+                if (queued[join] != stamp)
+                {
+                    queued[join] = stamp;
+                    worklist[pending++] = join;
+                }
+            }
+        }
+    }
+
+    // Renaming, walking the dominator tree with an explicit stack
+    state.current = (TacOperand *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(TacOperand));
+    state.version_number = (uint32_t *)arena_calloc(&cfg_arena, (size_t)tac_program.var_count * sizeof(uint32_t) + 1);
+    cfg->ssa_base_capacity = value_count * 2;
+    cfg->ssa_base = (uint32_t *)arena_alloc(&cfg_arena, (size_t)cfg->ssa_base_capacity * sizeof(uint32_t));
+    cfg->ssa_base_count = value_count;
+    for (uint32_t v = 0; v < value_count; v++)
+        cfg->ssa_base[v] = v;
+
+    typedef struct WalkFrame
+    {
+        int block;
+        int log_mark;
+        int next_child;
+    } WalkFrame;
+    WalkFrame *stack = (WalkFrame *)arena_alloc(&cfg_arena, (size_t)block_count * sizeof(WalkFrame));
+    int depth = 0;
+    stack[depth].block = 0;
+    stack[depth].log_mark = 0;
+    rename_block(&state, 0);
+    stack[depth].next_child = cfg->blocks[0].dom_child;
+    depth++;
+    while (depth > 0)
+    {
+        WalkFrame *frame = &stack[depth - 1];
+        int child = frame->next_child;
+        if (child >= 0)
+        {
+            frame->next_child = cfg->blocks[child].dom_sibling;
+            stack[depth].block = child;
+            stack[depth].log_mark = state.log_count;
+            rename_block(&state, child);
+            stack[depth].next_child = cfg->blocks[child].dom_child;
+            depth++;
+        }
+        else
+        {
+            while (state.log_count > frame->log_mark)
+            {
+                state.log_count--;
+                state.current[state.log[state.log_count].value] = state.log[state.log_count].previous;
+            }
+            depth--;
+        }
+    }
+}
+
+// --- Destruction ---
+
+// Emits the copies dest[i] = src[i] as if they happened at once, inserting
+// them into 'block' at 'position'. A copy is emitted once no pending copy
+// still reads its destination; when only cycles remain, one destination is
+// saved to a temp first.
+static void sequentialize_copies(Cfg *cfg, int block, int position, TacOperand *dest, TacOperand *src, int count,
+                                 int line_number)
+{
+    char *done = (char *)arena_calloc(&cfg_arena, (size_t)count + 1);
+    int remaining = count;
+    for (int i = 0; i < count; i++)
+    {
+        if (tac_same_value(dest[i], src[i]))
+        {
+            done[i] = 1;
+            remaining--;
+        }
+    }
+
+    while (remaining > 0)
+    {
+        int progress = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if (done[i])
+                continue;
+            int blocked = 0;
+            for (int j = 0; j < count && !blocked; j++)
+                blocked = !done[j] && j != i && tac_same_value(src[j], dest[i]);
+            if (blocked)
+                continue;
+            TacInstruction copy = {TAC_ASSIGN, dest[i], src[i], create_tac_none_operand(), line_number};
+            cfg_insert(cfg, block, position++, &copy);
+            STATS_INC(STAT_SSA_COPIES);
+            done[i] = 1;
+            remaining--;
+            progress = 1;
+        }
+        if (progress)
+            continue;
+
+        // Every pending destination is still read by another copy: a cycle
+        for (int i = 0; i < count; i++)
+        {
+            if (done[i])
+                continue;
+            TacOperand saved = create_tac_temp_operand(dest[i].data_type);
+            TacInstruction copy = {TAC_ASSIGN, saved, dest[i], create_tac_none_operand(), line_number};
+            cfg_insert(cfg, block, position++, &copy);
+            STATS_INC(STAT_SSA_COPIES);
+            for (int j = 0; j < count; j++)
+                if (!done[j] && tac_same_value(src[j], dest[i]))
+                    src[j] = saved;
+            break;
+        }
+    }
+}
+
+// Per original value: its versions that are live at the current point of the
+// backward walk in merge_versions()
+typedef struct LiveVersions
+{
+    uint32_t *items;
+    int count;
+    int capacity;
+} LiveVersions;
+
+typedef struct MergeState
+{
+    Cfg *cfg;
+    char *tracked;       // tracked[v]: v's original has versions
+    int *live_position;  // Index of v in its original's LiveVersions, -1 if not live
+    LiveVersions *live;  // Indexed by original value
+    uint32_t *edges;     // Interference pairs
+    int edge_count;
+    int edge_capacity;
+} MergeState;
+
+static void live_add(MergeState *state, uint32_t value)
+{
+    if (state->live_position[value] >= 0)
+        return;
+    LiveVersions *list = &state->live[base_of(state->cfg, value)];
+    if (list->count == list->capacity)
+    {
+        int capacity = list->capacity ? list->capacity * 2 : 4;
+        uint32_t *grown = (uint32_t *)arena_alloc(&cfg_arena, (size_t)capacity * sizeof(uint32_t));
+        if (list->count > 0)
+            memcpy(grown, list->items, (size_t)list->count * sizeof(uint32_t));
+        list->items = grown;
+        list->capacity = capacity;
+    }
+    state->live_position[value] = list->count;
+    list->items[list->count++] = value;
+}
+
+static void live_remove(MergeState *state, uint32_t value)
+{
+    int position = state->live_position[value];
+    if (position < 0)
+        return;
+    LiveVersions *list = &state->live[base_of(state->cfg, value)];
+    uint32_t last = list->items[--list->count];
+    list->items[position] = last;
+    state->live_position[last] = position;
+    state->live_position[value] = -1;
+}
+
+static void add_interference(MergeState *state, uint32_t a, uint32_t b)
+{
+    if (state->edge_count + 2 > state->edge_capacity)
+    {
+        int capacity = state->edge_capacity ? state->edge_capacity * 2 : 64;
+        uint32_t *grown = (uint32_t *)arena_alloc(&cfg_arena, (size_t)capacity * sizeof(uint32_t));
+        if (state->edge_count > 0)
+            memcpy(grown, state->edges, (size_t)state->edge_count * sizeof(uint32_t));
+        state->edges = grown;
+        state->edge_capacity = capacity;
+    }
+    state->edges[state->edge_count++] = a;
+    state->edges[state->edge_count++] = b;
+}
+
+// Gives the versions of each variable back their original name where their
+// live ranges allow. Two versions interfere when one is written while the
+// other is live (a copy between them excepted); the versions of a value are
+// then greedily packed, in creation order, into as few non-interfering groups
+// as possible. The first group takes the original ID.
+static void merge_versions(Cfg *cfg)
+{
+    Liveness liveness;
+    liveness_compute(cfg, &liveness);
+    uint32_t value_count = tac_value_count();
+
+    MergeState state;
+    memset(&state, 0, sizeof(state));
+    state.cfg = cfg;
+    state.tracked = (char *)arena_calloc(&cfg_arena, (size_t)value_count);
+    for (uint32_t v = 0; v < cfg->ssa_base_count; v++)
+        if (cfg->ssa_base[v] != v)
+            state.tracked[cfg->ssa_base[v]] = 1;
+    int any = 0;
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        if (base_of(cfg, v) != v)
+            state.tracked[v] = 1;
+        any |= state.tracked[v];
+    }
+    if (!any)
+        return;
+
+    state.live_position = (int *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    for (uint32_t v = 0; v < value_count; v++)
+        state.live_position[v] = -1;
+    state.live = (LiveVersions *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(LiveVersions));
+
+    // Interference, walking each block backwards from its live-out set
+    for (int r = 0; r < cfg->rpo_count; r++)
+    {
+        BasicBlock *block = &cfg->blocks[cfg->rpo[r]];
+        const uint64_t *out = liveness.live_out + (size_t)block->id * liveness.words;
+        for (int bit = 0; bit < liveness.bit_count; bit++)
+            if (((out[bit >> 6] >> (bit & 63)) & 1) && state.tracked[liveness.value_of[bit]])
+                live_add(&state, liveness.value_of[bit]);
+
+        for (int i = block->instr_count - 1; i >= 0; i--)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            TacOperand *def = tac_def(instr);
+            if (def && state.tracked[tac_value_index(*def)])
+            {
+                uint32_t value = tac_value_index(*def);
+                uint32_t copied = instr->opcode == TAC_ASSIGN && tac_is_value(instr->op1) ? tac_value_index(instr->op1)
+                                                                                          : UINT32_MAX;
+                LiveVersions *list = &state.live[base_of(cfg, value)];
+                for (int k = 0; k < list->count; k++)
+                    if (list->items[k] != value && list->items[k] != copied)
+                        add_interference(&state, value, list->items[k]);
+                live_remove(&state, value);
+            }
+            TacOperand *uses[3];
+            int use_count = tac_uses(instr, uses);
+            for (int u = 0; u < use_count; u++)
+                if (state.tracked[tac_value_index(*uses[u])])
+                    live_add(&state, tac_value_index(*uses[u]));
+        }
+
+        // Whatever is still live is live on entry; empty the lists again
+        for (int bit = 0; bit < liveness.bit_count; bit++)
+            if (state.live_position[liveness.value_of[bit]] >= 0)
+                live_remove(&state, liveness.value_of[bit]);
+    }
+
+    // Adjacency lists
+    int *adjacency_start = (int *)arena_calloc(&cfg_arena, ((size_t)value_count + 1) * sizeof(int));
+    for (int e = 0; e < state.edge_count; e++)
+        adjacency_start[state.edges[e] + 1]++;
+    for (uint32_t v = 0; v < value_count; v++)
+        adjacency_start[v + 1] += adjacency_start[v];
+    uint32_t *adjacent = (uint32_t *)arena_alloc(&cfg_arena, (size_t)(state.edge_count + 1) * sizeof(uint32_t));
+    int *fill = (int *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(int));
+    memcpy(fill, adjacency_start, (size_t)value_count * sizeof(int));
+    for (int e = 0; e < state.edge_count; e += 2)
+    {
+        adjacent[fill[state.edges[e]]++] = state.edges[e + 1];
+        adjacent[fill[state.edges[e + 1]]++] = state.edges[e];
+    }
+
+    // Greedy grouping. Versions are visited in creation order, which puts the
+    // original (the smallest index) first. group_of[v] is the representative
+    // value of v's group; group_next chains the groups of one original.
+    uint32_t *group_of = (uint32_t *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(uint32_t));
+    uint32_t *first_group = (uint32_t *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(uint32_t));
+    uint32_t *group_next = (uint32_t *)arena_alloc(&cfg_arena, (size_t)value_count * sizeof(uint32_t));
+    uint32_t *blocked = (uint32_t *)arena_calloc(&cfg_arena, (size_t)value_count * sizeof(uint32_t));
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        group_of[v] = UINT32_MAX;
+        first_group[v] = UINT32_MAX;
+    }
+    for (uint32_t v = 0; v < value_count; v++)
+    {
+        if (!state.tracked[v])
+            continue;
+        uint32_t base = base_of(cfg, v);
+        for (int a = adjacency_start[v]; a < adjacency_start[v + 1]; a++)
+            if (group_of[adjacent[a]] != UINT32_MAX)
+                blocked[group_of[adjacent[a]]] = v + 1;
+
+        uint32_t group = first_group[base], last = UINT32_MAX;
+        while (group != UINT32_MAX && blocked[group] == v + 1)
+        {
+            last = group;
+            group = group_next[group];
+        }
+        if (group == UINT32_MAX)
+        {
+            // New group; the original's first group is named after it
+            group = first_group[base] == UINT32_MAX ? base : v;
+            group_next[group] = UINT32_MAX;
+            if (last == UINT32_MAX)
+                first_group[base] = group;
+            else
+                group_next[last] = group;
+        }
+        group_of[v] = group;
+    }
+
+    // Rename, then drop the copies that became self-assignments
+    for (int b = 0; b < cfg->block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            TacOperand *operands[4];
+            int count = tac_uses(instr, operands);
+            TacOperand *def = tac_def(instr);
+            if (def)
+                operands[count++] = def;
+            for (int k = 0; k < count; k++)
+            {
+                uint32_t value = tac_value_index(*operands[k]);
+                if (value < value_count && group_of[value] != UINT32_MAX)
+                {
+                    operands[k]->type = (group_of[value] & 1) ? OP_TEMP : OP_VAR;
+                    operands[k]->val.id = group_of[value] >> 1;
+                }
+            }
+        }
+        int kept = 0;
+        for (int i = 0; i < block->instr_count; i++)
+        {
+            TacInstruction *instr = &block->instrs[i];
+            if (instr->opcode == TAC_ASSIGN && tac_same_value(instr->result, instr->op1))
+                continue;
+            block->instrs[kept++] = *instr;
+        }
+        block->instr_count = kept;
+    }
+}
+
+void ssa_destruct(Cfg *cfg)
+{
+    cfg_compute_dominators(cfg);
+    int block_count = cfg->block_count; // Blocks split off below have no phis
+    char *reachable = (char *)arena_alloc(&cfg_arena, (size_t)block_count);
+    for (int b = 0; b < block_count; b++)
+        reachable[b] = cfg->blocks[b].rpo_index >= 0;
+
+    // A predecessor with two successors cannot hold the copies of one edge
+    for (int b = 0; b < block_count; b++)
+    {
+        if (cfg->blocks[b].phi_count == 0 || !reachable[b])
+            continue;
+        for (int p = 0; p < cfg->blocks[b].pred_count; p++)
+        {
+            int pred = cfg->blocks[b].preds[p];
+            if (pred < block_count && reachable[pred] && cfg->blocks[pred].succ_count > 1)
+                cfg_split_edge(cfg, pred, b);
+        }
+    }
+
+    // One parallel copy per incoming edge, placed before the predecessor's jump
+    for (int b = 0; b < block_count; b++)
+    {
+        BasicBlock *block = &cfg->blocks[b];
+        if (block->phi_count == 0)
+            continue;
+        if (reachable[b])
+        {
+            TacOperand *dest = (TacOperand *)arena_alloc(&cfg_arena, (size_t)block->phi_count * sizeof(TacOperand));
+            TacOperand *src = (TacOperand *)arena_alloc(&cfg_arena, (size_t)block->phi_count * sizeof(TacOperand));
+            for (int p = 0; p < block->pred_count; p++)
+            {
+                int pred = block->preds[p];
+                if (pred < block_count && !reachable[pred])
+                    continue;
+                int count = 0;
+                for (int k = 0; k < block->phi_count; k++)
+                {
+                    if (block->phis[k].args[p].type == OP_NONE)
+                        continue;
+                    dest[count] = block->phis[k].result;
+                    src[count] = block->phis[k].args[p];
+                    count++;
+                }
+                BasicBlock *source = &cfg->blocks[pred];
+                int position = source->instr_count - (cfg_terminator(source) ? 1 : 0);
+                int line = source->instr_count > 0 ? source->instrs[source->instr_count - 1].line_number
+                                                   : cfg->begin.line_number;
+                sequentialize_copies(cfg, pred, position, dest, src, count, line);
+                block = &cfg->blocks[b];
+            }
+        }
+        block->phi_count = 0;
+    }
+
+    merge_versions(cfg);
+
+    // Edges that were split but whose copies all merged away
+    for (int b = block_count; b < cfg->block_count; b++)
+        cfg_remove_forwarder(cfg, b);
+}
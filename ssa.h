@@ -0,0 +1,31 @@
+// ssa.h
+#ifndef SSA_H
+#define SSA_H
+
+#include "cfg.h"
+
+// Puts a function into SSA form. Phis are placed at the iterated dominance
+// frontiers of each value's definitions (semi-pruned: only for values that
+// are live across a block boundary), then every definition of a value that
+// is written more than once, or merged by a phi, gets a fresh version. A
+// version of variable "x" is a new OP_VAR named "x.N"; a version of a temp is
+// a new temp. The original ID stands for the value on entry, so a read that
+// no definition reaches keeps referring to it.
+void ssa_construct(Cfg *cfg);
+
+// Leaves SSA form. Critical edges into blocks with phis are split, each
+// predecessor gets the phi moves as one parallel copy, sequentialized with a
+// temp where the moves form a cycle, and finally the versions of each
+// variable are merged back into as few variables as their live ranges allow,
+// so unoptimized code gets its original variables back.
+void ssa_destruct(Cfg *cfg);
+
+// The value a version was created from (itself for original values).
+TacOperand ssa_original(Cfg *cfg, TacOperand op);
+
+// Declares a value created by a pass to be another version of 'original'
+// (or of whatever 'original' is a version of), so that leaving SSA form
+// may give both the same name.
+void ssa_record_version(Cfg *cfg, TacOperand version, TacOperand original);
+
+#endif // SSA_H
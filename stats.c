@@ -0,0 +1,213 @@
+// stats.c
+#include "stats.h"
+#include "arena.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+uint64_t stats_counters[STATS_COUNTER_COUNT] = {0};
+
+typedef struct PhaseSample
+{
+    int ran;                  // Phase was started at least once
+    double wall_ms;           // Accumulated wall-clock time
+    double cpu_ms;            // Accumulated user + system CPU time
+    long peak_rss_kb;         // Process peak RSS when the phase ended
+    uint64_t allocations;     // Arena allocations made during the phase
+    uint64_t allocated_bytes; // Arena bytes handed out during the phase
+
+    // Values at stats_phase_begin()
+    double wall_start;
+    double cpu_start;
+    uint64_t allocations_start;
+    uint64_t bytes_start;
+} PhaseSample;
+
+static int enabled = 0;
+static PhaseSample phases[STATS_PHASE_COUNT];
+
+static const char *phase_names[STATS_PHASE_COUNT] = {
+    "parse",
+    "semantic",
+    "ir",
+    "opt",
+    "codegen",
+};
+
+static const char *counter_names[STATS_COUNTER_COUNT] = {
+    "tokens",
+    "ast_nodes",
+    "scopes",
+    "symbols",
+    "symbol_lookups",
+    "lookup_scope_steps",
+    "lookup_max_depth",
+    "tac_instructions",
+    "tac_temps",
+    "tac_labels",
+    "basic_blocks",
+    "phis",
+    "ssa_copies",
+    "constants_propagated",
+    "branches_folded",
+    "copies_removed",
+    "dead_instructions",
+    "unreachable_blocks",
+    "cse_eliminated",
+    "algebraic_simplified",
+    "licm_hoisted",
+    "iv_reduced",
+    "iv_tests_replaced",
+    "opt_tac_instructions",
+    "fused_branches",
+    "values_in_registers",
+    "values_spilled",
+    "values_rematerialized",
+    "frame_slots_shared",
+    "frame_bytes",
+    "peephole_loads_forwarded",
+    "peephole_moves_removed",
+    "peephole_movzx_removed",
+    "peephole_zero_idioms",
+    "peephole_jumps",
+    "peephole_dead_stores",
+    "asm_instructions",
+};
+
+static double clock_ms(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static long peak_rss_kb(void)
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return usage.ru_maxrss; // Kilobytes on Linux
+}
+
+void stats_enable(void)
+{
+    enabled = 1;
+}
+
+int stats_enabled(void)
+{
+    return enabled;
+}
+
+void stats_phase_begin(StatsPhase phase)
+{
+    if (!enabled)
+        return;
+    PhaseSample *sample = &phases[phase];
+    sample->ran = 1;
+    sample->wall_start = clock_ms(CLOCK_MONOTONIC);
+    sample->cpu_start = clock_ms(CLOCK_PROCESS_CPUTIME_ID);
+    sample->allocations_start = arena_total_allocations();
+    sample->bytes_start = arena_total_bytes();
+}
+
+void stats_phase_end(StatsPhase phase)
+{
+    if (!enabled)
+        return;
+    PhaseSample *sample = &phases[phase];
+    sample->wall_ms += clock_ms(CLOCK_MONOTONIC) - sample->wall_start;
+    sample->cpu_ms += clock_ms(CLOCK_PROCESS_CPUTIME_ID) - sample->cpu_start;
+    sample->peak_rss_kb = peak_rss_kb();
+    sample->allocations += arena_total_allocations() - sample->allocations_start;
+    sample->allocated_bytes += arena_total_bytes() - sample->bytes_start;
+}
+
+static const Arena *const report_arenas[] = {&ast_arena, &symtab_arena, &tac_arena, &cfg_arena, &codegen_arena};
+#define REPORT_ARENA_COUNT (sizeof(report_arenas) / sizeof(report_arenas[0]))
+
+void stats_print_text(FILE *out, const char *input_filename)
+{
+    double total_wall = 0, total_cpu = 0;
+    uint64_t total_allocations = 0, total_bytes = 0;
+
+    fprintf(out, "Compilation statistics for %s\n", input_filename);
+    fprintf(out, "  %-10s %10s %10s %12s %12s %12s\n", "phase", "wall ms", "cpu ms", "peak RSS KB", "allocations", "alloc bytes");
+    for (int i = 0; i < STATS_PHASE_COUNT; i++)
+    {
+        const PhaseSample *sample = &phases[i];
+        if (!sample->ran)
+            continue;
+        fprintf(out, "  %-10s %10.3f %10.3f %12ld %12llu %12llu\n", phase_names[i], sample->wall_ms, sample->cpu_ms,
+                sample->peak_rss_kb, (unsigned long long)sample->allocations, (unsigned long long)sample->allocated_bytes);
+        total_wall += sample->wall_ms;
+        total_cpu += sample->cpu_ms;
+        total_allocations += sample->allocations;
+        total_bytes += sample->allocated_bytes;
+    }
+    fprintf(out, "  %-10s %10.3f %10.3f %12ld %12llu %12llu\n", "total", total_wall, total_cpu, peak_rss_kb(),
+            (unsigned long long)total_allocations, (unsigned long long)total_bytes);
+
+    fprintf(out, "  counters:\n");
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+        fprintf(out, "    %-24s %8llu\n", counter_names[i], (unsigned long long)stats_counters[i]);
+
+    fprintf(out, "  arenas (peak):\n");
+    for (size_t i = 0; i < REPORT_ARENA_COUNT; i++)
+        fprintf(out, "    %-20s %12zu bytes used, %zu bytes reserved\n", report_arenas[i]->name,
+                report_arenas[i]->peak_used, report_arenas[i]->peak_reserved);
+}
+
+static void write_json_string(FILE *out, const char *text)
+{
+    fputc('"', out);
+    for (const unsigned char *p = (const unsigned char *)text; *p; p++)
+    {
+        if (*p == '"' || *p == '\\')
+            fprintf(out, "\\%c", *p);
+        else if (*p < 0x20)
+            fprintf(out, "\\u%04x", *p);
+        else
+            fputc(*p, out);
+    }
+    fputc('"', out);
+}
+
+int stats_write_json(const char *path, const char *input_filename)
+{
+    FILE *out = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if (!out)
+    {
+        perror("Failed to open stats output file");
+        return 0;
+    }
+
+    fprintf(out, "{\n  \"input\": ");
+    write_json_string(out, input_filename);
+    fprintf(out, ",\n  \"phases\": [");
+    int first = 1;
+    for (int i = 0; i < STATS_PHASE_COUNT; i++)
+    {
+        const PhaseSample *sample = &phases[i];
+        if (!sample->ran)
+            continue;
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"peak_rss_kb\": %ld, "
+                     "\"allocations\": %llu, \"allocated_bytes\": %llu}",
+                first ? "" : ",", phase_names[i], sample->wall_ms, sample->cpu_ms, sample->peak_rss_kb,
+                (unsigned long long)sample->allocations, (unsigned long long)sample->allocated_bytes);
+        first = 0;
+    }
+    fprintf(out, "\n  ],\n  \"peak_rss_kb\": %ld,\n  \"counters\": {", peak_rss_kb());
+    for (int i = 0; i < STATS_COUNTER_COUNT; i++)
+        fprintf(out, "%s\n    \"%s\": %llu", i ? "," : "", counter_names[i], (unsigned long long)stats_counters[i]);
+    fprintf(out, "\n  },\n  \"arenas\": {");
+    for (size_t i = 0; i < REPORT_ARENA_COUNT; i++)
+        fprintf(out, "%s\n    \"%s\": {\"peak_used\": %zu, \"peak_reserved\": %zu}", i ? "," : "",
+                report_arenas[i]->name, report_arenas[i]->peak_used, report_arenas[i]->peak_reserved);
+    fprintf(out, "\n  }\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+    return 1;
+}
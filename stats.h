@@ -0,0 +1,91 @@
+// stats.h
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Compile-time statistics for --stats / --stats-json.
+// Counters are plain increments and are always maintained; timing and memory
+// sampling only happen when a report was requested.
+
+typedef enum StatsPhase
+{
+    STATS_PHASE_PARSE,    // Lexing and parsing (yyparse drives the lexer)
+    STATS_PHASE_SEMANTIC, // analyze_semantics
+    STATS_PHASE_IR,       // generate_ir
+    STATS_PHASE_OPT,      // optimize_tac
+    STATS_PHASE_CODEGEN,  // generate_x86_assembly
+    STATS_PHASE_COUNT
+} StatsPhase;
+
+typedef enum StatsCounter
+{
+    STAT_TOKENS,             // Tokens handed to the parser
+    STAT_AST_NODES,          // Nodes created by create_node()
+    STAT_SCOPES,             // Scopes created
+    STAT_SYMBOLS,            // Symbols inserted
+    STAT_SYMBOL_LOOKUPS,     // lookup_symbol() and lookup_symbol_in_current_scope() calls
+    STAT_LOOKUP_SCOPE_STEPS, // Scopes probed by those lookups in total
+    STAT_LOOKUP_MAX_DEPTH,   // Most scopes probed by a single lookup
+    STAT_TAC_INSTRUCTIONS,   // Instructions in the TAC program
+    STAT_TAC_TEMPS,          // Temps allocated by IR generation
+    STAT_TAC_LABELS,         // Entries in the TAC label table
+    STAT_BASIC_BLOCKS,       // Basic blocks created by CFG construction and passes
+    STAT_PHIS,               // Phi functions inserted by SSA construction
+    STAT_SSA_COPIES,         // Phi moves inserted when leaving SSA form
+    STAT_CONSTANTS_PROPAGATED, // Operands replaced by a constant
+    STAT_BRANCHES_FOLDED,    // Conditional jumps on a constant turned into plain edges
+    STAT_COPIES_REMOVED,     // Copies and single-value phis removed by copy propagation
+    STAT_DEAD_INSTRUCTIONS,  // Instructions and phis deleted because their result is never used
+    STAT_UNREACHABLE_BLOCKS, // Blocks cut out because control can no longer reach them
+    STAT_CSE_ELIMINATED,     // Expressions reused from earlier in their block
+    STAT_ALGEBRAIC_SIMPLIFIED, // Instructions rewritten by an algebraic identity
+    STAT_LICM_HOISTED,       // Loop-invariant instructions moved to a preheader
+    STAT_IV_REDUCED,         // Induction variable products turned into additions
+    STAT_IV_TESTS_REPLACED,  // Loop tests moved onto a strength-reduced variable
+    STAT_OPT_TAC_INSTRUCTIONS, // Instructions in the TAC program after optimization
+    STAT_FUSED_BRANCHES,     // Comparisons emitted as cmp + jcc on the branch using them
+    STAT_VALUES_IN_REGISTERS, // Values given a register for their whole interval
+    STAT_VALUES_SPILLED,     // Values left in a frame slot for lack of registers
+    STAT_VALUES_REMATERIALIZED, // Spilled constants whose uses read the literal instead
+    STAT_FRAME_SLOTS_SHARED, // Spilled values that reuse the frame slot of an earlier one
+    STAT_FRAME_BYTES,        // Stack frame bytes, summed over all functions
+    STAT_PEEPHOLE_LOADS_FORWARDED, // Frame slot reads replaced by the register or constant just stored there
+    STAT_PEEPHOLE_MOVES_REMOVED, // Copies and loads folded into the instruction next to them
+    STAT_PEEPHOLE_MOVZX_REMOVED, // Zero extensions of a register that needed none
+    STAT_PEEPHOLE_ZERO_IDIOMS, // "cmp r, 0" and "mov r, 0" turned into test and xor
+    STAT_PEEPHOLE_JUMPS,     // Jumps deleted, inverted over a jmp or threaded through one
+    STAT_PEEPHOLE_DEAD_STORES, // Stores to frame slots that no path reads before the next write
+    STAT_ASM_INSTRUCTIONS,   // Instructions written to the .s file
+    STATS_COUNTER_COUNT
+} StatsCounter;
+
+extern uint64_t stats_counters[STATS_COUNTER_COUNT];
+
+#define STATS_ADD(counter, n) (stats_counters[(counter)] += (uint64_t)(n))
+#define STATS_INC(counter) (stats_counters[(counter)]++)
+#define STATS_MAX(counter, n)                                  \
+    do                                                         \
+    {                                                          \
+        if ((uint64_t)(n) > stats_counters[(counter)])         \
+            stats_counters[(counter)] = (uint64_t)(n);         \
+    } while (0)
+
+// Turns on phase sampling. Call before the first stats_phase_begin().
+void stats_enable(void);
+int stats_enabled(void);
+
+// Bracket each phase. Records wall and CPU time, the process's peak RSS at
+// the end of the phase, and the arena allocations made during it.
+void stats_phase_begin(StatsPhase phase);
+void stats_phase_end(StatsPhase phase);
+
+// Human-readable report (one table row per phase, then the counters).
+void stats_print_text(FILE *out, const char *input_filename);
+
+// The same data as a single JSON object. Returns 0 if 'path' cannot be
+// written ("-" writes to stdout).
+int stats_write_json(const char *path, const char *input_filename);
+
+#endif // STATS_H
@@ -3,59 +3,59 @@
 #include <string.h>
 #include "symbol_table.h"
 #include "ast.h" // For error reporting line numbers from nodes if needed
+#include "arena.h"
+#include "stats.h"
 
 // --- Global Scope Management ---
 Scope *current_scope = NULL;
 Scope *global_root_scope = NULL; // Defined here, declared extern in .h
 int next_scope_level = 0;        // To assign scope levels
+uint32_t symbol_count = 0;       // Next SymbolTableEntry::index
 
-// --- Internal list to track all created scopes for robust freeing ---
-// This dynamic array will hold pointers to all Scope structs allocated by create_scope.
-static Scope **all_created_scopes = NULL;
-static int num_created_scopes = 0;
-static int capacity_created_scopes = 0; // Initial capacity, will grow as needed
+// Scopes, entries and hash tables are allocated from symtab_arena and
+// released together by free_symbol_table(); scopes stay reachable through the
+// AST until then.
 
-// --- Helper Functions (Static for internal use) ---
+#define SCOPE_INITIAL_BUCKETS 8
 
-// Helper function to dynamically resize the all_created_scopes array
-static void resize_all_created_scopes_list()
+// Atoms are handed out densely, so a multiplicative hash spreads them evenly
+static inline uint32_t scope_hash(Atom name, uint32_t mask)
 {
-    int new_capacity = (capacity_created_scopes == 0) ? 4 : capacity_created_scopes * 2;
-    Scope **temp = (Scope **)realloc(all_created_scopes, new_capacity * sizeof(Scope *));
-    if (!temp)
-    {
-        fprintf(stderr, "Fatal: Memory reallocation failed for all_created_scopes list.\n");
-        exit(EXIT_FAILURE);
-    }
-    all_created_scopes = temp;
-    capacity_created_scopes = new_capacity;
+    return (name * 2654435761u) & mask;
 }
 
-// Helper function to free a single symbol entry (only its dynamically allocated members)
-void free_symbol_entry(SymbolTableEntry *entry)
+// Returns the bucket holding 'name' in 'scope', or the empty bucket where it
+// would be inserted. The scope must have a table.
+static SymbolTableEntry **scope_probe(Scope *scope, Atom name)
 {
-    if (entry)
-    {
-        free(entry->name); // Free the strdup'd name
-        // Note: entry->declaration_node is part of the AST and freed separately
-        free(entry);
-    }
+    uint32_t i = scope_hash(name, scope->bucket_mask);
+    while (scope->buckets[i] != NULL && scope->buckets[i]->atom != name)
+        i = (i + 1) & scope->bucket_mask;
+    return &scope->buckets[i];
 }
 
-// Helper function to free only the entries within a scope (but not the scope struct itself)
-static void free_scope_entries_only(Scope *scope)
+// Doubles the scope's table (or creates it). The old table is left in the arena.
+static void scope_grow(Scope *scope)
 {
-    if (!scope)
-        return;
-    SymbolTableEntry *current_entry = scope->head_entry;
-    SymbolTableEntry *next_entry;
-    while (current_entry != NULL)
+    uint32_t new_size = scope->buckets ? (scope->bucket_mask + 1) * 2 : SCOPE_INITIAL_BUCKETS;
+    SymbolTableEntry **old_buckets = scope->buckets;
+    uint32_t old_size = old_buckets ? scope->bucket_mask + 1 : 0;
+
+    scope->buckets = (SymbolTableEntry **)arena_calloc(&symtab_arena, new_size * sizeof(SymbolTableEntry *));
+    scope->bucket_mask = new_size - 1;
+    for (uint32_t i = 0; i < old_size; i++)
     {
-        next_entry = current_entry->next;
-        free_symbol_entry(current_entry);
-        current_entry = next_entry;
+        if (old_buckets[i])
+            *scope_probe(scope, old_buckets[i]->atom) = old_buckets[i];
     }
-    scope->head_entry = NULL; // Mark as empty
+}
+
+// Looks a name up in one scope only.
+static SymbolTableEntry *scope_find(Scope *scope, Atom name)
+{
+    if (!scope->buckets)
+        return NULL;
+    return *scope_probe(scope, name);
 }
 
 // --- Symbol Table Operations ---
@@ -74,60 +74,34 @@ void init_symbol_table()
     global_root_scope->scope_level = 0;     // Explicitly set level 0
     current_scope = global_root_scope;      // Set current scope to global
     next_scope_level = 1;                   // Next scope created will be level 1
+    symbol_count = 0;
     // printf("Symbol table initialized. Global scope (level 0) entered.\n");
 }
 
-// Frees all allocated scopes and their symbol entries.
+// Frees all scopes and their symbol entries in one step.
 void free_symbol_table()
 {
-    // Iterate through the list of all created scopes and free them
-    for (int i = 0; i < num_created_scopes; i++)
-    {
-        if (all_created_scopes[i] != NULL)
-        {
-            free_scope_entries_only(all_created_scopes[i]); // Free entries within this scope
-            free(all_created_scopes[i]);                    // Free the Scope struct itself
-            all_created_scopes[i] = NULL;                   // Mark as freed
-        }
-    }
-
-    // Free the list that tracked all scopes
-    if (all_created_scopes != NULL)
-    {
-        free(all_created_scopes);
-        all_created_scopes = NULL;
-    }
+    arena_release(&symtab_arena);
 
     // Reset global pointers and counters
     current_scope = NULL;
     global_root_scope = NULL;
-    num_created_scopes = 0;
-    capacity_created_scopes = 0;
     next_scope_level = 0;
+    symbol_count = 0;
     // printf("All symbol table memory freed.\n");
 }
 
-// Creates a new scope object.
-// This function is also responsible for tracking all created scopes for later cleanup.
+// Creates a new scope object in symtab_arena.
 Scope *create_scope(Scope *parent_scope)
 {
-    Scope *new_scope = (Scope *)malloc(sizeof(Scope));
-    if (!new_scope)
-    {
-        fprintf(stderr, "Fatal: Memory allocation failed for new scope.\n");
-        exit(EXIT_FAILURE);
-    }
+    Scope *new_scope = (Scope *)arena_alloc(&symtab_arena, sizeof(Scope));
     new_scope->head_entry = NULL;
+    new_scope->buckets = NULL; // Created on the first insert; most block scopes stay empty
+    new_scope->bucket_mask = 0;
+    new_scope->symbol_count = 0;
     new_scope->parent = parent_scope;
     new_scope->scope_level = next_scope_level++; // Assign level and increment for next
-
-    // Add this new scope to our global tracking list
-    if (num_created_scopes == capacity_created_scopes)
-    {
-        resize_all_created_scopes_list();
-    }
-    all_created_scopes[num_created_scopes++] = new_scope;
-
+    STATS_INC(STAT_SCOPES);
     return new_scope;
 }
 
@@ -139,8 +113,8 @@ void enter_scope()
 }
 
 // Exits the current scope, moving current_scope to its parent.
-// Note: This function does NOT free the exited scope's memory.
-// Memory management is handled centrally by free_symbol_table().
+// Note: This function does NOT free the exited scope's memory; the AST keeps
+// pointing at it. All scopes are released together by free_symbol_table().
 void exit_scope()
 {
     if (!current_scope)
@@ -156,87 +130,83 @@ void exit_scope()
 
 // Inserts a symbol into the *current* scope.
 // Returns 1 on success, 0 if symbol already exists in the current scope (redeclaration error).
-int insert_symbol(const char *name, TypeKind type, int line_number, int is_final, AstNode *decl_node)
+int insert_symbol(Atom name, TypeKind type, int line_number, int is_final, AstNode *decl_node)
 {
     if (!current_scope)
     {
-        fprintf(stderr, "Error line %d: Cannot insert symbol '%s', no current scope active.\n", line_number, name);
+        fprintf(stderr, "Error line %d: Cannot insert symbol '%s', no current scope active.\n", line_number, atom_name(name));
         return 0; // Failure
     }
 
     // Check for redeclaration in the *current* scope only
     if (lookup_symbol_in_current_scope(name) != NULL)
     {
-        fprintf(stderr, "Semantic Error line %d: Variable '%s' already declared in this scope.\n", line_number, name);
+        fprintf(stderr, "Semantic Error line %d: Variable '%s' already declared in this scope.\n", line_number, atom_name(name));
         return 0; // Failure - redeclaration
     }
 
-    SymbolTableEntry *new_entry = (SymbolTableEntry *)malloc(sizeof(SymbolTableEntry));
-    if (!new_entry)
-    {
-        fprintf(stderr, "Fatal: Memory allocation failed for symbol entry '%s'.\n", name);
-        exit(EXIT_FAILURE);
-    }
+    SymbolTableEntry *new_entry = (SymbolTableEntry *)arena_alloc(&symtab_arena, sizeof(SymbolTableEntry));
 
-    new_entry->name = strdup(name); // Duplicate the name string
-    if (!new_entry->name)
-    {
-        fprintf(stderr, "Fatal: Memory allocation failed for symbol name '%s'.\n", name);
-        free(new_entry);
-        exit(EXIT_FAILURE);
-    }
+    new_entry->atom = name;
+    new_entry->name = atom_name(name); // Shared spelling, not a copy
     new_entry->type = type;
     new_entry->line_number = line_number;
     new_entry->is_final = is_final;
     // Set is_initialized based on initializer presence, and if it's final (finals usually must be initialized)
     new_entry->is_initialized = (decl_node && decl_node->node_type == NODE_VARIABLE_DECLARATION && ((VariableDeclarationNode *)decl_node)->initializer != NULL) || is_final;
     new_entry->declaration_node = decl_node;
+    new_entry->index = symbol_count++; // Shadowing declarations get distinct indices
     new_entry->next = NULL; // Initialize next pointer
 
-    // Add to the head of the current scope's linked list of entries
+    // Keep the table at most half full so probe sequences stay short
+    if ((current_scope->symbol_count + 1) * 2 > (current_scope->buckets ? current_scope->bucket_mask + 1 : 0))
+        scope_grow(current_scope);
+    *scope_probe(current_scope, name) = new_entry;
+    current_scope->symbol_count++;
+    STATS_INC(STAT_SYMBOLS);
+
+    // Also link it into the scope's declaration-order list
     new_entry->next = current_scope->head_entry;
     current_scope->head_entry = new_entry;
 
-    // printf("Inserted symbol '%s' (type %d) in scope level %d.\n", name, type, current_scope->scope_level);
+    // printf("Inserted symbol '%s' (type %d) in scope level %d.\n", atom_name(name), type, current_scope->scope_level);
     return 1; // Success
 }
 
 // Looks up a symbol only in the *current* scope.
 // Returns a pointer to the SymbolTableEntry if found, otherwise NULL.
-SymbolTableEntry *lookup_symbol_in_current_scope(const char *name)
+SymbolTableEntry *lookup_symbol_in_current_scope(Atom name)
 {
     if (!current_scope)
         return NULL;
-    SymbolTableEntry *current_entry = current_scope->head_entry;
-    while (current_entry != NULL)
-    {
-        if (strcmp(current_entry->name, name) == 0)
-        {
-            return current_entry; // Found in current scope
-        }
-        current_entry = current_entry->next;
-    }
-    return NULL; // Not found in current scope
+    STATS_INC(STAT_SYMBOL_LOOKUPS);
+    STATS_INC(STAT_LOOKUP_SCOPE_STEPS);
+    STATS_MAX(STAT_LOOKUP_MAX_DEPTH, 1);
+    return scope_find(current_scope, name); // NULL if not found in current scope
 }
 
 // Looks up a symbol by name, starting from the current scope and going up to parent scopes.
 // Returns a pointer to the SymbolTableEntry if found, otherwise NULL.
-SymbolTableEntry *lookup_symbol(const char *name)
+SymbolTableEntry *lookup_symbol(Atom name)
 {
     Scope *scope_to_search = current_scope; // Start searching from the current active scope
+    SymbolTableEntry *entry = NULL;
+    int depth = 0; // Scopes probed, for --stats
     while (scope_to_search != NULL)
     {
-        SymbolTableEntry *entry = scope_to_search->head_entry;
-        while (entry != NULL)
+        depth++;
+        entry = scope_find(scope_to_search, name);
+        if (entry != NULL)
         {
-            if (strcmp(entry->name, name) == 0)
-            {
-                return entry; // Found the symbol
-            }
-            entry = entry->next;
+            break; // Found the symbol
         }
         scope_to_search = scope_to_search->parent; // Move to the parent (enclosing) scope
     }
-    // printf("Lookup: Symbol '%s' not found in any accessible scope.\n", name);
+    STATS_INC(STAT_SYMBOL_LOOKUPS);
+    STATS_ADD(STAT_LOOKUP_SCOPE_STEPS, depth);
+    STATS_MAX(STAT_LOOKUP_MAX_DEPTH, depth);
+    if (entry != NULL)
+        return entry;
+    // printf("Lookup: Symbol '%s' not found in any accessible scope.\n", atom_name(name));
     return NULL; // Symbol not found in any scope
 }
\ No newline at end of file
@@ -3,24 +3,33 @@
 
 #include "symbol_table_types.h" // For TypeKind and Scope forward decl
 #include "ast_fwd.h"            // Forward declarations of AST nodes if needed, or include full ast.h
+#include "intern.h"             // Atom
 
 // --- Symbol Table Entry ---
 typedef struct SymbolTableEntry
 {
-    char *name;
+    Atom atom;        // Interned name, used for all lookups
+    const char *name; // Spelling of 'atom' (owned by the intern table)
     TypeKind type;
     int line_number;                  // Line number of declaration
     int is_final;                     // Is it a final variable?
     int is_initialized;               // Has it been initialized? (for semantic checks)
     struct AstNode *declaration_node; // Pointer back to the AST declaration node
-    struct SymbolTableEntry *next;    // For linked list in scope
+    uint32_t index;                   // Dense program-wide number (0 .. symbol_count-1), used as the TAC variable ID
+    struct SymbolTableEntry *next;    // Previously declared entry in the same scope
 } SymbolTableEntry;
 
 // --- Scope Structure ---
 // Full definition of Scope
+// Each scope keeps its symbols in an open-addressing hash table keyed by atom
+// (linear probing, at most half full), so finding a name in a scope costs
+// the same no matter how many symbols the scope holds.
 struct Scope
 {
-    SymbolTableEntry *head_entry; // Head of the list of symbols in this scope
+    SymbolTableEntry *head_entry; // Most recently declared symbol (declaration order, newest first)
+    SymbolTableEntry **buckets;   // Hash table of entries; NULL until the first insert
+    uint32_t bucket_mask;         // Table size - 1 (the size is a power of two)
+    uint32_t symbol_count;        // Number of entries in this scope
     struct Scope *parent;         // Pointer to the parent (enclosing) scope
     int scope_level;              // Depth of the scope (0 for global)
     // You might add more: e.g., a list of child scopes, scope name for debugging
@@ -29,6 +38,7 @@ struct Scope
 // --- Global Scope Management (declared here, defined in symbol_table.c) ---
 extern Scope *current_scope;
 extern Scope *global_root_scope;
+extern uint32_t symbol_count; // Number of entries inserted since init_symbol_table()
 
 // --- Symbol Table Operations ---
 void init_symbol_table(void);
@@ -38,9 +48,9 @@ Scope *create_scope(Scope *parent_scope);
 void enter_scope(void); // Creates a new scope and enters it
 void exit_scope(void);  // Exits current scope, does not free it
 
-int insert_symbol(const char *name, TypeKind type, int line_number, int is_final, struct AstNode *decl_node);
-SymbolTableEntry *lookup_symbol(const char *name);                  // Searches current and parent scopes
-SymbolTableEntry *lookup_symbol_in_current_scope(const char *name); // Searches only current scope
+int insert_symbol(Atom name, TypeKind type, int line_number, int is_final, struct AstNode *decl_node);
+SymbolTableEntry *lookup_symbol(Atom name);                  // Searches current and parent scopes
+SymbolTableEntry *lookup_symbol_in_current_scope(Atom name); // Searches only current scope
 
 // Helper (if needed externally, otherwise static in .c)
 // void free_symbol_entry(SymbolTableEntry *entry);
@@ -1,29 +1,32 @@
 #include "tac.h"
+#include "arena.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-// Global pointers for the TAC instruction list
-TacInstruction *tac_head = NULL;
-TacInstruction *tac_tail = NULL;
-
-// Counters for unique temporary variables and labels
-static int temp_counter = 0;
-static int label_counter = 0;
+// The program being generated; instructions and labels live in tac_arena
+TacProgram tac_program = {0};
 
 // Initialize or reset the TAC generator state
 void init_tac_generator()
 {
-    if (tac_head != NULL) {
-        // It's good practice to free existing TAC if re-initializing
-        // to prevent memory leaks.
-        // printf("Warning: Re-initializing TAC generator. Freeing existing TAC.\n");
+    if (tac_program.instrs != NULL || tac_program.labels != NULL) {
+        // Release any TAC from a previous run before starting over.
         free_tac_code();
     }
-    tac_head = NULL;
-    tac_tail = NULL;
-    temp_counter = 0;
-    label_counter = 0;
+    memset(&tac_program, 0, sizeof(tac_program));
+}
+
+// Grows an arena-backed vector geometrically. The old array is simply left
+// behind in tac_arena; it is reclaimed with everything else by free_tac_code().
+static void *grow_tac_vector(void *old, int count, int *capacity, size_t elem_size, int initial)
+{
+    int new_capacity = *capacity ? *capacity * 2 : initial;
+    void *grown = arena_alloc(&tac_arena, (size_t)new_capacity * elem_size);
+    if (count > 0)
+        memcpy(grown, old, (size_t)count * elem_size);
+    *capacity = new_capacity;
+    return grown;
 }
 
 // Helper function to convert TypeKind enum to string for printing
@@ -44,39 +47,26 @@ const char *type_to_string(TypeKind type)
     }
 }
 
-// Create a new TAC instruction
-TacInstruction *create_tac_instruction(TacOpCode opcode, TacOperand result, TacOperand op1, TacOperand op2, int line_num)
+// Append a new TAC instruction to the program
+void emit_tac(TacOpCode opcode, TacOperand result, TacOperand op1, TacOperand op2, int line_num)
 {
-    TacInstruction *instr = (TacInstruction *)malloc(sizeof(TacInstruction));
-    if (!instr)
-    {
-        fprintf(stderr, "Fatal: Memory allocation failed for TAC instruction.\n");
-        exit(EXIT_FAILURE);
-    }
+    if (tac_program.count == tac_program.capacity)
+        tac_program.instrs = grow_tac_vector(tac_program.instrs, tac_program.count, &tac_program.capacity,
+                                             sizeof(TacInstruction), 256);
+
+    int position = tac_program.count++;
+    TacInstruction *instr = &tac_program.instrs[position];
     instr->opcode = opcode;
     instr->result = result;
     instr->op1 = op1;
     instr->op2 = op2;
-    instr->next = NULL;
-    // instr->prev = NULL; // This line was removed as 'prev' is not in your TacInstruction struct
     instr->line_number = line_num;
-    return instr;
-}
 
-// Add a new TAC instruction to the end of the list
-void emit_tac(TacOpCode opcode, TacOperand result, TacOperand op1, TacOperand op2, int line_num)
-{
-    TacInstruction *new_instr = create_tac_instruction(opcode, result, op1, op2, line_num);
-    if (tac_head == NULL)
-    {
-        tac_head = new_instr;
-        tac_tail = new_instr;
-    }
-    else
-    {
-        tac_tail->next = new_instr;
-        tac_tail = new_instr;
-    }
+    // Record where each label is defined so jumps can be resolved by index.
+    if (opcode == TAC_LABEL && result.type == OP_LABEL)
+        tac_program.labels[result.val.id].position = position;
+    else if (opcode == TAC_FUNCTION_BEGIN && op1.type == OP_LABEL)
+        tac_program.labels[op1.val.id].position = position;
 }
 
 // --- Operand Creation Helpers ---
@@ -86,24 +76,31 @@ TacOperand create_tac_none_operand()
     TacOperand op;
     op.type = OP_NONE;
     op.data_type = TYPE_VOID;
-    op.val.name = NULL;
+    op.val.id = 0;
     return op;
 }
 
-TacOperand create_tac_var_operand(const char *name, TypeKind type)
+TacOperand create_tac_var_operand(uint32_t var_id, Atom name, TypeKind type)
 {
     TacOperand op;
     op.type = OP_VAR;
-    if (name) {
-        op.val.name = strdup(name);
-        if (!op.val.name) {
-            fprintf(stderr, "Fatal: strdup failed for variable name.\n");
-            exit(EXIT_FAILURE);
-        }
-    } else {
+    if (name == ATOM_NONE) {
         fprintf(stderr, "Fatal: NULL name provided for variable operand.\n");
         exit(EXIT_FAILURE);
     }
+
+    // Grow the name table until it covers var_id; unused entries stay ATOM_NONE
+    while ((int)var_id >= tac_program.var_capacity) {
+        int old_capacity = tac_program.var_capacity;
+        tac_program.var_names = grow_tac_vector(tac_program.var_names, tac_program.var_count,
+                                                &tac_program.var_capacity, sizeof(Atom), 64);
+        memset(tac_program.var_names + old_capacity, 0, (size_t)(tac_program.var_capacity - old_capacity) * sizeof(Atom));
+    }
+    if ((int)var_id >= tac_program.var_count)
+        tac_program.var_count = (int)var_id + 1;
+    tac_program.var_names[var_id] = name;
+
+    op.val.id = var_id;
     op.data_type = type;
     return op;
 }
@@ -112,7 +109,7 @@ TacOperand create_tac_temp_operand(TypeKind type)
 {
     TacOperand op;
     op.type = OP_TEMP;
-    op.val.name = generate_new_temp_name(); // This should return an allocated string
+    op.val.id = tac_program.temp_count++;
     op.data_type = type;
     return op;
 }
@@ -157,73 +154,63 @@ TacOperand create_tac_string_literal_operand(const char *val)
 {
     TacOperand op;
     op.type = OP_STRING_LIT;
-    if (val) {
-        op.val.name = strdup(val);
-        if (!op.val.name) {
-            fprintf(stderr, "Fatal: strdup failed for string literal.\n");
-            exit(EXIT_FAILURE);
-        }
-    } else {
-        op.val.name = strdup(""); // Handle NULL by creating an empty string
-        if (!op.val.name) {
-            fprintf(stderr, "Fatal: strdup failed for empty string literal.\n");
-            exit(EXIT_FAILURE);
-        }
-    }
+    op.val.id = intern_cstr(val ? val : ""); // Equal literals share one atom
     op.data_type = TYPE_STRING;
     return op;
 }
 
-TacOperand create_tac_label_operand(const char *label_name)
+TacOperand create_tac_label_operand(int label_id)
 {
     TacOperand op;
     op.type = OP_LABEL;
-    if (label_name) {
-        op.val.name = strdup(label_name);
-        if (!op.val.name) {
-            fprintf(stderr, "Fatal: strdup failed for label name.\n");
-            exit(EXIT_FAILURE);
-        }
-    } else {
-        fprintf(stderr, "Fatal: NULL name provided for label operand.\n");
+    if (label_id < 0 || label_id >= tac_program.label_count) {
+        fprintf(stderr, "Fatal: Invalid label ID %d provided for label operand.\n", label_id);
         exit(EXIT_FAILURE);
     }
+    op.val.id = (uint32_t)label_id;
     op.data_type = TYPE_VOID;
     return op;
 }
 
-// --- Name Generation Helpers ---
-// These functions now use strdup to return allocated memory,
-// consistent with how operands store names.
-// returns a new temp name like _t3
-char *generate_new_temp_name()
+// --- Label Table ---
+
+static int add_tac_label(Atom name)
 {
-    char buffer[16]; // Temporary buffer for sprintf
-    sprintf(buffer, "_t%d", temp_counter++);
-    char *name = strdup(buffer);
-    if (!name) {
-        fprintf(stderr, "Fatal: strdup failed for temp name.\n");
-        exit(EXIT_FAILURE);
-    }
-    return name;
+    if (tac_program.label_count == tac_program.label_capacity)
+        tac_program.labels = grow_tac_vector(tac_program.labels, tac_program.label_count,
+                                             &tac_program.label_capacity, sizeof(TacLabel), 64);
+
+    int id = tac_program.label_count++;
+    tac_program.labels[id].name = name;
+    tac_program.labels[id].position = -1;
+    return id;
 }
 
-//returns a new label like L2.
-char *generate_new_label_name()
+// returns a new generated label, printed as L<id>
+int new_tac_label()
 {
-    char buffer[16]; // Temporary buffer for sprintf
-    sprintf(buffer, "L%d", label_counter++);
-    char *name = strdup(buffer);
-    if (!name) {
-        fprintf(stderr, "Fatal: strdup failed for label name.\n");
-        exit(EXIT_FAILURE);
-    }
-    return name;
+    return add_tac_label(ATOM_NONE);
+}
+
+// returns a new label that keeps its source-level name (function entry points)
+int new_tac_named_label(Atom name)
+{
+    return add_tac_label(name);
+}
+
+const char *tac_label_name(int label_id, char *buf, size_t size)
+{
+    Atom name = tac_program.labels[label_id].name;
+    if (name != ATOM_NONE)
+        snprintf(buf, size, "%s", atom_name(name));
+    else
+        snprintf(buf, size, "L%d", label_id);
+    return buf;
 }
 
 // --- Debugging: Print TAC Code ---
 
-static void print_tac_operand(FILE *fp, TacOperand op)
+void print_tac_operand(FILE *fp, TacOperand op)
 {
     switch (op.type)
     {
@@ -231,14 +218,19 @@ static void print_tac_operand(FILE *fp, TacOperand op)
         // fprintf(fp, "_"); // Optionally print a placeholder
         break;
     case OP_VAR:
+        fprintf(fp, "%s", atom_name(tac_program.var_names[op.val.id]));
+        break;
     case OP_TEMP:
+        fprintf(fp, "_t%u", op.val.id);
+        break;
     case OP_LABEL:
-        if (op.val.name) fprintf(fp, "%s", op.val.name);
-        else fprintf(fp, "<NULL_NAME_OP>"); // Should not happen
+    {
+        char label[64];
+        fprintf(fp, "%s", tac_label_name(op.val.id, label, sizeof(label)));
         break;
+    }
     case OP_STRING_LIT:
-        if (op.val.name) fprintf(fp, "\"%s\"", op.val.name);
-        else fprintf(fp, "<NULL_STRING_LIT>"); // Should not happen
+        fprintf(fp, "\"%s\"", atom_name(op.val.id));
         break;
     case OP_LIT_INT:
         fprintf(fp, "%d", op.val.int_val);
@@ -259,146 +251,119 @@ static void print_tac_operand(FILE *fp, TacOperand op)
     }
 }
 
+// Prints one instruction in the listing format, without index or newline.
+void print_tac_instruction(FILE *fp, const TacInstruction *current)
+{
+    switch (current->opcode)
+    {
+    case TAC_NOP: fprintf(fp, "NOP"); break;
+    case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD:
+    case TAC_LT:  case TAC_GT:  case TAC_LEQ: case TAC_GEQ:
+    case TAC_EQ:  case TAC_NEQ: case TAC_AND: case TAC_OR:
+        print_tac_operand(fp, current->result); fprintf(fp, " = ");
+        print_tac_operand(fp, current->op1);
+        switch (current->opcode) {
+            case TAC_ADD: fprintf(fp, " + "); break; case TAC_SUB: fprintf(fp, " - "); break;
+            case TAC_MUL: fprintf(fp, " * "); break; case TAC_DIV: fprintf(fp, " / "); break;
+            case TAC_MOD: fprintf(fp, " %% "); break; case TAC_LT:  fprintf(fp, " < "); break;
+            case TAC_GT:  fprintf(fp, " > "); break; case TAC_LEQ: fprintf(fp, " <= "); break;
+            case TAC_GEQ: fprintf(fp, " >= "); break; case TAC_EQ:  fprintf(fp, " == "); break;
+            case TAC_NEQ: fprintf(fp, " != "); break; case TAC_AND: fprintf(fp, " && "); break;
+            case TAC_OR:  fprintf(fp, " || "); break;
+            default: break; 
+        }
+        print_tac_operand(fp, current->op2);
+        break;
+    case TAC_ASSIGN:
+        print_tac_operand(fp, current->result); fprintf(fp, " = ");
+        print_tac_operand(fp, current->op1);
+        break;
+    case TAC_LABEL: // Label name is in result
+        print_tac_operand(fp, current->result); fprintf(fp, ":");
+        break;
+    case TAC_GOTO: // Target label is in result
+        fprintf(fp, "GOTO "); print_tac_operand(fp, current->result);
+        break;
+    case TAC_IF_GOTO: // Condition in op1, target label in result
+        fprintf(fp, "IF "); print_tac_operand(fp, current->op1);    
+        fprintf(fp, " GOTO "); print_tac_operand(fp, current->result); 
+        break;
+    case TAC_IF_NOT_GOTO: // Condition in op1, target label in result
+        fprintf(fp, "IF NOT "); print_tac_operand(fp, current->op1);    
+        fprintf(fp, " GOTO "); print_tac_operand(fp, current->result); 
+        break;
+    case TAC_NOT:
+        print_tac_operand(fp, current->result); fprintf(fp, " = !");
+        print_tac_operand(fp, current->op1);
+        break;
+    case TAC_UMINUS:
+        print_tac_operand(fp, current->result); fprintf(fp, " = -");
+        print_tac_operand(fp, current->op1);
+        break;
+    case TAC_PRINT: // Value to print is in op1
+        fprintf(fp, "PRINT "); print_tac_operand(fp, current->op1); 
+        break;
+    case TAC_RETURN: // Value to return is in op1 (or OP_NONE)
+        fprintf(fp, "RETURN "); print_tac_operand(fp, current->op1); 
+        break;
+    case TAC_CALL: // Function name in op1, return value (if any) in result
+        if (current->result.type != OP_NONE) {
+            print_tac_operand(fp, current->result); fprintf(fp, " = ");
+        }
+        fprintf(fp, "CALL "); print_tac_operand(fp, current->op1); 
+        break;
+    case TAC_PARAM: // Parameter value in op1
+        fprintf(fp, "PARAM "); print_tac_operand(fp, current->op1);
+        break;
+    case TAC_FUNCTION_BEGIN: // Function name in op1            
+        if(current->op1.type == OP_LABEL) { print_tac_operand(fp, current->op1); fprintf(fp, ":"); }
+        else fprintf(fp, "<ERROR_FUNC_BEGIN>:"); // Should be a label operand
+        break;
+    case TAC_FUNCTION_END: 
+        // No standard TAC output, but could be a comment
+        // if(current->op1.type == OP_LABEL) { fprintf(fp, "; End "); print_tac_operand(fp, current->op1); }
+        break;
+    case TAC_ARRAY_STORE: // result_array[op1_index] = op2_value
+        print_tac_operand(fp, current->result); fprintf(fp, "[");
+        print_tac_operand(fp, current->op1);    fprintf(fp, "] = ");
+        print_tac_operand(fp, current->op2);    
+        break;
+    case TAC_ARRAY_LOAD:  // result_dest = op1_array[op2_index] 
+        print_tac_operand(fp, current->result); fprintf(fp, " = ");
+        print_tac_operand(fp, current->op1);    fprintf(fp, "[");
+        print_tac_operand(fp, current->op2);    fprintf(fp, "]");
+        break;
+    case TAC_NEW_ARRAY: // result_array = NEW_ARRAY element_type(in result.data_type), op1_size
+        print_tac_operand(fp, current->result);
+        fprintf(fp, " = NEW_ARRAY %s, ", type_to_string(current->result.data_type)); 
+        print_tac_operand(fp, current->op1);                                
+        break;
+    default:
+        fprintf(fp, "<UNKNOWN_OPCODE_%d>", current->opcode);
+        break;
+    }
+}
+
 void print_tac_code()
 {
     printf("\n--- Generated Three-Address Code (TAC) ---\n");
-    TacInstruction *current = tac_head;
-    int line_counter = 0; // Use this for TAC line numbers for consistency
-
-    while (current)
+    for (int i = 0; i < tac_program.count; i++)
     {
+        const TacInstruction *current = &tac_program.instrs[i];
         // Using TAC line number instead of original source line for this printout
-        printf("%4d: ", line_counter++); 
+        printf("%4d: ", i); 
         // Or, if you want to keep the original source line:
         // printf("%4d: ", current->line_number); 
-
-        switch (current->opcode)
-        {
-        case TAC_NOP: printf("NOP"); break;
-        case TAC_ADD: case TAC_SUB: case TAC_MUL: case TAC_DIV: case TAC_MOD:
-        case TAC_LT:  case TAC_GT:  case TAC_LEQ: case TAC_GEQ:
-        case TAC_EQ:  case TAC_NEQ: case TAC_AND: case TAC_OR:
-            print_tac_operand(stdout, current->result); printf(" = ");
-            print_tac_operand(stdout, current->op1);
-            switch (current->opcode) {
-                case TAC_ADD: printf(" + "); break; case TAC_SUB: printf(" - "); break;
-                case TAC_MUL: printf(" * "); break; case TAC_DIV: printf(" / "); break;
-                case TAC_MOD: printf(" %% "); break; case TAC_LT:  printf(" < "); break;
-                case TAC_GT:  printf(" > "); break; case TAC_LEQ: printf(" <= "); break;
-                case TAC_GEQ: printf(" >= "); break; case TAC_EQ:  printf(" == "); break;
-                case TAC_NEQ: printf(" != "); break; case TAC_AND: printf(" && "); break;
-                case TAC_OR:  printf(" || "); break;
-                default: break; 
-            }
-            print_tac_operand(stdout, current->op2);
-            break;
-        case TAC_ASSIGN:
-            print_tac_operand(stdout, current->result); printf(" = ");
-            print_tac_operand(stdout, current->op1);
-            break;
-        case TAC_LABEL: // Label name is in result
-            print_tac_operand(stdout, current->result); printf(":");
-            break;
-        case TAC_GOTO: // Target label is in result
-            printf("GOTO "); print_tac_operand(stdout, current->result);
-            break;
-        case TAC_IF_GOTO: // Condition in op1, target label in result
-            printf("IF "); print_tac_operand(stdout, current->op1);    
-            printf(" GOTO "); print_tac_operand(stdout, current->result); 
-            break;
-        case TAC_IF_NOT_GOTO: // Condition in op1, target label in result
-            printf("IF NOT "); print_tac_operand(stdout, current->op1);    
-            printf(" GOTO "); print_tac_operand(stdout, current->result); 
-            break;
-        case TAC_NOT:
-            print_tac_operand(stdout, current->result); printf(" = !");
-            print_tac_operand(stdout, current->op1);
-            break;
-        case TAC_UMINUS:
-            print_tac_operand(stdout, current->result); printf(" = -");
-            print_tac_operand(stdout, current->op1);
-            break;
-        case TAC_PRINT: // Value to print is in op1
-            printf("PRINT "); print_tac_operand(stdout, current->op1); 
-            break;
-        case TAC_RETURN: // Value to return is in op1 (or OP_NONE)
-            printf("RETURN "); print_tac_operand(stdout, current->op1); 
-            break;
-        case TAC_CALL: // Function name in op1, return value (if any) in result
-            if (current->result.type != OP_NONE) {
-                print_tac_operand(stdout, current->result); printf(" = ");
-            }
-            printf("CALL "); print_tac_operand(stdout, current->op1); 
-            break;
-        case TAC_PARAM: // Parameter value in op1
-            printf("PARAM "); print_tac_operand(stdout, current->op1);
-            break;
-        case TAC_FUNCTION_BEGIN: // Function name in op1            
-            if(current->op1.type == OP_LABEL && current->op1.val.name) printf("%s:", current->op1.val.name); 
-            else printf("<ERROR_FUNC_BEGIN>:"); // Should be a label operand
-            break;
-        case TAC_FUNCTION_END: 
-            // No standard TAC output, but could be a comment
-            // if(current->op1.type == OP_LABEL && current->op1.val.name) printf("; End %s", current->op1.val.name);
-            break;
-        case TAC_ARRAY_STORE: // result_array[op1_index] = op2_value
-            print_tac_operand(stdout, current->result); printf("[");
-            print_tac_operand(stdout, current->op1);    printf("] = ");
-            print_tac_operand(stdout, current->op2);    
-            break;
-        case TAC_ARRAY_LOAD:  // result_dest = op1_array[op2_index] 
-            print_tac_operand(stdout, current->result); printf(" = ");
-            print_tac_operand(stdout, current->op1);    printf("[");
-            print_tac_operand(stdout, current->op2);    printf("]");
-            break;
-        case TAC_NEW_ARRAY: // result_array = NEW_ARRAY element_type(in result.data_type), op1_size
-            print_tac_operand(stdout, current->result);
-            printf(" = NEW_ARRAY %s, ", type_to_string(current->result.data_type)); 
-            print_tac_operand(stdout, current->op1);                                
-            break;
-        default:
-            printf("<UNKNOWN_OPCODE_%d>", current->opcode);
-            break;
-        }
+        print_tac_instruction(stdout, current);
         printf("\n");
-        current = current->next;
     }
     printf("------------------------------------------\n");
 }
 
 void free_tac_code()
 {
-    TacInstruction *current = tac_head;
-    TacInstruction *next_instr;
-    while (current)
-    {
-        next_instr = current->next;
-
-        if ((current->result.type == OP_VAR || current->result.type == OP_TEMP ||
-             current->result.type == OP_LABEL || current->result.type == OP_STRING_LIT) &&
-            current->result.val.name)
-        {
-            free(current->result.val.name);
-            current->result.val.name = NULL; 
-        }
-        if ((current->op1.type == OP_VAR || current->op1.type == OP_TEMP ||
-             current->op1.type == OP_LABEL || current->op1.type == OP_STRING_LIT) &&
-            current->op1.val.name)
-        {
-            free(current->op1.val.name);
-            current->op1.val.name = NULL;
-        }
-        if ((current->op2.type == OP_VAR || current->op2.type == OP_TEMP ||
-             current->op2.type == OP_LABEL || current->op2.type == OP_STRING_LIT) &&
-            current->op2.val.name)
-        {
-            free(current->op2.val.name);
-            current->op2.val.name = NULL;
-        }
-
-        free(current);
-        current = next_instr;
-    }
-    tac_head = NULL;
-    tac_tail = NULL;
+    // Instructions and labels live in tac_arena and operands hold no
+    // pointers, so the program is released without walking it.
+    arena_release(&tac_arena);
+    memset(&tac_program, 0, sizeof(tac_program));
 }
\ No newline at end of file
@@ -1,7 +1,10 @@
 #ifndef TAC_H
 #define TAC_H
 
-#include "ast.h" // Include AST definitions for TypeKind etc.
+#include "ast.h"    // Include AST definitions for TypeKind etc.
+#include "intern.h" // Variable and string operands are atoms
+#include <stdint.h>
+#include <stdio.h>
 
 // Define opcodes for Three-Address Code instructions
 typedef enum
@@ -61,58 +64,88 @@ typedef enum
     OP_STRING_LIT, // String literal (for print or later features)
 } TacOperandType;
 
-// Structure for a single operand in TAC
+// Structure for a single operand in TAC (8 bytes).
+// Names are never stored in operands: variables, temps and labels are small
+// integer IDs, so operands can be copied and compared freely. Variable IDs
+// come from the symbol table, so a shadowing declaration is a different
+// variable from the one it shadows even though both have the same name.
 typedef struct TacOperand
 {
-    TacOperandType type;
+    uint8_t type;      // TacOperandType
+    int8_t data_type;  // The resolved type of the operand (a TypeKind, e.g. TYPE_INT)
     union
     {
-        char *name;      // For OP_VAR, OP_TEMP, OP_LABEL, OP_STRING_LIT
+        uint32_t id;     // OP_VAR: variable number (SymbolTableEntry::index); OP_TEMP: temp number;
+                         // OP_LABEL: index into the label table; OP_STRING_LIT: atom of the text
         int int_val;     // For OP_LIT_INT, OP_LIT_BOOL
         float float_val; // For OP_LIT_FLOAT
         char char_val;   // For OP_LIT_CHAR
     } val;
-    TypeKind data_type; // The resolved type of the operand (e.g., TYPE_INT)
 } TacOperand;
 
 // Structure for a Three-Address Code instruction
 typedef struct TacInstruction
 {
     TacOpCode opcode;
-    TacOperand result;           // Destination
-    TacOperand op1;              // First operand
-    TacOperand op2;              // Second operand
-    struct TacInstruction *next; // Pointer to the next instruction in the list
-    int line_number;             // For debugging and error reporting
+    TacOperand result; // Destination
+    TacOperand op1;    // First operand
+    TacOperand op2;    // Second operand
+    int line_number;   // For debugging and error reporting
 } TacInstruction;
 
-// Global head and tail of the TAC instruction list
-extern TacInstruction *tac_head;
-extern TacInstruction *tac_tail;
+// One entry per label ID. 'position' is the index of the TAC_LABEL (or
+// TAC_FUNCTION_BEGIN) instruction that defines the label, so a jump target
+// is found with a single array access.
+typedef struct TacLabel
+{
+    Atom name;    // Source-level name such as "main", or ATOM_NONE for a generated L<id>
+    int position; // Instruction index of the definition, -1 until it is emitted
+} TacLabel;
+
+// The whole program as one contiguous instruction vector. Passes walk it with
+// a plain index loop; instructions are stored in tac_arena.
+typedef struct TacProgram
+{
+    TacInstruction *instrs;
+    int count;
+    int capacity;
+    TacLabel *labels;
+    int label_count;
+    int label_capacity;
+    Atom *var_names; // var_names[id] is the source name of variable 'id' (for printing)
+    int var_count;   // Variables are numbered 0 .. var_count-1
+    int var_capacity;
+    int temp_count; // Temps are numbered 0 .. temp_count-1
+} TacProgram;
+
+extern TacProgram tac_program;
 
 // Functions for TAC generation
 void init_tac_generator();
-TacInstruction *create_tac_instruction(TacOpCode opcode, TacOperand result, TacOperand op1, TacOperand op2, int line_num);
 void emit_tac(TacOpCode opcode, TacOperand result, TacOperand op1, TacOperand op2, int line_num);
 
 // Functions to create different types of operands
 TacOperand create_tac_none_operand();
-TacOperand create_tac_var_operand(const char *name, TypeKind type);
-TacOperand create_tac_temp_operand(TypeKind type);
+TacOperand create_tac_var_operand(uint32_t var_id, Atom name, TypeKind type); // Records 'name' for var_id
+TacOperand create_tac_temp_operand(TypeKind type); // Allocates a new temp number
 TacOperand create_tac_int_literal_operand(int val);
 TacOperand create_tac_float_literal_operand(float val);
 TacOperand create_tac_char_literal_operand(char val);
 TacOperand create_tac_bool_literal_operand(int val); // 0 for false, 1 for true
 TacOperand create_tac_string_literal_operand(const char *val);
-TacOperand create_tac_label_operand(const char *label_name);
+TacOperand create_tac_label_operand(int label_id);
 const char *type_to_string(TypeKind type);
 
-// Functions for generating unique names
-char *generate_new_temp_name();
-char *generate_new_label_name();
+// Label table
+int new_tac_label();             // A fresh generated label (printed as L<id>)
+int new_tac_named_label(Atom name); // A label with a source-level name (e.g. a function)
+// Writes the label's assembly name ("main", "L3") into buf and returns buf.
+const char *tac_label_name(int label_id, char *buf, size_t size);
 
 // Function to print the generated TAC for debugging
 void print_tac_code();
-void free_tac_code(); // To free allocated memory
+void print_tac_instruction(FILE *fp, const TacInstruction *instr); // One instruction, no newline
+void print_tac_operand(FILE *fp, TacOperand op);
+void free_tac_code(); // Releases tac_arena
 
 #endif // TAC_H
\ No newline at end of file
@@ -12,126 +12,44 @@ main:
     ; Function prologue
     push ebp
     mov ebp, esp
-    sub esp, 48
-    ; TAC: grade = 'A'
-    mov eax, 65
-    mov BYTE [ebp-1], al
-    ; TAC: isActive = true
-    mov eax, 1
-    mov DWORD [ebp-4], eax
-    ; TAC: _t0 = 20 * 2
-    mov eax, 20
-    mov ebx, 2
-    imul eax, ebx
-    mov DWORD [ebp-8], eax
-    ; TAC: _t1 = _t0 / 5
-    mov eax, DWORD [ebp-8]
-    mov ebx, 5
-    cdq
-    idiv ebx
-    mov DWORD [ebp-12], eax
-    ; TAC: _t2 = 10 + _t1
-    mov eax, 10
-    mov ebx, DWORD [ebp-12]
-    add eax, ebx
-    mov DWORD [ebp-16], eax
-    ; TAC: _t3 = _t2 - 3
-    mov eax, DWORD [ebp-16]
-    mov ebx, 3
-    sub eax, ebx
-    mov DWORD [ebp-20], eax
-    ; TAC: num = _t3
-    mov eax, DWORD [ebp-20]
-    mov DWORD [ebp-24], eax
-    ; TAC: _t4 = num > 15
-    mov eax, DWORD [ebp-24]
-    mov ebx, 15
-    cmp eax, ebx
-    setg al
-    movzx eax, al
-    mov DWORD [ebp-28], eax
-    ; ERROR: Unhandled TAC Opcode: 17 (_t5 = _t4 op isActive)
-    ; TAC: IF_NOT _t5 GOTO L0
-    mov eax, DWORD [ebp-32]
-    cmp eax, 0
-    je L0
-    ; TAC: PRINT num
-    mov eax, DWORD [ebp-24]
+    sub esp, 8
+    ; TAC: PRINT 16
+    mov eax, 16
     push eax
     push DWORD _int_fmt
     call printf
     add esp, 8
-    ; TAC: GOTO L1
-    jmp L1
-    ; TAC: LABEL L0:
-L0:
-    ; TAC: _t6 = num <= 10
-    mov eax, DWORD [ebp-24]
-    mov ebx, 10
-    cmp eax, ebx
-    setle al
-    movzx eax, al
-    mov DWORD [ebp-36], eax
-    ; TAC: IF_NOT _t6 GOTO L2
-    mov eax, DWORD [ebp-36]
-    cmp eax, 0
-    je L2
-    ; TAC: PRINT 0
-    mov eax, 0
-    push eax
-    push DWORD _int_fmt
-    call printf
-    add esp, 8
-    ; TAC: GOTO L3
-    jmp L3
-    ; TAC: LABEL L2:
-L2:
-    ; TAC: _t7 = num + 1
-    mov eax, DWORD [ebp-24]
-    mov ebx, 1
-    add eax, ebx
-    mov DWORD [ebp-40], eax
-    ; TAC: PRINT _t7
-    mov eax, DWORD [ebp-40]
-    push eax
-    push DWORD _int_fmt
-    call printf
-    add esp, 8
-    ; TAC: LABEL L3:
-L3:
-    ; TAC: LABEL L1:
-L1:
-    ; TAC: LABEL L4:
-L4:
+    ; TAC: num = 15
+    mov eax, 15
+    mov DWORD [ebp-4], eax
+    ; TAC: LABEL L5:
+L5:
     ; TAC: _t8 = num > 0
-    mov eax, DWORD [ebp-24]
+    mov eax, DWORD [ebp-4]
     mov ebx, 0
     cmp eax, ebx
     setg al
     movzx eax, al
-    mov DWORD [ebp-44], eax
-    ; TAC: IF_NOT _t8 GOTO L5
-    mov eax, DWORD [ebp-44]
+    mov DWORD [ebp-8], eax
+    ; TAC: IF_NOT _t8 GOTO L6
+    mov eax, DWORD [ebp-8]
     cmp eax, 0
-    je L5
-    ; TAC: _t9 = num - 1
-    mov eax, DWORD [ebp-24]
+    je L6
+    ; TAC: num = num - 1
+    mov eax, DWORD [ebp-4]
     mov ebx, 1
     sub eax, ebx
-    mov DWORD [ebp-48], eax
-    ; TAC: num = _t9
-    mov eax, DWORD [ebp-48]
-    mov DWORD [ebp-24], eax
+    mov DWORD [ebp-4], eax
     ; TAC: PRINT num
-    mov eax, DWORD [ebp-24]
+    mov eax, DWORD [ebp-4]
     push eax
     push DWORD _int_fmt
     call printf
     add esp, 8
-    ; TAC: GOTO L4
-    jmp L4
-    ; TAC: LABEL L5:
-L5:
+    ; TAC: GOTO L5
+    jmp L5
+    ; TAC: LABEL L6:
+L6:
     ; TAC: FUNCTION_END main
 
 .epilogue_main:
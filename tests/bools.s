@@ -0,0 +1,154 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    ; TAC: PRINT true
+    mov eax, 1
+    test eax, eax
+    jne .print_true0
+    push DWORD _false_str
+    jmp .print_bool_end1
+.print_true0:
+    push DWORD _true_str
+.print_bool_end1:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT false
+    xor eax, eax
+    test eax, eax
+    jne .print_true2
+    push DWORD _false_str
+    jmp .print_bool_end3
+.print_true2:
+    push DWORD _true_str
+.print_bool_end3:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT false
+    xor eax, eax
+    test eax, eax
+    jne .print_true4
+    push DWORD _false_str
+    jmp .print_bool_end5
+.print_true4:
+    push DWORD _true_str
+.print_bool_end5:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT true
+    mov eax, 1
+    test eax, eax
+    jne .print_true6
+    push DWORD _false_str
+    jmp .print_bool_end7
+.print_true6:
+    push DWORD _true_str
+.print_bool_end7:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT false
+    xor eax, eax
+    test eax, eax
+    jne .print_true8
+    push DWORD _false_str
+    jmp .print_bool_end9
+.print_true8:
+    push DWORD _true_str
+.print_bool_end9:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT true
+    mov eax, 1
+    test eax, eax
+    jne .print_true10
+    push DWORD _false_str
+    jmp .print_bool_end11
+.print_true10:
+    push DWORD _true_str
+.print_bool_end11:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT false
+    xor eax, eax
+    test eax, eax
+    jne .print_true12
+    push DWORD _false_str
+    jmp .print_bool_end13
+.print_true12:
+    push DWORD _true_str
+.print_bool_end13:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 1
+    push DWORD 1
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 3
+    push DWORD 3
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 6
+    push DWORD 6
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 'q'
+    push DWORD 113
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT true
+    mov eax, 1
+    test eax, eax
+    jne .print_true14
+    push DWORD _false_str
+    jmp .print_bool_end15
+.print_true14:
+    push DWORD _true_str
+.print_bool_end15:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 'a'
+    push DWORD 97
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 100
+    push DWORD 100
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
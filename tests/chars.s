@@ -0,0 +1,72 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    ; TAC: PRINT 'x'
+    push DWORD 120
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 'Z'
+    push DWORD 90
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT false
+    xor eax, eax
+    test eax, eax
+    jne .print_true0
+    push DWORD _false_str
+    jmp .print_bool_end1
+.print_true0:
+    push DWORD _true_str
+.print_bool_end1:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT '!'
+    push DWORD 33
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 'x'
+    push DWORD 120
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT false
+    xor eax, eax
+    test eax, eax
+    jne .print_true2
+    push DWORD _false_str
+    jmp .print_bool_end3
+.print_true2:
+    push DWORD _true_str
+.print_bool_end3:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
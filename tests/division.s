@@ -0,0 +1,150 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    push ebx
+    push esi
+    push edi
+    ; TAC: PRINT 3
+    push DWORD 3
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 2
+    push DWORD 2
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT -3
+    push DWORD -3
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT -2
+    push DWORD -2
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT -3
+    push DWORD -3
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 2
+    push DWORD 2
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 3
+    push DWORD 3
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT -2
+    push DWORD -2
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 14
+    push DWORD 14
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 2
+    push DWORD 2
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 17
+    push DWORD 17
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 0
+    push DWORD 0
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 0
+    push DWORD 0
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: n = 1000
+    mov ebx, 1000
+    ; TAC: digits = 0
+    xor esi, esi
+    ; TAC: sum = 0
+    xor edi, edi
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t21 = n > 0
+    ; TAC: IF_NOT _t21 GOTO L2
+    test ebx, ebx
+    jle L2
+    ; TAC: _t22 = n % 10
+    mov eax, ebx
+    mov ecx, 10
+    cdq
+    idiv ecx
+    ; TAC: sum = sum + _t22
+    add edi, edx
+    ; TAC: n = n / 10
+    mov eax, ebx
+    mov ecx, 10
+    cdq
+    idiv ecx
+    mov ebx, eax
+    ; TAC: digits = digits + 1
+    inc esi
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT digits
+    push esi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT sum
+    push edi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 12345
+    push DWORD 12345
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 3
+    push DWORD 3
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
@@ -0,0 +1,110 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    push ebx
+    push esi
+    push edi
+    ; TAC: a = 7
+    mov ebx, 7
+    ; TAC: total = 0
+    xor esi, esi
+    ; TAC: i = 0
+    xor edi, edi
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = i < 6
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp edi, 6
+    jge L2
+    ; TAC: total = a + total
+    lea esi, [ebx+esi]
+    ; TAC: PRINT total
+    push esi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: a = a + i
+    add ebx, edi
+    ; TAC: i = i + 1
+    inc edi
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT a
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: d = 3
+    mov ebx, 3
+    ; TAC: kept = 11
+    mov esi, 11
+    ; TAC: LABEL L3:
+L3:
+    ; TAC: _t4 = d < 12
+    ; TAC: IF_NOT _t4 GOTO L4
+    cmp ebx, 12
+    jge L4
+    ; TAC: q = 1000 / d
+    mov eax, 1000
+    cdq
+    idiv ebx
+    ; TAC: _t6 = q % 7
+    mov ecx, 7
+    cdq
+    idiv ecx
+    ; TAC: kept = _t6 + kept
+    lea esi, [edx+esi]
+    ; TAC: d = d + 2
+    add ebx, 2
+    ; TAC: GOTO L3
+    jmp L3
+    ; TAC: LABEL L4:
+L4:
+    ; TAC: PRINT kept
+    push esi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: _t9 = 1000 - d
+    mov ecx, 1000
+    sub ecx, ebx
+    ; TAC: PRINT _t9
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 5
+    push DWORD 5
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
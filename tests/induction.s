@@ -0,0 +1,187 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    push ebx
+    push esi
+    push edi
+    ; TAC: i = 0
+    xor ebx, ebx
+    ; TAC: sum = 0
+    xor ecx, ecx
+    ; TAC: _t39 = 0
+    xor esi, esi
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = i < 10
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp ebx, 10
+    jge L2
+    ; TAC: sum = _t39 + sum
+    lea ecx, [esi+ecx]
+    ; TAC: i = i + 1
+    inc ebx
+    ; TAC: _t39 = _t39 + 4
+    add esi, 4
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT sum
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT i
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: total = 0
+    xor ecx, ecx
+    ; TAC: _t36 = 21
+    mov ebx, 21
+    ; TAC: LABEL L3:
+L3:
+    ; TAC: _t4 = _t36 < 210
+    ; TAC: IF_NOT _t4 GOTO L4
+    cmp ebx, 210
+    jge L4
+    ; TAC: _t6 = _t36 + total
+    lea esi, [ebx+ecx]
+    ; TAC: total = _t6 + 1
+    lea ecx, [esi+1]
+    ; TAC: _t36 = _t36 + 21
+    add ebx, 21
+    ; TAC: GOTO L3
+    jmp L3
+    ; TAC: LABEL L4:
+L4:
+    ; TAC: PRINT total
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: k = 20
+    mov ebx, 20
+    ; TAC: down = 0
+    xor ecx, ecx
+    ; TAC: _t33 = 100
+    mov esi, 100
+    ; TAC: LABEL L5:
+L5:
+    ; TAC: _t9 = k > 0
+    ; TAC: IF_NOT _t9 GOTO L6
+    test ebx, ebx
+    jle L6
+    ; TAC: down = _t33 + down
+    lea ecx, [esi+ecx]
+    ; TAC: k = k - 2
+    sub ebx, 2
+    ; TAC: _t33 = _t33 + -10
+    add esi, -10
+    ; TAC: GOTO L5
+    jmp L5
+    ; TAC: LABEL L6:
+L6:
+    ; TAC: PRINT down
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT k
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: acc = 0
+    xor ecx, ecx
+    ; TAC: _t30 = 0
+    xor ebx, ebx
+    ; TAC: LABEL L7:
+L7:
+    ; TAC: _t13 = _t30 < 40
+    ; TAC: IF_NOT _t13 GOTO L8
+    cmp ebx, 40
+    jge L8
+    ; TAC: _t24 = 0
+    xor esi, esi
+    ; TAC: LABEL L9:
+L9:
+    ; TAC: _t14 = _t24 < 15
+    ; TAC: IF_NOT _t14 GOTO L10
+    cmp esi, 15
+    jge L10
+    ; TAC: _t16 = _t30 + acc
+    lea edi, [ebx+ecx]
+    ; TAC: acc = _t16 + _t24
+    lea ecx, [edi+esi]
+    ; TAC: _t24 = _t24 + 3
+    add esi, 3
+    ; TAC: GOTO L9
+    jmp L9
+    ; TAC: LABEL L10:
+L10:
+    ; TAC: _t30 = _t30 + 10
+    add ebx, 10
+    ; TAC: GOTO L7
+    jmp L7
+    ; TAC: LABEL L8:
+L8:
+    ; TAC: PRINT acc
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: last = 0
+    xor ecx, ecx
+    ; TAC: _t27 = 0
+    xor ebx, ebx
+    ; TAC: LABEL L11:
+L11:
+    ; TAC: _t21 = _t27 < 48
+    ; TAC: IF_NOT _t21 GOTO L12
+    cmp ebx, 48
+    jge L12
+    ; TAC: _t29 = _t27 + 6
+    lea esi, [ebx+6]
+    ; TAC: last = _t27
+    mov ecx, ebx
+    ; TAC: _t27 = _t29
+    mov ebx, esi
+    ; TAC: GOTO L11
+    jmp L11
+    ; TAC: LABEL L12:
+L12:
+    ; TAC: PRINT last
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
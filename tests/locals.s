@@ -0,0 +1,174 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    sub esp, 8
+    push ebx
+    push esi
+    push edi
+    ; TAC: c = 'a'
+    mov ebx, 97
+    ; TAC: best = 'a'
+    mov BYTE [ebp-1], 97
+    ; TAC: seen = false
+    mov DWORD [ebp-8], 0
+    ; TAC: flip = true
+    mov edi, 1
+    ; TAC: i = 0
+    xor ecx, ecx
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = i < 5
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp ecx, 5
+    jge L2
+    ; TAC: _t1 = c > best
+    ; TAC: IF_NOT _t1 GOTO L3
+    mov eax, ebx
+    movzx edx, BYTE [ebp-1]
+    cmp eax, edx
+    jle L3
+    ; TAC: best = c
+    mov BYTE [ebp-1], bl
+    ; TAC: seen = true
+    mov DWORD [ebp-8], 1
+    ; TAC: LABEL L3:
+L3:
+    ; TAC: flip = NOT flip
+    xor edi, 1
+    ; TAC: IF_NOT flip GOTO L6
+    test edi, edi
+    je L6
+    ; TAC: c = 'm'
+    mov ebx, 109
+    ; TAC: GOTO L5
+    jmp L5
+    ; TAC: LABEL L6:
+L6:
+    ; TAC: c = 'c'
+    mov ebx, 99
+    ; TAC: LABEL L5:
+L5:
+    ; TAC: i = i + 1
+    inc ecx
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT c
+    push ebx
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT best
+    movzx eax, BYTE [ebp-1]
+    push eax
+    push DWORD _char_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT seen
+    cmp DWORD [ebp-8], 0
+    jne .print_true0
+    push DWORD _false_str
+    jmp .print_bool_end1
+.print_true0:
+    push DWORD _true_str
+.print_bool_end1:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT flip
+    test edi, edi
+    jne .print_true2
+    push DWORD _false_str
+    jmp .print_bool_end3
+.print_true2:
+    push DWORD _true_str
+.print_bool_end3:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: both = seen && flip
+    mov ecx, DWORD [ebp-8]
+    and ecx, edi
+    ; TAC: either = seen || flip
+    mov esi, DWORD [ebp-8]
+    or esi, edi
+    ; TAC: PRINT both
+    test ecx, ecx
+    jne .print_true4
+    push DWORD _false_str
+    jmp .print_bool_end5
+.print_true4:
+    push DWORD _true_str
+.print_bool_end5:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT either
+    test esi, esi
+    jne .print_true6
+    push DWORD _false_str
+    jmp .print_bool_end7
+.print_true6:
+    push DWORD _true_str
+.print_bool_end7:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT true
+    mov eax, 1
+    test eax, eax
+    jne .print_true8
+    push DWORD _false_str
+    jmp .print_bool_end9
+.print_true8:
+    push DWORD _true_str
+.print_bool_end9:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: _t7 = c != best
+    mov eax, ebx
+    movzx edx, BYTE [ebp-1]
+    cmp eax, edx
+    setne al
+    movzx eax, al
+    ; TAC: PRINT _t7
+    test eax, eax
+    jne .print_true10
+    push DWORD _false_str
+    jmp .print_bool_end11
+.print_true10:
+    push DWORD _true_str
+.print_bool_end11:
+    push DWORD _str_nl_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
@@ -0,0 +1,174 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    sub esp, 4
+    push ebx
+    push esi
+    push edi
+    ; TAC: i = 0
+    xor ecx, ecx
+    ; TAC: sum = 0
+    mov DWORD [ebp-4], 0
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = i < 10
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp ecx, 10
+    jge L2
+    ; TAC: j = 0
+    xor esi, esi
+    ; TAC: _t18 = 0
+    xor edi, edi
+    ; TAC: LABEL L3:
+L3:
+    ; TAC: _t1 = i > j
+    ; TAC: IF_NOT _t1 GOTO L4
+    cmp ecx, esi
+    jle L4
+    ; TAC: _t3 = _t18 + sum
+    mov ebx, edi
+    add ebx, DWORD [ebp-4]
+    ; TAC: sum = _t3 + 10
+    mov eax, ebx
+    add eax, 10
+    mov DWORD [ebp-4], eax
+    ; TAC: j = j + 1
+    inc esi
+    ; TAC: _t18 = _t18 + i
+    add edi, ecx
+    ; TAC: GOTO L3
+    jmp L3
+    ; TAC: LABEL L4:
+L4:
+    ; TAC: i = i + 1
+    inc ecx
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT sum
+    push DWORD [ebp-4]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: p = 2
+    mov ebx, 2
+    ; TAC: count = 0
+    mov DWORD [ebp-4], 0
+    ; TAC: LABEL L5:
+L5:
+    ; TAC: _t7 = p < 60
+    ; TAC: IF_NOT _t7 GOTO L6
+    cmp ebx, 60
+    jge L6
+    ; TAC: d = 2
+    mov edi, 2
+    ; TAC: prime = true
+    mov esi, 1
+    ; TAC: LABEL L7:
+L7:
+    ; TAC: _t8 = d * d
+    mov ecx, edi
+    imul ecx, edi
+    ; TAC: _t9 = _t8 <= p
+    ; TAC: IF_NOT _t9 GOTO L8
+    cmp ecx, ebx
+    jg L8
+    ; TAC: _t10 = p % d
+    mov eax, ebx
+    cdq
+    idiv edi
+    ; TAC: _t11 = _t10 == 0
+    ; TAC: IF_NOT _t11 GOTO L9
+    test edx, edx
+    jne L9
+    ; TAC: prime = false
+    xor esi, esi
+    ; TAC: LABEL L9:
+L9:
+    ; TAC: d = d + 1
+    inc edi
+    ; TAC: GOTO L7
+    jmp L7
+    ; TAC: LABEL L8:
+L8:
+    ; TAC: IF_NOT prime GOTO L10
+    test esi, esi
+    je L10
+    ; TAC: count = count + 1
+    inc DWORD [ebp-4]
+    ; TAC: PRINT p
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: LABEL L10:
+L10:
+    ; TAC: p = p + 1
+    inc ebx
+    ; TAC: GOTO L5
+    jmp L5
+    ; TAC: LABEL L6:
+L6:
+    ; TAC: PRINT count
+    push DWORD [ebp-4]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: a = 0
+    xor ecx, ecx
+    ; TAC: b = 1
+    mov ebx, 1
+    ; TAC: k = 0
+    xor esi, esi
+    ; TAC: LABEL L11:
+L11:
+    ; TAC: _t15 = k < 20
+    ; TAC: IF_NOT _t15 GOTO L12
+    cmp esi, 20
+    jge L12
+    ; TAC: b.3 = a + b
+    lea edi, [ecx+ebx]
+    ; TAC: k = k + 1
+    inc esi
+    ; TAC: a = b
+    mov ecx, ebx
+    ; TAC: b = b.3
+    mov ebx, edi
+    ; TAC: GOTO L11
+    jmp L11
+    ; TAC: LABEL L12:
+L12:
+    ; TAC: PRINT a
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
@@ -0,0 +1,8065 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    push ebx
+    push esi
+    ; TAC: x = 0
+    xor ecx, ecx
+    ; TAC: hits = 0
+    xor ebx, ebx
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = x < 30
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp ecx, 30
+    jge L2
+    ; TAC: _t1 = x == 1
+    ; TAC: IF _t1 GOTO L5
+    cmp ecx, 1
+    je L5
+    ; TAC: _t2 = x == 4
+    ; TAC: IF _t2 GOTO L5
+    cmp ecx, 4
+    je L5
+    ; TAC: _t3 = x == 7
+    ; TAC: IF _t3 GOTO L5
+    cmp ecx, 7
+    je L5
+    ; TAC: _t4 = x == 10
+    ; TAC: IF _t4 GOTO L5
+    cmp ecx, 10
+    je L5
+    ; TAC: _t5 = x == 13
+    ; TAC: IF _t5 GOTO L5
+    cmp ecx, 13
+    je L5
+    ; TAC: _t6 = x == 16
+    ; TAC: IF _t6 GOTO L5
+    cmp ecx, 16
+    je L5
+    ; TAC: _t7 = x == 19
+    ; TAC: IF _t7 GOTO L5
+    cmp ecx, 19
+    je L5
+    ; TAC: _t8 = x == 22
+    ; TAC: IF _t8 GOTO L5
+    cmp ecx, 22
+    je L5
+    ; TAC: _t9 = x == 25
+    ; TAC: IF _t9 GOTO L5
+    cmp ecx, 25
+    je L5
+    ; TAC: _t10 = x == 28
+    ; TAC: IF _t10 GOTO L5
+    cmp ecx, 28
+    je L5
+    ; TAC: _t11 = x == 31
+    ; TAC: IF _t11 GOTO L5
+    cmp ecx, 31
+    je L5
+    ; TAC: _t12 = x == 34
+    ; TAC: IF _t12 GOTO L5
+    cmp ecx, 34
+    je L5
+    ; TAC: _t13 = x == 37
+    ; TAC: IF _t13 GOTO L5
+    cmp ecx, 37
+    je L5
+    ; TAC: _t14 = x == 40
+    ; TAC: IF _t14 GOTO L5
+    cmp ecx, 40
+    je L5
+    ; TAC: _t15 = x == 43
+    ; TAC: IF _t15 GOTO L5
+    cmp ecx, 43
+    je L5
+    ; TAC: _t16 = x == 46
+    ; TAC: IF _t16 GOTO L5
+    cmp ecx, 46
+    je L5
+    ; TAC: _t17 = x == 49
+    ; TAC: IF _t17 GOTO L5
+    cmp ecx, 49
+    je L5
+    ; TAC: _t18 = x == 52
+    ; TAC: IF _t18 GOTO L5
+    cmp ecx, 52
+    je L5
+    ; TAC: _t19 = x == 55
+    ; TAC: IF _t19 GOTO L5
+    cmp ecx, 55
+    je L5
+    ; TAC: _t20 = x == 58
+    ; TAC: IF _t20 GOTO L5
+    cmp ecx, 58
+    je L5
+    ; TAC: _t21 = x == 61
+    ; TAC: IF _t21 GOTO L5
+    cmp ecx, 61
+    je L5
+    ; TAC: _t22 = x == 64
+    ; TAC: IF _t22 GOTO L5
+    cmp ecx, 64
+    je L5
+    ; TAC: _t23 = x == 67
+    ; TAC: IF _t23 GOTO L5
+    cmp ecx, 67
+    je L5
+    ; TAC: _t24 = x == 70
+    ; TAC: IF _t24 GOTO L5
+    cmp ecx, 70
+    je L5
+    ; TAC: _t25 = x == 73
+    ; TAC: IF _t25 GOTO L5
+    cmp ecx, 73
+    je L5
+    ; TAC: _t26 = x == 76
+    ; TAC: IF _t26 GOTO L5
+    cmp ecx, 76
+    je L5
+    ; TAC: _t27 = x == 79
+    ; TAC: IF _t27 GOTO L5
+    cmp ecx, 79
+    je L5
+    ; TAC: _t28 = x == 82
+    ; TAC: IF _t28 GOTO L5
+    cmp ecx, 82
+    je L5
+    ; TAC: _t29 = x == 85
+    ; TAC: IF _t29 GOTO L5
+    cmp ecx, 85
+    je L5
+    ; TAC: _t30 = x == 88
+    ; TAC: IF _t30 GOTO L5
+    cmp ecx, 88
+    je L5
+    ; TAC: _t31 = x == 91
+    ; TAC: IF _t31 GOTO L5
+    cmp ecx, 91
+    je L5
+    ; TAC: _t32 = x == 94
+    ; TAC: IF _t32 GOTO L5
+    cmp ecx, 94
+    je L5
+    ; TAC: _t33 = x == 97
+    ; TAC: IF _t33 GOTO L5
+    cmp ecx, 97
+    je L5
+    ; TAC: _t34 = x == 100
+    ; TAC: IF _t34 GOTO L5
+    cmp ecx, 100
+    je L5
+    ; TAC: _t35 = x == 103
+    ; TAC: IF _t35 GOTO L5
+    cmp ecx, 103
+    je L5
+    ; TAC: _t36 = x == 106
+    ; TAC: IF _t36 GOTO L5
+    cmp ecx, 106
+    je L5
+    ; TAC: _t37 = x == 109
+    ; TAC: IF _t37 GOTO L5
+    cmp ecx, 109
+    je L5
+    ; TAC: _t38 = x == 112
+    ; TAC: IF _t38 GOTO L5
+    cmp ecx, 112
+    je L5
+    ; TAC: _t39 = x == 115
+    ; TAC: IF _t39 GOTO L5
+    cmp ecx, 115
+    je L5
+    ; TAC: _t40 = x == 118
+    ; TAC: IF _t40 GOTO L5
+    cmp ecx, 118
+    je L5
+    ; TAC: _t41 = x == 121
+    ; TAC: IF _t41 GOTO L5
+    cmp ecx, 121
+    je L5
+    ; TAC: _t42 = x == 124
+    ; TAC: IF _t42 GOTO L5
+    cmp ecx, 124
+    je L5
+    ; TAC: _t43 = x == 127
+    ; TAC: IF _t43 GOTO L5
+    cmp ecx, 127
+    je L5
+    ; TAC: _t44 = x == 130
+    ; TAC: IF _t44 GOTO L5
+    cmp ecx, 130
+    je L5
+    ; TAC: _t45 = x == 133
+    ; TAC: IF _t45 GOTO L5
+    cmp ecx, 133
+    je L5
+    ; TAC: _t46 = x == 136
+    ; TAC: IF _t46 GOTO L5
+    cmp ecx, 136
+    je L5
+    ; TAC: _t47 = x == 139
+    ; TAC: IF _t47 GOTO L5
+    cmp ecx, 139
+    je L5
+    ; TAC: _t48 = x == 142
+    ; TAC: IF _t48 GOTO L5
+    cmp ecx, 142
+    je L5
+    ; TAC: _t49 = x == 145
+    ; TAC: IF _t49 GOTO L5
+    cmp ecx, 145
+    je L5
+    ; TAC: _t50 = x == 148
+    ; TAC: IF _t50 GOTO L5
+    cmp ecx, 148
+    je L5
+    ; TAC: _t51 = x == 151
+    ; TAC: IF _t51 GOTO L5
+    cmp ecx, 151
+    je L5
+    ; TAC: _t52 = x == 154
+    ; TAC: IF _t52 GOTO L5
+    cmp ecx, 154
+    je L5
+    ; TAC: _t53 = x == 157
+    ; TAC: IF _t53 GOTO L5
+    cmp ecx, 157
+    je L5
+    ; TAC: _t54 = x == 160
+    ; TAC: IF _t54 GOTO L5
+    cmp ecx, 160
+    je L5
+    ; TAC: _t55 = x == 163
+    ; TAC: IF _t55 GOTO L5
+    cmp ecx, 163
+    je L5
+    ; TAC: _t56 = x == 166
+    ; TAC: IF _t56 GOTO L5
+    cmp ecx, 166
+    je L5
+    ; TAC: _t57 = x == 169
+    ; TAC: IF _t57 GOTO L5
+    cmp ecx, 169
+    je L5
+    ; TAC: _t58 = x == 172
+    ; TAC: IF _t58 GOTO L5
+    cmp ecx, 172
+    je L5
+    ; TAC: _t59 = x == 175
+    ; TAC: IF _t59 GOTO L5
+    cmp ecx, 175
+    je L5
+    ; TAC: _t60 = x == 178
+    ; TAC: IF _t60 GOTO L5
+    cmp ecx, 178
+    je L5
+    ; TAC: _t61 = x == 181
+    ; TAC: IF _t61 GOTO L5
+    cmp ecx, 181
+    je L5
+    ; TAC: _t62 = x == 184
+    ; TAC: IF _t62 GOTO L5
+    cmp ecx, 184
+    je L5
+    ; TAC: _t63 = x == 187
+    ; TAC: IF _t63 GOTO L5
+    cmp ecx, 187
+    je L5
+    ; TAC: _t64 = x == 190
+    ; TAC: IF _t64 GOTO L5
+    cmp ecx, 190
+    je L5
+    ; TAC: _t65 = x == 193
+    ; TAC: IF _t65 GOTO L5
+    cmp ecx, 193
+    je L5
+    ; TAC: _t66 = x == 196
+    ; TAC: IF _t66 GOTO L5
+    cmp ecx, 196
+    je L5
+    ; TAC: _t67 = x == 199
+    ; TAC: IF _t67 GOTO L5
+    cmp ecx, 199
+    je L5
+    ; TAC: _t68 = x == 202
+    ; TAC: IF _t68 GOTO L5
+    cmp ecx, 202
+    je L5
+    ; TAC: _t69 = x == 205
+    ; TAC: IF _t69 GOTO L5
+    cmp ecx, 205
+    je L5
+    ; TAC: _t70 = x == 208
+    ; TAC: IF _t70 GOTO L5
+    cmp ecx, 208
+    je L5
+    ; TAC: _t71 = x == 211
+    ; TAC: IF _t71 GOTO L5
+    cmp ecx, 211
+    je L5
+    ; TAC: _t72 = x == 214
+    ; TAC: IF _t72 GOTO L5
+    cmp ecx, 214
+    je L5
+    ; TAC: _t73 = x == 217
+    ; TAC: IF _t73 GOTO L5
+    cmp ecx, 217
+    je L5
+    ; TAC: _t74 = x == 220
+    ; TAC: IF _t74 GOTO L5
+    cmp ecx, 220
+    je L5
+    ; TAC: _t75 = x == 223
+    ; TAC: IF _t75 GOTO L5
+    cmp ecx, 223
+    je L5
+    ; TAC: _t76 = x == 226
+    ; TAC: IF _t76 GOTO L5
+    cmp ecx, 226
+    je L5
+    ; TAC: _t77 = x == 229
+    ; TAC: IF _t77 GOTO L5
+    cmp ecx, 229
+    je L5
+    ; TAC: _t78 = x == 232
+    ; TAC: IF _t78 GOTO L5
+    cmp ecx, 232
+    je L5
+    ; TAC: _t79 = x == 235
+    ; TAC: IF _t79 GOTO L5
+    cmp ecx, 235
+    je L5
+    ; TAC: _t80 = x == 238
+    ; TAC: IF _t80 GOTO L5
+    cmp ecx, 238
+    je L5
+    ; TAC: _t81 = x == 241
+    ; TAC: IF _t81 GOTO L5
+    cmp ecx, 241
+    je L5
+    ; TAC: _t82 = x == 244
+    ; TAC: IF _t82 GOTO L5
+    cmp ecx, 244
+    je L5
+    ; TAC: _t83 = x == 247
+    ; TAC: IF _t83 GOTO L5
+    cmp ecx, 247
+    je L5
+    ; TAC: _t84 = x == 250
+    ; TAC: IF _t84 GOTO L5
+    cmp ecx, 250
+    je L5
+    ; TAC: _t85 = x == 253
+    ; TAC: IF _t85 GOTO L5
+    cmp ecx, 253
+    je L5
+    ; TAC: _t86 = x == 256
+    ; TAC: IF _t86 GOTO L5
+    cmp ecx, 256
+    je L5
+    ; TAC: _t87 = x == 259
+    ; TAC: IF _t87 GOTO L5
+    cmp ecx, 259
+    je L5
+    ; TAC: _t88 = x == 262
+    ; TAC: IF _t88 GOTO L5
+    cmp ecx, 262
+    je L5
+    ; TAC: _t89 = x == 265
+    ; TAC: IF _t89 GOTO L5
+    cmp ecx, 265
+    je L5
+    ; TAC: _t90 = x == 268
+    ; TAC: IF _t90 GOTO L5
+    cmp ecx, 268
+    je L5
+    ; TAC: _t91 = x == 271
+    ; TAC: IF _t91 GOTO L5
+    cmp ecx, 271
+    je L5
+    ; TAC: _t92 = x == 274
+    ; TAC: IF _t92 GOTO L5
+    cmp ecx, 274
+    je L5
+    ; TAC: _t93 = x == 277
+    ; TAC: IF _t93 GOTO L5
+    cmp ecx, 277
+    je L5
+    ; TAC: _t94 = x == 280
+    ; TAC: IF _t94 GOTO L5
+    cmp ecx, 280
+    je L5
+    ; TAC: _t95 = x == 283
+    ; TAC: IF _t95 GOTO L5
+    cmp ecx, 283
+    je L5
+    ; TAC: _t96 = x == 286
+    ; TAC: IF _t96 GOTO L5
+    cmp ecx, 286
+    je L5
+    ; TAC: _t97 = x == 289
+    ; TAC: IF _t97 GOTO L5
+    cmp ecx, 289
+    je L5
+    ; TAC: _t98 = x == 292
+    ; TAC: IF _t98 GOTO L5
+    cmp ecx, 292
+    je L5
+    ; TAC: _t99 = x == 295
+    ; TAC: IF _t99 GOTO L5
+    cmp ecx, 295
+    je L5
+    ; TAC: _t100 = x == 298
+    ; TAC: IF _t100 GOTO L5
+    cmp ecx, 298
+    je L5
+    ; TAC: _t101 = x == 301
+    ; TAC: IF _t101 GOTO L5
+    cmp ecx, 301
+    je L5
+    ; TAC: _t102 = x == 304
+    ; TAC: IF _t102 GOTO L5
+    cmp ecx, 304
+    je L5
+    ; TAC: _t103 = x == 307
+    ; TAC: IF _t103 GOTO L5
+    cmp ecx, 307
+    je L5
+    ; TAC: _t104 = x == 310
+    ; TAC: IF _t104 GOTO L5
+    cmp ecx, 310
+    je L5
+    ; TAC: _t105 = x == 313
+    ; TAC: IF _t105 GOTO L5
+    cmp ecx, 313
+    je L5
+    ; TAC: _t106 = x == 316
+    ; TAC: IF _t106 GOTO L5
+    cmp ecx, 316
+    je L5
+    ; TAC: _t107 = x == 319
+    ; TAC: IF _t107 GOTO L5
+    cmp ecx, 319
+    je L5
+    ; TAC: _t108 = x == 322
+    ; TAC: IF _t108 GOTO L5
+    cmp ecx, 322
+    je L5
+    ; TAC: _t109 = x == 325
+    ; TAC: IF _t109 GOTO L5
+    cmp ecx, 325
+    je L5
+    ; TAC: _t110 = x == 328
+    ; TAC: IF _t110 GOTO L5
+    cmp ecx, 328
+    je L5
+    ; TAC: _t111 = x == 331
+    ; TAC: IF _t111 GOTO L5
+    cmp ecx, 331
+    je L5
+    ; TAC: _t112 = x == 334
+    ; TAC: IF _t112 GOTO L5
+    cmp ecx, 334
+    je L5
+    ; TAC: _t113 = x == 337
+    ; TAC: IF _t113 GOTO L5
+    cmp ecx, 337
+    je L5
+    ; TAC: _t114 = x == 340
+    ; TAC: IF _t114 GOTO L5
+    cmp ecx, 340
+    je L5
+    ; TAC: _t115 = x == 343
+    ; TAC: IF _t115 GOTO L5
+    cmp ecx, 343
+    je L5
+    ; TAC: _t116 = x == 346
+    ; TAC: IF _t116 GOTO L5
+    cmp ecx, 346
+    je L5
+    ; TAC: _t117 = x == 349
+    ; TAC: IF _t117 GOTO L5
+    cmp ecx, 349
+    je L5
+    ; TAC: _t118 = x == 352
+    ; TAC: IF _t118 GOTO L5
+    cmp ecx, 352
+    je L5
+    ; TAC: _t119 = x == 355
+    ; TAC: IF _t119 GOTO L5
+    cmp ecx, 355
+    je L5
+    ; TAC: _t120 = x == 358
+    ; TAC: IF _t120 GOTO L5
+    cmp ecx, 358
+    je L5
+    ; TAC: _t121 = x == 361
+    ; TAC: IF _t121 GOTO L5
+    cmp ecx, 361
+    je L5
+    ; TAC: _t122 = x == 364
+    ; TAC: IF _t122 GOTO L5
+    cmp ecx, 364
+    je L5
+    ; TAC: _t123 = x == 367
+    ; TAC: IF _t123 GOTO L5
+    cmp ecx, 367
+    je L5
+    ; TAC: _t124 = x == 370
+    ; TAC: IF _t124 GOTO L5
+    cmp ecx, 370
+    je L5
+    ; TAC: _t125 = x == 373
+    ; TAC: IF _t125 GOTO L5
+    cmp ecx, 373
+    je L5
+    ; TAC: _t126 = x == 376
+    ; TAC: IF _t126 GOTO L5
+    cmp ecx, 376
+    je L5
+    ; TAC: _t127 = x == 379
+    ; TAC: IF _t127 GOTO L5
+    cmp ecx, 379
+    je L5
+    ; TAC: _t128 = x == 382
+    ; TAC: IF _t128 GOTO L5
+    cmp ecx, 382
+    je L5
+    ; TAC: _t129 = x == 385
+    ; TAC: IF _t129 GOTO L5
+    cmp ecx, 385
+    je L5
+    ; TAC: _t130 = x == 388
+    ; TAC: IF _t130 GOTO L5
+    cmp ecx, 388
+    je L5
+    ; TAC: _t131 = x == 391
+    ; TAC: IF _t131 GOTO L5
+    cmp ecx, 391
+    je L5
+    ; TAC: _t132 = x == 394
+    ; TAC: IF _t132 GOTO L5
+    cmp ecx, 394
+    je L5
+    ; TAC: _t133 = x == 397
+    ; TAC: IF _t133 GOTO L5
+    cmp ecx, 397
+    je L5
+    ; TAC: _t134 = x == 400
+    ; TAC: IF _t134 GOTO L5
+    cmp ecx, 400
+    je L5
+    ; TAC: _t135 = x == 403
+    ; TAC: IF _t135 GOTO L5
+    cmp ecx, 403
+    je L5
+    ; TAC: _t136 = x == 406
+    ; TAC: IF _t136 GOTO L5
+    cmp ecx, 406
+    je L5
+    ; TAC: _t137 = x == 409
+    ; TAC: IF _t137 GOTO L5
+    cmp ecx, 409
+    je L5
+    ; TAC: _t138 = x == 412
+    ; TAC: IF _t138 GOTO L5
+    cmp ecx, 412
+    je L5
+    ; TAC: _t139 = x == 415
+    ; TAC: IF _t139 GOTO L5
+    cmp ecx, 415
+    je L5
+    ; TAC: _t140 = x == 418
+    ; TAC: IF _t140 GOTO L5
+    cmp ecx, 418
+    je L5
+    ; TAC: _t141 = x == 421
+    ; TAC: IF _t141 GOTO L5
+    cmp ecx, 421
+    je L5
+    ; TAC: _t142 = x == 424
+    ; TAC: IF _t142 GOTO L5
+    cmp ecx, 424
+    je L5
+    ; TAC: _t143 = x == 427
+    ; TAC: IF _t143 GOTO L5
+    cmp ecx, 427
+    je L5
+    ; TAC: _t144 = x == 430
+    ; TAC: IF _t144 GOTO L5
+    cmp ecx, 430
+    je L5
+    ; TAC: _t145 = x == 433
+    ; TAC: IF _t145 GOTO L5
+    cmp ecx, 433
+    je L5
+    ; TAC: _t146 = x == 436
+    ; TAC: IF _t146 GOTO L5
+    cmp ecx, 436
+    je L5
+    ; TAC: _t147 = x == 439
+    ; TAC: IF _t147 GOTO L5
+    cmp ecx, 439
+    je L5
+    ; TAC: _t148 = x == 442
+    ; TAC: IF _t148 GOTO L5
+    cmp ecx, 442
+    je L5
+    ; TAC: _t149 = x == 445
+    ; TAC: IF _t149 GOTO L5
+    cmp ecx, 445
+    je L5
+    ; TAC: _t150 = x == 448
+    ; TAC: IF _t150 GOTO L5
+    cmp ecx, 448
+    je L5
+    ; TAC: _t151 = x == 451
+    ; TAC: IF _t151 GOTO L5
+    cmp ecx, 451
+    je L5
+    ; TAC: _t152 = x == 454
+    ; TAC: IF _t152 GOTO L5
+    cmp ecx, 454
+    je L5
+    ; TAC: _t153 = x == 457
+    ; TAC: IF _t153 GOTO L5
+    cmp ecx, 457
+    je L5
+    ; TAC: _t154 = x == 460
+    ; TAC: IF _t154 GOTO L5
+    cmp ecx, 460
+    je L5
+    ; TAC: _t155 = x == 463
+    ; TAC: IF _t155 GOTO L5
+    cmp ecx, 463
+    je L5
+    ; TAC: _t156 = x == 466
+    ; TAC: IF _t156 GOTO L5
+    cmp ecx, 466
+    je L5
+    ; TAC: _t157 = x == 469
+    ; TAC: IF _t157 GOTO L5
+    cmp ecx, 469
+    je L5
+    ; TAC: _t158 = x == 472
+    ; TAC: IF _t158 GOTO L5
+    cmp ecx, 472
+    je L5
+    ; TAC: _t159 = x == 475
+    ; TAC: IF _t159 GOTO L5
+    cmp ecx, 475
+    je L5
+    ; TAC: _t160 = x == 478
+    ; TAC: IF _t160 GOTO L5
+    cmp ecx, 478
+    je L5
+    ; TAC: _t161 = x == 481
+    ; TAC: IF _t161 GOTO L5
+    cmp ecx, 481
+    je L5
+    ; TAC: _t162 = x == 484
+    ; TAC: IF _t162 GOTO L5
+    cmp ecx, 484
+    je L5
+    ; TAC: _t163 = x == 487
+    ; TAC: IF _t163 GOTO L5
+    cmp ecx, 487
+    je L5
+    ; TAC: _t164 = x == 490
+    ; TAC: IF _t164 GOTO L5
+    cmp ecx, 490
+    je L5
+    ; TAC: _t165 = x == 493
+    ; TAC: IF _t165 GOTO L5
+    cmp ecx, 493
+    je L5
+    ; TAC: _t166 = x == 496
+    ; TAC: IF _t166 GOTO L5
+    cmp ecx, 496
+    je L5
+    ; TAC: _t167 = x == 499
+    ; TAC: IF _t167 GOTO L5
+    cmp ecx, 499
+    je L5
+    ; TAC: _t168 = x == 502
+    ; TAC: IF _t168 GOTO L5
+    cmp ecx, 502
+    je L5
+    ; TAC: _t169 = x == 505
+    ; TAC: IF _t169 GOTO L5
+    cmp ecx, 505
+    je L5
+    ; TAC: _t170 = x == 508
+    ; TAC: IF _t170 GOTO L5
+    cmp ecx, 508
+    je L5
+    ; TAC: _t171 = x == 511
+    ; TAC: IF _t171 GOTO L5
+    cmp ecx, 511
+    je L5
+    ; TAC: _t172 = x == 514
+    ; TAC: IF _t172 GOTO L5
+    cmp ecx, 514
+    je L5
+    ; TAC: _t173 = x == 517
+    ; TAC: IF _t173 GOTO L5
+    cmp ecx, 517
+    je L5
+    ; TAC: _t174 = x == 520
+    ; TAC: IF _t174 GOTO L5
+    cmp ecx, 520
+    je L5
+    ; TAC: _t175 = x == 523
+    ; TAC: IF _t175 GOTO L5
+    cmp ecx, 523
+    je L5
+    ; TAC: _t176 = x == 526
+    ; TAC: IF _t176 GOTO L5
+    cmp ecx, 526
+    je L5
+    ; TAC: _t177 = x == 529
+    ; TAC: IF _t177 GOTO L5
+    cmp ecx, 529
+    je L5
+    ; TAC: _t178 = x == 532
+    ; TAC: IF _t178 GOTO L5
+    cmp ecx, 532
+    je L5
+    ; TAC: _t179 = x == 535
+    ; TAC: IF _t179 GOTO L5
+    cmp ecx, 535
+    je L5
+    ; TAC: _t180 = x == 538
+    ; TAC: IF _t180 GOTO L5
+    cmp ecx, 538
+    je L5
+    ; TAC: _t181 = x == 541
+    ; TAC: IF _t181 GOTO L5
+    cmp ecx, 541
+    je L5
+    ; TAC: _t182 = x == 544
+    ; TAC: IF _t182 GOTO L5
+    cmp ecx, 544
+    je L5
+    ; TAC: _t183 = x == 547
+    ; TAC: IF _t183 GOTO L5
+    cmp ecx, 547
+    je L5
+    ; TAC: _t184 = x == 550
+    ; TAC: IF _t184 GOTO L5
+    cmp ecx, 550
+    je L5
+    ; TAC: _t185 = x == 553
+    ; TAC: IF _t185 GOTO L5
+    cmp ecx, 553
+    je L5
+    ; TAC: _t186 = x == 556
+    ; TAC: IF _t186 GOTO L5
+    cmp ecx, 556
+    je L5
+    ; TAC: _t187 = x == 559
+    ; TAC: IF _t187 GOTO L5
+    cmp ecx, 559
+    je L5
+    ; TAC: _t188 = x == 562
+    ; TAC: IF _t188 GOTO L5
+    cmp ecx, 562
+    je L5
+    ; TAC: _t189 = x == 565
+    ; TAC: IF _t189 GOTO L5
+    cmp ecx, 565
+    je L5
+    ; TAC: _t190 = x == 568
+    ; TAC: IF _t190 GOTO L5
+    cmp ecx, 568
+    je L5
+    ; TAC: _t191 = x == 571
+    ; TAC: IF _t191 GOTO L5
+    cmp ecx, 571
+    je L5
+    ; TAC: _t192 = x == 574
+    ; TAC: IF _t192 GOTO L5
+    cmp ecx, 574
+    je L5
+    ; TAC: _t193 = x == 577
+    ; TAC: IF _t193 GOTO L5
+    cmp ecx, 577
+    je L5
+    ; TAC: _t194 = x == 580
+    ; TAC: IF _t194 GOTO L5
+    cmp ecx, 580
+    je L5
+    ; TAC: _t195 = x == 583
+    ; TAC: IF _t195 GOTO L5
+    cmp ecx, 583
+    je L5
+    ; TAC: _t196 = x == 586
+    ; TAC: IF _t196 GOTO L5
+    cmp ecx, 586
+    je L5
+    ; TAC: _t197 = x == 589
+    ; TAC: IF _t197 GOTO L5
+    cmp ecx, 589
+    je L5
+    ; TAC: _t198 = x == 592
+    ; TAC: IF _t198 GOTO L5
+    cmp ecx, 592
+    je L5
+    ; TAC: _t199 = x == 595
+    ; TAC: IF _t199 GOTO L5
+    cmp ecx, 595
+    je L5
+    ; TAC: _t200 = x == 598
+    ; TAC: IF _t200 GOTO L5
+    cmp ecx, 598
+    je L5
+    ; TAC: _t201 = x == 601
+    ; TAC: IF _t201 GOTO L5
+    cmp ecx, 601
+    je L5
+    ; TAC: _t202 = x == 604
+    ; TAC: IF _t202 GOTO L5
+    cmp ecx, 604
+    je L5
+    ; TAC: _t203 = x == 607
+    ; TAC: IF _t203 GOTO L5
+    cmp ecx, 607
+    je L5
+    ; TAC: _t204 = x == 610
+    ; TAC: IF _t204 GOTO L5
+    cmp ecx, 610
+    je L5
+    ; TAC: _t205 = x == 613
+    ; TAC: IF _t205 GOTO L5
+    cmp ecx, 613
+    je L5
+    ; TAC: _t206 = x == 616
+    ; TAC: IF _t206 GOTO L5
+    cmp ecx, 616
+    je L5
+    ; TAC: _t207 = x == 619
+    ; TAC: IF _t207 GOTO L5
+    cmp ecx, 619
+    je L5
+    ; TAC: _t208 = x == 622
+    ; TAC: IF _t208 GOTO L5
+    cmp ecx, 622
+    je L5
+    ; TAC: _t209 = x == 625
+    ; TAC: IF _t209 GOTO L5
+    cmp ecx, 625
+    je L5
+    ; TAC: _t210 = x == 628
+    ; TAC: IF _t210 GOTO L5
+    cmp ecx, 628
+    je L5
+    ; TAC: _t211 = x == 631
+    ; TAC: IF _t211 GOTO L5
+    cmp ecx, 631
+    je L5
+    ; TAC: _t212 = x == 634
+    ; TAC: IF _t212 GOTO L5
+    cmp ecx, 634
+    je L5
+    ; TAC: _t213 = x == 637
+    ; TAC: IF _t213 GOTO L5
+    cmp ecx, 637
+    je L5
+    ; TAC: _t214 = x == 640
+    ; TAC: IF _t214 GOTO L5
+    cmp ecx, 640
+    je L5
+    ; TAC: _t215 = x == 643
+    ; TAC: IF _t215 GOTO L5
+    cmp ecx, 643
+    je L5
+    ; TAC: _t216 = x == 646
+    ; TAC: IF _t216 GOTO L5
+    cmp ecx, 646
+    je L5
+    ; TAC: _t217 = x == 649
+    ; TAC: IF _t217 GOTO L5
+    cmp ecx, 649
+    je L5
+    ; TAC: _t218 = x == 652
+    ; TAC: IF _t218 GOTO L5
+    cmp ecx, 652
+    je L5
+    ; TAC: _t219 = x == 655
+    ; TAC: IF _t219 GOTO L5
+    cmp ecx, 655
+    je L5
+    ; TAC: _t220 = x == 658
+    ; TAC: IF _t220 GOTO L5
+    cmp ecx, 658
+    je L5
+    ; TAC: _t221 = x == 661
+    ; TAC: IF _t221 GOTO L5
+    cmp ecx, 661
+    je L5
+    ; TAC: _t222 = x == 664
+    ; TAC: IF _t222 GOTO L5
+    cmp ecx, 664
+    je L5
+    ; TAC: _t223 = x == 667
+    ; TAC: IF _t223 GOTO L5
+    cmp ecx, 667
+    je L5
+    ; TAC: _t224 = x == 670
+    ; TAC: IF _t224 GOTO L5
+    cmp ecx, 670
+    je L5
+    ; TAC: _t225 = x == 673
+    ; TAC: IF _t225 GOTO L5
+    cmp ecx, 673
+    je L5
+    ; TAC: _t226 = x == 676
+    ; TAC: IF _t226 GOTO L5
+    cmp ecx, 676
+    je L5
+    ; TAC: _t227 = x == 679
+    ; TAC: IF _t227 GOTO L5
+    cmp ecx, 679
+    je L5
+    ; TAC: _t228 = x == 682
+    ; TAC: IF _t228 GOTO L5
+    cmp ecx, 682
+    je L5
+    ; TAC: _t229 = x == 685
+    ; TAC: IF _t229 GOTO L5
+    cmp ecx, 685
+    je L5
+    ; TAC: _t230 = x == 688
+    ; TAC: IF _t230 GOTO L5
+    cmp ecx, 688
+    je L5
+    ; TAC: _t231 = x == 691
+    ; TAC: IF _t231 GOTO L5
+    cmp ecx, 691
+    je L5
+    ; TAC: _t232 = x == 694
+    ; TAC: IF _t232 GOTO L5
+    cmp ecx, 694
+    je L5
+    ; TAC: _t233 = x == 697
+    ; TAC: IF _t233 GOTO L5
+    cmp ecx, 697
+    je L5
+    ; TAC: _t234 = x == 700
+    ; TAC: IF _t234 GOTO L5
+    cmp ecx, 700
+    je L5
+    ; TAC: _t235 = x == 703
+    ; TAC: IF _t235 GOTO L5
+    cmp ecx, 703
+    je L5
+    ; TAC: _t236 = x == 706
+    ; TAC: IF _t236 GOTO L5
+    cmp ecx, 706
+    je L5
+    ; TAC: _t237 = x == 709
+    ; TAC: IF _t237 GOTO L5
+    cmp ecx, 709
+    je L5
+    ; TAC: _t238 = x == 712
+    ; TAC: IF _t238 GOTO L5
+    cmp ecx, 712
+    je L5
+    ; TAC: _t239 = x == 715
+    ; TAC: IF _t239 GOTO L5
+    cmp ecx, 715
+    je L5
+    ; TAC: _t240 = x == 718
+    ; TAC: IF _t240 GOTO L5
+    cmp ecx, 718
+    je L5
+    ; TAC: _t241 = x == 721
+    ; TAC: IF _t241 GOTO L5
+    cmp ecx, 721
+    je L5
+    ; TAC: _t242 = x == 724
+    ; TAC: IF _t242 GOTO L5
+    cmp ecx, 724
+    je L5
+    ; TAC: _t243 = x == 727
+    ; TAC: IF _t243 GOTO L5
+    cmp ecx, 727
+    je L5
+    ; TAC: _t244 = x == 730
+    ; TAC: IF _t244 GOTO L5
+    cmp ecx, 730
+    je L5
+    ; TAC: _t245 = x == 733
+    ; TAC: IF _t245 GOTO L5
+    cmp ecx, 733
+    je L5
+    ; TAC: _t246 = x == 736
+    ; TAC: IF _t246 GOTO L5
+    cmp ecx, 736
+    je L5
+    ; TAC: _t247 = x == 739
+    ; TAC: IF _t247 GOTO L5
+    cmp ecx, 739
+    je L5
+    ; TAC: _t248 = x == 742
+    ; TAC: IF _t248 GOTO L5
+    cmp ecx, 742
+    je L5
+    ; TAC: _t249 = x == 745
+    ; TAC: IF _t249 GOTO L5
+    cmp ecx, 745
+    je L5
+    ; TAC: _t250 = x == 748
+    ; TAC: IF _t250 GOTO L5
+    cmp ecx, 748
+    je L5
+    ; TAC: _t251 = x == 751
+    ; TAC: IF _t251 GOTO L5
+    cmp ecx, 751
+    je L5
+    ; TAC: _t252 = x == 754
+    ; TAC: IF _t252 GOTO L5
+    cmp ecx, 754
+    je L5
+    ; TAC: _t253 = x == 757
+    ; TAC: IF _t253 GOTO L5
+    cmp ecx, 757
+    je L5
+    ; TAC: _t254 = x == 760
+    ; TAC: IF _t254 GOTO L5
+    cmp ecx, 760
+    je L5
+    ; TAC: _t255 = x == 763
+    ; TAC: IF _t255 GOTO L5
+    cmp ecx, 763
+    je L5
+    ; TAC: _t256 = x == 766
+    ; TAC: IF _t256 GOTO L5
+    cmp ecx, 766
+    je L5
+    ; TAC: _t257 = x == 769
+    ; TAC: IF _t257 GOTO L5
+    cmp ecx, 769
+    je L5
+    ; TAC: _t258 = x == 772
+    ; TAC: IF _t258 GOTO L5
+    cmp ecx, 772
+    je L5
+    ; TAC: _t259 = x == 775
+    ; TAC: IF _t259 GOTO L5
+    cmp ecx, 775
+    je L5
+    ; TAC: _t260 = x == 778
+    ; TAC: IF _t260 GOTO L5
+    cmp ecx, 778
+    je L5
+    ; TAC: _t261 = x == 781
+    ; TAC: IF _t261 GOTO L5
+    cmp ecx, 781
+    je L5
+    ; TAC: _t262 = x == 784
+    ; TAC: IF _t262 GOTO L5
+    cmp ecx, 784
+    je L5
+    ; TAC: _t263 = x == 787
+    ; TAC: IF _t263 GOTO L5
+    cmp ecx, 787
+    je L5
+    ; TAC: _t264 = x == 790
+    ; TAC: IF _t264 GOTO L5
+    cmp ecx, 790
+    je L5
+    ; TAC: _t265 = x == 793
+    ; TAC: IF _t265 GOTO L5
+    cmp ecx, 793
+    je L5
+    ; TAC: _t266 = x == 796
+    ; TAC: IF _t266 GOTO L5
+    cmp ecx, 796
+    je L5
+    ; TAC: _t267 = x == 799
+    ; TAC: IF _t267 GOTO L5
+    cmp ecx, 799
+    je L5
+    ; TAC: _t268 = x == 802
+    ; TAC: IF _t268 GOTO L5
+    cmp ecx, 802
+    je L5
+    ; TAC: _t269 = x == 805
+    ; TAC: IF _t269 GOTO L5
+    cmp ecx, 805
+    je L5
+    ; TAC: _t270 = x == 808
+    ; TAC: IF _t270 GOTO L5
+    cmp ecx, 808
+    je L5
+    ; TAC: _t271 = x == 811
+    ; TAC: IF _t271 GOTO L5
+    cmp ecx, 811
+    je L5
+    ; TAC: _t272 = x == 814
+    ; TAC: IF _t272 GOTO L5
+    cmp ecx, 814
+    je L5
+    ; TAC: _t273 = x == 817
+    ; TAC: IF _t273 GOTO L5
+    cmp ecx, 817
+    je L5
+    ; TAC: _t274 = x == 820
+    ; TAC: IF _t274 GOTO L5
+    cmp ecx, 820
+    je L5
+    ; TAC: _t275 = x == 823
+    ; TAC: IF _t275 GOTO L5
+    cmp ecx, 823
+    je L5
+    ; TAC: _t276 = x == 826
+    ; TAC: IF _t276 GOTO L5
+    cmp ecx, 826
+    je L5
+    ; TAC: _t277 = x == 829
+    ; TAC: IF _t277 GOTO L5
+    cmp ecx, 829
+    je L5
+    ; TAC: _t278 = x == 832
+    ; TAC: IF _t278 GOTO L5
+    cmp ecx, 832
+    je L5
+    ; TAC: _t279 = x == 835
+    ; TAC: IF _t279 GOTO L5
+    cmp ecx, 835
+    je L5
+    ; TAC: _t280 = x == 838
+    ; TAC: IF _t280 GOTO L5
+    cmp ecx, 838
+    je L5
+    ; TAC: _t281 = x == 841
+    ; TAC: IF _t281 GOTO L5
+    cmp ecx, 841
+    je L5
+    ; TAC: _t282 = x == 844
+    ; TAC: IF _t282 GOTO L5
+    cmp ecx, 844
+    je L5
+    ; TAC: _t283 = x == 847
+    ; TAC: IF _t283 GOTO L5
+    cmp ecx, 847
+    je L5
+    ; TAC: _t284 = x == 850
+    ; TAC: IF _t284 GOTO L5
+    cmp ecx, 850
+    je L5
+    ; TAC: _t285 = x == 853
+    ; TAC: IF _t285 GOTO L5
+    cmp ecx, 853
+    je L5
+    ; TAC: _t286 = x == 856
+    ; TAC: IF _t286 GOTO L5
+    cmp ecx, 856
+    je L5
+    ; TAC: _t287 = x == 859
+    ; TAC: IF _t287 GOTO L5
+    cmp ecx, 859
+    je L5
+    ; TAC: _t288 = x == 862
+    ; TAC: IF _t288 GOTO L5
+    cmp ecx, 862
+    je L5
+    ; TAC: _t289 = x == 865
+    ; TAC: IF _t289 GOTO L5
+    cmp ecx, 865
+    je L5
+    ; TAC: _t290 = x == 868
+    ; TAC: IF _t290 GOTO L5
+    cmp ecx, 868
+    je L5
+    ; TAC: _t291 = x == 871
+    ; TAC: IF _t291 GOTO L5
+    cmp ecx, 871
+    je L5
+    ; TAC: _t292 = x == 874
+    ; TAC: IF _t292 GOTO L5
+    cmp ecx, 874
+    je L5
+    ; TAC: _t293 = x == 877
+    ; TAC: IF _t293 GOTO L5
+    cmp ecx, 877
+    je L5
+    ; TAC: _t294 = x == 880
+    ; TAC: IF _t294 GOTO L5
+    cmp ecx, 880
+    je L5
+    ; TAC: _t295 = x == 883
+    ; TAC: IF _t295 GOTO L5
+    cmp ecx, 883
+    je L5
+    ; TAC: _t296 = x == 886
+    ; TAC: IF _t296 GOTO L5
+    cmp ecx, 886
+    je L5
+    ; TAC: _t297 = x == 889
+    ; TAC: IF _t297 GOTO L5
+    cmp ecx, 889
+    je L5
+    ; TAC: _t298 = x == 892
+    ; TAC: IF _t298 GOTO L5
+    cmp ecx, 892
+    je L5
+    ; TAC: _t299 = x == 895
+    ; TAC: IF _t299 GOTO L5
+    cmp ecx, 895
+    je L5
+    ; TAC: _t300 = x == 898
+    ; TAC: IF _t300 GOTO L5
+    cmp ecx, 898
+    je L5
+    ; TAC: _t301 = x == 901
+    ; TAC: IF _t301 GOTO L5
+    cmp ecx, 901
+    je L5
+    ; TAC: _t302 = x == 904
+    ; TAC: IF _t302 GOTO L5
+    cmp ecx, 904
+    je L5
+    ; TAC: _t303 = x == 907
+    ; TAC: IF _t303 GOTO L5
+    cmp ecx, 907
+    je L5
+    ; TAC: _t304 = x == 910
+    ; TAC: IF _t304 GOTO L5
+    cmp ecx, 910
+    je L5
+    ; TAC: _t305 = x == 913
+    ; TAC: IF _t305 GOTO L5
+    cmp ecx, 913
+    je L5
+    ; TAC: _t306 = x == 916
+    ; TAC: IF _t306 GOTO L5
+    cmp ecx, 916
+    je L5
+    ; TAC: _t307 = x == 919
+    ; TAC: IF _t307 GOTO L5
+    cmp ecx, 919
+    je L5
+    ; TAC: _t308 = x == 922
+    ; TAC: IF _t308 GOTO L5
+    cmp ecx, 922
+    je L5
+    ; TAC: _t309 = x == 925
+    ; TAC: IF _t309 GOTO L5
+    cmp ecx, 925
+    je L5
+    ; TAC: _t310 = x == 928
+    ; TAC: IF _t310 GOTO L5
+    cmp ecx, 928
+    je L5
+    ; TAC: _t311 = x == 931
+    ; TAC: IF _t311 GOTO L5
+    cmp ecx, 931
+    je L5
+    ; TAC: _t312 = x == 934
+    ; TAC: IF _t312 GOTO L5
+    cmp ecx, 934
+    je L5
+    ; TAC: _t313 = x == 937
+    ; TAC: IF _t313 GOTO L5
+    cmp ecx, 937
+    je L5
+    ; TAC: _t314 = x == 940
+    ; TAC: IF _t314 GOTO L5
+    cmp ecx, 940
+    je L5
+    ; TAC: _t315 = x == 943
+    ; TAC: IF _t315 GOTO L5
+    cmp ecx, 943
+    je L5
+    ; TAC: _t316 = x == 946
+    ; TAC: IF _t316 GOTO L5
+    cmp ecx, 946
+    je L5
+    ; TAC: _t317 = x == 949
+    ; TAC: IF _t317 GOTO L5
+    cmp ecx, 949
+    je L5
+    ; TAC: _t318 = x == 952
+    ; TAC: IF _t318 GOTO L5
+    cmp ecx, 952
+    je L5
+    ; TAC: _t319 = x == 955
+    ; TAC: IF _t319 GOTO L5
+    cmp ecx, 955
+    je L5
+    ; TAC: _t320 = x == 958
+    ; TAC: IF _t320 GOTO L5
+    cmp ecx, 958
+    je L5
+    ; TAC: _t321 = x == 961
+    ; TAC: IF _t321 GOTO L5
+    cmp ecx, 961
+    je L5
+    ; TAC: _t322 = x == 964
+    ; TAC: IF _t322 GOTO L5
+    cmp ecx, 964
+    je L5
+    ; TAC: _t323 = x == 967
+    ; TAC: IF _t323 GOTO L5
+    cmp ecx, 967
+    je L5
+    ; TAC: _t324 = x == 970
+    ; TAC: IF _t324 GOTO L5
+    cmp ecx, 970
+    je L5
+    ; TAC: _t325 = x == 973
+    ; TAC: IF _t325 GOTO L5
+    cmp ecx, 973
+    je L5
+    ; TAC: _t326 = x == 976
+    ; TAC: IF _t326 GOTO L5
+    cmp ecx, 976
+    je L5
+    ; TAC: _t327 = x == 979
+    ; TAC: IF _t327 GOTO L5
+    cmp ecx, 979
+    je L5
+    ; TAC: _t328 = x == 982
+    ; TAC: IF _t328 GOTO L5
+    cmp ecx, 982
+    je L5
+    ; TAC: _t329 = x == 985
+    ; TAC: IF _t329 GOTO L5
+    cmp ecx, 985
+    je L5
+    ; TAC: _t330 = x == 988
+    ; TAC: IF _t330 GOTO L5
+    cmp ecx, 988
+    je L5
+    ; TAC: _t331 = x == 991
+    ; TAC: IF _t331 GOTO L5
+    cmp ecx, 991
+    je L5
+    ; TAC: _t332 = x == 994
+    ; TAC: IF _t332 GOTO L5
+    cmp ecx, 994
+    je L5
+    ; TAC: _t333 = x == 997
+    ; TAC: IF _t333 GOTO L5
+    cmp ecx, 997
+    je L5
+    ; TAC: _t334 = x == 1000
+    ; TAC: IF _t334 GOTO L5
+    cmp ecx, 1000
+    je L5
+    ; TAC: _t335 = x == 1003
+    ; TAC: IF _t335 GOTO L5
+    cmp ecx, 1003
+    je L5
+    ; TAC: _t336 = x == 1006
+    ; TAC: IF _t336 GOTO L5
+    cmp ecx, 1006
+    je L5
+    ; TAC: _t337 = x == 1009
+    ; TAC: IF _t337 GOTO L5
+    cmp ecx, 1009
+    je L5
+    ; TAC: _t338 = x == 1012
+    ; TAC: IF _t338 GOTO L5
+    cmp ecx, 1012
+    je L5
+    ; TAC: _t339 = x == 1015
+    ; TAC: IF _t339 GOTO L5
+    cmp ecx, 1015
+    je L5
+    ; TAC: _t340 = x == 1018
+    ; TAC: IF _t340 GOTO L5
+    cmp ecx, 1018
+    je L5
+    ; TAC: _t341 = x == 1021
+    ; TAC: IF _t341 GOTO L5
+    cmp ecx, 1021
+    je L5
+    ; TAC: _t342 = x == 1024
+    ; TAC: IF _t342 GOTO L5
+    cmp ecx, 1024
+    je L5
+    ; TAC: _t343 = x == 1027
+    ; TAC: IF _t343 GOTO L5
+    cmp ecx, 1027
+    je L5
+    ; TAC: _t344 = x == 1030
+    ; TAC: IF _t344 GOTO L5
+    cmp ecx, 1030
+    je L5
+    ; TAC: _t345 = x == 1033
+    ; TAC: IF _t345 GOTO L5
+    cmp ecx, 1033
+    je L5
+    ; TAC: _t346 = x == 1036
+    ; TAC: IF _t346 GOTO L5
+    cmp ecx, 1036
+    je L5
+    ; TAC: _t347 = x == 1039
+    ; TAC: IF _t347 GOTO L5
+    cmp ecx, 1039
+    je L5
+    ; TAC: _t348 = x == 1042
+    ; TAC: IF _t348 GOTO L5
+    cmp ecx, 1042
+    je L5
+    ; TAC: _t349 = x == 1045
+    ; TAC: IF _t349 GOTO L5
+    cmp ecx, 1045
+    je L5
+    ; TAC: _t350 = x == 1048
+    ; TAC: IF _t350 GOTO L5
+    cmp ecx, 1048
+    je L5
+    ; TAC: _t351 = x == 1051
+    ; TAC: IF _t351 GOTO L5
+    cmp ecx, 1051
+    je L5
+    ; TAC: _t352 = x == 1054
+    ; TAC: IF _t352 GOTO L5
+    cmp ecx, 1054
+    je L5
+    ; TAC: _t353 = x == 1057
+    ; TAC: IF _t353 GOTO L5
+    cmp ecx, 1057
+    je L5
+    ; TAC: _t354 = x == 1060
+    ; TAC: IF _t354 GOTO L5
+    cmp ecx, 1060
+    je L5
+    ; TAC: _t355 = x == 1063
+    ; TAC: IF _t355 GOTO L5
+    cmp ecx, 1063
+    je L5
+    ; TAC: _t356 = x == 1066
+    ; TAC: IF _t356 GOTO L5
+    cmp ecx, 1066
+    je L5
+    ; TAC: _t357 = x == 1069
+    ; TAC: IF _t357 GOTO L5
+    cmp ecx, 1069
+    je L5
+    ; TAC: _t358 = x == 1072
+    ; TAC: IF _t358 GOTO L5
+    cmp ecx, 1072
+    je L5
+    ; TAC: _t359 = x == 1075
+    ; TAC: IF _t359 GOTO L5
+    cmp ecx, 1075
+    je L5
+    ; TAC: _t360 = x == 1078
+    ; TAC: IF _t360 GOTO L5
+    cmp ecx, 1078
+    je L5
+    ; TAC: _t361 = x == 1081
+    ; TAC: IF _t361 GOTO L5
+    cmp ecx, 1081
+    je L5
+    ; TAC: _t362 = x == 1084
+    ; TAC: IF _t362 GOTO L5
+    cmp ecx, 1084
+    je L5
+    ; TAC: _t363 = x == 1087
+    ; TAC: IF _t363 GOTO L5
+    cmp ecx, 1087
+    je L5
+    ; TAC: _t364 = x == 1090
+    ; TAC: IF _t364 GOTO L5
+    cmp ecx, 1090
+    je L5
+    ; TAC: _t365 = x == 1093
+    ; TAC: IF _t365 GOTO L5
+    cmp ecx, 1093
+    je L5
+    ; TAC: _t366 = x == 1096
+    ; TAC: IF _t366 GOTO L5
+    cmp ecx, 1096
+    je L5
+    ; TAC: _t367 = x == 1099
+    ; TAC: IF _t367 GOTO L5
+    cmp ecx, 1099
+    je L5
+    ; TAC: _t368 = x == 1102
+    ; TAC: IF _t368 GOTO L5
+    cmp ecx, 1102
+    je L5
+    ; TAC: _t369 = x == 1105
+    ; TAC: IF _t369 GOTO L5
+    cmp ecx, 1105
+    je L5
+    ; TAC: _t370 = x == 1108
+    ; TAC: IF _t370 GOTO L5
+    cmp ecx, 1108
+    je L5
+    ; TAC: _t371 = x == 1111
+    ; TAC: IF _t371 GOTO L5
+    cmp ecx, 1111
+    je L5
+    ; TAC: _t372 = x == 1114
+    ; TAC: IF _t372 GOTO L5
+    cmp ecx, 1114
+    je L5
+    ; TAC: _t373 = x == 1117
+    ; TAC: IF _t373 GOTO L5
+    cmp ecx, 1117
+    je L5
+    ; TAC: _t374 = x == 1120
+    ; TAC: IF _t374 GOTO L5
+    cmp ecx, 1120
+    je L5
+    ; TAC: _t375 = x == 1123
+    ; TAC: IF _t375 GOTO L5
+    cmp ecx, 1123
+    je L5
+    ; TAC: _t376 = x == 1126
+    ; TAC: IF _t376 GOTO L5
+    cmp ecx, 1126
+    je L5
+    ; TAC: _t377 = x == 1129
+    ; TAC: IF _t377 GOTO L5
+    cmp ecx, 1129
+    je L5
+    ; TAC: _t378 = x == 1132
+    ; TAC: IF _t378 GOTO L5
+    cmp ecx, 1132
+    je L5
+    ; TAC: _t379 = x == 1135
+    ; TAC: IF _t379 GOTO L5
+    cmp ecx, 1135
+    je L5
+    ; TAC: _t380 = x == 1138
+    ; TAC: IF _t380 GOTO L5
+    cmp ecx, 1138
+    je L5
+    ; TAC: _t381 = x == 1141
+    ; TAC: IF _t381 GOTO L5
+    cmp ecx, 1141
+    je L5
+    ; TAC: _t382 = x == 1144
+    ; TAC: IF _t382 GOTO L5
+    cmp ecx, 1144
+    je L5
+    ; TAC: _t383 = x == 1147
+    ; TAC: IF _t383 GOTO L5
+    cmp ecx, 1147
+    je L5
+    ; TAC: _t384 = x == 1150
+    ; TAC: IF _t384 GOTO L5
+    cmp ecx, 1150
+    je L5
+    ; TAC: _t385 = x == 1153
+    ; TAC: IF _t385 GOTO L5
+    cmp ecx, 1153
+    je L5
+    ; TAC: _t386 = x == 1156
+    ; TAC: IF _t386 GOTO L5
+    cmp ecx, 1156
+    je L5
+    ; TAC: _t387 = x == 1159
+    ; TAC: IF _t387 GOTO L5
+    cmp ecx, 1159
+    je L5
+    ; TAC: _t388 = x == 1162
+    ; TAC: IF _t388 GOTO L5
+    cmp ecx, 1162
+    je L5
+    ; TAC: _t389 = x == 1165
+    ; TAC: IF _t389 GOTO L5
+    cmp ecx, 1165
+    je L5
+    ; TAC: _t390 = x == 1168
+    ; TAC: IF _t390 GOTO L5
+    cmp ecx, 1168
+    je L5
+    ; TAC: _t391 = x == 1171
+    ; TAC: IF _t391 GOTO L5
+    cmp ecx, 1171
+    je L5
+    ; TAC: _t392 = x == 1174
+    ; TAC: IF _t392 GOTO L5
+    cmp ecx, 1174
+    je L5
+    ; TAC: _t393 = x == 1177
+    ; TAC: IF _t393 GOTO L5
+    cmp ecx, 1177
+    je L5
+    ; TAC: _t394 = x == 1180
+    ; TAC: IF _t394 GOTO L5
+    cmp ecx, 1180
+    je L5
+    ; TAC: _t395 = x == 1183
+    ; TAC: IF _t395 GOTO L5
+    cmp ecx, 1183
+    je L5
+    ; TAC: _t396 = x == 1186
+    ; TAC: IF _t396 GOTO L5
+    cmp ecx, 1186
+    je L5
+    ; TAC: _t397 = x == 1189
+    ; TAC: IF _t397 GOTO L5
+    cmp ecx, 1189
+    je L5
+    ; TAC: _t398 = x == 1192
+    ; TAC: IF _t398 GOTO L5
+    cmp ecx, 1192
+    je L5
+    ; TAC: _t399 = x == 1195
+    ; TAC: IF _t399 GOTO L5
+    cmp ecx, 1195
+    je L5
+    ; TAC: _t400 = x == 1198
+    ; TAC: IF _t400 GOTO L5
+    cmp ecx, 1198
+    je L5
+    ; TAC: _t401 = x == 1201
+    ; TAC: IF _t401 GOTO L5
+    cmp ecx, 1201
+    je L5
+    ; TAC: _t402 = x == 1204
+    ; TAC: IF _t402 GOTO L5
+    cmp ecx, 1204
+    je L5
+    ; TAC: _t403 = x == 1207
+    ; TAC: IF _t403 GOTO L5
+    cmp ecx, 1207
+    je L5
+    ; TAC: _t404 = x == 1210
+    ; TAC: IF _t404 GOTO L5
+    cmp ecx, 1210
+    je L5
+    ; TAC: _t405 = x == 1213
+    ; TAC: IF _t405 GOTO L5
+    cmp ecx, 1213
+    je L5
+    ; TAC: _t406 = x == 1216
+    ; TAC: IF _t406 GOTO L5
+    cmp ecx, 1216
+    je L5
+    ; TAC: _t407 = x == 1219
+    ; TAC: IF _t407 GOTO L5
+    cmp ecx, 1219
+    je L5
+    ; TAC: _t408 = x == 1222
+    ; TAC: IF _t408 GOTO L5
+    cmp ecx, 1222
+    je L5
+    ; TAC: _t409 = x == 1225
+    ; TAC: IF _t409 GOTO L5
+    cmp ecx, 1225
+    je L5
+    ; TAC: _t410 = x == 1228
+    ; TAC: IF _t410 GOTO L5
+    cmp ecx, 1228
+    je L5
+    ; TAC: _t411 = x == 1231
+    ; TAC: IF _t411 GOTO L5
+    cmp ecx, 1231
+    je L5
+    ; TAC: _t412 = x == 1234
+    ; TAC: IF _t412 GOTO L5
+    cmp ecx, 1234
+    je L5
+    ; TAC: _t413 = x == 1237
+    ; TAC: IF _t413 GOTO L5
+    cmp ecx, 1237
+    je L5
+    ; TAC: _t414 = x == 1240
+    ; TAC: IF _t414 GOTO L5
+    cmp ecx, 1240
+    je L5
+    ; TAC: _t415 = x == 1243
+    ; TAC: IF _t415 GOTO L5
+    cmp ecx, 1243
+    je L5
+    ; TAC: _t416 = x == 1246
+    ; TAC: IF _t416 GOTO L5
+    cmp ecx, 1246
+    je L5
+    ; TAC: _t417 = x == 1249
+    ; TAC: IF _t417 GOTO L5
+    cmp ecx, 1249
+    je L5
+    ; TAC: _t418 = x == 1252
+    ; TAC: IF _t418 GOTO L5
+    cmp ecx, 1252
+    je L5
+    ; TAC: _t419 = x == 1255
+    ; TAC: IF _t419 GOTO L5
+    cmp ecx, 1255
+    je L5
+    ; TAC: _t420 = x == 1258
+    ; TAC: IF _t420 GOTO L5
+    cmp ecx, 1258
+    je L5
+    ; TAC: _t421 = x == 1261
+    ; TAC: IF _t421 GOTO L5
+    cmp ecx, 1261
+    je L5
+    ; TAC: _t422 = x == 1264
+    ; TAC: IF _t422 GOTO L5
+    cmp ecx, 1264
+    je L5
+    ; TAC: _t423 = x == 1267
+    ; TAC: IF _t423 GOTO L5
+    cmp ecx, 1267
+    je L5
+    ; TAC: _t424 = x == 1270
+    ; TAC: IF _t424 GOTO L5
+    cmp ecx, 1270
+    je L5
+    ; TAC: _t425 = x == 1273
+    ; TAC: IF _t425 GOTO L5
+    cmp ecx, 1273
+    je L5
+    ; TAC: _t426 = x == 1276
+    ; TAC: IF _t426 GOTO L5
+    cmp ecx, 1276
+    je L5
+    ; TAC: _t427 = x == 1279
+    ; TAC: IF _t427 GOTO L5
+    cmp ecx, 1279
+    je L5
+    ; TAC: _t428 = x == 1282
+    ; TAC: IF _t428 GOTO L5
+    cmp ecx, 1282
+    je L5
+    ; TAC: _t429 = x == 1285
+    ; TAC: IF _t429 GOTO L5
+    cmp ecx, 1285
+    je L5
+    ; TAC: _t430 = x == 1288
+    ; TAC: IF _t430 GOTO L5
+    cmp ecx, 1288
+    je L5
+    ; TAC: _t431 = x == 1291
+    ; TAC: IF _t431 GOTO L5
+    cmp ecx, 1291
+    je L5
+    ; TAC: _t432 = x == 1294
+    ; TAC: IF _t432 GOTO L5
+    cmp ecx, 1294
+    je L5
+    ; TAC: _t433 = x == 1297
+    ; TAC: IF _t433 GOTO L5
+    cmp ecx, 1297
+    je L5
+    ; TAC: _t434 = x == 1300
+    ; TAC: IF _t434 GOTO L5
+    cmp ecx, 1300
+    je L5
+    ; TAC: _t435 = x == 1303
+    ; TAC: IF _t435 GOTO L5
+    cmp ecx, 1303
+    je L5
+    ; TAC: _t436 = x == 1306
+    ; TAC: IF _t436 GOTO L5
+    cmp ecx, 1306
+    je L5
+    ; TAC: _t437 = x == 1309
+    ; TAC: IF _t437 GOTO L5
+    cmp ecx, 1309
+    je L5
+    ; TAC: _t438 = x == 1312
+    ; TAC: IF _t438 GOTO L5
+    cmp ecx, 1312
+    je L5
+    ; TAC: _t439 = x == 1315
+    ; TAC: IF _t439 GOTO L5
+    cmp ecx, 1315
+    je L5
+    ; TAC: _t440 = x == 1318
+    ; TAC: IF _t440 GOTO L5
+    cmp ecx, 1318
+    je L5
+    ; TAC: _t441 = x == 1321
+    ; TAC: IF _t441 GOTO L5
+    cmp ecx, 1321
+    je L5
+    ; TAC: _t442 = x == 1324
+    ; TAC: IF _t442 GOTO L5
+    cmp ecx, 1324
+    je L5
+    ; TAC: _t443 = x == 1327
+    ; TAC: IF _t443 GOTO L5
+    cmp ecx, 1327
+    je L5
+    ; TAC: _t444 = x == 1330
+    ; TAC: IF _t444 GOTO L5
+    cmp ecx, 1330
+    je L5
+    ; TAC: _t445 = x == 1333
+    ; TAC: IF _t445 GOTO L5
+    cmp ecx, 1333
+    je L5
+    ; TAC: _t446 = x == 1336
+    ; TAC: IF _t446 GOTO L5
+    cmp ecx, 1336
+    je L5
+    ; TAC: _t447 = x == 1339
+    ; TAC: IF _t447 GOTO L5
+    cmp ecx, 1339
+    je L5
+    ; TAC: _t448 = x == 1342
+    ; TAC: IF _t448 GOTO L5
+    cmp ecx, 1342
+    je L5
+    ; TAC: _t449 = x == 1345
+    ; TAC: IF _t449 GOTO L5
+    cmp ecx, 1345
+    je L5
+    ; TAC: _t450 = x == 1348
+    ; TAC: IF _t450 GOTO L5
+    cmp ecx, 1348
+    je L5
+    ; TAC: _t451 = x == 1351
+    ; TAC: IF _t451 GOTO L5
+    cmp ecx, 1351
+    je L5
+    ; TAC: _t452 = x == 1354
+    ; TAC: IF _t452 GOTO L5
+    cmp ecx, 1354
+    je L5
+    ; TAC: _t453 = x == 1357
+    ; TAC: IF _t453 GOTO L5
+    cmp ecx, 1357
+    je L5
+    ; TAC: _t454 = x == 1360
+    ; TAC: IF _t454 GOTO L5
+    cmp ecx, 1360
+    je L5
+    ; TAC: _t455 = x == 1363
+    ; TAC: IF _t455 GOTO L5
+    cmp ecx, 1363
+    je L5
+    ; TAC: _t456 = x == 1366
+    ; TAC: IF _t456 GOTO L5
+    cmp ecx, 1366
+    je L5
+    ; TAC: _t457 = x == 1369
+    ; TAC: IF _t457 GOTO L5
+    cmp ecx, 1369
+    je L5
+    ; TAC: _t458 = x == 1372
+    ; TAC: IF _t458 GOTO L5
+    cmp ecx, 1372
+    je L5
+    ; TAC: _t459 = x == 1375
+    ; TAC: IF _t459 GOTO L5
+    cmp ecx, 1375
+    je L5
+    ; TAC: _t460 = x == 1378
+    ; TAC: IF _t460 GOTO L5
+    cmp ecx, 1378
+    je L5
+    ; TAC: _t461 = x == 1381
+    ; TAC: IF _t461 GOTO L5
+    cmp ecx, 1381
+    je L5
+    ; TAC: _t462 = x == 1384
+    ; TAC: IF _t462 GOTO L5
+    cmp ecx, 1384
+    je L5
+    ; TAC: _t463 = x == 1387
+    ; TAC: IF _t463 GOTO L5
+    cmp ecx, 1387
+    je L5
+    ; TAC: _t464 = x == 1390
+    ; TAC: IF _t464 GOTO L5
+    cmp ecx, 1390
+    je L5
+    ; TAC: _t465 = x == 1393
+    ; TAC: IF _t465 GOTO L5
+    cmp ecx, 1393
+    je L5
+    ; TAC: _t466 = x == 1396
+    ; TAC: IF _t466 GOTO L5
+    cmp ecx, 1396
+    je L5
+    ; TAC: _t467 = x == 1399
+    ; TAC: IF _t467 GOTO L5
+    cmp ecx, 1399
+    je L5
+    ; TAC: _t468 = x == 1402
+    ; TAC: IF _t468 GOTO L5
+    cmp ecx, 1402
+    je L5
+    ; TAC: _t469 = x == 1405
+    ; TAC: IF _t469 GOTO L5
+    cmp ecx, 1405
+    je L5
+    ; TAC: _t470 = x == 1408
+    ; TAC: IF _t470 GOTO L5
+    cmp ecx, 1408
+    je L5
+    ; TAC: _t471 = x == 1411
+    ; TAC: IF _t471 GOTO L5
+    cmp ecx, 1411
+    je L5
+    ; TAC: _t472 = x == 1414
+    ; TAC: IF _t472 GOTO L5
+    cmp ecx, 1414
+    je L5
+    ; TAC: _t473 = x == 1417
+    ; TAC: IF _t473 GOTO L5
+    cmp ecx, 1417
+    je L5
+    ; TAC: _t474 = x == 1420
+    ; TAC: IF _t474 GOTO L5
+    cmp ecx, 1420
+    je L5
+    ; TAC: _t475 = x == 1423
+    ; TAC: IF _t475 GOTO L5
+    cmp ecx, 1423
+    je L5
+    ; TAC: _t476 = x == 1426
+    ; TAC: IF _t476 GOTO L5
+    cmp ecx, 1426
+    je L5
+    ; TAC: _t477 = x == 1429
+    ; TAC: IF _t477 GOTO L5
+    cmp ecx, 1429
+    je L5
+    ; TAC: _t478 = x == 1432
+    ; TAC: IF _t478 GOTO L5
+    cmp ecx, 1432
+    je L5
+    ; TAC: _t479 = x == 1435
+    ; TAC: IF _t479 GOTO L5
+    cmp ecx, 1435
+    je L5
+    ; TAC: _t480 = x == 1438
+    ; TAC: IF _t480 GOTO L5
+    cmp ecx, 1438
+    je L5
+    ; TAC: _t481 = x == 1441
+    ; TAC: IF _t481 GOTO L5
+    cmp ecx, 1441
+    je L5
+    ; TAC: _t482 = x == 1444
+    ; TAC: IF _t482 GOTO L5
+    cmp ecx, 1444
+    je L5
+    ; TAC: _t483 = x == 1447
+    ; TAC: IF _t483 GOTO L5
+    cmp ecx, 1447
+    je L5
+    ; TAC: _t484 = x == 1450
+    ; TAC: IF _t484 GOTO L5
+    cmp ecx, 1450
+    je L5
+    ; TAC: _t485 = x == 1453
+    ; TAC: IF _t485 GOTO L5
+    cmp ecx, 1453
+    je L5
+    ; TAC: _t486 = x == 1456
+    ; TAC: IF _t486 GOTO L5
+    cmp ecx, 1456
+    je L5
+    ; TAC: _t487 = x == 1459
+    ; TAC: IF _t487 GOTO L5
+    cmp ecx, 1459
+    je L5
+    ; TAC: _t488 = x == 1462
+    ; TAC: IF _t488 GOTO L5
+    cmp ecx, 1462
+    je L5
+    ; TAC: _t489 = x == 1465
+    ; TAC: IF _t489 GOTO L5
+    cmp ecx, 1465
+    je L5
+    ; TAC: _t490 = x == 1468
+    ; TAC: IF _t490 GOTO L5
+    cmp ecx, 1468
+    je L5
+    ; TAC: _t491 = x == 1471
+    ; TAC: IF _t491 GOTO L5
+    cmp ecx, 1471
+    je L5
+    ; TAC: _t492 = x == 1474
+    ; TAC: IF _t492 GOTO L5
+    cmp ecx, 1474
+    je L5
+    ; TAC: _t493 = x == 1477
+    ; TAC: IF _t493 GOTO L5
+    cmp ecx, 1477
+    je L5
+    ; TAC: _t494 = x == 1480
+    ; TAC: IF _t494 GOTO L5
+    cmp ecx, 1480
+    je L5
+    ; TAC: _t495 = x == 1483
+    ; TAC: IF _t495 GOTO L5
+    cmp ecx, 1483
+    je L5
+    ; TAC: _t496 = x == 1486
+    ; TAC: IF _t496 GOTO L5
+    cmp ecx, 1486
+    je L5
+    ; TAC: _t497 = x == 1489
+    ; TAC: IF _t497 GOTO L5
+    cmp ecx, 1489
+    je L5
+    ; TAC: _t498 = x == 1492
+    ; TAC: IF _t498 GOTO L5
+    cmp ecx, 1492
+    je L5
+    ; TAC: _t499 = x == 1495
+    ; TAC: IF _t499 GOTO L5
+    cmp ecx, 1495
+    je L5
+    ; TAC: _t500 = x == 1498
+    ; TAC: IF _t500 GOTO L5
+    cmp ecx, 1498
+    je L5
+    ; TAC: _t501 = x == 1501
+    ; TAC: IF _t501 GOTO L5
+    cmp ecx, 1501
+    je L5
+    ; TAC: _t502 = x == 1504
+    ; TAC: IF _t502 GOTO L5
+    cmp ecx, 1504
+    je L5
+    ; TAC: _t503 = x == 1507
+    ; TAC: IF _t503 GOTO L5
+    cmp ecx, 1507
+    je L5
+    ; TAC: _t504 = x == 1510
+    ; TAC: IF _t504 GOTO L5
+    cmp ecx, 1510
+    je L5
+    ; TAC: _t505 = x == 1513
+    ; TAC: IF _t505 GOTO L5
+    cmp ecx, 1513
+    je L5
+    ; TAC: _t506 = x == 1516
+    ; TAC: IF _t506 GOTO L5
+    cmp ecx, 1516
+    je L5
+    ; TAC: _t507 = x == 1519
+    ; TAC: IF _t507 GOTO L5
+    cmp ecx, 1519
+    je L5
+    ; TAC: _t508 = x == 1522
+    ; TAC: IF _t508 GOTO L5
+    cmp ecx, 1522
+    je L5
+    ; TAC: _t509 = x == 1525
+    ; TAC: IF _t509 GOTO L5
+    cmp ecx, 1525
+    je L5
+    ; TAC: _t510 = x == 1528
+    ; TAC: IF _t510 GOTO L5
+    cmp ecx, 1528
+    je L5
+    ; TAC: _t511 = x == 1531
+    ; TAC: IF _t511 GOTO L5
+    cmp ecx, 1531
+    je L5
+    ; TAC: _t512 = x == 1534
+    ; TAC: IF _t512 GOTO L5
+    cmp ecx, 1534
+    je L5
+    ; TAC: _t513 = x == 1537
+    ; TAC: IF _t513 GOTO L5
+    cmp ecx, 1537
+    je L5
+    ; TAC: _t514 = x == 1540
+    ; TAC: IF _t514 GOTO L5
+    cmp ecx, 1540
+    je L5
+    ; TAC: _t515 = x == 1543
+    ; TAC: IF _t515 GOTO L5
+    cmp ecx, 1543
+    je L5
+    ; TAC: _t516 = x == 1546
+    ; TAC: IF _t516 GOTO L5
+    cmp ecx, 1546
+    je L5
+    ; TAC: _t517 = x == 1549
+    ; TAC: IF _t517 GOTO L5
+    cmp ecx, 1549
+    je L5
+    ; TAC: _t518 = x == 1552
+    ; TAC: IF _t518 GOTO L5
+    cmp ecx, 1552
+    je L5
+    ; TAC: _t519 = x == 1555
+    ; TAC: IF _t519 GOTO L5
+    cmp ecx, 1555
+    je L5
+    ; TAC: _t520 = x == 1558
+    ; TAC: IF _t520 GOTO L5
+    cmp ecx, 1558
+    je L5
+    ; TAC: _t521 = x == 1561
+    ; TAC: IF _t521 GOTO L5
+    cmp ecx, 1561
+    je L5
+    ; TAC: _t522 = x == 1564
+    ; TAC: IF _t522 GOTO L5
+    cmp ecx, 1564
+    je L5
+    ; TAC: _t523 = x == 1567
+    ; TAC: IF _t523 GOTO L5
+    cmp ecx, 1567
+    je L5
+    ; TAC: _t524 = x == 1570
+    ; TAC: IF _t524 GOTO L5
+    cmp ecx, 1570
+    je L5
+    ; TAC: _t525 = x == 1573
+    ; TAC: IF _t525 GOTO L5
+    cmp ecx, 1573
+    je L5
+    ; TAC: _t526 = x == 1576
+    ; TAC: IF _t526 GOTO L5
+    cmp ecx, 1576
+    je L5
+    ; TAC: _t527 = x == 1579
+    ; TAC: IF _t527 GOTO L5
+    cmp ecx, 1579
+    je L5
+    ; TAC: _t528 = x == 1582
+    ; TAC: IF _t528 GOTO L5
+    cmp ecx, 1582
+    je L5
+    ; TAC: _t529 = x == 1585
+    ; TAC: IF _t529 GOTO L5
+    cmp ecx, 1585
+    je L5
+    ; TAC: _t530 = x == 1588
+    ; TAC: IF _t530 GOTO L5
+    cmp ecx, 1588
+    je L5
+    ; TAC: _t531 = x == 1591
+    ; TAC: IF _t531 GOTO L5
+    cmp ecx, 1591
+    je L5
+    ; TAC: _t532 = x == 1594
+    ; TAC: IF _t532 GOTO L5
+    cmp ecx, 1594
+    je L5
+    ; TAC: _t533 = x == 1597
+    ; TAC: IF _t533 GOTO L5
+    cmp ecx, 1597
+    je L5
+    ; TAC: _t534 = x == 1600
+    ; TAC: IF _t534 GOTO L5
+    cmp ecx, 1600
+    je L5
+    ; TAC: _t535 = x == 1603
+    ; TAC: IF _t535 GOTO L5
+    cmp ecx, 1603
+    je L5
+    ; TAC: _t536 = x == 1606
+    ; TAC: IF _t536 GOTO L5
+    cmp ecx, 1606
+    je L5
+    ; TAC: _t537 = x == 1609
+    ; TAC: IF _t537 GOTO L5
+    cmp ecx, 1609
+    je L5
+    ; TAC: _t538 = x == 1612
+    ; TAC: IF _t538 GOTO L5
+    cmp ecx, 1612
+    je L5
+    ; TAC: _t539 = x == 1615
+    ; TAC: IF _t539 GOTO L5
+    cmp ecx, 1615
+    je L5
+    ; TAC: _t540 = x == 1618
+    ; TAC: IF _t540 GOTO L5
+    cmp ecx, 1618
+    je L5
+    ; TAC: _t541 = x == 1621
+    ; TAC: IF _t541 GOTO L5
+    cmp ecx, 1621
+    je L5
+    ; TAC: _t542 = x == 1624
+    ; TAC: IF _t542 GOTO L5
+    cmp ecx, 1624
+    je L5
+    ; TAC: _t543 = x == 1627
+    ; TAC: IF _t543 GOTO L5
+    cmp ecx, 1627
+    je L5
+    ; TAC: _t544 = x == 1630
+    ; TAC: IF _t544 GOTO L5
+    cmp ecx, 1630
+    je L5
+    ; TAC: _t545 = x == 1633
+    ; TAC: IF _t545 GOTO L5
+    cmp ecx, 1633
+    je L5
+    ; TAC: _t546 = x == 1636
+    ; TAC: IF _t546 GOTO L5
+    cmp ecx, 1636
+    je L5
+    ; TAC: _t547 = x == 1639
+    ; TAC: IF _t547 GOTO L5
+    cmp ecx, 1639
+    je L5
+    ; TAC: _t548 = x == 1642
+    ; TAC: IF _t548 GOTO L5
+    cmp ecx, 1642
+    je L5
+    ; TAC: _t549 = x == 1645
+    ; TAC: IF _t549 GOTO L5
+    cmp ecx, 1645
+    je L5
+    ; TAC: _t550 = x == 1648
+    ; TAC: IF _t550 GOTO L5
+    cmp ecx, 1648
+    je L5
+    ; TAC: _t551 = x == 1651
+    ; TAC: IF _t551 GOTO L5
+    cmp ecx, 1651
+    je L5
+    ; TAC: _t552 = x == 1654
+    ; TAC: IF _t552 GOTO L5
+    cmp ecx, 1654
+    je L5
+    ; TAC: _t553 = x == 1657
+    ; TAC: IF _t553 GOTO L5
+    cmp ecx, 1657
+    je L5
+    ; TAC: _t554 = x == 1660
+    ; TAC: IF _t554 GOTO L5
+    cmp ecx, 1660
+    je L5
+    ; TAC: _t555 = x == 1663
+    ; TAC: IF _t555 GOTO L5
+    cmp ecx, 1663
+    je L5
+    ; TAC: _t556 = x == 1666
+    ; TAC: IF _t556 GOTO L5
+    cmp ecx, 1666
+    je L5
+    ; TAC: _t557 = x == 1669
+    ; TAC: IF _t557 GOTO L5
+    cmp ecx, 1669
+    je L5
+    ; TAC: _t558 = x == 1672
+    ; TAC: IF _t558 GOTO L5
+    cmp ecx, 1672
+    je L5
+    ; TAC: _t559 = x == 1675
+    ; TAC: IF _t559 GOTO L5
+    cmp ecx, 1675
+    je L5
+    ; TAC: _t560 = x == 1678
+    ; TAC: IF _t560 GOTO L5
+    cmp ecx, 1678
+    je L5
+    ; TAC: _t561 = x == 1681
+    ; TAC: IF _t561 GOTO L5
+    cmp ecx, 1681
+    je L5
+    ; TAC: _t562 = x == 1684
+    ; TAC: IF _t562 GOTO L5
+    cmp ecx, 1684
+    je L5
+    ; TAC: _t563 = x == 1687
+    ; TAC: IF _t563 GOTO L5
+    cmp ecx, 1687
+    je L5
+    ; TAC: _t564 = x == 1690
+    ; TAC: IF _t564 GOTO L5
+    cmp ecx, 1690
+    je L5
+    ; TAC: _t565 = x == 1693
+    ; TAC: IF _t565 GOTO L5
+    cmp ecx, 1693
+    je L5
+    ; TAC: _t566 = x == 1696
+    ; TAC: IF _t566 GOTO L5
+    cmp ecx, 1696
+    je L5
+    ; TAC: _t567 = x == 1699
+    ; TAC: IF _t567 GOTO L5
+    cmp ecx, 1699
+    je L5
+    ; TAC: _t568 = x == 1702
+    ; TAC: IF _t568 GOTO L5
+    cmp ecx, 1702
+    je L5
+    ; TAC: _t569 = x == 1705
+    ; TAC: IF _t569 GOTO L5
+    cmp ecx, 1705
+    je L5
+    ; TAC: _t570 = x == 1708
+    ; TAC: IF _t570 GOTO L5
+    cmp ecx, 1708
+    je L5
+    ; TAC: _t571 = x == 1711
+    ; TAC: IF _t571 GOTO L5
+    cmp ecx, 1711
+    je L5
+    ; TAC: _t572 = x == 1714
+    ; TAC: IF _t572 GOTO L5
+    cmp ecx, 1714
+    je L5
+    ; TAC: _t573 = x == 1717
+    ; TAC: IF _t573 GOTO L5
+    cmp ecx, 1717
+    je L5
+    ; TAC: _t574 = x == 1720
+    ; TAC: IF _t574 GOTO L5
+    cmp ecx, 1720
+    je L5
+    ; TAC: _t575 = x == 1723
+    ; TAC: IF _t575 GOTO L5
+    cmp ecx, 1723
+    je L5
+    ; TAC: _t576 = x == 1726
+    ; TAC: IF _t576 GOTO L5
+    cmp ecx, 1726
+    je L5
+    ; TAC: _t577 = x == 1729
+    ; TAC: IF _t577 GOTO L5
+    cmp ecx, 1729
+    je L5
+    ; TAC: _t578 = x == 1732
+    ; TAC: IF _t578 GOTO L5
+    cmp ecx, 1732
+    je L5
+    ; TAC: _t579 = x == 1735
+    ; TAC: IF _t579 GOTO L5
+    cmp ecx, 1735
+    je L5
+    ; TAC: _t580 = x == 1738
+    ; TAC: IF _t580 GOTO L5
+    cmp ecx, 1738
+    je L5
+    ; TAC: _t581 = x == 1741
+    ; TAC: IF _t581 GOTO L5
+    cmp ecx, 1741
+    je L5
+    ; TAC: _t582 = x == 1744
+    ; TAC: IF _t582 GOTO L5
+    cmp ecx, 1744
+    je L5
+    ; TAC: _t583 = x == 1747
+    ; TAC: IF _t583 GOTO L5
+    cmp ecx, 1747
+    je L5
+    ; TAC: _t584 = x == 1750
+    ; TAC: IF _t584 GOTO L5
+    cmp ecx, 1750
+    je L5
+    ; TAC: _t585 = x == 1753
+    ; TAC: IF _t585 GOTO L5
+    cmp ecx, 1753
+    je L5
+    ; TAC: _t586 = x == 1756
+    ; TAC: IF _t586 GOTO L5
+    cmp ecx, 1756
+    je L5
+    ; TAC: _t587 = x == 1759
+    ; TAC: IF _t587 GOTO L5
+    cmp ecx, 1759
+    je L5
+    ; TAC: _t588 = x == 1762
+    ; TAC: IF _t588 GOTO L5
+    cmp ecx, 1762
+    je L5
+    ; TAC: _t589 = x == 1765
+    ; TAC: IF _t589 GOTO L5
+    cmp ecx, 1765
+    je L5
+    ; TAC: _t590 = x == 1768
+    ; TAC: IF _t590 GOTO L5
+    cmp ecx, 1768
+    je L5
+    ; TAC: _t591 = x == 1771
+    ; TAC: IF _t591 GOTO L5
+    cmp ecx, 1771
+    je L5
+    ; TAC: _t592 = x == 1774
+    ; TAC: IF _t592 GOTO L5
+    cmp ecx, 1774
+    je L5
+    ; TAC: _t593 = x == 1777
+    ; TAC: IF _t593 GOTO L5
+    cmp ecx, 1777
+    je L5
+    ; TAC: _t594 = x == 1780
+    ; TAC: IF _t594 GOTO L5
+    cmp ecx, 1780
+    je L5
+    ; TAC: _t595 = x == 1783
+    ; TAC: IF _t595 GOTO L5
+    cmp ecx, 1783
+    je L5
+    ; TAC: _t596 = x == 1786
+    ; TAC: IF _t596 GOTO L5
+    cmp ecx, 1786
+    je L5
+    ; TAC: _t597 = x == 1789
+    ; TAC: IF _t597 GOTO L5
+    cmp ecx, 1789
+    je L5
+    ; TAC: _t598 = x == 1792
+    ; TAC: IF _t598 GOTO L5
+    cmp ecx, 1792
+    je L5
+    ; TAC: _t599 = x == 1795
+    ; TAC: IF _t599 GOTO L5
+    cmp ecx, 1795
+    je L5
+    ; TAC: _t600 = x == 1798
+    ; TAC: IF _t600 GOTO L5
+    cmp ecx, 1798
+    je L5
+    ; TAC: _t601 = x == 1801
+    ; TAC: IF _t601 GOTO L5
+    cmp ecx, 1801
+    je L5
+    ; TAC: _t602 = x == 1804
+    ; TAC: IF _t602 GOTO L5
+    cmp ecx, 1804
+    je L5
+    ; TAC: _t603 = x == 1807
+    ; TAC: IF _t603 GOTO L5
+    cmp ecx, 1807
+    je L5
+    ; TAC: _t604 = x == 1810
+    ; TAC: IF _t604 GOTO L5
+    cmp ecx, 1810
+    je L5
+    ; TAC: _t605 = x == 1813
+    ; TAC: IF _t605 GOTO L5
+    cmp ecx, 1813
+    je L5
+    ; TAC: _t606 = x == 1816
+    ; TAC: IF _t606 GOTO L5
+    cmp ecx, 1816
+    je L5
+    ; TAC: _t607 = x == 1819
+    ; TAC: IF _t607 GOTO L5
+    cmp ecx, 1819
+    je L5
+    ; TAC: _t608 = x == 1822
+    ; TAC: IF _t608 GOTO L5
+    cmp ecx, 1822
+    je L5
+    ; TAC: _t609 = x == 1825
+    ; TAC: IF _t609 GOTO L5
+    cmp ecx, 1825
+    je L5
+    ; TAC: _t610 = x == 1828
+    ; TAC: IF _t610 GOTO L5
+    cmp ecx, 1828
+    je L5
+    ; TAC: _t611 = x == 1831
+    ; TAC: IF _t611 GOTO L5
+    cmp ecx, 1831
+    je L5
+    ; TAC: _t612 = x == 1834
+    ; TAC: IF _t612 GOTO L5
+    cmp ecx, 1834
+    je L5
+    ; TAC: _t613 = x == 1837
+    ; TAC: IF _t613 GOTO L5
+    cmp ecx, 1837
+    je L5
+    ; TAC: _t614 = x == 1840
+    ; TAC: IF _t614 GOTO L5
+    cmp ecx, 1840
+    je L5
+    ; TAC: _t615 = x == 1843
+    ; TAC: IF _t615 GOTO L5
+    cmp ecx, 1843
+    je L5
+    ; TAC: _t616 = x == 1846
+    ; TAC: IF _t616 GOTO L5
+    cmp ecx, 1846
+    je L5
+    ; TAC: _t617 = x == 1849
+    ; TAC: IF _t617 GOTO L5
+    cmp ecx, 1849
+    je L5
+    ; TAC: _t618 = x == 1852
+    ; TAC: IF _t618 GOTO L5
+    cmp ecx, 1852
+    je L5
+    ; TAC: _t619 = x == 1855
+    ; TAC: IF _t619 GOTO L5
+    cmp ecx, 1855
+    je L5
+    ; TAC: _t620 = x == 1858
+    ; TAC: IF _t620 GOTO L5
+    cmp ecx, 1858
+    je L5
+    ; TAC: _t621 = x == 1861
+    ; TAC: IF _t621 GOTO L5
+    cmp ecx, 1861
+    je L5
+    ; TAC: _t622 = x == 1864
+    ; TAC: IF _t622 GOTO L5
+    cmp ecx, 1864
+    je L5
+    ; TAC: _t623 = x == 1867
+    ; TAC: IF _t623 GOTO L5
+    cmp ecx, 1867
+    je L5
+    ; TAC: _t624 = x == 1870
+    ; TAC: IF _t624 GOTO L5
+    cmp ecx, 1870
+    je L5
+    ; TAC: _t625 = x == 1873
+    ; TAC: IF _t625 GOTO L5
+    cmp ecx, 1873
+    je L5
+    ; TAC: _t626 = x == 1876
+    ; TAC: IF _t626 GOTO L5
+    cmp ecx, 1876
+    je L5
+    ; TAC: _t627 = x == 1879
+    ; TAC: IF _t627 GOTO L5
+    cmp ecx, 1879
+    je L5
+    ; TAC: _t628 = x == 1882
+    ; TAC: IF _t628 GOTO L5
+    cmp ecx, 1882
+    je L5
+    ; TAC: _t629 = x == 1885
+    ; TAC: IF _t629 GOTO L5
+    cmp ecx, 1885
+    je L5
+    ; TAC: _t630 = x == 1888
+    ; TAC: IF _t630 GOTO L5
+    cmp ecx, 1888
+    je L5
+    ; TAC: _t631 = x == 1891
+    ; TAC: IF _t631 GOTO L5
+    cmp ecx, 1891
+    je L5
+    ; TAC: _t632 = x == 1894
+    ; TAC: IF _t632 GOTO L5
+    cmp ecx, 1894
+    je L5
+    ; TAC: _t633 = x == 1897
+    ; TAC: IF _t633 GOTO L5
+    cmp ecx, 1897
+    je L5
+    ; TAC: _t634 = x == 1900
+    ; TAC: IF _t634 GOTO L5
+    cmp ecx, 1900
+    je L5
+    ; TAC: _t635 = x == 1903
+    ; TAC: IF _t635 GOTO L5
+    cmp ecx, 1903
+    je L5
+    ; TAC: _t636 = x == 1906
+    ; TAC: IF _t636 GOTO L5
+    cmp ecx, 1906
+    je L5
+    ; TAC: _t637 = x == 1909
+    ; TAC: IF _t637 GOTO L5
+    cmp ecx, 1909
+    je L5
+    ; TAC: _t638 = x == 1912
+    ; TAC: IF _t638 GOTO L5
+    cmp ecx, 1912
+    je L5
+    ; TAC: _t639 = x == 1915
+    ; TAC: IF _t639 GOTO L5
+    cmp ecx, 1915
+    je L5
+    ; TAC: _t640 = x == 1918
+    ; TAC: IF _t640 GOTO L5
+    cmp ecx, 1918
+    je L5
+    ; TAC: _t641 = x == 1921
+    ; TAC: IF _t641 GOTO L5
+    cmp ecx, 1921
+    je L5
+    ; TAC: _t642 = x == 1924
+    ; TAC: IF _t642 GOTO L5
+    cmp ecx, 1924
+    je L5
+    ; TAC: _t643 = x == 1927
+    ; TAC: IF _t643 GOTO L5
+    cmp ecx, 1927
+    je L5
+    ; TAC: _t644 = x == 1930
+    ; TAC: IF _t644 GOTO L5
+    cmp ecx, 1930
+    je L5
+    ; TAC: _t645 = x == 1933
+    ; TAC: IF _t645 GOTO L5
+    cmp ecx, 1933
+    je L5
+    ; TAC: _t646 = x == 1936
+    ; TAC: IF _t646 GOTO L5
+    cmp ecx, 1936
+    je L5
+    ; TAC: _t647 = x == 1939
+    ; TAC: IF _t647 GOTO L5
+    cmp ecx, 1939
+    je L5
+    ; TAC: _t648 = x == 1942
+    ; TAC: IF _t648 GOTO L5
+    cmp ecx, 1942
+    je L5
+    ; TAC: _t649 = x == 1945
+    ; TAC: IF _t649 GOTO L5
+    cmp ecx, 1945
+    je L5
+    ; TAC: _t650 = x == 1948
+    ; TAC: IF _t650 GOTO L5
+    cmp ecx, 1948
+    je L5
+    ; TAC: _t651 = x == 1951
+    ; TAC: IF _t651 GOTO L5
+    cmp ecx, 1951
+    je L5
+    ; TAC: _t652 = x == 1954
+    ; TAC: IF _t652 GOTO L5
+    cmp ecx, 1954
+    je L5
+    ; TAC: _t653 = x == 1957
+    ; TAC: IF _t653 GOTO L5
+    cmp ecx, 1957
+    je L5
+    ; TAC: _t654 = x == 1960
+    ; TAC: IF _t654 GOTO L5
+    cmp ecx, 1960
+    je L5
+    ; TAC: _t655 = x == 1963
+    ; TAC: IF _t655 GOTO L5
+    cmp ecx, 1963
+    je L5
+    ; TAC: _t656 = x == 1966
+    ; TAC: IF _t656 GOTO L5
+    cmp ecx, 1966
+    je L5
+    ; TAC: _t657 = x == 1969
+    ; TAC: IF _t657 GOTO L5
+    cmp ecx, 1969
+    je L5
+    ; TAC: _t658 = x == 1972
+    ; TAC: IF _t658 GOTO L5
+    cmp ecx, 1972
+    je L5
+    ; TAC: _t659 = x == 1975
+    ; TAC: IF _t659 GOTO L5
+    cmp ecx, 1975
+    je L5
+    ; TAC: _t660 = x == 1978
+    ; TAC: IF _t660 GOTO L5
+    cmp ecx, 1978
+    je L5
+    ; TAC: _t661 = x == 1981
+    ; TAC: IF _t661 GOTO L5
+    cmp ecx, 1981
+    je L5
+    ; TAC: _t662 = x == 1984
+    ; TAC: IF _t662 GOTO L5
+    cmp ecx, 1984
+    je L5
+    ; TAC: _t663 = x == 1987
+    ; TAC: IF _t663 GOTO L5
+    cmp ecx, 1987
+    je L5
+    ; TAC: _t664 = x == 1990
+    ; TAC: IF _t664 GOTO L5
+    cmp ecx, 1990
+    je L5
+    ; TAC: _t665 = x == 1993
+    ; TAC: IF _t665 GOTO L5
+    cmp ecx, 1993
+    je L5
+    ; TAC: _t666 = x == 1996
+    ; TAC: IF _t666 GOTO L5
+    cmp ecx, 1996
+    je L5
+    ; TAC: _t667 = x == 1999
+    ; TAC: IF _t667 GOTO L5
+    cmp ecx, 1999
+    je L5
+    ; TAC: _t668 = x == 2002
+    ; TAC: IF _t668 GOTO L5
+    cmp ecx, 2002
+    je L5
+    ; TAC: _t669 = x == 2005
+    ; TAC: IF _t669 GOTO L5
+    cmp ecx, 2005
+    je L5
+    ; TAC: _t670 = x == 2008
+    ; TAC: IF _t670 GOTO L5
+    cmp ecx, 2008
+    je L5
+    ; TAC: _t671 = x == 2011
+    ; TAC: IF _t671 GOTO L5
+    cmp ecx, 2011
+    je L5
+    ; TAC: _t672 = x == 2014
+    ; TAC: IF _t672 GOTO L5
+    cmp ecx, 2014
+    je L5
+    ; TAC: _t673 = x == 2017
+    ; TAC: IF _t673 GOTO L5
+    cmp ecx, 2017
+    je L5
+    ; TAC: _t674 = x == 2020
+    ; TAC: IF _t674 GOTO L5
+    cmp ecx, 2020
+    je L5
+    ; TAC: _t675 = x == 2023
+    ; TAC: IF _t675 GOTO L5
+    cmp ecx, 2023
+    je L5
+    ; TAC: _t676 = x == 2026
+    ; TAC: IF _t676 GOTO L5
+    cmp ecx, 2026
+    je L5
+    ; TAC: _t677 = x == 2029
+    ; TAC: IF _t677 GOTO L5
+    cmp ecx, 2029
+    je L5
+    ; TAC: _t678 = x == 2032
+    ; TAC: IF _t678 GOTO L5
+    cmp ecx, 2032
+    je L5
+    ; TAC: _t679 = x == 2035
+    ; TAC: IF _t679 GOTO L5
+    cmp ecx, 2035
+    je L5
+    ; TAC: _t680 = x == 2038
+    ; TAC: IF _t680 GOTO L5
+    cmp ecx, 2038
+    je L5
+    ; TAC: _t681 = x == 2041
+    ; TAC: IF _t681 GOTO L5
+    cmp ecx, 2041
+    je L5
+    ; TAC: _t682 = x == 2044
+    ; TAC: IF _t682 GOTO L5
+    cmp ecx, 2044
+    je L5
+    ; TAC: _t683 = x == 2047
+    ; TAC: IF _t683 GOTO L5
+    cmp ecx, 2047
+    je L5
+    ; TAC: _t684 = x == 2050
+    ; TAC: IF _t684 GOTO L5
+    cmp ecx, 2050
+    je L5
+    ; TAC: _t685 = x == 2053
+    ; TAC: IF _t685 GOTO L5
+    cmp ecx, 2053
+    je L5
+    ; TAC: _t686 = x == 2056
+    ; TAC: IF _t686 GOTO L5
+    cmp ecx, 2056
+    je L5
+    ; TAC: _t687 = x == 2059
+    ; TAC: IF _t687 GOTO L5
+    cmp ecx, 2059
+    je L5
+    ; TAC: _t688 = x == 2062
+    ; TAC: IF _t688 GOTO L5
+    cmp ecx, 2062
+    je L5
+    ; TAC: _t689 = x == 2065
+    ; TAC: IF _t689 GOTO L5
+    cmp ecx, 2065
+    je L5
+    ; TAC: _t690 = x == 2068
+    ; TAC: IF _t690 GOTO L5
+    cmp ecx, 2068
+    je L5
+    ; TAC: _t691 = x == 2071
+    ; TAC: IF _t691 GOTO L5
+    cmp ecx, 2071
+    je L5
+    ; TAC: _t692 = x == 2074
+    ; TAC: IF _t692 GOTO L5
+    cmp ecx, 2074
+    je L5
+    ; TAC: _t693 = x == 2077
+    ; TAC: IF _t693 GOTO L5
+    cmp ecx, 2077
+    je L5
+    ; TAC: _t694 = x == 2080
+    ; TAC: IF _t694 GOTO L5
+    cmp ecx, 2080
+    je L5
+    ; TAC: _t695 = x == 2083
+    ; TAC: IF _t695 GOTO L5
+    cmp ecx, 2083
+    je L5
+    ; TAC: _t696 = x == 2086
+    ; TAC: IF _t696 GOTO L5
+    cmp ecx, 2086
+    je L5
+    ; TAC: _t697 = x == 2089
+    ; TAC: IF _t697 GOTO L5
+    cmp ecx, 2089
+    je L5
+    ; TAC: _t698 = x == 2092
+    ; TAC: IF _t698 GOTO L5
+    cmp ecx, 2092
+    je L5
+    ; TAC: _t699 = x == 2095
+    ; TAC: IF _t699 GOTO L5
+    cmp ecx, 2095
+    je L5
+    ; TAC: _t700 = x == 2098
+    ; TAC: IF _t700 GOTO L5
+    cmp ecx, 2098
+    je L5
+    ; TAC: _t701 = x == 2101
+    ; TAC: IF _t701 GOTO L5
+    cmp ecx, 2101
+    je L5
+    ; TAC: _t702 = x == 2104
+    ; TAC: IF _t702 GOTO L5
+    cmp ecx, 2104
+    je L5
+    ; TAC: _t703 = x == 2107
+    ; TAC: IF _t703 GOTO L5
+    cmp ecx, 2107
+    je L5
+    ; TAC: _t704 = x == 2110
+    ; TAC: IF _t704 GOTO L5
+    cmp ecx, 2110
+    je L5
+    ; TAC: _t705 = x == 2113
+    ; TAC: IF _t705 GOTO L5
+    cmp ecx, 2113
+    je L5
+    ; TAC: _t706 = x == 2116
+    ; TAC: IF _t706 GOTO L5
+    cmp ecx, 2116
+    je L5
+    ; TAC: _t707 = x == 2119
+    ; TAC: IF _t707 GOTO L5
+    cmp ecx, 2119
+    je L5
+    ; TAC: _t708 = x == 2122
+    ; TAC: IF _t708 GOTO L5
+    cmp ecx, 2122
+    je L5
+    ; TAC: _t709 = x == 2125
+    ; TAC: IF _t709 GOTO L5
+    cmp ecx, 2125
+    je L5
+    ; TAC: _t710 = x == 2128
+    ; TAC: IF _t710 GOTO L5
+    cmp ecx, 2128
+    je L5
+    ; TAC: _t711 = x == 2131
+    ; TAC: IF _t711 GOTO L5
+    cmp ecx, 2131
+    je L5
+    ; TAC: _t712 = x == 2134
+    ; TAC: IF _t712 GOTO L5
+    cmp ecx, 2134
+    je L5
+    ; TAC: _t713 = x == 2137
+    ; TAC: IF _t713 GOTO L5
+    cmp ecx, 2137
+    je L5
+    ; TAC: _t714 = x == 2140
+    ; TAC: IF _t714 GOTO L5
+    cmp ecx, 2140
+    je L5
+    ; TAC: _t715 = x == 2143
+    ; TAC: IF _t715 GOTO L5
+    cmp ecx, 2143
+    je L5
+    ; TAC: _t716 = x == 2146
+    ; TAC: IF _t716 GOTO L5
+    cmp ecx, 2146
+    je L5
+    ; TAC: _t717 = x == 2149
+    ; TAC: IF _t717 GOTO L5
+    cmp ecx, 2149
+    je L5
+    ; TAC: _t718 = x == 2152
+    ; TAC: IF _t718 GOTO L5
+    cmp ecx, 2152
+    je L5
+    ; TAC: _t719 = x == 2155
+    ; TAC: IF _t719 GOTO L5
+    cmp ecx, 2155
+    je L5
+    ; TAC: _t720 = x == 2158
+    ; TAC: IF _t720 GOTO L5
+    cmp ecx, 2158
+    je L5
+    ; TAC: _t721 = x == 2161
+    ; TAC: IF _t721 GOTO L5
+    cmp ecx, 2161
+    je L5
+    ; TAC: _t722 = x == 2164
+    ; TAC: IF _t722 GOTO L5
+    cmp ecx, 2164
+    je L5
+    ; TAC: _t723 = x == 2167
+    ; TAC: IF _t723 GOTO L5
+    cmp ecx, 2167
+    je L5
+    ; TAC: _t724 = x == 2170
+    ; TAC: IF _t724 GOTO L5
+    cmp ecx, 2170
+    je L5
+    ; TAC: _t725 = x == 2173
+    ; TAC: IF _t725 GOTO L5
+    cmp ecx, 2173
+    je L5
+    ; TAC: _t726 = x == 2176
+    ; TAC: IF _t726 GOTO L5
+    cmp ecx, 2176
+    je L5
+    ; TAC: _t727 = x == 2179
+    ; TAC: IF _t727 GOTO L5
+    cmp ecx, 2179
+    je L5
+    ; TAC: _t728 = x == 2182
+    ; TAC: IF _t728 GOTO L5
+    cmp ecx, 2182
+    je L5
+    ; TAC: _t729 = x == 2185
+    ; TAC: IF _t729 GOTO L5
+    cmp ecx, 2185
+    je L5
+    ; TAC: _t730 = x == 2188
+    ; TAC: IF _t730 GOTO L5
+    cmp ecx, 2188
+    je L5
+    ; TAC: _t731 = x == 2191
+    ; TAC: IF _t731 GOTO L5
+    cmp ecx, 2191
+    je L5
+    ; TAC: _t732 = x == 2194
+    ; TAC: IF _t732 GOTO L5
+    cmp ecx, 2194
+    je L5
+    ; TAC: _t733 = x == 2197
+    ; TAC: IF _t733 GOTO L5
+    cmp ecx, 2197
+    je L5
+    ; TAC: _t734 = x == 2200
+    ; TAC: IF _t734 GOTO L5
+    cmp ecx, 2200
+    je L5
+    ; TAC: _t735 = x == 2203
+    ; TAC: IF _t735 GOTO L5
+    cmp ecx, 2203
+    je L5
+    ; TAC: _t736 = x == 2206
+    ; TAC: IF _t736 GOTO L5
+    cmp ecx, 2206
+    je L5
+    ; TAC: _t737 = x == 2209
+    ; TAC: IF _t737 GOTO L5
+    cmp ecx, 2209
+    je L5
+    ; TAC: _t738 = x == 2212
+    ; TAC: IF _t738 GOTO L5
+    cmp ecx, 2212
+    je L5
+    ; TAC: _t739 = x == 2215
+    ; TAC: IF _t739 GOTO L5
+    cmp ecx, 2215
+    je L5
+    ; TAC: _t740 = x == 2218
+    ; TAC: IF _t740 GOTO L5
+    cmp ecx, 2218
+    je L5
+    ; TAC: _t741 = x == 2221
+    ; TAC: IF _t741 GOTO L5
+    cmp ecx, 2221
+    je L5
+    ; TAC: _t742 = x == 2224
+    ; TAC: IF _t742 GOTO L5
+    cmp ecx, 2224
+    je L5
+    ; TAC: _t743 = x == 2227
+    ; TAC: IF _t743 GOTO L5
+    cmp ecx, 2227
+    je L5
+    ; TAC: _t744 = x == 2230
+    ; TAC: IF _t744 GOTO L5
+    cmp ecx, 2230
+    je L5
+    ; TAC: _t745 = x == 2233
+    ; TAC: IF _t745 GOTO L5
+    cmp ecx, 2233
+    je L5
+    ; TAC: _t746 = x == 2236
+    ; TAC: IF _t746 GOTO L5
+    cmp ecx, 2236
+    je L5
+    ; TAC: _t747 = x == 2239
+    ; TAC: IF _t747 GOTO L5
+    cmp ecx, 2239
+    je L5
+    ; TAC: _t748 = x == 2242
+    ; TAC: IF _t748 GOTO L5
+    cmp ecx, 2242
+    je L5
+    ; TAC: _t749 = x == 2245
+    ; TAC: IF _t749 GOTO L5
+    cmp ecx, 2245
+    je L5
+    ; TAC: _t750 = x == 2248
+    ; TAC: IF _t750 GOTO L5
+    cmp ecx, 2248
+    je L5
+    ; TAC: _t751 = x == 2251
+    ; TAC: IF _t751 GOTO L5
+    cmp ecx, 2251
+    je L5
+    ; TAC: _t752 = x == 2254
+    ; TAC: IF _t752 GOTO L5
+    cmp ecx, 2254
+    je L5
+    ; TAC: _t753 = x == 2257
+    ; TAC: IF _t753 GOTO L5
+    cmp ecx, 2257
+    je L5
+    ; TAC: _t754 = x == 2260
+    ; TAC: IF _t754 GOTO L5
+    cmp ecx, 2260
+    je L5
+    ; TAC: _t755 = x == 2263
+    ; TAC: IF _t755 GOTO L5
+    cmp ecx, 2263
+    je L5
+    ; TAC: _t756 = x == 2266
+    ; TAC: IF _t756 GOTO L5
+    cmp ecx, 2266
+    je L5
+    ; TAC: _t757 = x == 2269
+    ; TAC: IF _t757 GOTO L5
+    cmp ecx, 2269
+    je L5
+    ; TAC: _t758 = x == 2272
+    ; TAC: IF _t758 GOTO L5
+    cmp ecx, 2272
+    je L5
+    ; TAC: _t759 = x == 2275
+    ; TAC: IF _t759 GOTO L5
+    cmp ecx, 2275
+    je L5
+    ; TAC: _t760 = x == 2278
+    ; TAC: IF _t760 GOTO L5
+    cmp ecx, 2278
+    je L5
+    ; TAC: _t761 = x == 2281
+    ; TAC: IF _t761 GOTO L5
+    cmp ecx, 2281
+    je L5
+    ; TAC: _t762 = x == 2284
+    ; TAC: IF _t762 GOTO L5
+    cmp ecx, 2284
+    je L5
+    ; TAC: _t763 = x == 2287
+    ; TAC: IF _t763 GOTO L5
+    cmp ecx, 2287
+    je L5
+    ; TAC: _t764 = x == 2290
+    ; TAC: IF _t764 GOTO L5
+    cmp ecx, 2290
+    je L5
+    ; TAC: _t765 = x == 2293
+    ; TAC: IF _t765 GOTO L5
+    cmp ecx, 2293
+    je L5
+    ; TAC: _t766 = x == 2296
+    ; TAC: IF _t766 GOTO L5
+    cmp ecx, 2296
+    je L5
+    ; TAC: _t767 = x == 2299
+    ; TAC: IF _t767 GOTO L5
+    cmp ecx, 2299
+    je L5
+    ; TAC: _t768 = x == 2302
+    ; TAC: IF _t768 GOTO L5
+    cmp ecx, 2302
+    je L5
+    ; TAC: _t769 = x == 2305
+    ; TAC: IF _t769 GOTO L5
+    cmp ecx, 2305
+    je L5
+    ; TAC: _t770 = x == 2308
+    ; TAC: IF _t770 GOTO L5
+    cmp ecx, 2308
+    je L5
+    ; TAC: _t771 = x == 2311
+    ; TAC: IF _t771 GOTO L5
+    cmp ecx, 2311
+    je L5
+    ; TAC: _t772 = x == 2314
+    ; TAC: IF _t772 GOTO L5
+    cmp ecx, 2314
+    je L5
+    ; TAC: _t773 = x == 2317
+    ; TAC: IF _t773 GOTO L5
+    cmp ecx, 2317
+    je L5
+    ; TAC: _t774 = x == 2320
+    ; TAC: IF _t774 GOTO L5
+    cmp ecx, 2320
+    je L5
+    ; TAC: _t775 = x == 2323
+    ; TAC: IF _t775 GOTO L5
+    cmp ecx, 2323
+    je L5
+    ; TAC: _t776 = x == 2326
+    ; TAC: IF _t776 GOTO L5
+    cmp ecx, 2326
+    je L5
+    ; TAC: _t777 = x == 2329
+    ; TAC: IF _t777 GOTO L5
+    cmp ecx, 2329
+    je L5
+    ; TAC: _t778 = x == 2332
+    ; TAC: IF _t778 GOTO L5
+    cmp ecx, 2332
+    je L5
+    ; TAC: _t779 = x == 2335
+    ; TAC: IF _t779 GOTO L5
+    cmp ecx, 2335
+    je L5
+    ; TAC: _t780 = x == 2338
+    ; TAC: IF _t780 GOTO L5
+    cmp ecx, 2338
+    je L5
+    ; TAC: _t781 = x == 2341
+    ; TAC: IF _t781 GOTO L5
+    cmp ecx, 2341
+    je L5
+    ; TAC: _t782 = x == 2344
+    ; TAC: IF _t782 GOTO L5
+    cmp ecx, 2344
+    je L5
+    ; TAC: _t783 = x == 2347
+    ; TAC: IF _t783 GOTO L5
+    cmp ecx, 2347
+    je L5
+    ; TAC: _t784 = x == 2350
+    ; TAC: IF _t784 GOTO L5
+    cmp ecx, 2350
+    je L5
+    ; TAC: _t785 = x == 2353
+    ; TAC: IF _t785 GOTO L5
+    cmp ecx, 2353
+    je L5
+    ; TAC: _t786 = x == 2356
+    ; TAC: IF _t786 GOTO L5
+    cmp ecx, 2356
+    je L5
+    ; TAC: _t787 = x == 2359
+    ; TAC: IF _t787 GOTO L5
+    cmp ecx, 2359
+    je L5
+    ; TAC: _t788 = x == 2362
+    ; TAC: IF _t788 GOTO L5
+    cmp ecx, 2362
+    je L5
+    ; TAC: _t789 = x == 2365
+    ; TAC: IF _t789 GOTO L5
+    cmp ecx, 2365
+    je L5
+    ; TAC: _t790 = x == 2368
+    ; TAC: IF _t790 GOTO L5
+    cmp ecx, 2368
+    je L5
+    ; TAC: _t791 = x == 2371
+    ; TAC: IF _t791 GOTO L5
+    cmp ecx, 2371
+    je L5
+    ; TAC: _t792 = x == 2374
+    ; TAC: IF _t792 GOTO L5
+    cmp ecx, 2374
+    je L5
+    ; TAC: _t793 = x == 2377
+    ; TAC: IF _t793 GOTO L5
+    cmp ecx, 2377
+    je L5
+    ; TAC: _t794 = x == 2380
+    ; TAC: IF _t794 GOTO L5
+    cmp ecx, 2380
+    je L5
+    ; TAC: _t795 = x == 2383
+    ; TAC: IF _t795 GOTO L5
+    cmp ecx, 2383
+    je L5
+    ; TAC: _t796 = x == 2386
+    ; TAC: IF _t796 GOTO L5
+    cmp ecx, 2386
+    je L5
+    ; TAC: _t797 = x == 2389
+    ; TAC: IF _t797 GOTO L5
+    cmp ecx, 2389
+    je L5
+    ; TAC: _t798 = x == 2392
+    ; TAC: IF _t798 GOTO L5
+    cmp ecx, 2392
+    je L5
+    ; TAC: _t799 = x == 2395
+    ; TAC: IF _t799 GOTO L5
+    cmp ecx, 2395
+    je L5
+    ; TAC: _t800 = x == 2398
+    ; TAC: IF _t800 GOTO L5
+    cmp ecx, 2398
+    je L5
+    ; TAC: _t801 = x == 2401
+    ; TAC: IF _t801 GOTO L5
+    cmp ecx, 2401
+    je L5
+    ; TAC: _t802 = x == 2404
+    ; TAC: IF _t802 GOTO L5
+    cmp ecx, 2404
+    je L5
+    ; TAC: _t803 = x == 2407
+    ; TAC: IF _t803 GOTO L5
+    cmp ecx, 2407
+    je L5
+    ; TAC: _t804 = x == 2410
+    ; TAC: IF _t804 GOTO L5
+    cmp ecx, 2410
+    je L5
+    ; TAC: _t805 = x == 2413
+    ; TAC: IF _t805 GOTO L5
+    cmp ecx, 2413
+    je L5
+    ; TAC: _t806 = x == 2416
+    ; TAC: IF _t806 GOTO L5
+    cmp ecx, 2416
+    je L5
+    ; TAC: _t807 = x == 2419
+    ; TAC: IF _t807 GOTO L5
+    cmp ecx, 2419
+    je L5
+    ; TAC: _t808 = x == 2422
+    ; TAC: IF _t808 GOTO L5
+    cmp ecx, 2422
+    je L5
+    ; TAC: _t809 = x == 2425
+    ; TAC: IF _t809 GOTO L5
+    cmp ecx, 2425
+    je L5
+    ; TAC: _t810 = x == 2428
+    ; TAC: IF _t810 GOTO L5
+    cmp ecx, 2428
+    je L5
+    ; TAC: _t811 = x == 2431
+    ; TAC: IF _t811 GOTO L5
+    cmp ecx, 2431
+    je L5
+    ; TAC: _t812 = x == 2434
+    ; TAC: IF _t812 GOTO L5
+    cmp ecx, 2434
+    je L5
+    ; TAC: _t813 = x == 2437
+    ; TAC: IF _t813 GOTO L5
+    cmp ecx, 2437
+    je L5
+    ; TAC: _t814 = x == 2440
+    ; TAC: IF _t814 GOTO L5
+    cmp ecx, 2440
+    je L5
+    ; TAC: _t815 = x == 2443
+    ; TAC: IF _t815 GOTO L5
+    cmp ecx, 2443
+    je L5
+    ; TAC: _t816 = x == 2446
+    ; TAC: IF _t816 GOTO L5
+    cmp ecx, 2446
+    je L5
+    ; TAC: _t817 = x == 2449
+    ; TAC: IF _t817 GOTO L5
+    cmp ecx, 2449
+    je L5
+    ; TAC: _t818 = x == 2452
+    ; TAC: IF _t818 GOTO L5
+    cmp ecx, 2452
+    je L5
+    ; TAC: _t819 = x == 2455
+    ; TAC: IF _t819 GOTO L5
+    cmp ecx, 2455
+    je L5
+    ; TAC: _t820 = x == 2458
+    ; TAC: IF _t820 GOTO L5
+    cmp ecx, 2458
+    je L5
+    ; TAC: _t821 = x == 2461
+    ; TAC: IF _t821 GOTO L5
+    cmp ecx, 2461
+    je L5
+    ; TAC: _t822 = x == 2464
+    ; TAC: IF _t822 GOTO L5
+    cmp ecx, 2464
+    je L5
+    ; TAC: _t823 = x == 2467
+    ; TAC: IF _t823 GOTO L5
+    cmp ecx, 2467
+    je L5
+    ; TAC: _t824 = x == 2470
+    ; TAC: IF _t824 GOTO L5
+    cmp ecx, 2470
+    je L5
+    ; TAC: _t825 = x == 2473
+    ; TAC: IF _t825 GOTO L5
+    cmp ecx, 2473
+    je L5
+    ; TAC: _t826 = x == 2476
+    ; TAC: IF _t826 GOTO L5
+    cmp ecx, 2476
+    je L5
+    ; TAC: _t827 = x == 2479
+    ; TAC: IF _t827 GOTO L5
+    cmp ecx, 2479
+    je L5
+    ; TAC: _t828 = x == 2482
+    ; TAC: IF _t828 GOTO L5
+    cmp ecx, 2482
+    je L5
+    ; TAC: _t829 = x == 2485
+    ; TAC: IF _t829 GOTO L5
+    cmp ecx, 2485
+    je L5
+    ; TAC: _t830 = x == 2488
+    ; TAC: IF _t830 GOTO L5
+    cmp ecx, 2488
+    je L5
+    ; TAC: _t831 = x == 2491
+    ; TAC: IF _t831 GOTO L5
+    cmp ecx, 2491
+    je L5
+    ; TAC: _t832 = x == 2494
+    ; TAC: IF _t832 GOTO L5
+    cmp ecx, 2494
+    je L5
+    ; TAC: _t833 = x == 2497
+    ; TAC: IF _t833 GOTO L5
+    cmp ecx, 2497
+    je L5
+    ; TAC: _t834 = x == 2500
+    ; TAC: IF _t834 GOTO L5
+    cmp ecx, 2500
+    je L5
+    ; TAC: _t835 = x == 2503
+    ; TAC: IF _t835 GOTO L5
+    cmp ecx, 2503
+    je L5
+    ; TAC: _t836 = x == 2506
+    ; TAC: IF _t836 GOTO L5
+    cmp ecx, 2506
+    je L5
+    ; TAC: _t837 = x == 2509
+    ; TAC: IF _t837 GOTO L5
+    cmp ecx, 2509
+    je L5
+    ; TAC: _t838 = x == 2512
+    ; TAC: IF _t838 GOTO L5
+    cmp ecx, 2512
+    je L5
+    ; TAC: _t839 = x == 2515
+    ; TAC: IF _t839 GOTO L5
+    cmp ecx, 2515
+    je L5
+    ; TAC: _t840 = x == 2518
+    ; TAC: IF _t840 GOTO L5
+    cmp ecx, 2518
+    je L5
+    ; TAC: _t841 = x == 2521
+    ; TAC: IF _t841 GOTO L5
+    cmp ecx, 2521
+    je L5
+    ; TAC: _t842 = x == 2524
+    ; TAC: IF _t842 GOTO L5
+    cmp ecx, 2524
+    je L5
+    ; TAC: _t843 = x == 2527
+    ; TAC: IF _t843 GOTO L5
+    cmp ecx, 2527
+    je L5
+    ; TAC: _t844 = x == 2530
+    ; TAC: IF _t844 GOTO L5
+    cmp ecx, 2530
+    je L5
+    ; TAC: _t845 = x == 2533
+    ; TAC: IF _t845 GOTO L5
+    cmp ecx, 2533
+    je L5
+    ; TAC: _t846 = x == 2536
+    ; TAC: IF _t846 GOTO L5
+    cmp ecx, 2536
+    je L5
+    ; TAC: _t847 = x == 2539
+    ; TAC: IF _t847 GOTO L5
+    cmp ecx, 2539
+    je L5
+    ; TAC: _t848 = x == 2542
+    ; TAC: IF _t848 GOTO L5
+    cmp ecx, 2542
+    je L5
+    ; TAC: _t849 = x == 2545
+    ; TAC: IF _t849 GOTO L5
+    cmp ecx, 2545
+    je L5
+    ; TAC: _t850 = x == 2548
+    ; TAC: IF _t850 GOTO L5
+    cmp ecx, 2548
+    je L5
+    ; TAC: _t851 = x == 2551
+    ; TAC: IF _t851 GOTO L5
+    cmp ecx, 2551
+    je L5
+    ; TAC: _t852 = x == 2554
+    ; TAC: IF _t852 GOTO L5
+    cmp ecx, 2554
+    je L5
+    ; TAC: _t853 = x == 2557
+    ; TAC: IF _t853 GOTO L5
+    cmp ecx, 2557
+    je L5
+    ; TAC: _t854 = x == 2560
+    ; TAC: IF _t854 GOTO L5
+    cmp ecx, 2560
+    je L5
+    ; TAC: _t855 = x == 2563
+    ; TAC: IF _t855 GOTO L5
+    cmp ecx, 2563
+    je L5
+    ; TAC: _t856 = x == 2566
+    ; TAC: IF _t856 GOTO L5
+    cmp ecx, 2566
+    je L5
+    ; TAC: _t857 = x == 2569
+    ; TAC: IF _t857 GOTO L5
+    cmp ecx, 2569
+    je L5
+    ; TAC: _t858 = x == 2572
+    ; TAC: IF _t858 GOTO L5
+    cmp ecx, 2572
+    je L5
+    ; TAC: _t859 = x == 2575
+    ; TAC: IF _t859 GOTO L5
+    cmp ecx, 2575
+    je L5
+    ; TAC: _t860 = x == 2578
+    ; TAC: IF _t860 GOTO L5
+    cmp ecx, 2578
+    je L5
+    ; TAC: _t861 = x == 2581
+    ; TAC: IF _t861 GOTO L5
+    cmp ecx, 2581
+    je L5
+    ; TAC: _t862 = x == 2584
+    ; TAC: IF _t862 GOTO L5
+    cmp ecx, 2584
+    je L5
+    ; TAC: _t863 = x == 2587
+    ; TAC: IF _t863 GOTO L5
+    cmp ecx, 2587
+    je L5
+    ; TAC: _t864 = x == 2590
+    ; TAC: IF _t864 GOTO L5
+    cmp ecx, 2590
+    je L5
+    ; TAC: _t865 = x == 2593
+    ; TAC: IF _t865 GOTO L5
+    cmp ecx, 2593
+    je L5
+    ; TAC: _t866 = x == 2596
+    ; TAC: IF _t866 GOTO L5
+    cmp ecx, 2596
+    je L5
+    ; TAC: _t867 = x == 2599
+    ; TAC: IF _t867 GOTO L5
+    cmp ecx, 2599
+    je L5
+    ; TAC: _t868 = x == 2602
+    ; TAC: IF _t868 GOTO L5
+    cmp ecx, 2602
+    je L5
+    ; TAC: _t869 = x == 2605
+    ; TAC: IF _t869 GOTO L5
+    cmp ecx, 2605
+    je L5
+    ; TAC: _t870 = x == 2608
+    ; TAC: IF _t870 GOTO L5
+    cmp ecx, 2608
+    je L5
+    ; TAC: _t871 = x == 2611
+    ; TAC: IF _t871 GOTO L5
+    cmp ecx, 2611
+    je L5
+    ; TAC: _t872 = x == 2614
+    ; TAC: IF _t872 GOTO L5
+    cmp ecx, 2614
+    je L5
+    ; TAC: _t873 = x == 2617
+    ; TAC: IF _t873 GOTO L5
+    cmp ecx, 2617
+    je L5
+    ; TAC: _t874 = x == 2620
+    ; TAC: IF _t874 GOTO L5
+    cmp ecx, 2620
+    je L5
+    ; TAC: _t875 = x == 2623
+    ; TAC: IF _t875 GOTO L5
+    cmp ecx, 2623
+    je L5
+    ; TAC: _t876 = x == 2626
+    ; TAC: IF _t876 GOTO L5
+    cmp ecx, 2626
+    je L5
+    ; TAC: _t877 = x == 2629
+    ; TAC: IF _t877 GOTO L5
+    cmp ecx, 2629
+    je L5
+    ; TAC: _t878 = x == 2632
+    ; TAC: IF _t878 GOTO L5
+    cmp ecx, 2632
+    je L5
+    ; TAC: _t879 = x == 2635
+    ; TAC: IF _t879 GOTO L5
+    cmp ecx, 2635
+    je L5
+    ; TAC: _t880 = x == 2638
+    ; TAC: IF _t880 GOTO L5
+    cmp ecx, 2638
+    je L5
+    ; TAC: _t881 = x == 2641
+    ; TAC: IF _t881 GOTO L5
+    cmp ecx, 2641
+    je L5
+    ; TAC: _t882 = x == 2644
+    ; TAC: IF _t882 GOTO L5
+    cmp ecx, 2644
+    je L5
+    ; TAC: _t883 = x == 2647
+    ; TAC: IF _t883 GOTO L5
+    cmp ecx, 2647
+    je L5
+    ; TAC: _t884 = x == 2650
+    ; TAC: IF _t884 GOTO L5
+    cmp ecx, 2650
+    je L5
+    ; TAC: _t885 = x == 2653
+    ; TAC: IF _t885 GOTO L5
+    cmp ecx, 2653
+    je L5
+    ; TAC: _t886 = x == 2656
+    ; TAC: IF _t886 GOTO L5
+    cmp ecx, 2656
+    je L5
+    ; TAC: _t887 = x == 2659
+    ; TAC: IF _t887 GOTO L5
+    cmp ecx, 2659
+    je L5
+    ; TAC: _t888 = x == 2662
+    ; TAC: IF _t888 GOTO L5
+    cmp ecx, 2662
+    je L5
+    ; TAC: _t889 = x == 2665
+    ; TAC: IF _t889 GOTO L5
+    cmp ecx, 2665
+    je L5
+    ; TAC: _t890 = x == 2668
+    ; TAC: IF _t890 GOTO L5
+    cmp ecx, 2668
+    je L5
+    ; TAC: _t891 = x == 2671
+    ; TAC: IF _t891 GOTO L5
+    cmp ecx, 2671
+    je L5
+    ; TAC: _t892 = x == 2674
+    ; TAC: IF _t892 GOTO L5
+    cmp ecx, 2674
+    je L5
+    ; TAC: _t893 = x == 2677
+    ; TAC: IF _t893 GOTO L5
+    cmp ecx, 2677
+    je L5
+    ; TAC: _t894 = x == 2680
+    ; TAC: IF _t894 GOTO L5
+    cmp ecx, 2680
+    je L5
+    ; TAC: _t895 = x == 2683
+    ; TAC: IF _t895 GOTO L5
+    cmp ecx, 2683
+    je L5
+    ; TAC: _t896 = x == 2686
+    ; TAC: IF _t896 GOTO L5
+    cmp ecx, 2686
+    je L5
+    ; TAC: _t897 = x == 2689
+    ; TAC: IF _t897 GOTO L5
+    cmp ecx, 2689
+    je L5
+    ; TAC: _t898 = x == 2692
+    ; TAC: IF _t898 GOTO L5
+    cmp ecx, 2692
+    je L5
+    ; TAC: _t899 = x == 2695
+    ; TAC: IF _t899 GOTO L5
+    cmp ecx, 2695
+    je L5
+    ; TAC: _t900 = x == 2698
+    ; TAC: IF _t900 GOTO L5
+    cmp ecx, 2698
+    je L5
+    ; TAC: _t901 = x == 2701
+    ; TAC: IF _t901 GOTO L5
+    cmp ecx, 2701
+    je L5
+    ; TAC: _t902 = x == 2704
+    ; TAC: IF _t902 GOTO L5
+    cmp ecx, 2704
+    je L5
+    ; TAC: _t903 = x == 2707
+    ; TAC: IF _t903 GOTO L5
+    cmp ecx, 2707
+    je L5
+    ; TAC: _t904 = x == 2710
+    ; TAC: IF _t904 GOTO L5
+    cmp ecx, 2710
+    je L5
+    ; TAC: _t905 = x == 2713
+    ; TAC: IF _t905 GOTO L5
+    cmp ecx, 2713
+    je L5
+    ; TAC: _t906 = x == 2716
+    ; TAC: IF _t906 GOTO L5
+    cmp ecx, 2716
+    je L5
+    ; TAC: _t907 = x == 2719
+    ; TAC: IF _t907 GOTO L5
+    cmp ecx, 2719
+    je L5
+    ; TAC: _t908 = x == 2722
+    ; TAC: IF _t908 GOTO L5
+    cmp ecx, 2722
+    je L5
+    ; TAC: _t909 = x == 2725
+    ; TAC: IF _t909 GOTO L5
+    cmp ecx, 2725
+    je L5
+    ; TAC: _t910 = x == 2728
+    ; TAC: IF _t910 GOTO L5
+    cmp ecx, 2728
+    je L5
+    ; TAC: _t911 = x == 2731
+    ; TAC: IF _t911 GOTO L5
+    cmp ecx, 2731
+    je L5
+    ; TAC: _t912 = x == 2734
+    ; TAC: IF _t912 GOTO L5
+    cmp ecx, 2734
+    je L5
+    ; TAC: _t913 = x == 2737
+    ; TAC: IF _t913 GOTO L5
+    cmp ecx, 2737
+    je L5
+    ; TAC: _t914 = x == 2740
+    ; TAC: IF _t914 GOTO L5
+    cmp ecx, 2740
+    je L5
+    ; TAC: _t915 = x == 2743
+    ; TAC: IF _t915 GOTO L5
+    cmp ecx, 2743
+    je L5
+    ; TAC: _t916 = x == 2746
+    ; TAC: IF _t916 GOTO L5
+    cmp ecx, 2746
+    je L5
+    ; TAC: _t917 = x == 2749
+    ; TAC: IF _t917 GOTO L5
+    cmp ecx, 2749
+    je L5
+    ; TAC: _t918 = x == 2752
+    ; TAC: IF _t918 GOTO L5
+    cmp ecx, 2752
+    je L5
+    ; TAC: _t919 = x == 2755
+    ; TAC: IF _t919 GOTO L5
+    cmp ecx, 2755
+    je L5
+    ; TAC: _t920 = x == 2758
+    ; TAC: IF _t920 GOTO L5
+    cmp ecx, 2758
+    je L5
+    ; TAC: _t921 = x == 2761
+    ; TAC: IF _t921 GOTO L5
+    cmp ecx, 2761
+    je L5
+    ; TAC: _t922 = x == 2764
+    ; TAC: IF _t922 GOTO L5
+    cmp ecx, 2764
+    je L5
+    ; TAC: _t923 = x == 2767
+    ; TAC: IF _t923 GOTO L5
+    cmp ecx, 2767
+    je L5
+    ; TAC: _t924 = x == 2770
+    ; TAC: IF _t924 GOTO L5
+    cmp ecx, 2770
+    je L5
+    ; TAC: _t925 = x == 2773
+    ; TAC: IF _t925 GOTO L5
+    cmp ecx, 2773
+    je L5
+    ; TAC: _t926 = x == 2776
+    ; TAC: IF _t926 GOTO L5
+    cmp ecx, 2776
+    je L5
+    ; TAC: _t927 = x == 2779
+    ; TAC: IF _t927 GOTO L5
+    cmp ecx, 2779
+    je L5
+    ; TAC: _t928 = x == 2782
+    ; TAC: IF _t928 GOTO L5
+    cmp ecx, 2782
+    je L5
+    ; TAC: _t929 = x == 2785
+    ; TAC: IF _t929 GOTO L5
+    cmp ecx, 2785
+    je L5
+    ; TAC: _t930 = x == 2788
+    ; TAC: IF _t930 GOTO L5
+    cmp ecx, 2788
+    je L5
+    ; TAC: _t931 = x == 2791
+    ; TAC: IF _t931 GOTO L5
+    cmp ecx, 2791
+    je L5
+    ; TAC: _t932 = x == 2794
+    ; TAC: IF _t932 GOTO L5
+    cmp ecx, 2794
+    je L5
+    ; TAC: _t933 = x == 2797
+    ; TAC: IF _t933 GOTO L5
+    cmp ecx, 2797
+    je L5
+    ; TAC: _t934 = x == 2800
+    ; TAC: IF _t934 GOTO L5
+    cmp ecx, 2800
+    je L5
+    ; TAC: _t935 = x == 2803
+    ; TAC: IF _t935 GOTO L5
+    cmp ecx, 2803
+    je L5
+    ; TAC: _t936 = x == 2806
+    ; TAC: IF _t936 GOTO L5
+    cmp ecx, 2806
+    je L5
+    ; TAC: _t937 = x == 2809
+    ; TAC: IF _t937 GOTO L5
+    cmp ecx, 2809
+    je L5
+    ; TAC: _t938 = x == 2812
+    ; TAC: IF _t938 GOTO L5
+    cmp ecx, 2812
+    je L5
+    ; TAC: _t939 = x == 2815
+    ; TAC: IF _t939 GOTO L5
+    cmp ecx, 2815
+    je L5
+    ; TAC: _t940 = x == 2818
+    ; TAC: IF _t940 GOTO L5
+    cmp ecx, 2818
+    je L5
+    ; TAC: _t941 = x == 2821
+    ; TAC: IF _t941 GOTO L5
+    cmp ecx, 2821
+    je L5
+    ; TAC: _t942 = x == 2824
+    ; TAC: IF _t942 GOTO L5
+    cmp ecx, 2824
+    je L5
+    ; TAC: _t943 = x == 2827
+    ; TAC: IF _t943 GOTO L5
+    cmp ecx, 2827
+    je L5
+    ; TAC: _t944 = x == 2830
+    ; TAC: IF _t944 GOTO L5
+    cmp ecx, 2830
+    je L5
+    ; TAC: _t945 = x == 2833
+    ; TAC: IF _t945 GOTO L5
+    cmp ecx, 2833
+    je L5
+    ; TAC: _t946 = x == 2836
+    ; TAC: IF _t946 GOTO L5
+    cmp ecx, 2836
+    je L5
+    ; TAC: _t947 = x == 2839
+    ; TAC: IF _t947 GOTO L5
+    cmp ecx, 2839
+    je L5
+    ; TAC: _t948 = x == 2842
+    ; TAC: IF _t948 GOTO L5
+    cmp ecx, 2842
+    je L5
+    ; TAC: _t949 = x == 2845
+    ; TAC: IF _t949 GOTO L5
+    cmp ecx, 2845
+    je L5
+    ; TAC: _t950 = x == 2848
+    ; TAC: IF _t950 GOTO L5
+    cmp ecx, 2848
+    je L5
+    ; TAC: _t951 = x == 2851
+    ; TAC: IF _t951 GOTO L5
+    cmp ecx, 2851
+    je L5
+    ; TAC: _t952 = x == 2854
+    ; TAC: IF _t952 GOTO L5
+    cmp ecx, 2854
+    je L5
+    ; TAC: _t953 = x == 2857
+    ; TAC: IF _t953 GOTO L5
+    cmp ecx, 2857
+    je L5
+    ; TAC: _t954 = x == 2860
+    ; TAC: IF _t954 GOTO L5
+    cmp ecx, 2860
+    je L5
+    ; TAC: _t955 = x == 2863
+    ; TAC: IF _t955 GOTO L5
+    cmp ecx, 2863
+    je L5
+    ; TAC: _t956 = x == 2866
+    ; TAC: IF _t956 GOTO L5
+    cmp ecx, 2866
+    je L5
+    ; TAC: _t957 = x == 2869
+    ; TAC: IF _t957 GOTO L5
+    cmp ecx, 2869
+    je L5
+    ; TAC: _t958 = x == 2872
+    ; TAC: IF _t958 GOTO L5
+    cmp ecx, 2872
+    je L5
+    ; TAC: _t959 = x == 2875
+    ; TAC: IF _t959 GOTO L5
+    cmp ecx, 2875
+    je L5
+    ; TAC: _t960 = x == 2878
+    ; TAC: IF _t960 GOTO L5
+    cmp ecx, 2878
+    je L5
+    ; TAC: _t961 = x == 2881
+    ; TAC: IF _t961 GOTO L5
+    cmp ecx, 2881
+    je L5
+    ; TAC: _t962 = x == 2884
+    ; TAC: IF _t962 GOTO L5
+    cmp ecx, 2884
+    je L5
+    ; TAC: _t963 = x == 2887
+    ; TAC: IF _t963 GOTO L5
+    cmp ecx, 2887
+    je L5
+    ; TAC: _t964 = x == 2890
+    ; TAC: IF _t964 GOTO L5
+    cmp ecx, 2890
+    je L5
+    ; TAC: _t965 = x == 2893
+    ; TAC: IF _t965 GOTO L5
+    cmp ecx, 2893
+    je L5
+    ; TAC: _t966 = x == 2896
+    ; TAC: IF _t966 GOTO L5
+    cmp ecx, 2896
+    je L5
+    ; TAC: _t967 = x == 2899
+    ; TAC: IF _t967 GOTO L5
+    cmp ecx, 2899
+    je L5
+    ; TAC: _t968 = x == 2902
+    ; TAC: IF _t968 GOTO L5
+    cmp ecx, 2902
+    je L5
+    ; TAC: _t969 = x == 2905
+    ; TAC: IF _t969 GOTO L5
+    cmp ecx, 2905
+    je L5
+    ; TAC: _t970 = x == 2908
+    ; TAC: IF _t970 GOTO L5
+    cmp ecx, 2908
+    je L5
+    ; TAC: _t971 = x == 2911
+    ; TAC: IF _t971 GOTO L5
+    cmp ecx, 2911
+    je L5
+    ; TAC: _t972 = x == 2914
+    ; TAC: IF _t972 GOTO L5
+    cmp ecx, 2914
+    je L5
+    ; TAC: _t973 = x == 2917
+    ; TAC: IF _t973 GOTO L5
+    cmp ecx, 2917
+    je L5
+    ; TAC: _t974 = x == 2920
+    ; TAC: IF _t974 GOTO L5
+    cmp ecx, 2920
+    je L5
+    ; TAC: _t975 = x == 2923
+    ; TAC: IF _t975 GOTO L5
+    cmp ecx, 2923
+    je L5
+    ; TAC: _t976 = x == 2926
+    ; TAC: IF _t976 GOTO L5
+    cmp ecx, 2926
+    je L5
+    ; TAC: _t977 = x == 2929
+    ; TAC: IF _t977 GOTO L5
+    cmp ecx, 2929
+    je L5
+    ; TAC: _t978 = x == 2932
+    ; TAC: IF _t978 GOTO L5
+    cmp ecx, 2932
+    je L5
+    ; TAC: _t979 = x == 2935
+    ; TAC: IF _t979 GOTO L5
+    cmp ecx, 2935
+    je L5
+    ; TAC: _t980 = x == 2938
+    ; TAC: IF _t980 GOTO L5
+    cmp ecx, 2938
+    je L5
+    ; TAC: _t981 = x == 2941
+    ; TAC: IF _t981 GOTO L5
+    cmp ecx, 2941
+    je L5
+    ; TAC: _t982 = x == 2944
+    ; TAC: IF _t982 GOTO L5
+    cmp ecx, 2944
+    je L5
+    ; TAC: _t983 = x == 2947
+    ; TAC: IF _t983 GOTO L5
+    cmp ecx, 2947
+    je L5
+    ; TAC: _t984 = x == 2950
+    ; TAC: IF _t984 GOTO L5
+    cmp ecx, 2950
+    je L5
+    ; TAC: _t985 = x == 2953
+    ; TAC: IF _t985 GOTO L5
+    cmp ecx, 2953
+    je L5
+    ; TAC: _t986 = x == 2956
+    ; TAC: IF _t986 GOTO L5
+    cmp ecx, 2956
+    je L5
+    ; TAC: _t987 = x == 2959
+    ; TAC: IF _t987 GOTO L5
+    cmp ecx, 2959
+    je L5
+    ; TAC: _t988 = x == 2962
+    ; TAC: IF _t988 GOTO L5
+    cmp ecx, 2962
+    je L5
+    ; TAC: _t989 = x == 2965
+    ; TAC: IF _t989 GOTO L5
+    cmp ecx, 2965
+    je L5
+    ; TAC: _t990 = x == 2968
+    ; TAC: IF _t990 GOTO L5
+    cmp ecx, 2968
+    je L5
+    ; TAC: _t991 = x == 2971
+    ; TAC: IF _t991 GOTO L5
+    cmp ecx, 2971
+    je L5
+    ; TAC: _t992 = x == 2974
+    ; TAC: IF _t992 GOTO L5
+    cmp ecx, 2974
+    je L5
+    ; TAC: _t993 = x == 2977
+    ; TAC: IF _t993 GOTO L5
+    cmp ecx, 2977
+    je L5
+    ; TAC: _t994 = x == 2980
+    ; TAC: IF _t994 GOTO L5
+    cmp ecx, 2980
+    je L5
+    ; TAC: _t995 = x == 2983
+    ; TAC: IF _t995 GOTO L5
+    cmp ecx, 2983
+    je L5
+    ; TAC: _t996 = x == 2986
+    ; TAC: IF _t996 GOTO L5
+    cmp ecx, 2986
+    je L5
+    ; TAC: _t997 = x == 2989
+    ; TAC: IF _t997 GOTO L5
+    cmp ecx, 2989
+    je L5
+    ; TAC: _t998 = x == 2992
+    ; TAC: IF _t998 GOTO L5
+    cmp ecx, 2992
+    je L5
+    ; TAC: _t999 = x == 2995
+    ; TAC: IF _t999 GOTO L5
+    cmp ecx, 2995
+    je L5
+    ; TAC: _t1000 = x == 2998
+    ; TAC: IF _t1000 GOTO L5
+    cmp ecx, 2998
+    je L5
+    ; TAC: _t1001 = x == 3001
+    ; TAC: IF _t1001 GOTO L5
+    cmp ecx, 3001
+    je L5
+    ; TAC: _t1002 = x == 3004
+    ; TAC: IF _t1002 GOTO L5
+    cmp ecx, 3004
+    je L5
+    ; TAC: _t1003 = x == 3007
+    ; TAC: IF _t1003 GOTO L5
+    cmp ecx, 3007
+    je L5
+    ; TAC: _t1004 = x == 3010
+    ; TAC: IF _t1004 GOTO L5
+    cmp ecx, 3010
+    je L5
+    ; TAC: _t1005 = x == 3013
+    ; TAC: IF _t1005 GOTO L5
+    cmp ecx, 3013
+    je L5
+    ; TAC: _t1006 = x == 3016
+    ; TAC: IF _t1006 GOTO L5
+    cmp ecx, 3016
+    je L5
+    ; TAC: _t1007 = x == 3019
+    ; TAC: IF _t1007 GOTO L5
+    cmp ecx, 3019
+    je L5
+    ; TAC: _t1008 = x == 3022
+    ; TAC: IF _t1008 GOTO L5
+    cmp ecx, 3022
+    je L5
+    ; TAC: _t1009 = x == 3025
+    ; TAC: IF _t1009 GOTO L5
+    cmp ecx, 3025
+    je L5
+    ; TAC: _t1010 = x == 3028
+    ; TAC: IF _t1010 GOTO L5
+    cmp ecx, 3028
+    je L5
+    ; TAC: _t1011 = x == 3031
+    ; TAC: IF _t1011 GOTO L5
+    cmp ecx, 3031
+    je L5
+    ; TAC: _t1012 = x == 3034
+    ; TAC: IF _t1012 GOTO L5
+    cmp ecx, 3034
+    je L5
+    ; TAC: _t1013 = x == 3037
+    ; TAC: IF _t1013 GOTO L5
+    cmp ecx, 3037
+    je L5
+    ; TAC: _t1014 = x == 3040
+    ; TAC: IF _t1014 GOTO L5
+    cmp ecx, 3040
+    je L5
+    ; TAC: _t1015 = x == 3043
+    ; TAC: IF _t1015 GOTO L5
+    cmp ecx, 3043
+    je L5
+    ; TAC: _t1016 = x == 3046
+    ; TAC: IF _t1016 GOTO L5
+    cmp ecx, 3046
+    je L5
+    ; TAC: _t1017 = x == 3049
+    ; TAC: IF _t1017 GOTO L5
+    cmp ecx, 3049
+    je L5
+    ; TAC: _t1018 = x == 3052
+    ; TAC: IF _t1018 GOTO L5
+    cmp ecx, 3052
+    je L5
+    ; TAC: _t1019 = x == 3055
+    ; TAC: IF _t1019 GOTO L5
+    cmp ecx, 3055
+    je L5
+    ; TAC: _t1020 = x == 3058
+    ; TAC: IF _t1020 GOTO L5
+    cmp ecx, 3058
+    je L5
+    ; TAC: _t1021 = x == 3061
+    ; TAC: IF _t1021 GOTO L5
+    cmp ecx, 3061
+    je L5
+    ; TAC: _t1022 = x == 3064
+    ; TAC: IF _t1022 GOTO L5
+    cmp ecx, 3064
+    je L5
+    ; TAC: _t1023 = x == 3067
+    ; TAC: IF _t1023 GOTO L5
+    cmp ecx, 3067
+    je L5
+    ; TAC: _t1024 = x == 3070
+    ; TAC: IF _t1024 GOTO L5
+    cmp ecx, 3070
+    je L5
+    ; TAC: _t1025 = x == 3073
+    ; TAC: IF _t1025 GOTO L5
+    cmp ecx, 3073
+    je L5
+    ; TAC: _t1026 = x == 3076
+    ; TAC: IF _t1026 GOTO L5
+    cmp ecx, 3076
+    je L5
+    ; TAC: _t1027 = x == 3079
+    ; TAC: IF _t1027 GOTO L5
+    cmp ecx, 3079
+    je L5
+    ; TAC: _t1028 = x == 3082
+    ; TAC: IF _t1028 GOTO L5
+    cmp ecx, 3082
+    je L5
+    ; TAC: _t1029 = x == 3085
+    ; TAC: IF _t1029 GOTO L5
+    cmp ecx, 3085
+    je L5
+    ; TAC: _t1030 = x == 3088
+    ; TAC: IF _t1030 GOTO L5
+    cmp ecx, 3088
+    je L5
+    ; TAC: _t1031 = x == 3091
+    ; TAC: IF _t1031 GOTO L5
+    cmp ecx, 3091
+    je L5
+    ; TAC: _t1032 = x == 3094
+    ; TAC: IF _t1032 GOTO L5
+    cmp ecx, 3094
+    je L5
+    ; TAC: _t1033 = x == 3097
+    ; TAC: IF _t1033 GOTO L5
+    cmp ecx, 3097
+    je L5
+    ; TAC: _t1034 = x == 3100
+    ; TAC: IF _t1034 GOTO L5
+    cmp ecx, 3100
+    je L5
+    ; TAC: _t1035 = x == 3103
+    ; TAC: IF _t1035 GOTO L5
+    cmp ecx, 3103
+    je L5
+    ; TAC: _t1036 = x == 3106
+    ; TAC: IF _t1036 GOTO L5
+    cmp ecx, 3106
+    je L5
+    ; TAC: _t1037 = x == 3109
+    ; TAC: IF _t1037 GOTO L5
+    cmp ecx, 3109
+    je L5
+    ; TAC: _t1038 = x == 3112
+    ; TAC: IF _t1038 GOTO L5
+    cmp ecx, 3112
+    je L5
+    ; TAC: _t1039 = x == 3115
+    ; TAC: IF _t1039 GOTO L5
+    cmp ecx, 3115
+    je L5
+    ; TAC: _t1040 = x == 3118
+    ; TAC: IF _t1040 GOTO L5
+    cmp ecx, 3118
+    je L5
+    ; TAC: _t1041 = x == 3121
+    ; TAC: IF _t1041 GOTO L5
+    cmp ecx, 3121
+    je L5
+    ; TAC: _t1042 = x == 3124
+    ; TAC: IF _t1042 GOTO L5
+    cmp ecx, 3124
+    je L5
+    ; TAC: _t1043 = x == 3127
+    ; TAC: IF _t1043 GOTO L5
+    cmp ecx, 3127
+    je L5
+    ; TAC: _t1044 = x == 3130
+    ; TAC: IF _t1044 GOTO L5
+    cmp ecx, 3130
+    je L5
+    ; TAC: _t1045 = x == 3133
+    ; TAC: IF _t1045 GOTO L5
+    cmp ecx, 3133
+    je L5
+    ; TAC: _t1046 = x == 3136
+    ; TAC: IF _t1046 GOTO L5
+    cmp ecx, 3136
+    je L5
+    ; TAC: _t1047 = x == 3139
+    ; TAC: IF _t1047 GOTO L5
+    cmp ecx, 3139
+    je L5
+    ; TAC: _t1048 = x == 3142
+    ; TAC: IF _t1048 GOTO L5
+    cmp ecx, 3142
+    je L5
+    ; TAC: _t1049 = x == 3145
+    ; TAC: IF _t1049 GOTO L5
+    cmp ecx, 3145
+    je L5
+    ; TAC: _t1050 = x == 3148
+    ; TAC: IF _t1050 GOTO L5
+    cmp ecx, 3148
+    je L5
+    ; TAC: _t1051 = x == 3151
+    ; TAC: IF _t1051 GOTO L5
+    cmp ecx, 3151
+    je L5
+    ; TAC: _t1052 = x == 3154
+    ; TAC: IF _t1052 GOTO L5
+    cmp ecx, 3154
+    je L5
+    ; TAC: _t1053 = x == 3157
+    ; TAC: IF _t1053 GOTO L5
+    cmp ecx, 3157
+    je L5
+    ; TAC: _t1054 = x == 3160
+    ; TAC: IF _t1054 GOTO L5
+    cmp ecx, 3160
+    je L5
+    ; TAC: _t1055 = x == 3163
+    ; TAC: IF _t1055 GOTO L5
+    cmp ecx, 3163
+    je L5
+    ; TAC: _t1056 = x == 3166
+    ; TAC: IF _t1056 GOTO L5
+    cmp ecx, 3166
+    je L5
+    ; TAC: _t1057 = x == 3169
+    ; TAC: IF _t1057 GOTO L5
+    cmp ecx, 3169
+    je L5
+    ; TAC: _t1058 = x == 3172
+    ; TAC: IF _t1058 GOTO L5
+    cmp ecx, 3172
+    je L5
+    ; TAC: _t1059 = x == 3175
+    ; TAC: IF _t1059 GOTO L5
+    cmp ecx, 3175
+    je L5
+    ; TAC: _t1060 = x == 3178
+    ; TAC: IF _t1060 GOTO L5
+    cmp ecx, 3178
+    je L5
+    ; TAC: _t1061 = x == 3181
+    ; TAC: IF _t1061 GOTO L5
+    cmp ecx, 3181
+    je L5
+    ; TAC: _t1062 = x == 3184
+    ; TAC: IF _t1062 GOTO L5
+    cmp ecx, 3184
+    je L5
+    ; TAC: _t1063 = x == 3187
+    ; TAC: IF _t1063 GOTO L5
+    cmp ecx, 3187
+    je L5
+    ; TAC: _t1064 = x == 3190
+    ; TAC: IF _t1064 GOTO L5
+    cmp ecx, 3190
+    je L5
+    ; TAC: _t1065 = x == 3193
+    ; TAC: IF _t1065 GOTO L5
+    cmp ecx, 3193
+    je L5
+    ; TAC: _t1066 = x == 3196
+    ; TAC: IF _t1066 GOTO L5
+    cmp ecx, 3196
+    je L5
+    ; TAC: _t1067 = x == 3199
+    ; TAC: IF _t1067 GOTO L5
+    cmp ecx, 3199
+    je L5
+    ; TAC: _t1068 = x == 3202
+    ; TAC: IF _t1068 GOTO L5
+    cmp ecx, 3202
+    je L5
+    ; TAC: _t1069 = x == 3205
+    ; TAC: IF _t1069 GOTO L5
+    cmp ecx, 3205
+    je L5
+    ; TAC: _t1070 = x == 3208
+    ; TAC: IF _t1070 GOTO L5
+    cmp ecx, 3208
+    je L5
+    ; TAC: _t1071 = x == 3211
+    ; TAC: IF _t1071 GOTO L5
+    cmp ecx, 3211
+    je L5
+    ; TAC: _t1072 = x == 3214
+    ; TAC: IF _t1072 GOTO L5
+    cmp ecx, 3214
+    je L5
+    ; TAC: _t1073 = x == 3217
+    ; TAC: IF _t1073 GOTO L5
+    cmp ecx, 3217
+    je L5
+    ; TAC: _t1074 = x == 3220
+    ; TAC: IF _t1074 GOTO L5
+    cmp ecx, 3220
+    je L5
+    ; TAC: _t1075 = x == 3223
+    ; TAC: IF _t1075 GOTO L5
+    cmp ecx, 3223
+    je L5
+    ; TAC: _t1076 = x == 3226
+    ; TAC: IF _t1076 GOTO L5
+    cmp ecx, 3226
+    je L5
+    ; TAC: _t1077 = x == 3229
+    ; TAC: IF _t1077 GOTO L5
+    cmp ecx, 3229
+    je L5
+    ; TAC: _t1078 = x == 3232
+    ; TAC: IF _t1078 GOTO L5
+    cmp ecx, 3232
+    je L5
+    ; TAC: _t1079 = x == 3235
+    ; TAC: IF _t1079 GOTO L5
+    cmp ecx, 3235
+    je L5
+    ; TAC: _t1080 = x == 3238
+    ; TAC: IF _t1080 GOTO L5
+    cmp ecx, 3238
+    je L5
+    ; TAC: _t1081 = x == 3241
+    ; TAC: IF _t1081 GOTO L5
+    cmp ecx, 3241
+    je L5
+    ; TAC: _t1082 = x == 3244
+    ; TAC: IF _t1082 GOTO L5
+    cmp ecx, 3244
+    je L5
+    ; TAC: _t1083 = x == 3247
+    ; TAC: IF _t1083 GOTO L5
+    cmp ecx, 3247
+    je L5
+    ; TAC: _t1084 = x == 3250
+    ; TAC: IF _t1084 GOTO L5
+    cmp ecx, 3250
+    je L5
+    ; TAC: _t1085 = x == 3253
+    ; TAC: IF _t1085 GOTO L5
+    cmp ecx, 3253
+    je L5
+    ; TAC: _t1086 = x == 3256
+    ; TAC: IF _t1086 GOTO L5
+    cmp ecx, 3256
+    je L5
+    ; TAC: _t1087 = x == 3259
+    ; TAC: IF _t1087 GOTO L5
+    cmp ecx, 3259
+    je L5
+    ; TAC: _t1088 = x == 3262
+    ; TAC: IF _t1088 GOTO L5
+    cmp ecx, 3262
+    je L5
+    ; TAC: _t1089 = x == 3265
+    ; TAC: IF _t1089 GOTO L5
+    cmp ecx, 3265
+    je L5
+    ; TAC: _t1090 = x == 3268
+    ; TAC: IF _t1090 GOTO L5
+    cmp ecx, 3268
+    je L5
+    ; TAC: _t1091 = x == 3271
+    ; TAC: IF _t1091 GOTO L5
+    cmp ecx, 3271
+    je L5
+    ; TAC: _t1092 = x == 3274
+    ; TAC: IF _t1092 GOTO L5
+    cmp ecx, 3274
+    je L5
+    ; TAC: _t1093 = x == 3277
+    ; TAC: IF _t1093 GOTO L5
+    cmp ecx, 3277
+    je L5
+    ; TAC: _t1094 = x == 3280
+    ; TAC: IF _t1094 GOTO L5
+    cmp ecx, 3280
+    je L5
+    ; TAC: _t1095 = x == 3283
+    ; TAC: IF _t1095 GOTO L5
+    cmp ecx, 3283
+    je L5
+    ; TAC: _t1096 = x == 3286
+    ; TAC: IF _t1096 GOTO L5
+    cmp ecx, 3286
+    je L5
+    ; TAC: _t1097 = x == 3289
+    ; TAC: IF _t1097 GOTO L5
+    cmp ecx, 3289
+    je L5
+    ; TAC: _t1098 = x == 3292
+    ; TAC: IF _t1098 GOTO L5
+    cmp ecx, 3292
+    je L5
+    ; TAC: _t1099 = x == 3295
+    ; TAC: IF _t1099 GOTO L5
+    cmp ecx, 3295
+    je L5
+    ; TAC: _t1100 = x == 3298
+    ; TAC: IF _t1100 GOTO L5
+    cmp ecx, 3298
+    je L5
+    ; TAC: _t1101 = x == 3301
+    ; TAC: IF _t1101 GOTO L5
+    cmp ecx, 3301
+    je L5
+    ; TAC: _t1102 = x == 3304
+    ; TAC: IF _t1102 GOTO L5
+    cmp ecx, 3304
+    je L5
+    ; TAC: _t1103 = x == 3307
+    ; TAC: IF _t1103 GOTO L5
+    cmp ecx, 3307
+    je L5
+    ; TAC: _t1104 = x == 3310
+    ; TAC: IF _t1104 GOTO L5
+    cmp ecx, 3310
+    je L5
+    ; TAC: _t1105 = x == 3313
+    ; TAC: IF _t1105 GOTO L5
+    cmp ecx, 3313
+    je L5
+    ; TAC: _t1106 = x == 3316
+    ; TAC: IF _t1106 GOTO L5
+    cmp ecx, 3316
+    je L5
+    ; TAC: _t1107 = x == 3319
+    ; TAC: IF _t1107 GOTO L5
+    cmp ecx, 3319
+    je L5
+    ; TAC: _t1108 = x == 3322
+    ; TAC: IF _t1108 GOTO L5
+    cmp ecx, 3322
+    je L5
+    ; TAC: _t1109 = x == 3325
+    ; TAC: IF _t1109 GOTO L5
+    cmp ecx, 3325
+    je L5
+    ; TAC: _t1110 = x == 3328
+    ; TAC: IF _t1110 GOTO L5
+    cmp ecx, 3328
+    je L5
+    ; TAC: _t1111 = x == 3331
+    ; TAC: IF _t1111 GOTO L5
+    cmp ecx, 3331
+    je L5
+    ; TAC: _t1112 = x == 3334
+    ; TAC: IF _t1112 GOTO L5
+    cmp ecx, 3334
+    je L5
+    ; TAC: _t1113 = x == 3337
+    ; TAC: IF _t1113 GOTO L5
+    cmp ecx, 3337
+    je L5
+    ; TAC: _t1114 = x == 3340
+    ; TAC: IF _t1114 GOTO L5
+    cmp ecx, 3340
+    je L5
+    ; TAC: _t1115 = x == 3343
+    ; TAC: IF _t1115 GOTO L5
+    cmp ecx, 3343
+    je L5
+    ; TAC: _t1116 = x == 3346
+    ; TAC: IF _t1116 GOTO L5
+    cmp ecx, 3346
+    je L5
+    ; TAC: _t1117 = x == 3349
+    ; TAC: IF _t1117 GOTO L5
+    cmp ecx, 3349
+    je L5
+    ; TAC: _t1118 = x == 3352
+    ; TAC: IF _t1118 GOTO L5
+    cmp ecx, 3352
+    je L5
+    ; TAC: _t1119 = x == 3355
+    ; TAC: IF _t1119 GOTO L5
+    cmp ecx, 3355
+    je L5
+    ; TAC: _t1120 = x == 3358
+    ; TAC: IF _t1120 GOTO L5
+    cmp ecx, 3358
+    je L5
+    ; TAC: _t1121 = x == 3361
+    ; TAC: IF _t1121 GOTO L5
+    cmp ecx, 3361
+    je L5
+    ; TAC: _t1122 = x == 3364
+    ; TAC: IF _t1122 GOTO L5
+    cmp ecx, 3364
+    je L5
+    ; TAC: _t1123 = x == 3367
+    ; TAC: IF _t1123 GOTO L5
+    cmp ecx, 3367
+    je L5
+    ; TAC: _t1124 = x == 3370
+    ; TAC: IF _t1124 GOTO L5
+    cmp ecx, 3370
+    je L5
+    ; TAC: _t1125 = x == 3373
+    ; TAC: IF _t1125 GOTO L5
+    cmp ecx, 3373
+    je L5
+    ; TAC: _t1126 = x == 3376
+    ; TAC: IF _t1126 GOTO L5
+    cmp ecx, 3376
+    je L5
+    ; TAC: _t1127 = x == 3379
+    ; TAC: IF _t1127 GOTO L5
+    cmp ecx, 3379
+    je L5
+    ; TAC: _t1128 = x == 3382
+    ; TAC: IF _t1128 GOTO L5
+    cmp ecx, 3382
+    je L5
+    ; TAC: _t1129 = x == 3385
+    ; TAC: IF _t1129 GOTO L5
+    cmp ecx, 3385
+    je L5
+    ; TAC: _t1130 = x == 3388
+    ; TAC: IF _t1130 GOTO L5
+    cmp ecx, 3388
+    je L5
+    ; TAC: _t1131 = x == 3391
+    ; TAC: IF _t1131 GOTO L5
+    cmp ecx, 3391
+    je L5
+    ; TAC: _t1132 = x == 3394
+    ; TAC: IF _t1132 GOTO L5
+    cmp ecx, 3394
+    je L5
+    ; TAC: _t1133 = x == 3397
+    ; TAC: IF _t1133 GOTO L5
+    cmp ecx, 3397
+    je L5
+    ; TAC: _t1134 = x == 3400
+    ; TAC: IF _t1134 GOTO L5
+    cmp ecx, 3400
+    je L5
+    ; TAC: _t1135 = x == 3403
+    ; TAC: IF _t1135 GOTO L5
+    cmp ecx, 3403
+    je L5
+    ; TAC: _t1136 = x == 3406
+    ; TAC: IF _t1136 GOTO L5
+    cmp ecx, 3406
+    je L5
+    ; TAC: _t1137 = x == 3409
+    ; TAC: IF _t1137 GOTO L5
+    cmp ecx, 3409
+    je L5
+    ; TAC: _t1138 = x == 3412
+    ; TAC: IF _t1138 GOTO L5
+    cmp ecx, 3412
+    je L5
+    ; TAC: _t1139 = x == 3415
+    ; TAC: IF _t1139 GOTO L5
+    cmp ecx, 3415
+    je L5
+    ; TAC: _t1140 = x == 3418
+    ; TAC: IF _t1140 GOTO L5
+    cmp ecx, 3418
+    je L5
+    ; TAC: _t1141 = x == 3421
+    ; TAC: IF _t1141 GOTO L5
+    cmp ecx, 3421
+    je L5
+    ; TAC: _t1142 = x == 3424
+    ; TAC: IF _t1142 GOTO L5
+    cmp ecx, 3424
+    je L5
+    ; TAC: _t1143 = x == 3427
+    ; TAC: IF _t1143 GOTO L5
+    cmp ecx, 3427
+    je L5
+    ; TAC: _t1144 = x == 3430
+    ; TAC: IF _t1144 GOTO L5
+    cmp ecx, 3430
+    je L5
+    ; TAC: _t1145 = x == 3433
+    ; TAC: IF _t1145 GOTO L5
+    cmp ecx, 3433
+    je L5
+    ; TAC: _t1146 = x == 3436
+    ; TAC: IF _t1146 GOTO L5
+    cmp ecx, 3436
+    je L5
+    ; TAC: _t1147 = x == 3439
+    ; TAC: IF _t1147 GOTO L5
+    cmp ecx, 3439
+    je L5
+    ; TAC: _t1148 = x == 3442
+    ; TAC: IF _t1148 GOTO L5
+    cmp ecx, 3442
+    je L5
+    ; TAC: _t1149 = x == 3445
+    ; TAC: IF _t1149 GOTO L5
+    cmp ecx, 3445
+    je L5
+    ; TAC: _t1150 = x == 3448
+    ; TAC: IF _t1150 GOTO L5
+    cmp ecx, 3448
+    je L5
+    ; TAC: _t1151 = x == 3451
+    ; TAC: IF _t1151 GOTO L5
+    cmp ecx, 3451
+    je L5
+    ; TAC: _t1152 = x == 3454
+    ; TAC: IF _t1152 GOTO L5
+    cmp ecx, 3454
+    je L5
+    ; TAC: _t1153 = x == 3457
+    ; TAC: IF _t1153 GOTO L5
+    cmp ecx, 3457
+    je L5
+    ; TAC: _t1154 = x == 3460
+    ; TAC: IF _t1154 GOTO L5
+    cmp ecx, 3460
+    je L5
+    ; TAC: _t1155 = x == 3463
+    ; TAC: IF _t1155 GOTO L5
+    cmp ecx, 3463
+    je L5
+    ; TAC: _t1156 = x == 3466
+    ; TAC: IF _t1156 GOTO L5
+    cmp ecx, 3466
+    je L5
+    ; TAC: _t1157 = x == 3469
+    ; TAC: IF _t1157 GOTO L5
+    cmp ecx, 3469
+    je L5
+    ; TAC: _t1158 = x == 3472
+    ; TAC: IF _t1158 GOTO L5
+    cmp ecx, 3472
+    je L5
+    ; TAC: _t1159 = x == 3475
+    ; TAC: IF _t1159 GOTO L5
+    cmp ecx, 3475
+    je L5
+    ; TAC: _t1160 = x == 3478
+    ; TAC: IF _t1160 GOTO L5
+    cmp ecx, 3478
+    je L5
+    ; TAC: _t1161 = x == 3481
+    ; TAC: IF _t1161 GOTO L5
+    cmp ecx, 3481
+    je L5
+    ; TAC: _t1162 = x == 3484
+    ; TAC: IF _t1162 GOTO L5
+    cmp ecx, 3484
+    je L5
+    ; TAC: _t1163 = x == 3487
+    ; TAC: IF _t1163 GOTO L5
+    cmp ecx, 3487
+    je L5
+    ; TAC: _t1164 = x == 3490
+    ; TAC: IF _t1164 GOTO L5
+    cmp ecx, 3490
+    je L5
+    ; TAC: _t1165 = x == 3493
+    ; TAC: IF _t1165 GOTO L5
+    cmp ecx, 3493
+    je L5
+    ; TAC: _t1166 = x == 3496
+    ; TAC: IF _t1166 GOTO L5
+    cmp ecx, 3496
+    je L5
+    ; TAC: _t1167 = x == 3499
+    ; TAC: IF _t1167 GOTO L5
+    cmp ecx, 3499
+    je L5
+    ; TAC: _t1168 = x == 3502
+    ; TAC: IF _t1168 GOTO L5
+    cmp ecx, 3502
+    je L5
+    ; TAC: _t1169 = x == 3505
+    ; TAC: IF _t1169 GOTO L5
+    cmp ecx, 3505
+    je L5
+    ; TAC: _t1170 = x == 3508
+    ; TAC: IF _t1170 GOTO L5
+    cmp ecx, 3508
+    je L5
+    ; TAC: _t1171 = x == 3511
+    ; TAC: IF _t1171 GOTO L5
+    cmp ecx, 3511
+    je L5
+    ; TAC: _t1172 = x == 3514
+    ; TAC: IF _t1172 GOTO L5
+    cmp ecx, 3514
+    je L5
+    ; TAC: _t1173 = x == 3517
+    ; TAC: IF _t1173 GOTO L5
+    cmp ecx, 3517
+    je L5
+    ; TAC: _t1174 = x == 3520
+    ; TAC: IF _t1174 GOTO L5
+    cmp ecx, 3520
+    je L5
+    ; TAC: _t1175 = x == 3523
+    ; TAC: IF _t1175 GOTO L5
+    cmp ecx, 3523
+    je L5
+    ; TAC: _t1176 = x == 3526
+    ; TAC: IF _t1176 GOTO L5
+    cmp ecx, 3526
+    je L5
+    ; TAC: _t1177 = x == 3529
+    ; TAC: IF _t1177 GOTO L5
+    cmp ecx, 3529
+    je L5
+    ; TAC: _t1178 = x == 3532
+    ; TAC: IF _t1178 GOTO L5
+    cmp ecx, 3532
+    je L5
+    ; TAC: _t1179 = x == 3535
+    ; TAC: IF _t1179 GOTO L5
+    cmp ecx, 3535
+    je L5
+    ; TAC: _t1180 = x == 3538
+    ; TAC: IF _t1180 GOTO L5
+    cmp ecx, 3538
+    je L5
+    ; TAC: _t1181 = x == 3541
+    ; TAC: IF _t1181 GOTO L5
+    cmp ecx, 3541
+    je L5
+    ; TAC: _t1182 = x == 3544
+    ; TAC: IF _t1182 GOTO L5
+    cmp ecx, 3544
+    je L5
+    ; TAC: _t1183 = x == 3547
+    ; TAC: IF _t1183 GOTO L5
+    cmp ecx, 3547
+    je L5
+    ; TAC: _t1184 = x == 3550
+    ; TAC: IF _t1184 GOTO L5
+    cmp ecx, 3550
+    je L5
+    ; TAC: _t1185 = x == 3553
+    ; TAC: IF _t1185 GOTO L5
+    cmp ecx, 3553
+    je L5
+    ; TAC: _t1186 = x == 3556
+    ; TAC: IF _t1186 GOTO L5
+    cmp ecx, 3556
+    je L5
+    ; TAC: _t1187 = x == 3559
+    ; TAC: IF _t1187 GOTO L5
+    cmp ecx, 3559
+    je L5
+    ; TAC: _t1188 = x == 3562
+    ; TAC: IF _t1188 GOTO L5
+    cmp ecx, 3562
+    je L5
+    ; TAC: _t1189 = x == 3565
+    ; TAC: IF _t1189 GOTO L5
+    cmp ecx, 3565
+    je L5
+    ; TAC: _t1190 = x == 3568
+    ; TAC: IF _t1190 GOTO L5
+    cmp ecx, 3568
+    je L5
+    ; TAC: _t1191 = x == 3571
+    ; TAC: IF _t1191 GOTO L5
+    cmp ecx, 3571
+    je L5
+    ; TAC: _t1192 = x == 3574
+    ; TAC: IF _t1192 GOTO L5
+    cmp ecx, 3574
+    je L5
+    ; TAC: _t1193 = x == 3577
+    ; TAC: IF _t1193 GOTO L5
+    cmp ecx, 3577
+    je L5
+    ; TAC: _t1194 = x == 3580
+    ; TAC: IF _t1194 GOTO L5
+    cmp ecx, 3580
+    je L5
+    ; TAC: _t1195 = x == 3583
+    ; TAC: IF _t1195 GOTO L5
+    cmp ecx, 3583
+    je L5
+    ; TAC: _t1196 = x == 3586
+    ; TAC: IF _t1196 GOTO L5
+    cmp ecx, 3586
+    je L5
+    ; TAC: _t1197 = x == 3589
+    ; TAC: IF _t1197 GOTO L5
+    cmp ecx, 3589
+    je L5
+    ; TAC: _t1198 = x == 3592
+    ; TAC: IF _t1198 GOTO L5
+    cmp ecx, 3592
+    je L5
+    ; TAC: _t1199 = x == 3595
+    ; TAC: IF _t1199 GOTO L5
+    cmp ecx, 3595
+    je L5
+    ; TAC: _t1200 = x == 3598
+    ; TAC: IF _t1200 GOTO L5
+    cmp ecx, 3598
+    je L5
+    ; TAC: _t1201 = x == 3601
+    ; TAC: IF _t1201 GOTO L5
+    cmp ecx, 3601
+    je L5
+    ; TAC: _t1202 = x == 3604
+    ; TAC: IF _t1202 GOTO L5
+    cmp ecx, 3604
+    je L5
+    ; TAC: _t1203 = x == 3607
+    ; TAC: IF _t1203 GOTO L5
+    cmp ecx, 3607
+    je L5
+    ; TAC: _t1204 = x == 3610
+    ; TAC: IF _t1204 GOTO L5
+    cmp ecx, 3610
+    je L5
+    ; TAC: _t1205 = x == 3613
+    ; TAC: IF _t1205 GOTO L5
+    cmp ecx, 3613
+    je L5
+    ; TAC: _t1206 = x == 3616
+    ; TAC: IF _t1206 GOTO L5
+    cmp ecx, 3616
+    je L5
+    ; TAC: _t1207 = x == 3619
+    ; TAC: IF _t1207 GOTO L5
+    cmp ecx, 3619
+    je L5
+    ; TAC: _t1208 = x == 3622
+    ; TAC: IF _t1208 GOTO L5
+    cmp ecx, 3622
+    je L5
+    ; TAC: _t1209 = x == 3625
+    ; TAC: IF _t1209 GOTO L5
+    cmp ecx, 3625
+    je L5
+    ; TAC: _t1210 = x == 3628
+    ; TAC: IF _t1210 GOTO L5
+    cmp ecx, 3628
+    je L5
+    ; TAC: _t1211 = x == 3631
+    ; TAC: IF _t1211 GOTO L5
+    cmp ecx, 3631
+    je L5
+    ; TAC: _t1212 = x == 3634
+    ; TAC: IF _t1212 GOTO L5
+    cmp ecx, 3634
+    je L5
+    ; TAC: _t1213 = x == 3637
+    ; TAC: IF _t1213 GOTO L5
+    cmp ecx, 3637
+    je L5
+    ; TAC: _t1214 = x == 3640
+    ; TAC: IF _t1214 GOTO L5
+    cmp ecx, 3640
+    je L5
+    ; TAC: _t1215 = x == 3643
+    ; TAC: IF _t1215 GOTO L5
+    cmp ecx, 3643
+    je L5
+    ; TAC: _t1216 = x == 3646
+    ; TAC: IF _t1216 GOTO L5
+    cmp ecx, 3646
+    je L5
+    ; TAC: _t1217 = x == 3649
+    ; TAC: IF _t1217 GOTO L5
+    cmp ecx, 3649
+    je L5
+    ; TAC: _t1218 = x == 3652
+    ; TAC: IF _t1218 GOTO L5
+    cmp ecx, 3652
+    je L5
+    ; TAC: _t1219 = x == 3655
+    ; TAC: IF _t1219 GOTO L5
+    cmp ecx, 3655
+    je L5
+    ; TAC: _t1220 = x == 3658
+    ; TAC: IF _t1220 GOTO L5
+    cmp ecx, 3658
+    je L5
+    ; TAC: _t1221 = x == 3661
+    ; TAC: IF _t1221 GOTO L5
+    cmp ecx, 3661
+    je L5
+    ; TAC: _t1222 = x == 3664
+    ; TAC: IF _t1222 GOTO L5
+    cmp ecx, 3664
+    je L5
+    ; TAC: _t1223 = x == 3667
+    ; TAC: IF _t1223 GOTO L5
+    cmp ecx, 3667
+    je L5
+    ; TAC: _t1224 = x == 3670
+    ; TAC: IF _t1224 GOTO L5
+    cmp ecx, 3670
+    je L5
+    ; TAC: _t1225 = x == 3673
+    ; TAC: IF _t1225 GOTO L5
+    cmp ecx, 3673
+    je L5
+    ; TAC: _t1226 = x == 3676
+    ; TAC: IF _t1226 GOTO L5
+    cmp ecx, 3676
+    je L5
+    ; TAC: _t1227 = x == 3679
+    ; TAC: IF _t1227 GOTO L5
+    cmp ecx, 3679
+    je L5
+    ; TAC: _t1228 = x == 3682
+    ; TAC: IF _t1228 GOTO L5
+    cmp ecx, 3682
+    je L5
+    ; TAC: _t1229 = x == 3685
+    ; TAC: IF _t1229 GOTO L5
+    cmp ecx, 3685
+    je L5
+    ; TAC: _t1230 = x == 3688
+    ; TAC: IF _t1230 GOTO L5
+    cmp ecx, 3688
+    je L5
+    ; TAC: _t1231 = x == 3691
+    ; TAC: IF _t1231 GOTO L5
+    cmp ecx, 3691
+    je L5
+    ; TAC: _t1232 = x == 3694
+    ; TAC: IF _t1232 GOTO L5
+    cmp ecx, 3694
+    je L5
+    ; TAC: _t1233 = x == 3697
+    ; TAC: IF _t1233 GOTO L5
+    cmp ecx, 3697
+    je L5
+    ; TAC: _t1234 = x == 3700
+    ; TAC: IF _t1234 GOTO L5
+    cmp ecx, 3700
+    je L5
+    ; TAC: _t1235 = x == 3703
+    ; TAC: IF _t1235 GOTO L5
+    cmp ecx, 3703
+    je L5
+    ; TAC: _t1236 = x == 3706
+    ; TAC: IF _t1236 GOTO L5
+    cmp ecx, 3706
+    je L5
+    ; TAC: _t1237 = x == 3709
+    ; TAC: IF _t1237 GOTO L5
+    cmp ecx, 3709
+    je L5
+    ; TAC: _t1238 = x == 3712
+    ; TAC: IF _t1238 GOTO L5
+    cmp ecx, 3712
+    je L5
+    ; TAC: _t1239 = x == 3715
+    ; TAC: IF _t1239 GOTO L5
+    cmp ecx, 3715
+    je L5
+    ; TAC: _t1240 = x == 3718
+    ; TAC: IF _t1240 GOTO L5
+    cmp ecx, 3718
+    je L5
+    ; TAC: _t1241 = x == 3721
+    ; TAC: IF _t1241 GOTO L5
+    cmp ecx, 3721
+    je L5
+    ; TAC: _t1242 = x == 3724
+    ; TAC: IF _t1242 GOTO L5
+    cmp ecx, 3724
+    je L5
+    ; TAC: _t1243 = x == 3727
+    ; TAC: IF _t1243 GOTO L5
+    cmp ecx, 3727
+    je L5
+    ; TAC: _t1244 = x == 3730
+    ; TAC: IF _t1244 GOTO L5
+    cmp ecx, 3730
+    je L5
+    ; TAC: _t1245 = x == 3733
+    ; TAC: IF _t1245 GOTO L5
+    cmp ecx, 3733
+    je L5
+    ; TAC: _t1246 = x == 3736
+    ; TAC: IF _t1246 GOTO L5
+    cmp ecx, 3736
+    je L5
+    ; TAC: _t1247 = x == 3739
+    ; TAC: IF _t1247 GOTO L5
+    cmp ecx, 3739
+    je L5
+    ; TAC: _t1248 = x == 3742
+    ; TAC: IF _t1248 GOTO L5
+    cmp ecx, 3742
+    je L5
+    ; TAC: _t1249 = x == 3745
+    ; TAC: IF _t1249 GOTO L5
+    cmp ecx, 3745
+    je L5
+    ; TAC: _t1250 = x == 3748
+    ; TAC: IF _t1250 GOTO L5
+    cmp ecx, 3748
+    je L5
+    ; TAC: _t1251 = x == 3751
+    ; TAC: IF _t1251 GOTO L5
+    cmp ecx, 3751
+    je L5
+    ; TAC: _t1252 = x == 3754
+    ; TAC: IF _t1252 GOTO L5
+    cmp ecx, 3754
+    je L5
+    ; TAC: _t1253 = x == 3757
+    ; TAC: IF _t1253 GOTO L5
+    cmp ecx, 3757
+    je L5
+    ; TAC: _t1254 = x == 3760
+    ; TAC: IF _t1254 GOTO L5
+    cmp ecx, 3760
+    je L5
+    ; TAC: _t1255 = x == 3763
+    ; TAC: IF _t1255 GOTO L5
+    cmp ecx, 3763
+    je L5
+    ; TAC: _t1256 = x == 3766
+    ; TAC: IF _t1256 GOTO L5
+    cmp ecx, 3766
+    je L5
+    ; TAC: _t1257 = x == 3769
+    ; TAC: IF _t1257 GOTO L5
+    cmp ecx, 3769
+    je L5
+    ; TAC: _t1258 = x == 3772
+    ; TAC: IF _t1258 GOTO L5
+    cmp ecx, 3772
+    je L5
+    ; TAC: _t1259 = x == 3775
+    ; TAC: IF _t1259 GOTO L5
+    cmp ecx, 3775
+    je L5
+    ; TAC: _t1260 = x == 3778
+    ; TAC: IF _t1260 GOTO L5
+    cmp ecx, 3778
+    je L5
+    ; TAC: _t1261 = x == 3781
+    ; TAC: IF _t1261 GOTO L5
+    cmp ecx, 3781
+    je L5
+    ; TAC: _t1262 = x == 3784
+    ; TAC: IF _t1262 GOTO L5
+    cmp ecx, 3784
+    je L5
+    ; TAC: _t1263 = x == 3787
+    ; TAC: IF _t1263 GOTO L5
+    cmp ecx, 3787
+    je L5
+    ; TAC: _t1264 = x == 3790
+    ; TAC: IF _t1264 GOTO L5
+    cmp ecx, 3790
+    je L5
+    ; TAC: _t1265 = x == 3793
+    ; TAC: IF _t1265 GOTO L5
+    cmp ecx, 3793
+    je L5
+    ; TAC: _t1266 = x == 3796
+    ; TAC: IF _t1266 GOTO L5
+    cmp ecx, 3796
+    je L5
+    ; TAC: _t1267 = x == 3799
+    ; TAC: IF _t1267 GOTO L5
+    cmp ecx, 3799
+    je L5
+    ; TAC: _t1268 = x == 3802
+    ; TAC: IF _t1268 GOTO L5
+    cmp ecx, 3802
+    je L5
+    ; TAC: _t1269 = x == 3805
+    ; TAC: IF _t1269 GOTO L5
+    cmp ecx, 3805
+    je L5
+    ; TAC: _t1270 = x == 3808
+    ; TAC: IF _t1270 GOTO L5
+    cmp ecx, 3808
+    je L5
+    ; TAC: _t1271 = x == 3811
+    ; TAC: IF _t1271 GOTO L5
+    cmp ecx, 3811
+    je L5
+    ; TAC: _t1272 = x == 3814
+    ; TAC: IF _t1272 GOTO L5
+    cmp ecx, 3814
+    je L5
+    ; TAC: _t1273 = x == 3817
+    ; TAC: IF _t1273 GOTO L5
+    cmp ecx, 3817
+    je L5
+    ; TAC: _t1274 = x == 3820
+    ; TAC: IF _t1274 GOTO L5
+    cmp ecx, 3820
+    je L5
+    ; TAC: _t1275 = x == 3823
+    ; TAC: IF _t1275 GOTO L5
+    cmp ecx, 3823
+    je L5
+    ; TAC: _t1276 = x == 3826
+    ; TAC: IF _t1276 GOTO L5
+    cmp ecx, 3826
+    je L5
+    ; TAC: _t1277 = x == 3829
+    ; TAC: IF _t1277 GOTO L5
+    cmp ecx, 3829
+    je L5
+    ; TAC: _t1278 = x == 3832
+    ; TAC: IF _t1278 GOTO L5
+    cmp ecx, 3832
+    je L5
+    ; TAC: _t1279 = x == 3835
+    ; TAC: IF _t1279 GOTO L5
+    cmp ecx, 3835
+    je L5
+    ; TAC: _t1280 = x == 3838
+    ; TAC: IF _t1280 GOTO L5
+    cmp ecx, 3838
+    je L5
+    ; TAC: _t1281 = x == 3841
+    ; TAC: IF _t1281 GOTO L5
+    cmp ecx, 3841
+    je L5
+    ; TAC: _t1282 = x == 3844
+    ; TAC: IF _t1282 GOTO L5
+    cmp ecx, 3844
+    je L5
+    ; TAC: _t1283 = x == 3847
+    ; TAC: IF _t1283 GOTO L5
+    cmp ecx, 3847
+    je L5
+    ; TAC: _t1284 = x == 3850
+    ; TAC: IF _t1284 GOTO L5
+    cmp ecx, 3850
+    je L5
+    ; TAC: _t1285 = x == 3853
+    ; TAC: IF _t1285 GOTO L5
+    cmp ecx, 3853
+    je L5
+    ; TAC: _t1286 = x == 3856
+    ; TAC: IF _t1286 GOTO L5
+    cmp ecx, 3856
+    je L5
+    ; TAC: _t1287 = x == 3859
+    ; TAC: IF _t1287 GOTO L5
+    cmp ecx, 3859
+    je L5
+    ; TAC: _t1288 = x == 3862
+    ; TAC: IF _t1288 GOTO L5
+    cmp ecx, 3862
+    je L5
+    ; TAC: _t1289 = x == 3865
+    ; TAC: IF _t1289 GOTO L5
+    cmp ecx, 3865
+    je L5
+    ; TAC: _t1290 = x == 3868
+    ; TAC: IF _t1290 GOTO L5
+    cmp ecx, 3868
+    je L5
+    ; TAC: _t1291 = x == 3871
+    ; TAC: IF _t1291 GOTO L5
+    cmp ecx, 3871
+    je L5
+    ; TAC: _t1292 = x == 3874
+    ; TAC: IF _t1292 GOTO L5
+    cmp ecx, 3874
+    je L5
+    ; TAC: _t1293 = x == 3877
+    ; TAC: IF _t1293 GOTO L5
+    cmp ecx, 3877
+    je L5
+    ; TAC: _t1294 = x == 3880
+    ; TAC: IF _t1294 GOTO L5
+    cmp ecx, 3880
+    je L5
+    ; TAC: _t1295 = x == 3883
+    ; TAC: IF _t1295 GOTO L5
+    cmp ecx, 3883
+    je L5
+    ; TAC: _t1296 = x == 3886
+    ; TAC: IF _t1296 GOTO L5
+    cmp ecx, 3886
+    je L5
+    ; TAC: _t1297 = x == 3889
+    ; TAC: IF _t1297 GOTO L5
+    cmp ecx, 3889
+    je L5
+    ; TAC: _t1298 = x == 3892
+    ; TAC: IF _t1298 GOTO L5
+    cmp ecx, 3892
+    je L5
+    ; TAC: _t1299 = x == 3895
+    ; TAC: IF _t1299 GOTO L5
+    cmp ecx, 3895
+    je L5
+    ; TAC: _t1300 = x == 3898
+    ; TAC: IF _t1300 GOTO L5
+    cmp ecx, 3898
+    je L5
+    ; TAC: _t1301 = x == 3901
+    ; TAC: IF _t1301 GOTO L5
+    cmp ecx, 3901
+    je L5
+    ; TAC: _t1302 = x == 3904
+    ; TAC: IF _t1302 GOTO L5
+    cmp ecx, 3904
+    je L5
+    ; TAC: _t1303 = x == 3907
+    ; TAC: IF _t1303 GOTO L5
+    cmp ecx, 3907
+    je L5
+    ; TAC: _t1304 = x == 3910
+    ; TAC: IF _t1304 GOTO L5
+    cmp ecx, 3910
+    je L5
+    ; TAC: _t1305 = x == 3913
+    ; TAC: IF _t1305 GOTO L5
+    cmp ecx, 3913
+    je L5
+    ; TAC: _t1306 = x == 3916
+    ; TAC: IF _t1306 GOTO L5
+    cmp ecx, 3916
+    je L5
+    ; TAC: _t1307 = x == 3919
+    ; TAC: IF _t1307 GOTO L5
+    cmp ecx, 3919
+    je L5
+    ; TAC: _t1308 = x == 3922
+    ; TAC: IF _t1308 GOTO L5
+    cmp ecx, 3922
+    je L5
+    ; TAC: _t1309 = x == 3925
+    ; TAC: IF _t1309 GOTO L5
+    cmp ecx, 3925
+    je L5
+    ; TAC: _t1310 = x == 3928
+    ; TAC: IF _t1310 GOTO L5
+    cmp ecx, 3928
+    je L5
+    ; TAC: _t1311 = x == 3931
+    ; TAC: IF _t1311 GOTO L5
+    cmp ecx, 3931
+    je L5
+    ; TAC: _t1312 = x == 3934
+    ; TAC: IF _t1312 GOTO L5
+    cmp ecx, 3934
+    je L5
+    ; TAC: _t1313 = x == 3937
+    ; TAC: IF _t1313 GOTO L5
+    cmp ecx, 3937
+    je L5
+    ; TAC: _t1314 = x == 3940
+    ; TAC: IF _t1314 GOTO L5
+    cmp ecx, 3940
+    je L5
+    ; TAC: _t1315 = x == 3943
+    ; TAC: IF _t1315 GOTO L5
+    cmp ecx, 3943
+    je L5
+    ; TAC: _t1316 = x == 3946
+    ; TAC: IF _t1316 GOTO L5
+    cmp ecx, 3946
+    je L5
+    ; TAC: _t1317 = x == 3949
+    ; TAC: IF _t1317 GOTO L5
+    cmp ecx, 3949
+    je L5
+    ; TAC: _t1318 = x == 3952
+    ; TAC: IF _t1318 GOTO L5
+    cmp ecx, 3952
+    je L5
+    ; TAC: _t1319 = x == 3955
+    ; TAC: IF _t1319 GOTO L5
+    cmp ecx, 3955
+    je L5
+    ; TAC: _t1320 = x == 3958
+    ; TAC: IF _t1320 GOTO L5
+    cmp ecx, 3958
+    je L5
+    ; TAC: _t1321 = x == 3961
+    ; TAC: IF _t1321 GOTO L5
+    cmp ecx, 3961
+    je L5
+    ; TAC: _t1322 = x == 3964
+    ; TAC: IF _t1322 GOTO L5
+    cmp ecx, 3964
+    je L5
+    ; TAC: _t1323 = x == 3967
+    ; TAC: IF _t1323 GOTO L5
+    cmp ecx, 3967
+    je L5
+    ; TAC: _t1324 = x == 3970
+    ; TAC: IF _t1324 GOTO L5
+    cmp ecx, 3970
+    je L5
+    ; TAC: _t1325 = x == 3973
+    ; TAC: IF _t1325 GOTO L5
+    cmp ecx, 3973
+    je L5
+    ; TAC: _t1326 = x == 3976
+    ; TAC: IF _t1326 GOTO L5
+    cmp ecx, 3976
+    je L5
+    ; TAC: _t1327 = x == 3979
+    ; TAC: IF _t1327 GOTO L5
+    cmp ecx, 3979
+    je L5
+    ; TAC: _t1328 = x == 3982
+    ; TAC: IF _t1328 GOTO L5
+    cmp ecx, 3982
+    je L5
+    ; TAC: _t1329 = x == 3985
+    ; TAC: IF _t1329 GOTO L5
+    cmp ecx, 3985
+    je L5
+    ; TAC: _t1330 = x == 3988
+    ; TAC: IF _t1330 GOTO L5
+    cmp ecx, 3988
+    je L5
+    ; TAC: _t1331 = x == 3991
+    ; TAC: IF _t1331 GOTO L5
+    cmp ecx, 3991
+    je L5
+    ; TAC: _t1332 = x == 3994
+    ; TAC: IF _t1332 GOTO L5
+    cmp ecx, 3994
+    je L5
+    ; TAC: _t1333 = x == 3997
+    ; TAC: IF _t1333 GOTO L5
+    cmp ecx, 3997
+    je L5
+    ; TAC: _t1334 = x == 4000
+    ; TAC: IF _t1334 GOTO L5
+    cmp ecx, 4000
+    je L5
+    ; TAC: _t1335 = x == 4003
+    ; TAC: IF _t1335 GOTO L5
+    cmp ecx, 4003
+    je L5
+    ; TAC: _t1336 = x == 4006
+    ; TAC: IF _t1336 GOTO L5
+    cmp ecx, 4006
+    je L5
+    ; TAC: _t1337 = x == 4009
+    ; TAC: IF _t1337 GOTO L5
+    cmp ecx, 4009
+    je L5
+    ; TAC: _t1338 = x == 4012
+    ; TAC: IF _t1338 GOTO L5
+    cmp ecx, 4012
+    je L5
+    ; TAC: _t1339 = x == 4015
+    ; TAC: IF _t1339 GOTO L5
+    cmp ecx, 4015
+    je L5
+    ; TAC: _t1340 = x == 4018
+    ; TAC: IF _t1340 GOTO L5
+    cmp ecx, 4018
+    je L5
+    ; TAC: _t1341 = x == 4021
+    ; TAC: IF _t1341 GOTO L5
+    cmp ecx, 4021
+    je L5
+    ; TAC: _t1342 = x == 4024
+    ; TAC: IF _t1342 GOTO L5
+    cmp ecx, 4024
+    je L5
+    ; TAC: _t1343 = x == 4027
+    ; TAC: IF _t1343 GOTO L5
+    cmp ecx, 4027
+    je L5
+    ; TAC: _t1344 = x == 4030
+    ; TAC: IF _t1344 GOTO L5
+    cmp ecx, 4030
+    je L5
+    ; TAC: _t1345 = x == 4033
+    ; TAC: IF _t1345 GOTO L5
+    cmp ecx, 4033
+    je L5
+    ; TAC: _t1346 = x == 4036
+    ; TAC: IF _t1346 GOTO L5
+    cmp ecx, 4036
+    je L5
+    ; TAC: _t1347 = x == 4039
+    ; TAC: IF _t1347 GOTO L5
+    cmp ecx, 4039
+    je L5
+    ; TAC: _t1348 = x == 4042
+    ; TAC: IF _t1348 GOTO L5
+    cmp ecx, 4042
+    je L5
+    ; TAC: _t1349 = x == 4045
+    ; TAC: IF _t1349 GOTO L5
+    cmp ecx, 4045
+    je L5
+    ; TAC: _t1350 = x == 4048
+    ; TAC: IF _t1350 GOTO L5
+    cmp ecx, 4048
+    je L5
+    ; TAC: _t1351 = x == 4051
+    ; TAC: IF _t1351 GOTO L5
+    cmp ecx, 4051
+    je L5
+    ; TAC: _t1352 = x == 4054
+    ; TAC: IF _t1352 GOTO L5
+    cmp ecx, 4054
+    je L5
+    ; TAC: _t1353 = x == 4057
+    ; TAC: IF _t1353 GOTO L5
+    cmp ecx, 4057
+    je L5
+    ; TAC: _t1354 = x == 4060
+    ; TAC: IF _t1354 GOTO L5
+    cmp ecx, 4060
+    je L5
+    ; TAC: _t1355 = x == 4063
+    ; TAC: IF _t1355 GOTO L5
+    cmp ecx, 4063
+    je L5
+    ; TAC: _t1356 = x == 4066
+    ; TAC: IF _t1356 GOTO L5
+    cmp ecx, 4066
+    je L5
+    ; TAC: _t1357 = x == 4069
+    ; TAC: IF _t1357 GOTO L5
+    cmp ecx, 4069
+    je L5
+    ; TAC: _t1358 = x == 4072
+    ; TAC: IF _t1358 GOTO L5
+    cmp ecx, 4072
+    je L5
+    ; TAC: _t1359 = x == 4075
+    ; TAC: IF _t1359 GOTO L5
+    cmp ecx, 4075
+    je L5
+    ; TAC: _t1360 = x == 4078
+    ; TAC: IF _t1360 GOTO L5
+    cmp ecx, 4078
+    je L5
+    ; TAC: _t1361 = x == 4081
+    ; TAC: IF _t1361 GOTO L5
+    cmp ecx, 4081
+    je L5
+    ; TAC: _t1362 = x == 4084
+    ; TAC: IF _t1362 GOTO L5
+    cmp ecx, 4084
+    je L5
+    ; TAC: _t1363 = x == 4087
+    ; TAC: IF _t1363 GOTO L5
+    cmp ecx, 4087
+    je L5
+    ; TAC: _t1364 = x == 4090
+    ; TAC: IF _t1364 GOTO L5
+    cmp ecx, 4090
+    je L5
+    ; TAC: _t1365 = x == 4093
+    ; TAC: IF _t1365 GOTO L5
+    cmp ecx, 4093
+    je L5
+    ; TAC: _t1366 = x == 4096
+    ; TAC: IF _t1366 GOTO L5
+    cmp ecx, 4096
+    je L5
+    ; TAC: _t1367 = x == 4099
+    ; TAC: IF _t1367 GOTO L5
+    cmp ecx, 4099
+    je L5
+    ; TAC: _t1368 = x == 4102
+    ; TAC: IF _t1368 GOTO L5
+    cmp ecx, 4102
+    je L5
+    ; TAC: _t1369 = x == 4105
+    ; TAC: IF _t1369 GOTO L5
+    cmp ecx, 4105
+    je L5
+    ; TAC: _t1370 = x == 4108
+    ; TAC: IF _t1370 GOTO L5
+    cmp ecx, 4108
+    je L5
+    ; TAC: _t1371 = x == 4111
+    ; TAC: IF _t1371 GOTO L5
+    cmp ecx, 4111
+    je L5
+    ; TAC: _t1372 = x == 4114
+    ; TAC: IF _t1372 GOTO L5
+    cmp ecx, 4114
+    je L5
+    ; TAC: _t1373 = x == 4117
+    ; TAC: IF _t1373 GOTO L5
+    cmp ecx, 4117
+    je L5
+    ; TAC: _t1374 = x == 4120
+    ; TAC: IF _t1374 GOTO L5
+    cmp ecx, 4120
+    je L5
+    ; TAC: _t1375 = x == 4123
+    ; TAC: IF _t1375 GOTO L5
+    cmp ecx, 4123
+    je L5
+    ; TAC: _t1376 = x == 4126
+    ; TAC: IF _t1376 GOTO L5
+    cmp ecx, 4126
+    je L5
+    ; TAC: _t1377 = x == 4129
+    ; TAC: IF _t1377 GOTO L5
+    cmp ecx, 4129
+    je L5
+    ; TAC: _t1378 = x == 4132
+    ; TAC: IF _t1378 GOTO L5
+    cmp ecx, 4132
+    je L5
+    ; TAC: _t1379 = x == 4135
+    ; TAC: IF _t1379 GOTO L5
+    cmp ecx, 4135
+    je L5
+    ; TAC: _t1380 = x == 4138
+    ; TAC: IF _t1380 GOTO L5
+    cmp ecx, 4138
+    je L5
+    ; TAC: _t1381 = x == 4141
+    ; TAC: IF _t1381 GOTO L5
+    cmp ecx, 4141
+    je L5
+    ; TAC: _t1382 = x == 4144
+    ; TAC: IF _t1382 GOTO L5
+    cmp ecx, 4144
+    je L5
+    ; TAC: _t1383 = x == 4147
+    ; TAC: IF _t1383 GOTO L5
+    cmp ecx, 4147
+    je L5
+    ; TAC: _t1384 = x == 4150
+    ; TAC: IF _t1384 GOTO L5
+    cmp ecx, 4150
+    je L5
+    ; TAC: _t1385 = x == 4153
+    ; TAC: IF _t1385 GOTO L5
+    cmp ecx, 4153
+    je L5
+    ; TAC: _t1386 = x == 4156
+    ; TAC: IF _t1386 GOTO L5
+    cmp ecx, 4156
+    je L5
+    ; TAC: _t1387 = x == 4159
+    ; TAC: IF _t1387 GOTO L5
+    cmp ecx, 4159
+    je L5
+    ; TAC: _t1388 = x == 4162
+    ; TAC: IF _t1388 GOTO L5
+    cmp ecx, 4162
+    je L5
+    ; TAC: _t1389 = x == 4165
+    ; TAC: IF _t1389 GOTO L5
+    cmp ecx, 4165
+    je L5
+    ; TAC: _t1390 = x == 4168
+    ; TAC: IF _t1390 GOTO L5
+    cmp ecx, 4168
+    je L5
+    ; TAC: _t1391 = x == 4171
+    ; TAC: IF _t1391 GOTO L5
+    cmp ecx, 4171
+    je L5
+    ; TAC: _t1392 = x == 4174
+    ; TAC: IF _t1392 GOTO L5
+    cmp ecx, 4174
+    je L5
+    ; TAC: _t1393 = x == 4177
+    ; TAC: IF _t1393 GOTO L5
+    cmp ecx, 4177
+    je L5
+    ; TAC: _t1394 = x == 4180
+    ; TAC: IF _t1394 GOTO L5
+    cmp ecx, 4180
+    je L5
+    ; TAC: _t1395 = x == 4183
+    ; TAC: IF _t1395 GOTO L5
+    cmp ecx, 4183
+    je L5
+    ; TAC: _t1396 = x == 4186
+    ; TAC: IF _t1396 GOTO L5
+    cmp ecx, 4186
+    je L5
+    ; TAC: _t1397 = x == 4189
+    ; TAC: IF _t1397 GOTO L5
+    cmp ecx, 4189
+    je L5
+    ; TAC: _t1398 = x == 4192
+    ; TAC: IF _t1398 GOTO L5
+    cmp ecx, 4192
+    je L5
+    ; TAC: _t1399 = x == 4195
+    ; TAC: IF _t1399 GOTO L5
+    cmp ecx, 4195
+    je L5
+    ; TAC: _t1400 = x == 4198
+    ; TAC: IF _t1400 GOTO L5
+    cmp ecx, 4198
+    je L5
+    ; TAC: _t1401 = x == 4201
+    ; TAC: IF _t1401 GOTO L5
+    cmp ecx, 4201
+    je L5
+    ; TAC: _t1402 = x == 4204
+    ; TAC: IF _t1402 GOTO L5
+    cmp ecx, 4204
+    je L5
+    ; TAC: _t1403 = x == 4207
+    ; TAC: IF _t1403 GOTO L5
+    cmp ecx, 4207
+    je L5
+    ; TAC: _t1404 = x == 4210
+    ; TAC: IF _t1404 GOTO L5
+    cmp ecx, 4210
+    je L5
+    ; TAC: _t1405 = x == 4213
+    ; TAC: IF _t1405 GOTO L5
+    cmp ecx, 4213
+    je L5
+    ; TAC: _t1406 = x == 4216
+    ; TAC: IF _t1406 GOTO L5
+    cmp ecx, 4216
+    je L5
+    ; TAC: _t1407 = x == 4219
+    ; TAC: IF _t1407 GOTO L5
+    cmp ecx, 4219
+    je L5
+    ; TAC: _t1408 = x == 4222
+    ; TAC: IF _t1408 GOTO L5
+    cmp ecx, 4222
+    je L5
+    ; TAC: _t1409 = x == 4225
+    ; TAC: IF _t1409 GOTO L5
+    cmp ecx, 4225
+    je L5
+    ; TAC: _t1410 = x == 4228
+    ; TAC: IF _t1410 GOTO L5
+    cmp ecx, 4228
+    je L5
+    ; TAC: _t1411 = x == 4231
+    ; TAC: IF _t1411 GOTO L5
+    cmp ecx, 4231
+    je L5
+    ; TAC: _t1412 = x == 4234
+    ; TAC: IF _t1412 GOTO L5
+    cmp ecx, 4234
+    je L5
+    ; TAC: _t1413 = x == 4237
+    ; TAC: IF _t1413 GOTO L5
+    cmp ecx, 4237
+    je L5
+    ; TAC: _t1414 = x == 4240
+    ; TAC: IF _t1414 GOTO L5
+    cmp ecx, 4240
+    je L5
+    ; TAC: _t1415 = x == 4243
+    ; TAC: IF _t1415 GOTO L5
+    cmp ecx, 4243
+    je L5
+    ; TAC: _t1416 = x == 4246
+    ; TAC: IF _t1416 GOTO L5
+    cmp ecx, 4246
+    je L5
+    ; TAC: _t1417 = x == 4249
+    ; TAC: IF _t1417 GOTO L5
+    cmp ecx, 4249
+    je L5
+    ; TAC: _t1418 = x == 4252
+    ; TAC: IF _t1418 GOTO L5
+    cmp ecx, 4252
+    je L5
+    ; TAC: _t1419 = x == 4255
+    ; TAC: IF _t1419 GOTO L5
+    cmp ecx, 4255
+    je L5
+    ; TAC: _t1420 = x == 4258
+    ; TAC: IF _t1420 GOTO L5
+    cmp ecx, 4258
+    je L5
+    ; TAC: _t1421 = x == 4261
+    ; TAC: IF _t1421 GOTO L5
+    cmp ecx, 4261
+    je L5
+    ; TAC: _t1422 = x == 4264
+    ; TAC: IF _t1422 GOTO L5
+    cmp ecx, 4264
+    je L5
+    ; TAC: _t1423 = x == 4267
+    ; TAC: IF _t1423 GOTO L5
+    cmp ecx, 4267
+    je L5
+    ; TAC: _t1424 = x == 4270
+    ; TAC: IF _t1424 GOTO L5
+    cmp ecx, 4270
+    je L5
+    ; TAC: _t1425 = x == 4273
+    ; TAC: IF _t1425 GOTO L5
+    cmp ecx, 4273
+    je L5
+    ; TAC: _t1426 = x == 4276
+    ; TAC: IF _t1426 GOTO L5
+    cmp ecx, 4276
+    je L5
+    ; TAC: _t1427 = x == 4279
+    ; TAC: IF _t1427 GOTO L5
+    cmp ecx, 4279
+    je L5
+    ; TAC: _t1428 = x == 4282
+    ; TAC: IF _t1428 GOTO L5
+    cmp ecx, 4282
+    je L5
+    ; TAC: _t1429 = x == 4285
+    ; TAC: IF _t1429 GOTO L5
+    cmp ecx, 4285
+    je L5
+    ; TAC: _t1430 = x == 4288
+    ; TAC: IF _t1430 GOTO L5
+    cmp ecx, 4288
+    je L5
+    ; TAC: _t1431 = x == 4291
+    ; TAC: IF _t1431 GOTO L5
+    cmp ecx, 4291
+    je L5
+    ; TAC: _t1432 = x == 4294
+    ; TAC: IF _t1432 GOTO L5
+    cmp ecx, 4294
+    je L5
+    ; TAC: _t1433 = x == 4297
+    ; TAC: IF _t1433 GOTO L5
+    cmp ecx, 4297
+    je L5
+    ; TAC: _t1434 = x == 4300
+    ; TAC: IF _t1434 GOTO L5
+    cmp ecx, 4300
+    je L5
+    ; TAC: _t1435 = x == 4303
+    ; TAC: IF _t1435 GOTO L5
+    cmp ecx, 4303
+    je L5
+    ; TAC: _t1436 = x == 4306
+    ; TAC: IF _t1436 GOTO L5
+    cmp ecx, 4306
+    je L5
+    ; TAC: _t1437 = x == 4309
+    ; TAC: IF _t1437 GOTO L5
+    cmp ecx, 4309
+    je L5
+    ; TAC: _t1438 = x == 4312
+    ; TAC: IF _t1438 GOTO L5
+    cmp ecx, 4312
+    je L5
+    ; TAC: _t1439 = x == 4315
+    ; TAC: IF _t1439 GOTO L5
+    cmp ecx, 4315
+    je L5
+    ; TAC: _t1440 = x == 4318
+    ; TAC: IF _t1440 GOTO L5
+    cmp ecx, 4318
+    je L5
+    ; TAC: _t1441 = x == 4321
+    ; TAC: IF _t1441 GOTO L5
+    cmp ecx, 4321
+    je L5
+    ; TAC: _t1442 = x == 4324
+    ; TAC: IF _t1442 GOTO L5
+    cmp ecx, 4324
+    je L5
+    ; TAC: _t1443 = x == 4327
+    ; TAC: IF _t1443 GOTO L5
+    cmp ecx, 4327
+    je L5
+    ; TAC: _t1444 = x == 4330
+    ; TAC: IF _t1444 GOTO L5
+    cmp ecx, 4330
+    je L5
+    ; TAC: _t1445 = x == 4333
+    ; TAC: IF _t1445 GOTO L5
+    cmp ecx, 4333
+    je L5
+    ; TAC: _t1446 = x == 4336
+    ; TAC: IF _t1446 GOTO L5
+    cmp ecx, 4336
+    je L5
+    ; TAC: _t1447 = x == 4339
+    ; TAC: IF _t1447 GOTO L5
+    cmp ecx, 4339
+    je L5
+    ; TAC: _t1448 = x == 4342
+    ; TAC: IF _t1448 GOTO L5
+    cmp ecx, 4342
+    je L5
+    ; TAC: _t1449 = x == 4345
+    ; TAC: IF _t1449 GOTO L5
+    cmp ecx, 4345
+    je L5
+    ; TAC: _t1450 = x == 4348
+    ; TAC: IF _t1450 GOTO L5
+    cmp ecx, 4348
+    je L5
+    ; TAC: _t1451 = x == 4351
+    ; TAC: IF _t1451 GOTO L5
+    cmp ecx, 4351
+    je L5
+    ; TAC: _t1452 = x == 4354
+    ; TAC: IF _t1452 GOTO L5
+    cmp ecx, 4354
+    je L5
+    ; TAC: _t1453 = x == 4357
+    ; TAC: IF _t1453 GOTO L5
+    cmp ecx, 4357
+    je L5
+    ; TAC: _t1454 = x == 4360
+    ; TAC: IF _t1454 GOTO L5
+    cmp ecx, 4360
+    je L5
+    ; TAC: _t1455 = x == 4363
+    ; TAC: IF _t1455 GOTO L5
+    cmp ecx, 4363
+    je L5
+    ; TAC: _t1456 = x == 4366
+    ; TAC: IF _t1456 GOTO L5
+    cmp ecx, 4366
+    je L5
+    ; TAC: _t1457 = x == 4369
+    ; TAC: IF _t1457 GOTO L5
+    cmp ecx, 4369
+    je L5
+    ; TAC: _t1458 = x == 4372
+    ; TAC: IF _t1458 GOTO L5
+    cmp ecx, 4372
+    je L5
+    ; TAC: _t1459 = x == 4375
+    ; TAC: IF _t1459 GOTO L5
+    cmp ecx, 4375
+    je L5
+    ; TAC: _t1460 = x == 4378
+    ; TAC: IF _t1460 GOTO L5
+    cmp ecx, 4378
+    je L5
+    ; TAC: _t1461 = x == 4381
+    ; TAC: IF _t1461 GOTO L5
+    cmp ecx, 4381
+    je L5
+    ; TAC: _t1462 = x == 4384
+    ; TAC: IF _t1462 GOTO L5
+    cmp ecx, 4384
+    je L5
+    ; TAC: _t1463 = x == 4387
+    ; TAC: IF _t1463 GOTO L5
+    cmp ecx, 4387
+    je L5
+    ; TAC: _t1464 = x == 4390
+    ; TAC: IF _t1464 GOTO L5
+    cmp ecx, 4390
+    je L5
+    ; TAC: _t1465 = x == 4393
+    ; TAC: IF _t1465 GOTO L5
+    cmp ecx, 4393
+    je L5
+    ; TAC: _t1466 = x == 4396
+    ; TAC: IF _t1466 GOTO L5
+    cmp ecx, 4396
+    je L5
+    ; TAC: _t1467 = x == 4399
+    ; TAC: IF _t1467 GOTO L5
+    cmp ecx, 4399
+    je L5
+    ; TAC: _t1468 = x == 4402
+    ; TAC: IF _t1468 GOTO L5
+    cmp ecx, 4402
+    je L5
+    ; TAC: _t1469 = x == 4405
+    ; TAC: IF _t1469 GOTO L5
+    cmp ecx, 4405
+    je L5
+    ; TAC: _t1470 = x == 4408
+    ; TAC: IF _t1470 GOTO L5
+    cmp ecx, 4408
+    je L5
+    ; TAC: _t1471 = x == 4411
+    ; TAC: IF _t1471 GOTO L5
+    cmp ecx, 4411
+    je L5
+    ; TAC: _t1472 = x == 4414
+    ; TAC: IF _t1472 GOTO L5
+    cmp ecx, 4414
+    je L5
+    ; TAC: _t1473 = x == 4417
+    ; TAC: IF _t1473 GOTO L5
+    cmp ecx, 4417
+    je L5
+    ; TAC: _t1474 = x == 4420
+    ; TAC: IF _t1474 GOTO L5
+    cmp ecx, 4420
+    je L5
+    ; TAC: _t1475 = x == 4423
+    ; TAC: IF _t1475 GOTO L5
+    cmp ecx, 4423
+    je L5
+    ; TAC: _t1476 = x == 4426
+    ; TAC: IF _t1476 GOTO L5
+    cmp ecx, 4426
+    je L5
+    ; TAC: _t1477 = x == 4429
+    ; TAC: IF _t1477 GOTO L5
+    cmp ecx, 4429
+    je L5
+    ; TAC: _t1478 = x == 4432
+    ; TAC: IF _t1478 GOTO L5
+    cmp ecx, 4432
+    je L5
+    ; TAC: _t1479 = x == 4435
+    ; TAC: IF _t1479 GOTO L5
+    cmp ecx, 4435
+    je L5
+    ; TAC: _t1480 = x == 4438
+    ; TAC: IF _t1480 GOTO L5
+    cmp ecx, 4438
+    je L5
+    ; TAC: _t1481 = x == 4441
+    ; TAC: IF _t1481 GOTO L5
+    cmp ecx, 4441
+    je L5
+    ; TAC: _t1482 = x == 4444
+    ; TAC: IF _t1482 GOTO L5
+    cmp ecx, 4444
+    je L5
+    ; TAC: _t1483 = x == 4447
+    ; TAC: IF _t1483 GOTO L5
+    cmp ecx, 4447
+    je L5
+    ; TAC: _t1484 = x == 4450
+    ; TAC: IF _t1484 GOTO L5
+    cmp ecx, 4450
+    je L5
+    ; TAC: _t1485 = x == 4453
+    ; TAC: IF _t1485 GOTO L5
+    cmp ecx, 4453
+    je L5
+    ; TAC: _t1486 = x == 4456
+    ; TAC: IF _t1486 GOTO L5
+    cmp ecx, 4456
+    je L5
+    ; TAC: _t1487 = x == 4459
+    ; TAC: IF _t1487 GOTO L5
+    cmp ecx, 4459
+    je L5
+    ; TAC: _t1488 = x == 4462
+    ; TAC: IF _t1488 GOTO L5
+    cmp ecx, 4462
+    je L5
+    ; TAC: _t1489 = x == 4465
+    ; TAC: IF _t1489 GOTO L5
+    cmp ecx, 4465
+    je L5
+    ; TAC: _t1490 = x == 4468
+    ; TAC: IF _t1490 GOTO L5
+    cmp ecx, 4468
+    je L5
+    ; TAC: _t1491 = x == 4471
+    ; TAC: IF _t1491 GOTO L5
+    cmp ecx, 4471
+    je L5
+    ; TAC: _t1492 = x == 4474
+    ; TAC: IF _t1492 GOTO L5
+    cmp ecx, 4474
+    je L5
+    ; TAC: _t1493 = x == 4477
+    ; TAC: IF _t1493 GOTO L5
+    cmp ecx, 4477
+    je L5
+    ; TAC: _t1494 = x == 4480
+    ; TAC: IF _t1494 GOTO L5
+    cmp ecx, 4480
+    je L5
+    ; TAC: _t1495 = x == 4483
+    ; TAC: IF _t1495 GOTO L5
+    cmp ecx, 4483
+    je L5
+    ; TAC: _t1496 = x == 4486
+    ; TAC: IF _t1496 GOTO L5
+    cmp ecx, 4486
+    je L5
+    ; TAC: _t1497 = x == 4489
+    ; TAC: IF _t1497 GOTO L5
+    cmp ecx, 4489
+    je L5
+    ; TAC: _t1498 = x == 4492
+    ; TAC: IF _t1498 GOTO L5
+    cmp ecx, 4492
+    je L5
+    ; TAC: _t1499 = x == 4495
+    ; TAC: IF _t1499 GOTO L5
+    cmp ecx, 4495
+    je L5
+    ; TAC: _t1500 = x == 4498
+    ; TAC: IF _t1500 GOTO L5
+    cmp ecx, 4498
+    je L5
+    ; TAC: _t1501 = x == 4501
+    ; TAC: IF _t1501 GOTO L5
+    cmp ecx, 4501
+    je L5
+    ; TAC: _t1502 = x == 4504
+    ; TAC: IF _t1502 GOTO L5
+    cmp ecx, 4504
+    je L5
+    ; TAC: _t1503 = x == 4507
+    ; TAC: IF _t1503 GOTO L5
+    cmp ecx, 4507
+    je L5
+    ; TAC: _t1504 = x == 4510
+    ; TAC: IF _t1504 GOTO L5
+    cmp ecx, 4510
+    je L5
+    ; TAC: _t1505 = x == 4513
+    ; TAC: IF _t1505 GOTO L5
+    cmp ecx, 4513
+    je L5
+    ; TAC: _t1506 = x == 4516
+    ; TAC: IF _t1506 GOTO L5
+    cmp ecx, 4516
+    je L5
+    ; TAC: _t1507 = x == 4519
+    ; TAC: IF _t1507 GOTO L5
+    cmp ecx, 4519
+    je L5
+    ; TAC: _t1508 = x == 4522
+    ; TAC: IF _t1508 GOTO L5
+    cmp ecx, 4522
+    je L5
+    ; TAC: _t1509 = x == 4525
+    ; TAC: IF _t1509 GOTO L5
+    cmp ecx, 4525
+    je L5
+    ; TAC: _t1510 = x == 4528
+    ; TAC: IF _t1510 GOTO L5
+    cmp ecx, 4528
+    je L5
+    ; TAC: _t1511 = x == 4531
+    ; TAC: IF _t1511 GOTO L5
+    cmp ecx, 4531
+    je L5
+    ; TAC: _t1512 = x == 4534
+    ; TAC: IF _t1512 GOTO L5
+    cmp ecx, 4534
+    je L5
+    ; TAC: _t1513 = x == 4537
+    ; TAC: IF _t1513 GOTO L5
+    cmp ecx, 4537
+    je L5
+    ; TAC: _t1514 = x == 4540
+    ; TAC: IF _t1514 GOTO L5
+    cmp ecx, 4540
+    je L5
+    ; TAC: _t1515 = x == 4543
+    ; TAC: IF _t1515 GOTO L5
+    cmp ecx, 4543
+    je L5
+    ; TAC: _t1516 = x == 4546
+    ; TAC: IF _t1516 GOTO L5
+    cmp ecx, 4546
+    je L5
+    ; TAC: _t1517 = x == 4549
+    ; TAC: IF _t1517 GOTO L5
+    cmp ecx, 4549
+    je L5
+    ; TAC: _t1518 = x == 4552
+    ; TAC: IF _t1518 GOTO L5
+    cmp ecx, 4552
+    je L5
+    ; TAC: _t1519 = x == 4555
+    ; TAC: IF _t1519 GOTO L5
+    cmp ecx, 4555
+    je L5
+    ; TAC: _t1520 = x == 4558
+    ; TAC: IF _t1520 GOTO L5
+    cmp ecx, 4558
+    je L5
+    ; TAC: _t1521 = x == 4561
+    ; TAC: IF _t1521 GOTO L5
+    cmp ecx, 4561
+    je L5
+    ; TAC: _t1522 = x == 4564
+    ; TAC: IF _t1522 GOTO L5
+    cmp ecx, 4564
+    je L5
+    ; TAC: _t1523 = x == 4567
+    ; TAC: IF _t1523 GOTO L5
+    cmp ecx, 4567
+    je L5
+    ; TAC: _t1524 = x == 4570
+    ; TAC: IF _t1524 GOTO L5
+    cmp ecx, 4570
+    je L5
+    ; TAC: _t1525 = x == 4573
+    ; TAC: IF _t1525 GOTO L5
+    cmp ecx, 4573
+    je L5
+    ; TAC: _t1526 = x == 4576
+    ; TAC: IF _t1526 GOTO L5
+    cmp ecx, 4576
+    je L5
+    ; TAC: _t1527 = x == 4579
+    ; TAC: IF _t1527 GOTO L5
+    cmp ecx, 4579
+    je L5
+    ; TAC: _t1528 = x == 4582
+    ; TAC: IF _t1528 GOTO L5
+    cmp ecx, 4582
+    je L5
+    ; TAC: _t1529 = x == 4585
+    ; TAC: IF _t1529 GOTO L5
+    cmp ecx, 4585
+    je L5
+    ; TAC: _t1530 = x == 4588
+    ; TAC: IF _t1530 GOTO L5
+    cmp ecx, 4588
+    je L5
+    ; TAC: _t1531 = x == 4591
+    ; TAC: IF _t1531 GOTO L5
+    cmp ecx, 4591
+    je L5
+    ; TAC: _t1532 = x == 4594
+    ; TAC: IF _t1532 GOTO L5
+    cmp ecx, 4594
+    je L5
+    ; TAC: _t1533 = x == 4597
+    ; TAC: IF _t1533 GOTO L5
+    cmp ecx, 4597
+    je L5
+    ; TAC: _t1534 = x == 4600
+    ; TAC: IF _t1534 GOTO L5
+    cmp ecx, 4600
+    je L5
+    ; TAC: _t1535 = x == 4603
+    ; TAC: IF _t1535 GOTO L5
+    cmp ecx, 4603
+    je L5
+    ; TAC: _t1536 = x == 4606
+    ; TAC: IF _t1536 GOTO L5
+    cmp ecx, 4606
+    je L5
+    ; TAC: _t1537 = x == 4609
+    ; TAC: IF _t1537 GOTO L5
+    cmp ecx, 4609
+    je L5
+    ; TAC: _t1538 = x == 4612
+    ; TAC: IF _t1538 GOTO L5
+    cmp ecx, 4612
+    je L5
+    ; TAC: _t1539 = x == 4615
+    ; TAC: IF _t1539 GOTO L5
+    cmp ecx, 4615
+    je L5
+    ; TAC: _t1540 = x == 4618
+    ; TAC: IF _t1540 GOTO L5
+    cmp ecx, 4618
+    je L5
+    ; TAC: _t1541 = x == 4621
+    ; TAC: IF _t1541 GOTO L5
+    cmp ecx, 4621
+    je L5
+    ; TAC: _t1542 = x == 4624
+    ; TAC: IF _t1542 GOTO L5
+    cmp ecx, 4624
+    je L5
+    ; TAC: _t1543 = x == 4627
+    ; TAC: IF _t1543 GOTO L5
+    cmp ecx, 4627
+    je L5
+    ; TAC: _t1544 = x == 4630
+    ; TAC: IF _t1544 GOTO L5
+    cmp ecx, 4630
+    je L5
+    ; TAC: _t1545 = x == 4633
+    ; TAC: IF _t1545 GOTO L5
+    cmp ecx, 4633
+    je L5
+    ; TAC: _t1546 = x == 4636
+    ; TAC: IF _t1546 GOTO L5
+    cmp ecx, 4636
+    je L5
+    ; TAC: _t1547 = x == 4639
+    ; TAC: IF _t1547 GOTO L5
+    cmp ecx, 4639
+    je L5
+    ; TAC: _t1548 = x == 4642
+    ; TAC: IF _t1548 GOTO L5
+    cmp ecx, 4642
+    je L5
+    ; TAC: _t1549 = x == 4645
+    ; TAC: IF _t1549 GOTO L5
+    cmp ecx, 4645
+    je L5
+    ; TAC: _t1550 = x == 4648
+    ; TAC: IF _t1550 GOTO L5
+    cmp ecx, 4648
+    je L5
+    ; TAC: _t1551 = x == 4651
+    ; TAC: IF _t1551 GOTO L5
+    cmp ecx, 4651
+    je L5
+    ; TAC: _t1552 = x == 4654
+    ; TAC: IF _t1552 GOTO L5
+    cmp ecx, 4654
+    je L5
+    ; TAC: _t1553 = x == 4657
+    ; TAC: IF _t1553 GOTO L5
+    cmp ecx, 4657
+    je L5
+    ; TAC: _t1554 = x == 4660
+    ; TAC: IF _t1554 GOTO L5
+    cmp ecx, 4660
+    je L5
+    ; TAC: _t1555 = x == 4663
+    ; TAC: IF _t1555 GOTO L5
+    cmp ecx, 4663
+    je L5
+    ; TAC: _t1556 = x == 4666
+    ; TAC: IF _t1556 GOTO L5
+    cmp ecx, 4666
+    je L5
+    ; TAC: _t1557 = x == 4669
+    ; TAC: IF _t1557 GOTO L5
+    cmp ecx, 4669
+    je L5
+    ; TAC: _t1558 = x == 4672
+    ; TAC: IF _t1558 GOTO L5
+    cmp ecx, 4672
+    je L5
+    ; TAC: _t1559 = x == 4675
+    ; TAC: IF _t1559 GOTO L5
+    cmp ecx, 4675
+    je L5
+    ; TAC: _t1560 = x == 4678
+    ; TAC: IF _t1560 GOTO L5
+    cmp ecx, 4678
+    je L5
+    ; TAC: _t1561 = x == 4681
+    ; TAC: IF _t1561 GOTO L5
+    cmp ecx, 4681
+    je L5
+    ; TAC: _t1562 = x == 4684
+    ; TAC: IF _t1562 GOTO L5
+    cmp ecx, 4684
+    je L5
+    ; TAC: _t1563 = x == 4687
+    ; TAC: IF _t1563 GOTO L5
+    cmp ecx, 4687
+    je L5
+    ; TAC: _t1564 = x == 4690
+    ; TAC: IF _t1564 GOTO L5
+    cmp ecx, 4690
+    je L5
+    ; TAC: _t1565 = x == 4693
+    ; TAC: IF _t1565 GOTO L5
+    cmp ecx, 4693
+    je L5
+    ; TAC: _t1566 = x == 4696
+    ; TAC: IF _t1566 GOTO L5
+    cmp ecx, 4696
+    je L5
+    ; TAC: _t1567 = x == 4699
+    ; TAC: IF _t1567 GOTO L5
+    cmp ecx, 4699
+    je L5
+    ; TAC: _t1568 = x == 4702
+    ; TAC: IF _t1568 GOTO L5
+    cmp ecx, 4702
+    je L5
+    ; TAC: _t1569 = x == 4705
+    ; TAC: IF _t1569 GOTO L5
+    cmp ecx, 4705
+    je L5
+    ; TAC: _t1570 = x == 4708
+    ; TAC: IF _t1570 GOTO L5
+    cmp ecx, 4708
+    je L5
+    ; TAC: _t1571 = x == 4711
+    ; TAC: IF _t1571 GOTO L5
+    cmp ecx, 4711
+    je L5
+    ; TAC: _t1572 = x == 4714
+    ; TAC: IF _t1572 GOTO L5
+    cmp ecx, 4714
+    je L5
+    ; TAC: _t1573 = x == 4717
+    ; TAC: IF _t1573 GOTO L5
+    cmp ecx, 4717
+    je L5
+    ; TAC: _t1574 = x == 4720
+    ; TAC: IF _t1574 GOTO L5
+    cmp ecx, 4720
+    je L5
+    ; TAC: _t1575 = x == 4723
+    ; TAC: IF _t1575 GOTO L5
+    cmp ecx, 4723
+    je L5
+    ; TAC: _t1576 = x == 4726
+    ; TAC: IF _t1576 GOTO L5
+    cmp ecx, 4726
+    je L5
+    ; TAC: _t1577 = x == 4729
+    ; TAC: IF _t1577 GOTO L5
+    cmp ecx, 4729
+    je L5
+    ; TAC: _t1578 = x == 4732
+    ; TAC: IF _t1578 GOTO L5
+    cmp ecx, 4732
+    je L5
+    ; TAC: _t1579 = x == 4735
+    ; TAC: IF _t1579 GOTO L5
+    cmp ecx, 4735
+    je L5
+    ; TAC: _t1580 = x == 4738
+    ; TAC: IF _t1580 GOTO L5
+    cmp ecx, 4738
+    je L5
+    ; TAC: _t1581 = x == 4741
+    ; TAC: IF _t1581 GOTO L5
+    cmp ecx, 4741
+    je L5
+    ; TAC: _t1582 = x == 4744
+    ; TAC: IF _t1582 GOTO L5
+    cmp ecx, 4744
+    je L5
+    ; TAC: _t1583 = x == 4747
+    ; TAC: IF _t1583 GOTO L5
+    cmp ecx, 4747
+    je L5
+    ; TAC: _t1584 = x == 4750
+    ; TAC: IF _t1584 GOTO L5
+    cmp ecx, 4750
+    je L5
+    ; TAC: _t1585 = x == 4753
+    ; TAC: IF _t1585 GOTO L5
+    cmp ecx, 4753
+    je L5
+    ; TAC: _t1586 = x == 4756
+    ; TAC: IF _t1586 GOTO L5
+    cmp ecx, 4756
+    je L5
+    ; TAC: _t1587 = x == 4759
+    ; TAC: IF _t1587 GOTO L5
+    cmp ecx, 4759
+    je L5
+    ; TAC: _t1588 = x == 4762
+    ; TAC: IF _t1588 GOTO L5
+    cmp ecx, 4762
+    je L5
+    ; TAC: _t1589 = x == 4765
+    ; TAC: IF _t1589 GOTO L5
+    cmp ecx, 4765
+    je L5
+    ; TAC: _t1590 = x == 4768
+    ; TAC: IF _t1590 GOTO L5
+    cmp ecx, 4768
+    je L5
+    ; TAC: _t1591 = x == 4771
+    ; TAC: IF _t1591 GOTO L5
+    cmp ecx, 4771
+    je L5
+    ; TAC: _t1592 = x == 4774
+    ; TAC: IF _t1592 GOTO L5
+    cmp ecx, 4774
+    je L5
+    ; TAC: _t1593 = x == 4777
+    ; TAC: IF _t1593 GOTO L5
+    cmp ecx, 4777
+    je L5
+    ; TAC: _t1594 = x == 4780
+    ; TAC: IF _t1594 GOTO L5
+    cmp ecx, 4780
+    je L5
+    ; TAC: _t1595 = x == 4783
+    ; TAC: IF _t1595 GOTO L5
+    cmp ecx, 4783
+    je L5
+    ; TAC: _t1596 = x == 4786
+    ; TAC: IF _t1596 GOTO L5
+    cmp ecx, 4786
+    je L5
+    ; TAC: _t1597 = x == 4789
+    ; TAC: IF _t1597 GOTO L5
+    cmp ecx, 4789
+    je L5
+    ; TAC: _t1598 = x == 4792
+    ; TAC: IF _t1598 GOTO L5
+    cmp ecx, 4792
+    je L5
+    ; TAC: _t1599 = x == 4795
+    ; TAC: IF _t1599 GOTO L5
+    cmp ecx, 4795
+    je L5
+    ; TAC: _t1600 = x == 4798
+    ; TAC: IF _t1600 GOTO L5
+    cmp ecx, 4798
+    je L5
+    ; TAC: _t1601 = x == 4801
+    ; TAC: IF _t1601 GOTO L5
+    cmp ecx, 4801
+    je L5
+    ; TAC: _t1602 = x == 4804
+    ; TAC: IF _t1602 GOTO L5
+    cmp ecx, 4804
+    je L5
+    ; TAC: _t1603 = x == 4807
+    ; TAC: IF _t1603 GOTO L5
+    cmp ecx, 4807
+    je L5
+    ; TAC: _t1604 = x == 4810
+    ; TAC: IF _t1604 GOTO L5
+    cmp ecx, 4810
+    je L5
+    ; TAC: _t1605 = x == 4813
+    ; TAC: IF _t1605 GOTO L5
+    cmp ecx, 4813
+    je L5
+    ; TAC: _t1606 = x == 4816
+    ; TAC: IF _t1606 GOTO L5
+    cmp ecx, 4816
+    je L5
+    ; TAC: _t1607 = x == 4819
+    ; TAC: IF _t1607 GOTO L5
+    cmp ecx, 4819
+    je L5
+    ; TAC: _t1608 = x == 4822
+    ; TAC: IF _t1608 GOTO L5
+    cmp ecx, 4822
+    je L5
+    ; TAC: _t1609 = x == 4825
+    ; TAC: IF _t1609 GOTO L5
+    cmp ecx, 4825
+    je L5
+    ; TAC: _t1610 = x == 4828
+    ; TAC: IF _t1610 GOTO L5
+    cmp ecx, 4828
+    je L5
+    ; TAC: _t1611 = x == 4831
+    ; TAC: IF _t1611 GOTO L5
+    cmp ecx, 4831
+    je L5
+    ; TAC: _t1612 = x == 4834
+    ; TAC: IF _t1612 GOTO L5
+    cmp ecx, 4834
+    je L5
+    ; TAC: _t1613 = x == 4837
+    ; TAC: IF _t1613 GOTO L5
+    cmp ecx, 4837
+    je L5
+    ; TAC: _t1614 = x == 4840
+    ; TAC: IF _t1614 GOTO L5
+    cmp ecx, 4840
+    je L5
+    ; TAC: _t1615 = x == 4843
+    ; TAC: IF _t1615 GOTO L5
+    cmp ecx, 4843
+    je L5
+    ; TAC: _t1616 = x == 4846
+    ; TAC: IF _t1616 GOTO L5
+    cmp ecx, 4846
+    je L5
+    ; TAC: _t1617 = x == 4849
+    ; TAC: IF _t1617 GOTO L5
+    cmp ecx, 4849
+    je L5
+    ; TAC: _t1618 = x == 4852
+    ; TAC: IF _t1618 GOTO L5
+    cmp ecx, 4852
+    je L5
+    ; TAC: _t1619 = x == 4855
+    ; TAC: IF _t1619 GOTO L5
+    cmp ecx, 4855
+    je L5
+    ; TAC: _t1620 = x == 4858
+    ; TAC: IF _t1620 GOTO L5
+    cmp ecx, 4858
+    je L5
+    ; TAC: _t1621 = x == 4861
+    ; TAC: IF _t1621 GOTO L5
+    cmp ecx, 4861
+    je L5
+    ; TAC: _t1622 = x == 4864
+    ; TAC: IF _t1622 GOTO L5
+    cmp ecx, 4864
+    je L5
+    ; TAC: _t1623 = x == 4867
+    ; TAC: IF _t1623 GOTO L5
+    cmp ecx, 4867
+    je L5
+    ; TAC: _t1624 = x == 4870
+    ; TAC: IF _t1624 GOTO L5
+    cmp ecx, 4870
+    je L5
+    ; TAC: _t1625 = x == 4873
+    ; TAC: IF _t1625 GOTO L5
+    cmp ecx, 4873
+    je L5
+    ; TAC: _t1626 = x == 4876
+    ; TAC: IF _t1626 GOTO L5
+    cmp ecx, 4876
+    je L5
+    ; TAC: _t1627 = x == 4879
+    ; TAC: IF _t1627 GOTO L5
+    cmp ecx, 4879
+    je L5
+    ; TAC: _t1628 = x == 4882
+    ; TAC: IF _t1628 GOTO L5
+    cmp ecx, 4882
+    je L5
+    ; TAC: _t1629 = x == 4885
+    ; TAC: IF _t1629 GOTO L5
+    cmp ecx, 4885
+    je L5
+    ; TAC: _t1630 = x == 4888
+    ; TAC: IF _t1630 GOTO L5
+    cmp ecx, 4888
+    je L5
+    ; TAC: _t1631 = x == 4891
+    ; TAC: IF _t1631 GOTO L5
+    cmp ecx, 4891
+    je L5
+    ; TAC: _t1632 = x == 4894
+    ; TAC: IF _t1632 GOTO L5
+    cmp ecx, 4894
+    je L5
+    ; TAC: _t1633 = x == 4897
+    ; TAC: IF _t1633 GOTO L5
+    cmp ecx, 4897
+    je L5
+    ; TAC: _t1634 = x == 4900
+    ; TAC: IF _t1634 GOTO L5
+    cmp ecx, 4900
+    je L5
+    ; TAC: _t1635 = x == 4903
+    ; TAC: IF _t1635 GOTO L5
+    cmp ecx, 4903
+    je L5
+    ; TAC: _t1636 = x == 4906
+    ; TAC: IF _t1636 GOTO L5
+    cmp ecx, 4906
+    je L5
+    ; TAC: _t1637 = x == 4909
+    ; TAC: IF _t1637 GOTO L5
+    cmp ecx, 4909
+    je L5
+    ; TAC: _t1638 = x == 4912
+    ; TAC: IF _t1638 GOTO L5
+    cmp ecx, 4912
+    je L5
+    ; TAC: _t1639 = x == 4915
+    ; TAC: IF _t1639 GOTO L5
+    cmp ecx, 4915
+    je L5
+    ; TAC: _t1640 = x == 4918
+    ; TAC: IF _t1640 GOTO L5
+    cmp ecx, 4918
+    je L5
+    ; TAC: _t1641 = x == 4921
+    ; TAC: IF _t1641 GOTO L5
+    cmp ecx, 4921
+    je L5
+    ; TAC: _t1642 = x == 4924
+    ; TAC: IF _t1642 GOTO L5
+    cmp ecx, 4924
+    je L5
+    ; TAC: _t1643 = x == 4927
+    ; TAC: IF _t1643 GOTO L5
+    cmp ecx, 4927
+    je L5
+    ; TAC: _t1644 = x == 4930
+    ; TAC: IF _t1644 GOTO L5
+    cmp ecx, 4930
+    je L5
+    ; TAC: _t1645 = x == 4933
+    ; TAC: IF _t1645 GOTO L5
+    cmp ecx, 4933
+    je L5
+    ; TAC: _t1646 = x == 4936
+    ; TAC: IF _t1646 GOTO L5
+    cmp ecx, 4936
+    je L5
+    ; TAC: _t1647 = x == 4939
+    ; TAC: IF _t1647 GOTO L5
+    cmp ecx, 4939
+    je L5
+    ; TAC: _t1648 = x == 4942
+    ; TAC: IF _t1648 GOTO L5
+    cmp ecx, 4942
+    je L5
+    ; TAC: _t1649 = x == 4945
+    ; TAC: IF _t1649 GOTO L5
+    cmp ecx, 4945
+    je L5
+    ; TAC: _t1650 = x == 4948
+    ; TAC: IF _t1650 GOTO L5
+    cmp ecx, 4948
+    je L5
+    ; TAC: _t1651 = x == 4951
+    ; TAC: IF _t1651 GOTO L5
+    cmp ecx, 4951
+    je L5
+    ; TAC: _t1652 = x == 4954
+    ; TAC: IF _t1652 GOTO L5
+    cmp ecx, 4954
+    je L5
+    ; TAC: _t1653 = x == 4957
+    ; TAC: IF _t1653 GOTO L5
+    cmp ecx, 4957
+    je L5
+    ; TAC: _t1654 = x == 4960
+    ; TAC: IF _t1654 GOTO L5
+    cmp ecx, 4960
+    je L5
+    ; TAC: _t1655 = x == 4963
+    ; TAC: IF _t1655 GOTO L5
+    cmp ecx, 4963
+    je L5
+    ; TAC: _t1656 = x == 4966
+    ; TAC: IF _t1656 GOTO L5
+    cmp ecx, 4966
+    je L5
+    ; TAC: _t1657 = x == 4969
+    ; TAC: IF _t1657 GOTO L5
+    cmp ecx, 4969
+    je L5
+    ; TAC: _t1658 = x == 4972
+    ; TAC: IF _t1658 GOTO L5
+    cmp ecx, 4972
+    je L5
+    ; TAC: _t1659 = x == 4975
+    ; TAC: IF _t1659 GOTO L5
+    cmp ecx, 4975
+    je L5
+    ; TAC: _t1660 = x == 4978
+    ; TAC: IF _t1660 GOTO L5
+    cmp ecx, 4978
+    je L5
+    ; TAC: _t1661 = x == 4981
+    ; TAC: IF _t1661 GOTO L5
+    cmp ecx, 4981
+    je L5
+    ; TAC: _t1662 = x == 4984
+    ; TAC: IF _t1662 GOTO L5
+    cmp ecx, 4984
+    je L5
+    ; TAC: _t1663 = x == 4987
+    ; TAC: IF _t1663 GOTO L5
+    cmp ecx, 4987
+    je L5
+    ; TAC: _t1664 = x == 4990
+    ; TAC: IF _t1664 GOTO L5
+    cmp ecx, 4990
+    je L5
+    ; TAC: _t1665 = x == 4993
+    ; TAC: IF _t1665 GOTO L5
+    cmp ecx, 4993
+    je L5
+    ; TAC: _t1666 = x == 4996
+    ; TAC: IF _t1666 GOTO L5
+    cmp ecx, 4996
+    je L5
+    ; TAC: _t1667 = x == 4999
+    ; TAC: IF _t1667 GOTO L5
+    cmp ecx, 4999
+    je L5
+    ; TAC: _t1668 = x == 5002
+    ; TAC: IF _t1668 GOTO L5
+    cmp ecx, 5002
+    je L5
+    ; TAC: _t1669 = x == 5005
+    ; TAC: IF _t1669 GOTO L5
+    cmp ecx, 5005
+    je L5
+    ; TAC: _t1670 = x == 5008
+    ; TAC: IF _t1670 GOTO L5
+    cmp ecx, 5008
+    je L5
+    ; TAC: _t1671 = x == 5011
+    ; TAC: IF _t1671 GOTO L5
+    cmp ecx, 5011
+    je L5
+    ; TAC: _t1672 = x == 5014
+    ; TAC: IF _t1672 GOTO L5
+    cmp ecx, 5014
+    je L5
+    ; TAC: _t1673 = x == 5017
+    ; TAC: IF _t1673 GOTO L5
+    cmp ecx, 5017
+    je L5
+    ; TAC: _t1674 = x == 5020
+    ; TAC: IF _t1674 GOTO L5
+    cmp ecx, 5020
+    je L5
+    ; TAC: _t1675 = x == 5023
+    ; TAC: IF _t1675 GOTO L5
+    cmp ecx, 5023
+    je L5
+    ; TAC: _t1676 = x == 5026
+    ; TAC: IF _t1676 GOTO L5
+    cmp ecx, 5026
+    je L5
+    ; TAC: _t1677 = x == 5029
+    ; TAC: IF _t1677 GOTO L5
+    cmp ecx, 5029
+    je L5
+    ; TAC: _t1678 = x == 5032
+    ; TAC: IF _t1678 GOTO L5
+    cmp ecx, 5032
+    je L5
+    ; TAC: _t1679 = x == 5035
+    ; TAC: IF _t1679 GOTO L5
+    cmp ecx, 5035
+    je L5
+    ; TAC: _t1680 = x == 5038
+    ; TAC: IF _t1680 GOTO L5
+    cmp ecx, 5038
+    je L5
+    ; TAC: _t1681 = x == 5041
+    ; TAC: IF _t1681 GOTO L5
+    cmp ecx, 5041
+    je L5
+    ; TAC: _t1682 = x == 5044
+    ; TAC: IF _t1682 GOTO L5
+    cmp ecx, 5044
+    je L5
+    ; TAC: _t1683 = x == 5047
+    ; TAC: IF _t1683 GOTO L5
+    cmp ecx, 5047
+    je L5
+    ; TAC: _t1684 = x == 5050
+    ; TAC: IF _t1684 GOTO L5
+    cmp ecx, 5050
+    je L5
+    ; TAC: _t1685 = x == 5053
+    ; TAC: IF _t1685 GOTO L5
+    cmp ecx, 5053
+    je L5
+    ; TAC: _t1686 = x == 5056
+    ; TAC: IF _t1686 GOTO L5
+    cmp ecx, 5056
+    je L5
+    ; TAC: _t1687 = x == 5059
+    ; TAC: IF _t1687 GOTO L5
+    cmp ecx, 5059
+    je L5
+    ; TAC: _t1688 = x == 5062
+    ; TAC: IF _t1688 GOTO L5
+    cmp ecx, 5062
+    je L5
+    ; TAC: _t1689 = x == 5065
+    ; TAC: IF _t1689 GOTO L5
+    cmp ecx, 5065
+    je L5
+    ; TAC: _t1690 = x == 5068
+    ; TAC: IF _t1690 GOTO L5
+    cmp ecx, 5068
+    je L5
+    ; TAC: _t1691 = x == 5071
+    ; TAC: IF _t1691 GOTO L5
+    cmp ecx, 5071
+    je L5
+    ; TAC: _t1692 = x == 5074
+    ; TAC: IF _t1692 GOTO L5
+    cmp ecx, 5074
+    je L5
+    ; TAC: _t1693 = x == 5077
+    ; TAC: IF _t1693 GOTO L5
+    cmp ecx, 5077
+    je L5
+    ; TAC: _t1694 = x == 5080
+    ; TAC: IF _t1694 GOTO L5
+    cmp ecx, 5080
+    je L5
+    ; TAC: _t1695 = x == 5083
+    ; TAC: IF _t1695 GOTO L5
+    cmp ecx, 5083
+    je L5
+    ; TAC: _t1696 = x == 5086
+    ; TAC: IF _t1696 GOTO L5
+    cmp ecx, 5086
+    je L5
+    ; TAC: _t1697 = x == 5089
+    ; TAC: IF _t1697 GOTO L5
+    cmp ecx, 5089
+    je L5
+    ; TAC: _t1698 = x == 5092
+    ; TAC: IF _t1698 GOTO L5
+    cmp ecx, 5092
+    je L5
+    ; TAC: _t1699 = x == 5095
+    ; TAC: IF _t1699 GOTO L5
+    cmp ecx, 5095
+    je L5
+    ; TAC: _t1700 = x == 5098
+    ; TAC: IF _t1700 GOTO L5
+    cmp ecx, 5098
+    je L5
+    ; TAC: _t1701 = x == 5101
+    ; TAC: IF _t1701 GOTO L5
+    cmp ecx, 5101
+    je L5
+    ; TAC: _t1702 = x == 5104
+    ; TAC: IF _t1702 GOTO L5
+    cmp ecx, 5104
+    je L5
+    ; TAC: _t1703 = x == 5107
+    ; TAC: IF _t1703 GOTO L5
+    cmp ecx, 5107
+    je L5
+    ; TAC: _t1704 = x == 5110
+    ; TAC: IF _t1704 GOTO L5
+    cmp ecx, 5110
+    je L5
+    ; TAC: _t1705 = x == 5113
+    ; TAC: IF _t1705 GOTO L5
+    cmp ecx, 5113
+    je L5
+    ; TAC: _t1706 = x == 5116
+    ; TAC: IF _t1706 GOTO L5
+    cmp ecx, 5116
+    je L5
+    ; TAC: _t1707 = x == 5119
+    ; TAC: IF _t1707 GOTO L5
+    cmp ecx, 5119
+    je L5
+    ; TAC: _t1708 = x == 5122
+    ; TAC: IF _t1708 GOTO L5
+    cmp ecx, 5122
+    je L5
+    ; TAC: _t1709 = x == 5125
+    ; TAC: IF _t1709 GOTO L5
+    cmp ecx, 5125
+    je L5
+    ; TAC: _t1710 = x == 5128
+    ; TAC: IF _t1710 GOTO L5
+    cmp ecx, 5128
+    je L5
+    ; TAC: _t1711 = x == 5131
+    ; TAC: IF _t1711 GOTO L5
+    cmp ecx, 5131
+    je L5
+    ; TAC: _t1712 = x == 5134
+    ; TAC: IF _t1712 GOTO L5
+    cmp ecx, 5134
+    je L5
+    ; TAC: _t1713 = x == 5137
+    ; TAC: IF _t1713 GOTO L5
+    cmp ecx, 5137
+    je L5
+    ; TAC: _t1714 = x == 5140
+    ; TAC: IF _t1714 GOTO L5
+    cmp ecx, 5140
+    je L5
+    ; TAC: _t1715 = x == 5143
+    ; TAC: IF _t1715 GOTO L5
+    cmp ecx, 5143
+    je L5
+    ; TAC: _t1716 = x == 5146
+    ; TAC: IF _t1716 GOTO L5
+    cmp ecx, 5146
+    je L5
+    ; TAC: _t1717 = x == 5149
+    ; TAC: IF _t1717 GOTO L5
+    cmp ecx, 5149
+    je L5
+    ; TAC: _t1718 = x == 5152
+    ; TAC: IF _t1718 GOTO L5
+    cmp ecx, 5152
+    je L5
+    ; TAC: _t1719 = x == 5155
+    ; TAC: IF _t1719 GOTO L5
+    cmp ecx, 5155
+    je L5
+    ; TAC: _t1720 = x == 5158
+    ; TAC: IF _t1720 GOTO L5
+    cmp ecx, 5158
+    je L5
+    ; TAC: _t1721 = x == 5161
+    ; TAC: IF _t1721 GOTO L5
+    cmp ecx, 5161
+    je L5
+    ; TAC: _t1722 = x == 5164
+    ; TAC: IF _t1722 GOTO L5
+    cmp ecx, 5164
+    je L5
+    ; TAC: _t1723 = x == 5167
+    ; TAC: IF _t1723 GOTO L5
+    cmp ecx, 5167
+    je L5
+    ; TAC: _t1724 = x == 5170
+    ; TAC: IF _t1724 GOTO L5
+    cmp ecx, 5170
+    je L5
+    ; TAC: _t1725 = x == 5173
+    ; TAC: IF _t1725 GOTO L5
+    cmp ecx, 5173
+    je L5
+    ; TAC: _t1726 = x == 5176
+    ; TAC: IF _t1726 GOTO L5
+    cmp ecx, 5176
+    je L5
+    ; TAC: _t1727 = x == 5179
+    ; TAC: IF _t1727 GOTO L5
+    cmp ecx, 5179
+    je L5
+    ; TAC: _t1728 = x == 5182
+    ; TAC: IF _t1728 GOTO L5
+    cmp ecx, 5182
+    je L5
+    ; TAC: _t1729 = x == 5185
+    ; TAC: IF _t1729 GOTO L5
+    cmp ecx, 5185
+    je L5
+    ; TAC: _t1730 = x == 5188
+    ; TAC: IF _t1730 GOTO L5
+    cmp ecx, 5188
+    je L5
+    ; TAC: _t1731 = x == 5191
+    ; TAC: IF _t1731 GOTO L5
+    cmp ecx, 5191
+    je L5
+    ; TAC: _t1732 = x == 5194
+    ; TAC: IF _t1732 GOTO L5
+    cmp ecx, 5194
+    je L5
+    ; TAC: _t1733 = x == 5197
+    ; TAC: IF _t1733 GOTO L5
+    cmp ecx, 5197
+    je L5
+    ; TAC: _t1734 = x == 5200
+    ; TAC: IF _t1734 GOTO L5
+    cmp ecx, 5200
+    je L5
+    ; TAC: _t1735 = x == 5203
+    ; TAC: IF _t1735 GOTO L5
+    cmp ecx, 5203
+    je L5
+    ; TAC: _t1736 = x == 5206
+    ; TAC: IF _t1736 GOTO L5
+    cmp ecx, 5206
+    je L5
+    ; TAC: _t1737 = x == 5209
+    ; TAC: IF _t1737 GOTO L5
+    cmp ecx, 5209
+    je L5
+    ; TAC: _t1738 = x == 5212
+    ; TAC: IF _t1738 GOTO L5
+    cmp ecx, 5212
+    je L5
+    ; TAC: _t1739 = x == 5215
+    ; TAC: IF _t1739 GOTO L5
+    cmp ecx, 5215
+    je L5
+    ; TAC: _t1740 = x == 5218
+    ; TAC: IF _t1740 GOTO L5
+    cmp ecx, 5218
+    je L5
+    ; TAC: _t1741 = x == 5221
+    ; TAC: IF _t1741 GOTO L5
+    cmp ecx, 5221
+    je L5
+    ; TAC: _t1742 = x == 5224
+    ; TAC: IF _t1742 GOTO L5
+    cmp ecx, 5224
+    je L5
+    ; TAC: _t1743 = x == 5227
+    ; TAC: IF _t1743 GOTO L5
+    cmp ecx, 5227
+    je L5
+    ; TAC: _t1744 = x == 5230
+    ; TAC: IF _t1744 GOTO L5
+    cmp ecx, 5230
+    je L5
+    ; TAC: _t1745 = x == 5233
+    ; TAC: IF _t1745 GOTO L5
+    cmp ecx, 5233
+    je L5
+    ; TAC: _t1746 = x == 5236
+    ; TAC: IF _t1746 GOTO L5
+    cmp ecx, 5236
+    je L5
+    ; TAC: _t1747 = x == 5239
+    ; TAC: IF _t1747 GOTO L5
+    cmp ecx, 5239
+    je L5
+    ; TAC: _t1748 = x == 5242
+    ; TAC: IF _t1748 GOTO L5
+    cmp ecx, 5242
+    je L5
+    ; TAC: _t1749 = x == 5245
+    ; TAC: IF _t1749 GOTO L5
+    cmp ecx, 5245
+    je L5
+    ; TAC: _t1750 = x == 5248
+    ; TAC: IF _t1750 GOTO L5
+    cmp ecx, 5248
+    je L5
+    ; TAC: _t1751 = x == 5251
+    ; TAC: IF _t1751 GOTO L5
+    cmp ecx, 5251
+    je L5
+    ; TAC: _t1752 = x == 5254
+    ; TAC: IF _t1752 GOTO L5
+    cmp ecx, 5254
+    je L5
+    ; TAC: _t1753 = x == 5257
+    ; TAC: IF _t1753 GOTO L5
+    cmp ecx, 5257
+    je L5
+    ; TAC: _t1754 = x == 5260
+    ; TAC: IF _t1754 GOTO L5
+    cmp ecx, 5260
+    je L5
+    ; TAC: _t1755 = x == 5263
+    ; TAC: IF _t1755 GOTO L5
+    cmp ecx, 5263
+    je L5
+    ; TAC: _t1756 = x == 5266
+    ; TAC: IF _t1756 GOTO L5
+    cmp ecx, 5266
+    je L5
+    ; TAC: _t1757 = x == 5269
+    ; TAC: IF _t1757 GOTO L5
+    cmp ecx, 5269
+    je L5
+    ; TAC: _t1758 = x == 5272
+    ; TAC: IF _t1758 GOTO L5
+    cmp ecx, 5272
+    je L5
+    ; TAC: _t1759 = x == 5275
+    ; TAC: IF _t1759 GOTO L5
+    cmp ecx, 5275
+    je L5
+    ; TAC: _t1760 = x == 5278
+    ; TAC: IF _t1760 GOTO L5
+    cmp ecx, 5278
+    je L5
+    ; TAC: _t1761 = x == 5281
+    ; TAC: IF _t1761 GOTO L5
+    cmp ecx, 5281
+    je L5
+    ; TAC: _t1762 = x == 5284
+    ; TAC: IF _t1762 GOTO L5
+    cmp ecx, 5284
+    je L5
+    ; TAC: _t1763 = x == 5287
+    ; TAC: IF _t1763 GOTO L5
+    cmp ecx, 5287
+    je L5
+    ; TAC: _t1764 = x == 5290
+    ; TAC: IF _t1764 GOTO L5
+    cmp ecx, 5290
+    je L5
+    ; TAC: _t1765 = x == 5293
+    ; TAC: IF _t1765 GOTO L5
+    cmp ecx, 5293
+    je L5
+    ; TAC: _t1766 = x == 5296
+    ; TAC: IF _t1766 GOTO L5
+    cmp ecx, 5296
+    je L5
+    ; TAC: _t1767 = x == 5299
+    ; TAC: IF _t1767 GOTO L5
+    cmp ecx, 5299
+    je L5
+    ; TAC: _t1768 = x == 5302
+    ; TAC: IF _t1768 GOTO L5
+    cmp ecx, 5302
+    je L5
+    ; TAC: _t1769 = x == 5305
+    ; TAC: IF _t1769 GOTO L5
+    cmp ecx, 5305
+    je L5
+    ; TAC: _t1770 = x == 5308
+    ; TAC: IF _t1770 GOTO L5
+    cmp ecx, 5308
+    je L5
+    ; TAC: _t1771 = x == 5311
+    ; TAC: IF _t1771 GOTO L5
+    cmp ecx, 5311
+    je L5
+    ; TAC: _t1772 = x == 5314
+    ; TAC: IF _t1772 GOTO L5
+    cmp ecx, 5314
+    je L5
+    ; TAC: _t1773 = x == 5317
+    ; TAC: IF _t1773 GOTO L5
+    cmp ecx, 5317
+    je L5
+    ; TAC: _t1774 = x == 5320
+    ; TAC: IF _t1774 GOTO L5
+    cmp ecx, 5320
+    je L5
+    ; TAC: _t1775 = x == 5323
+    ; TAC: IF _t1775 GOTO L5
+    cmp ecx, 5323
+    je L5
+    ; TAC: _t1776 = x == 5326
+    ; TAC: IF _t1776 GOTO L5
+    cmp ecx, 5326
+    je L5
+    ; TAC: _t1777 = x == 5329
+    ; TAC: IF _t1777 GOTO L5
+    cmp ecx, 5329
+    je L5
+    ; TAC: _t1778 = x == 5332
+    ; TAC: IF _t1778 GOTO L5
+    cmp ecx, 5332
+    je L5
+    ; TAC: _t1779 = x == 5335
+    ; TAC: IF _t1779 GOTO L5
+    cmp ecx, 5335
+    je L5
+    ; TAC: _t1780 = x == 5338
+    ; TAC: IF _t1780 GOTO L5
+    cmp ecx, 5338
+    je L5
+    ; TAC: _t1781 = x == 5341
+    ; TAC: IF _t1781 GOTO L5
+    cmp ecx, 5341
+    je L5
+    ; TAC: _t1782 = x == 5344
+    ; TAC: IF _t1782 GOTO L5
+    cmp ecx, 5344
+    je L5
+    ; TAC: _t1783 = x == 5347
+    ; TAC: IF _t1783 GOTO L5
+    cmp ecx, 5347
+    je L5
+    ; TAC: _t1784 = x == 5350
+    ; TAC: IF _t1784 GOTO L5
+    cmp ecx, 5350
+    je L5
+    ; TAC: _t1785 = x == 5353
+    ; TAC: IF _t1785 GOTO L5
+    cmp ecx, 5353
+    je L5
+    ; TAC: _t1786 = x == 5356
+    ; TAC: IF _t1786 GOTO L5
+    cmp ecx, 5356
+    je L5
+    ; TAC: _t1787 = x == 5359
+    ; TAC: IF _t1787 GOTO L5
+    cmp ecx, 5359
+    je L5
+    ; TAC: _t1788 = x == 5362
+    ; TAC: IF _t1788 GOTO L5
+    cmp ecx, 5362
+    je L5
+    ; TAC: _t1789 = x == 5365
+    ; TAC: IF _t1789 GOTO L5
+    cmp ecx, 5365
+    je L5
+    ; TAC: _t1790 = x == 5368
+    ; TAC: IF _t1790 GOTO L5
+    cmp ecx, 5368
+    je L5
+    ; TAC: _t1791 = x == 5371
+    ; TAC: IF _t1791 GOTO L5
+    cmp ecx, 5371
+    je L5
+    ; TAC: _t1792 = x == 5374
+    ; TAC: IF _t1792 GOTO L5
+    cmp ecx, 5374
+    je L5
+    ; TAC: _t1793 = x == 5377
+    ; TAC: IF _t1793 GOTO L5
+    cmp ecx, 5377
+    je L5
+    ; TAC: _t1794 = x == 5380
+    ; TAC: IF _t1794 GOTO L5
+    cmp ecx, 5380
+    je L5
+    ; TAC: _t1795 = x == 5383
+    ; TAC: IF _t1795 GOTO L5
+    cmp ecx, 5383
+    je L5
+    ; TAC: _t1796 = x == 5386
+    ; TAC: IF _t1796 GOTO L5
+    cmp ecx, 5386
+    je L5
+    ; TAC: _t1797 = x == 5389
+    ; TAC: IF _t1797 GOTO L5
+    cmp ecx, 5389
+    je L5
+    ; TAC: _t1798 = x == 5392
+    ; TAC: IF _t1798 GOTO L5
+    cmp ecx, 5392
+    je L5
+    ; TAC: _t1799 = x == 5395
+    ; TAC: IF _t1799 GOTO L5
+    cmp ecx, 5395
+    je L5
+    ; TAC: _t1800 = x == 5398
+    ; TAC: IF _t1800 GOTO L5
+    cmp ecx, 5398
+    je L5
+    ; TAC: _t1801 = x == 5401
+    ; TAC: IF _t1801 GOTO L5
+    cmp ecx, 5401
+    je L5
+    ; TAC: _t1802 = x == 5404
+    ; TAC: IF _t1802 GOTO L5
+    cmp ecx, 5404
+    je L5
+    ; TAC: _t1803 = x == 5407
+    ; TAC: IF _t1803 GOTO L5
+    cmp ecx, 5407
+    je L5
+    ; TAC: _t1804 = x == 5410
+    ; TAC: IF _t1804 GOTO L5
+    cmp ecx, 5410
+    je L5
+    ; TAC: _t1805 = x == 5413
+    ; TAC: IF _t1805 GOTO L5
+    cmp ecx, 5413
+    je L5
+    ; TAC: _t1806 = x == 5416
+    ; TAC: IF _t1806 GOTO L5
+    cmp ecx, 5416
+    je L5
+    ; TAC: _t1807 = x == 5419
+    ; TAC: IF _t1807 GOTO L5
+    cmp ecx, 5419
+    je L5
+    ; TAC: _t1808 = x == 5422
+    ; TAC: IF _t1808 GOTO L5
+    cmp ecx, 5422
+    je L5
+    ; TAC: _t1809 = x == 5425
+    ; TAC: IF _t1809 GOTO L5
+    cmp ecx, 5425
+    je L5
+    ; TAC: _t1810 = x == 5428
+    ; TAC: IF _t1810 GOTO L5
+    cmp ecx, 5428
+    je L5
+    ; TAC: _t1811 = x == 5431
+    ; TAC: IF _t1811 GOTO L5
+    cmp ecx, 5431
+    je L5
+    ; TAC: _t1812 = x == 5434
+    ; TAC: IF _t1812 GOTO L5
+    cmp ecx, 5434
+    je L5
+    ; TAC: _t1813 = x == 5437
+    ; TAC: IF _t1813 GOTO L5
+    cmp ecx, 5437
+    je L5
+    ; TAC: _t1814 = x == 5440
+    ; TAC: IF _t1814 GOTO L5
+    cmp ecx, 5440
+    je L5
+    ; TAC: _t1815 = x == 5443
+    ; TAC: IF _t1815 GOTO L5
+    cmp ecx, 5443
+    je L5
+    ; TAC: _t1816 = x == 5446
+    ; TAC: IF _t1816 GOTO L5
+    cmp ecx, 5446
+    je L5
+    ; TAC: _t1817 = x == 5449
+    ; TAC: IF _t1817 GOTO L5
+    cmp ecx, 5449
+    je L5
+    ; TAC: _t1818 = x == 5452
+    ; TAC: IF _t1818 GOTO L5
+    cmp ecx, 5452
+    je L5
+    ; TAC: _t1819 = x == 5455
+    ; TAC: IF _t1819 GOTO L5
+    cmp ecx, 5455
+    je L5
+    ; TAC: _t1820 = x == 5458
+    ; TAC: IF _t1820 GOTO L5
+    cmp ecx, 5458
+    je L5
+    ; TAC: _t1821 = x == 5461
+    ; TAC: IF _t1821 GOTO L5
+    cmp ecx, 5461
+    je L5
+    ; TAC: _t1822 = x == 5464
+    ; TAC: IF _t1822 GOTO L5
+    cmp ecx, 5464
+    je L5
+    ; TAC: _t1823 = x == 5467
+    ; TAC: IF _t1823 GOTO L5
+    cmp ecx, 5467
+    je L5
+    ; TAC: _t1824 = x == 5470
+    ; TAC: IF _t1824 GOTO L5
+    cmp ecx, 5470
+    je L5
+    ; TAC: _t1825 = x == 5473
+    ; TAC: IF _t1825 GOTO L5
+    cmp ecx, 5473
+    je L5
+    ; TAC: _t1826 = x == 5476
+    ; TAC: IF _t1826 GOTO L5
+    cmp ecx, 5476
+    je L5
+    ; TAC: _t1827 = x == 5479
+    ; TAC: IF _t1827 GOTO L5
+    cmp ecx, 5479
+    je L5
+    ; TAC: _t1828 = x == 5482
+    ; TAC: IF _t1828 GOTO L5
+    cmp ecx, 5482
+    je L5
+    ; TAC: _t1829 = x == 5485
+    ; TAC: IF _t1829 GOTO L5
+    cmp ecx, 5485
+    je L5
+    ; TAC: _t1830 = x == 5488
+    ; TAC: IF _t1830 GOTO L5
+    cmp ecx, 5488
+    je L5
+    ; TAC: _t1831 = x == 5491
+    ; TAC: IF _t1831 GOTO L5
+    cmp ecx, 5491
+    je L5
+    ; TAC: _t1832 = x == 5494
+    ; TAC: IF _t1832 GOTO L5
+    cmp ecx, 5494
+    je L5
+    ; TAC: _t1833 = x == 5497
+    ; TAC: IF _t1833 GOTO L5
+    cmp ecx, 5497
+    je L5
+    ; TAC: _t1834 = x == 5500
+    ; TAC: IF _t1834 GOTO L5
+    cmp ecx, 5500
+    je L5
+    ; TAC: _t1835 = x == 5503
+    ; TAC: IF _t1835 GOTO L5
+    cmp ecx, 5503
+    je L5
+    ; TAC: _t1836 = x == 5506
+    ; TAC: IF _t1836 GOTO L5
+    cmp ecx, 5506
+    je L5
+    ; TAC: _t1837 = x == 5509
+    ; TAC: IF _t1837 GOTO L5
+    cmp ecx, 5509
+    je L5
+    ; TAC: _t1838 = x == 5512
+    ; TAC: IF _t1838 GOTO L5
+    cmp ecx, 5512
+    je L5
+    ; TAC: _t1839 = x == 5515
+    ; TAC: IF _t1839 GOTO L5
+    cmp ecx, 5515
+    je L5
+    ; TAC: _t1840 = x == 5518
+    ; TAC: IF _t1840 GOTO L5
+    cmp ecx, 5518
+    je L5
+    ; TAC: _t1841 = x == 5521
+    ; TAC: IF _t1841 GOTO L5
+    cmp ecx, 5521
+    je L5
+    ; TAC: _t1842 = x == 5524
+    ; TAC: IF _t1842 GOTO L5
+    cmp ecx, 5524
+    je L5
+    ; TAC: _t1843 = x == 5527
+    ; TAC: IF _t1843 GOTO L5
+    cmp ecx, 5527
+    je L5
+    ; TAC: _t1844 = x == 5530
+    ; TAC: IF _t1844 GOTO L5
+    cmp ecx, 5530
+    je L5
+    ; TAC: _t1845 = x == 5533
+    ; TAC: IF _t1845 GOTO L5
+    cmp ecx, 5533
+    je L5
+    ; TAC: _t1846 = x == 5536
+    ; TAC: IF _t1846 GOTO L5
+    cmp ecx, 5536
+    je L5
+    ; TAC: _t1847 = x == 5539
+    ; TAC: IF _t1847 GOTO L5
+    cmp ecx, 5539
+    je L5
+    ; TAC: _t1848 = x == 5542
+    ; TAC: IF _t1848 GOTO L5
+    cmp ecx, 5542
+    je L5
+    ; TAC: _t1849 = x == 5545
+    ; TAC: IF _t1849 GOTO L5
+    cmp ecx, 5545
+    je L5
+    ; TAC: _t1850 = x == 5548
+    ; TAC: IF _t1850 GOTO L5
+    cmp ecx, 5548
+    je L5
+    ; TAC: _t1851 = x == 5551
+    ; TAC: IF _t1851 GOTO L5
+    cmp ecx, 5551
+    je L5
+    ; TAC: _t1852 = x == 5554
+    ; TAC: IF _t1852 GOTO L5
+    cmp ecx, 5554
+    je L5
+    ; TAC: _t1853 = x == 5557
+    ; TAC: IF _t1853 GOTO L5
+    cmp ecx, 5557
+    je L5
+    ; TAC: _t1854 = x == 5560
+    ; TAC: IF _t1854 GOTO L5
+    cmp ecx, 5560
+    je L5
+    ; TAC: _t1855 = x == 5563
+    ; TAC: IF _t1855 GOTO L5
+    cmp ecx, 5563
+    je L5
+    ; TAC: _t1856 = x == 5566
+    ; TAC: IF _t1856 GOTO L5
+    cmp ecx, 5566
+    je L5
+    ; TAC: _t1857 = x == 5569
+    ; TAC: IF _t1857 GOTO L5
+    cmp ecx, 5569
+    je L5
+    ; TAC: _t1858 = x == 5572
+    ; TAC: IF _t1858 GOTO L5
+    cmp ecx, 5572
+    je L5
+    ; TAC: _t1859 = x == 5575
+    ; TAC: IF _t1859 GOTO L5
+    cmp ecx, 5575
+    je L5
+    ; TAC: _t1860 = x == 5578
+    ; TAC: IF _t1860 GOTO L5
+    cmp ecx, 5578
+    je L5
+    ; TAC: _t1861 = x == 5581
+    ; TAC: IF _t1861 GOTO L5
+    cmp ecx, 5581
+    je L5
+    ; TAC: _t1862 = x == 5584
+    ; TAC: IF _t1862 GOTO L5
+    cmp ecx, 5584
+    je L5
+    ; TAC: _t1863 = x == 5587
+    ; TAC: IF _t1863 GOTO L5
+    cmp ecx, 5587
+    je L5
+    ; TAC: _t1864 = x == 5590
+    ; TAC: IF _t1864 GOTO L5
+    cmp ecx, 5590
+    je L5
+    ; TAC: _t1865 = x == 5593
+    ; TAC: IF _t1865 GOTO L5
+    cmp ecx, 5593
+    je L5
+    ; TAC: _t1866 = x == 5596
+    ; TAC: IF _t1866 GOTO L5
+    cmp ecx, 5596
+    je L5
+    ; TAC: _t1867 = x == 5599
+    ; TAC: IF _t1867 GOTO L5
+    cmp ecx, 5599
+    je L5
+    ; TAC: _t1868 = x == 5602
+    ; TAC: IF _t1868 GOTO L5
+    cmp ecx, 5602
+    je L5
+    ; TAC: _t1869 = x == 5605
+    ; TAC: IF _t1869 GOTO L5
+    cmp ecx, 5605
+    je L5
+    ; TAC: _t1870 = x == 5608
+    ; TAC: IF _t1870 GOTO L5
+    cmp ecx, 5608
+    je L5
+    ; TAC: _t1871 = x == 5611
+    ; TAC: IF _t1871 GOTO L5
+    cmp ecx, 5611
+    je L5
+    ; TAC: _t1872 = x == 5614
+    ; TAC: IF _t1872 GOTO L5
+    cmp ecx, 5614
+    je L5
+    ; TAC: _t1873 = x == 5617
+    ; TAC: IF _t1873 GOTO L5
+    cmp ecx, 5617
+    je L5
+    ; TAC: _t1874 = x == 5620
+    ; TAC: IF _t1874 GOTO L5
+    cmp ecx, 5620
+    je L5
+    ; TAC: _t1875 = x == 5623
+    ; TAC: IF _t1875 GOTO L5
+    cmp ecx, 5623
+    je L5
+    ; TAC: _t1876 = x == 5626
+    ; TAC: IF _t1876 GOTO L5
+    cmp ecx, 5626
+    je L5
+    ; TAC: _t1877 = x == 5629
+    ; TAC: IF _t1877 GOTO L5
+    cmp ecx, 5629
+    je L5
+    ; TAC: _t1878 = x == 5632
+    ; TAC: IF _t1878 GOTO L5
+    cmp ecx, 5632
+    je L5
+    ; TAC: _t1879 = x == 5635
+    ; TAC: IF _t1879 GOTO L5
+    cmp ecx, 5635
+    je L5
+    ; TAC: _t1880 = x == 5638
+    ; TAC: IF _t1880 GOTO L5
+    cmp ecx, 5638
+    je L5
+    ; TAC: _t1881 = x == 5641
+    ; TAC: IF _t1881 GOTO L5
+    cmp ecx, 5641
+    je L5
+    ; TAC: _t1882 = x == 5644
+    ; TAC: IF _t1882 GOTO L5
+    cmp ecx, 5644
+    je L5
+    ; TAC: _t1883 = x == 5647
+    ; TAC: IF _t1883 GOTO L5
+    cmp ecx, 5647
+    je L5
+    ; TAC: _t1884 = x == 5650
+    ; TAC: IF _t1884 GOTO L5
+    cmp ecx, 5650
+    je L5
+    ; TAC: _t1885 = x == 5653
+    ; TAC: IF _t1885 GOTO L5
+    cmp ecx, 5653
+    je L5
+    ; TAC: _t1886 = x == 5656
+    ; TAC: IF _t1886 GOTO L5
+    cmp ecx, 5656
+    je L5
+    ; TAC: _t1887 = x == 5659
+    ; TAC: IF _t1887 GOTO L5
+    cmp ecx, 5659
+    je L5
+    ; TAC: _t1888 = x == 5662
+    ; TAC: IF _t1888 GOTO L5
+    cmp ecx, 5662
+    je L5
+    ; TAC: _t1889 = x == 5665
+    ; TAC: IF _t1889 GOTO L5
+    cmp ecx, 5665
+    je L5
+    ; TAC: _t1890 = x == 5668
+    ; TAC: IF _t1890 GOTO L5
+    cmp ecx, 5668
+    je L5
+    ; TAC: _t1891 = x == 5671
+    ; TAC: IF _t1891 GOTO L5
+    cmp ecx, 5671
+    je L5
+    ; TAC: _t1892 = x == 5674
+    ; TAC: IF _t1892 GOTO L5
+    cmp ecx, 5674
+    je L5
+    ; TAC: _t1893 = x == 5677
+    ; TAC: IF _t1893 GOTO L5
+    cmp ecx, 5677
+    je L5
+    ; TAC: _t1894 = x == 5680
+    ; TAC: IF _t1894 GOTO L5
+    cmp ecx, 5680
+    je L5
+    ; TAC: _t1895 = x == 5683
+    ; TAC: IF _t1895 GOTO L5
+    cmp ecx, 5683
+    je L5
+    ; TAC: _t1896 = x == 5686
+    ; TAC: IF _t1896 GOTO L5
+    cmp ecx, 5686
+    je L5
+    ; TAC: _t1897 = x == 5689
+    ; TAC: IF _t1897 GOTO L5
+    cmp ecx, 5689
+    je L5
+    ; TAC: _t1898 = x == 5692
+    ; TAC: IF _t1898 GOTO L5
+    cmp ecx, 5692
+    je L5
+    ; TAC: _t1899 = x == 5695
+    ; TAC: IF _t1899 GOTO L5
+    cmp ecx, 5695
+    je L5
+    ; TAC: _t1900 = x == 5698
+    ; TAC: IF _t1900 GOTO L5
+    cmp ecx, 5698
+    je L5
+    ; TAC: _t1901 = x == 5701
+    ; TAC: IF _t1901 GOTO L5
+    cmp ecx, 5701
+    je L5
+    ; TAC: _t1902 = x == 5704
+    ; TAC: IF _t1902 GOTO L5
+    cmp ecx, 5704
+    je L5
+    ; TAC: _t1903 = x == 5707
+    ; TAC: IF _t1903 GOTO L5
+    cmp ecx, 5707
+    je L5
+    ; TAC: _t1904 = x == 5710
+    ; TAC: IF _t1904 GOTO L5
+    cmp ecx, 5710
+    je L5
+    ; TAC: _t1905 = x == 5713
+    ; TAC: IF _t1905 GOTO L5
+    cmp ecx, 5713
+    je L5
+    ; TAC: _t1906 = x == 5716
+    ; TAC: IF _t1906 GOTO L5
+    cmp ecx, 5716
+    je L5
+    ; TAC: _t1907 = x == 5719
+    ; TAC: IF _t1907 GOTO L5
+    cmp ecx, 5719
+    je L5
+    ; TAC: _t1908 = x == 5722
+    ; TAC: IF _t1908 GOTO L5
+    cmp ecx, 5722
+    je L5
+    ; TAC: _t1909 = x == 5725
+    ; TAC: IF _t1909 GOTO L5
+    cmp ecx, 5725
+    je L5
+    ; TAC: _t1910 = x == 5728
+    ; TAC: IF _t1910 GOTO L5
+    cmp ecx, 5728
+    je L5
+    ; TAC: _t1911 = x == 5731
+    ; TAC: IF _t1911 GOTO L5
+    cmp ecx, 5731
+    je L5
+    ; TAC: _t1912 = x == 5734
+    ; TAC: IF _t1912 GOTO L5
+    cmp ecx, 5734
+    je L5
+    ; TAC: _t1913 = x == 5737
+    ; TAC: IF _t1913 GOTO L5
+    cmp ecx, 5737
+    je L5
+    ; TAC: _t1914 = x == 5740
+    ; TAC: IF _t1914 GOTO L5
+    cmp ecx, 5740
+    je L5
+    ; TAC: _t1915 = x == 5743
+    ; TAC: IF _t1915 GOTO L5
+    cmp ecx, 5743
+    je L5
+    ; TAC: _t1916 = x == 5746
+    ; TAC: IF _t1916 GOTO L5
+    cmp ecx, 5746
+    je L5
+    ; TAC: _t1917 = x == 5749
+    ; TAC: IF _t1917 GOTO L5
+    cmp ecx, 5749
+    je L5
+    ; TAC: _t1918 = x == 5752
+    ; TAC: IF _t1918 GOTO L5
+    cmp ecx, 5752
+    je L5
+    ; TAC: _t1919 = x == 5755
+    ; TAC: IF _t1919 GOTO L5
+    cmp ecx, 5755
+    je L5
+    ; TAC: _t1920 = x == 5758
+    ; TAC: IF _t1920 GOTO L5
+    cmp ecx, 5758
+    je L5
+    ; TAC: _t1921 = x == 5761
+    ; TAC: IF _t1921 GOTO L5
+    cmp ecx, 5761
+    je L5
+    ; TAC: _t1922 = x == 5764
+    ; TAC: IF _t1922 GOTO L5
+    cmp ecx, 5764
+    je L5
+    ; TAC: _t1923 = x == 5767
+    ; TAC: IF _t1923 GOTO L5
+    cmp ecx, 5767
+    je L5
+    ; TAC: _t1924 = x == 5770
+    ; TAC: IF _t1924 GOTO L5
+    cmp ecx, 5770
+    je L5
+    ; TAC: _t1925 = x == 5773
+    ; TAC: IF _t1925 GOTO L5
+    cmp ecx, 5773
+    je L5
+    ; TAC: _t1926 = x == 5776
+    ; TAC: IF _t1926 GOTO L5
+    cmp ecx, 5776
+    je L5
+    ; TAC: _t1927 = x == 5779
+    ; TAC: IF _t1927 GOTO L5
+    cmp ecx, 5779
+    je L5
+    ; TAC: _t1928 = x == 5782
+    ; TAC: IF _t1928 GOTO L5
+    cmp ecx, 5782
+    je L5
+    ; TAC: _t1929 = x == 5785
+    ; TAC: IF _t1929 GOTO L5
+    cmp ecx, 5785
+    je L5
+    ; TAC: _t1930 = x == 5788
+    ; TAC: IF _t1930 GOTO L5
+    cmp ecx, 5788
+    je L5
+    ; TAC: _t1931 = x == 5791
+    ; TAC: IF _t1931 GOTO L5
+    cmp ecx, 5791
+    je L5
+    ; TAC: _t1932 = x == 5794
+    ; TAC: IF _t1932 GOTO L5
+    cmp ecx, 5794
+    je L5
+    ; TAC: _t1933 = x == 5797
+    ; TAC: IF _t1933 GOTO L5
+    cmp ecx, 5797
+    je L5
+    ; TAC: _t1934 = x == 5800
+    ; TAC: IF _t1934 GOTO L5
+    cmp ecx, 5800
+    je L5
+    ; TAC: _t1935 = x == 5803
+    ; TAC: IF _t1935 GOTO L5
+    cmp ecx, 5803
+    je L5
+    ; TAC: _t1936 = x == 5806
+    ; TAC: IF _t1936 GOTO L5
+    cmp ecx, 5806
+    je L5
+    ; TAC: _t1937 = x == 5809
+    ; TAC: IF _t1937 GOTO L5
+    cmp ecx, 5809
+    je L5
+    ; TAC: _t1938 = x == 5812
+    ; TAC: IF _t1938 GOTO L5
+    cmp ecx, 5812
+    je L5
+    ; TAC: _t1939 = x == 5815
+    ; TAC: IF _t1939 GOTO L5
+    cmp ecx, 5815
+    je L5
+    ; TAC: _t1940 = x == 5818
+    ; TAC: IF _t1940 GOTO L5
+    cmp ecx, 5818
+    je L5
+    ; TAC: _t1941 = x == 5821
+    ; TAC: IF _t1941 GOTO L5
+    cmp ecx, 5821
+    je L5
+    ; TAC: _t1942 = x == 5824
+    ; TAC: IF _t1942 GOTO L5
+    cmp ecx, 5824
+    je L5
+    ; TAC: _t1943 = x == 5827
+    ; TAC: IF _t1943 GOTO L5
+    cmp ecx, 5827
+    je L5
+    ; TAC: _t1944 = x == 5830
+    ; TAC: IF _t1944 GOTO L5
+    cmp ecx, 5830
+    je L5
+    ; TAC: _t1945 = x == 5833
+    ; TAC: IF _t1945 GOTO L5
+    cmp ecx, 5833
+    je L5
+    ; TAC: _t1946 = x == 5836
+    ; TAC: IF _t1946 GOTO L5
+    cmp ecx, 5836
+    je L5
+    ; TAC: _t1947 = x == 5839
+    ; TAC: IF _t1947 GOTO L5
+    cmp ecx, 5839
+    je L5
+    ; TAC: _t1948 = x == 5842
+    ; TAC: IF _t1948 GOTO L5
+    cmp ecx, 5842
+    je L5
+    ; TAC: _t1949 = x == 5845
+    ; TAC: IF _t1949 GOTO L5
+    cmp ecx, 5845
+    je L5
+    ; TAC: _t1950 = x == 5848
+    ; TAC: IF _t1950 GOTO L5
+    cmp ecx, 5848
+    je L5
+    ; TAC: _t1951 = x == 5851
+    ; TAC: IF _t1951 GOTO L5
+    cmp ecx, 5851
+    je L5
+    ; TAC: _t1952 = x == 5854
+    ; TAC: IF _t1952 GOTO L5
+    cmp ecx, 5854
+    je L5
+    ; TAC: _t1953 = x == 5857
+    ; TAC: IF _t1953 GOTO L5
+    cmp ecx, 5857
+    je L5
+    ; TAC: _t1954 = x == 5860
+    ; TAC: IF _t1954 GOTO L5
+    cmp ecx, 5860
+    je L5
+    ; TAC: _t1955 = x == 5863
+    ; TAC: IF _t1955 GOTO L5
+    cmp ecx, 5863
+    je L5
+    ; TAC: _t1956 = x == 5866
+    ; TAC: IF _t1956 GOTO L5
+    cmp ecx, 5866
+    je L5
+    ; TAC: _t1957 = x == 5869
+    ; TAC: IF _t1957 GOTO L5
+    cmp ecx, 5869
+    je L5
+    ; TAC: _t1958 = x == 5872
+    ; TAC: IF _t1958 GOTO L5
+    cmp ecx, 5872
+    je L5
+    ; TAC: _t1959 = x == 5875
+    ; TAC: IF _t1959 GOTO L5
+    cmp ecx, 5875
+    je L5
+    ; TAC: _t1960 = x == 5878
+    ; TAC: IF _t1960 GOTO L5
+    cmp ecx, 5878
+    je L5
+    ; TAC: _t1961 = x == 5881
+    ; TAC: IF _t1961 GOTO L5
+    cmp ecx, 5881
+    je L5
+    ; TAC: _t1962 = x == 5884
+    ; TAC: IF _t1962 GOTO L5
+    cmp ecx, 5884
+    je L5
+    ; TAC: _t1963 = x == 5887
+    ; TAC: IF _t1963 GOTO L5
+    cmp ecx, 5887
+    je L5
+    ; TAC: _t1964 = x == 5890
+    ; TAC: IF _t1964 GOTO L5
+    cmp ecx, 5890
+    je L5
+    ; TAC: _t1965 = x == 5893
+    ; TAC: IF _t1965 GOTO L5
+    cmp ecx, 5893
+    je L5
+    ; TAC: _t1966 = x == 5896
+    ; TAC: IF _t1966 GOTO L5
+    cmp ecx, 5896
+    je L5
+    ; TAC: _t1967 = x == 5899
+    ; TAC: IF _t1967 GOTO L5
+    cmp ecx, 5899
+    je L5
+    ; TAC: _t1968 = x == 5902
+    ; TAC: IF _t1968 GOTO L5
+    cmp ecx, 5902
+    je L5
+    ; TAC: _t1969 = x == 5905
+    ; TAC: IF _t1969 GOTO L5
+    cmp ecx, 5905
+    je L5
+    ; TAC: _t1970 = x == 5908
+    ; TAC: IF _t1970 GOTO L5
+    cmp ecx, 5908
+    je L5
+    ; TAC: _t1971 = x == 5911
+    ; TAC: IF _t1971 GOTO L5
+    cmp ecx, 5911
+    je L5
+    ; TAC: _t1972 = x == 5914
+    ; TAC: IF _t1972 GOTO L5
+    cmp ecx, 5914
+    je L5
+    ; TAC: _t1973 = x == 5917
+    ; TAC: IF _t1973 GOTO L5
+    cmp ecx, 5917
+    je L5
+    ; TAC: _t1974 = x == 5920
+    ; TAC: IF _t1974 GOTO L5
+    cmp ecx, 5920
+    je L5
+    ; TAC: _t1975 = x == 5923
+    ; TAC: IF _t1975 GOTO L5
+    cmp ecx, 5923
+    je L5
+    ; TAC: _t1976 = x == 5926
+    ; TAC: IF _t1976 GOTO L5
+    cmp ecx, 5926
+    je L5
+    ; TAC: _t1977 = x == 5929
+    ; TAC: IF _t1977 GOTO L5
+    cmp ecx, 5929
+    je L5
+    ; TAC: _t1978 = x == 5932
+    ; TAC: IF _t1978 GOTO L5
+    cmp ecx, 5932
+    je L5
+    ; TAC: _t1979 = x == 5935
+    ; TAC: IF _t1979 GOTO L5
+    cmp ecx, 5935
+    je L5
+    ; TAC: _t1980 = x == 5938
+    ; TAC: IF _t1980 GOTO L5
+    cmp ecx, 5938
+    je L5
+    ; TAC: _t1981 = x == 5941
+    ; TAC: IF _t1981 GOTO L5
+    cmp ecx, 5941
+    je L5
+    ; TAC: _t1982 = x == 5944
+    ; TAC: IF _t1982 GOTO L5
+    cmp ecx, 5944
+    je L5
+    ; TAC: _t1983 = x == 5947
+    ; TAC: IF _t1983 GOTO L5
+    cmp ecx, 5947
+    je L5
+    ; TAC: _t1984 = x == 5950
+    ; TAC: IF _t1984 GOTO L5
+    cmp ecx, 5950
+    je L5
+    ; TAC: _t1985 = x == 5953
+    ; TAC: IF _t1985 GOTO L5
+    cmp ecx, 5953
+    je L5
+    ; TAC: _t1986 = x == 5956
+    ; TAC: IF _t1986 GOTO L5
+    cmp ecx, 5956
+    je L5
+    ; TAC: _t1987 = x == 5959
+    ; TAC: IF _t1987 GOTO L5
+    cmp ecx, 5959
+    je L5
+    ; TAC: _t1988 = x == 5962
+    ; TAC: IF _t1988 GOTO L5
+    cmp ecx, 5962
+    je L5
+    ; TAC: _t1989 = x == 5965
+    ; TAC: IF _t1989 GOTO L5
+    cmp ecx, 5965
+    je L5
+    ; TAC: _t1990 = x == 5968
+    ; TAC: IF _t1990 GOTO L5
+    cmp ecx, 5968
+    je L5
+    ; TAC: _t1991 = x == 5971
+    ; TAC: IF _t1991 GOTO L5
+    cmp ecx, 5971
+    je L5
+    ; TAC: _t1992 = x == 5974
+    ; TAC: IF _t1992 GOTO L5
+    cmp ecx, 5974
+    je L5
+    ; TAC: _t1993 = x == 5977
+    ; TAC: IF _t1993 GOTO L5
+    cmp ecx, 5977
+    je L5
+    ; TAC: _t1994 = x == 5980
+    ; TAC: IF _t1994 GOTO L5
+    cmp ecx, 5980
+    je L5
+    ; TAC: _t1995 = x == 5983
+    ; TAC: IF _t1995 GOTO L5
+    cmp ecx, 5983
+    je L5
+    ; TAC: _t1996 = x == 5986
+    ; TAC: IF _t1996 GOTO L5
+    cmp ecx, 5986
+    je L5
+    ; TAC: _t1997 = x == 5989
+    ; TAC: IF _t1997 GOTO L5
+    cmp ecx, 5989
+    je L5
+    ; TAC: _t1998 = x == 5992
+    ; TAC: IF _t1998 GOTO L5
+    cmp ecx, 5992
+    je L5
+    ; TAC: _t1999 = x == 5995
+    ; TAC: IF _t1999 GOTO L5
+    cmp ecx, 5995
+    je L5
+    ; TAC: _t2000 = x == 5998
+    ; TAC: IF_NOT _t2000 GOTO L3
+    cmp ecx, 5998
+    jne L3
+    ; TAC: LABEL L5:
+L5:
+    ; TAC: hits = hits + 1
+    inc ebx
+    ; TAC: GOTO L4
+    jmp L4
+    ; TAC: LABEL L3:
+L3:
+    ; TAC: hits = hits + 100
+    add ebx, 100
+    ; TAC: LABEL L4:
+L4:
+    ; TAC: x = x + 1
+    inc ecx
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT hits
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
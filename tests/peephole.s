@@ -0,0 +1,142 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    sub esp, 24
+    push ebx
+    push esi
+    push edi
+    ; TAC: a = 1
+    mov ecx, 1
+    ; TAC: b = 2
+    mov ebx, 2
+    ; TAC: c = 3
+    mov DWORD [ebp-4], 3
+    ; TAC: d = 4
+    mov DWORD [ebp-12], 4
+    ; TAC: e = 5
+    mov DWORD [ebp-16], 5
+    ; TAC: f = 6
+    mov DWORD [ebp-20], 6
+    ; TAC: g = 7
+    mov DWORD [ebp-24], 7
+    ; TAC: h = 8
+    mov DWORD [ebp-8], 8
+    ; TAC: i = 0
+    xor edi, edi
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = i < 3
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp edi, 3
+    jge L2
+    ; TAC: _t1 = a * b
+    mov esi, ecx
+    imul esi, ebx
+    ; TAC: h = _t1 + c
+    mov eax, esi
+    add eax, DWORD [ebp-4]
+    ; TAC: g = h - d
+    sub eax, DWORD [ebp-12]
+    mov DWORD [ebp-24], eax
+    ; TAC: _t4 = g * 2
+    imul esi, eax, 2
+    ; TAC: h = _t4 + e
+    mov eax, esi
+    add eax, DWORD [ebp-16]
+    mov DWORD [ebp-8], eax
+    ; TAC: a = b + h
+    mov ecx, ebx
+    add ecx, eax
+    ; TAC: b = c + g
+    mov ebx, DWORD [ebp-4]
+    add ebx, DWORD [ebp-24]
+    ; TAC: c = d + f
+    mov eax, DWORD [ebp-12]
+    add eax, DWORD [ebp-20]
+    mov DWORD [ebp-4], eax
+    ; TAC: d = e + a
+    mov eax, DWORD [ebp-16]
+    add eax, ecx
+    mov DWORD [ebp-12], eax
+    ; TAC: e = f - b
+    mov eax, DWORD [ebp-20]
+    sub eax, ebx
+    mov DWORD [ebp-16], eax
+    ; TAC: f = a + c
+    mov eax, ecx
+    add eax, DWORD [ebp-4]
+    mov DWORD [ebp-20], eax
+    ; TAC: i = i + 1
+    inc edi
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT a
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT b
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT c
+    push DWORD [ebp-4]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT d
+    push DWORD [ebp-12]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT e
+    push DWORD [ebp-16]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT f
+    push DWORD [ebp-20]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT g
+    push DWORD [ebp-24]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT h
+    push DWORD [ebp-8]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
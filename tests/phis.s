@@ -0,0 +1,168 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    sub esp, 4
+    push ebx
+    push esi
+    push edi
+    ; TAC: a = 1
+    mov ecx, 1
+    ; TAC: b = 2
+    mov esi, 2
+    ; TAC: i = 0
+    xor edi, edi
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = i < 5
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp edi, 5
+    jge L2
+    ; TAC: b.3 = a + b
+    lea ebx, [ecx+esi]
+    ; TAC: i = i + 1
+    inc edi
+    ; TAC: a = b
+    mov ecx, esi
+    ; TAC: b = b.3
+    mov esi, ebx
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT a
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT b
+    push esi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: x = 10
+    mov ebx, 10
+    ; TAC: y = 0
+    xor esi, esi
+    ; TAC: n = 0
+    xor ecx, ecx
+    ; TAC: LABEL L3:
+L3:
+    ; TAC: _t3 = n < 4
+    ; TAC: IF_NOT _t3 GOTO L4
+    cmp ecx, 4
+    jge L4
+    ; TAC: x.3 = x - n
+    mov edi, ebx
+    sub edi, ecx
+    ; TAC: y = x + y
+    lea esi, [ebx+esi]
+    ; TAC: n = n + 1
+    inc ecx
+    ; TAC: before = x
+    mov DWORD [ebp-4], ebx
+    ; TAC: x = x.3
+    mov ebx, edi
+    ; TAC: GOTO L3
+    jmp L3
+    ; TAC: LABEL L4:
+L4:
+    ; TAC: PRINT before
+    push DWORD [ebp-4]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT x
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT y
+    push esi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 21
+    push DWORD 21
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT 3
+    push DWORD 3
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: p = 0
+    xor ebx, ebx
+    ; TAC: q = 1
+    mov esi, 1
+    ; TAC: j = 0
+    xor edi, edi
+    ; TAC: LABEL L8:
+L8:
+    ; TAC: _t11 = j < 6
+    ; TAC: IF_NOT _t11 GOTO L9
+    cmp edi, 6
+    jge L9
+    ; TAC: _t12 = j % 2
+    mov eax, edi
+    mov ecx, 2
+    cdq
+    idiv ecx
+    ; TAC: _t13 = _t12 == 0
+    ; TAC: IF_NOT _t13 GOTO L10
+    test edx, edx
+    jne L10
+    ; TAC: p = p + q
+    add ebx, esi
+    ; TAC: GOTO L11
+    jmp L11
+    ; TAC: LABEL L10:
+L10:
+    ; TAC: q = p + q
+    lea esi, [ebx+esi]
+    ; TAC: LABEL L11:
+L11:
+    ; TAC: j = j + 1
+    inc edi
+    ; TAC: GOTO L8
+    jmp L8
+    ; TAC: LABEL L9:
+L9:
+    ; TAC: PRINT p
+    push ebx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT q
+    push esi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
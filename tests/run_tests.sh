@@ -0,0 +1,87 @@
+#!/bin/sh
+# Regression tests: compiles every tests/<name>.txt at -O0, -O1, -O2 and
+# -O2 --no-peephole, assembles, links and runs each build, and compares what
+# it prints with tests/<name>.expected. All builds must print the same output.
+#
+# An optional tests/<name>.stats lists '<options> <counter>' lines, e.g.
+# '-O1 values_spilled': the --stats counter must be nonzero when compiling
+# with those options, so a test can check that the code path it was written
+# for still runs.
+#
+# Usage: tests/run_tests.sh [compiler]   (normally run through 'make test')
+# NASM and CC name the assembler and the 32-bit capable C compiler.
+
+COMPILER=${1:-./miniJavac}
+NASM=${NASM:-nasm}
+CC=${CC:-gcc}
+TESTS_DIR=$(dirname "$0")
+
+case $COMPILER in
+    /*) ;;
+    *) COMPILER=$(pwd)/$COMPILER ;;
+esac
+
+WORK_DIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+passed=0
+failed=0
+
+fail() {
+    echo "FAIL: $1"
+    failed=$((failed + 1))
+}
+
+for source in "$TESTS_DIR"/*.txt; do
+    name=$(basename "$source" .txt)
+    expected="$TESTS_DIR/$name.expected"
+    if [ ! -f "$expected" ]; then
+        fail "$name (no $name.expected)"
+        continue
+    fi
+
+    for options in "-O0" "-O1" "-O2" "-O2 --no-peephole"; do
+        label="$name $options"
+        # The compiler writes <name>.s next to its input
+        cp "$source" "$WORK_DIR/$name.txt"
+        rm -f "$WORK_DIR/$name.s" "$WORK_DIR/$name.o" "$WORK_DIR/$name"
+
+        if ! "$COMPILER" $options --stats "$WORK_DIR/$name.txt" > "$WORK_DIR/compile.log" 2>&1; then
+            fail "$label (compiler error)"
+            cat "$WORK_DIR/compile.log"
+            continue
+        fi
+        if ! $NASM -f elf32 "$WORK_DIR/$name.s" -o "$WORK_DIR/$name.o" ||
+           ! $CC -m32 -no-pie "$WORK_DIR/$name.o" -o "$WORK_DIR/$name" -Wl,-z,noexecstack; then
+            fail "$label (assemble/link error)"
+            continue
+        fi
+
+        # The exit status of a MiniJava program is whatever is left in eax
+        "$WORK_DIR/$name" > "$WORK_DIR/$name.out" 2>&1
+        if ! cmp -s "$WORK_DIR/$name.out" "$expected"; then
+            fail "$label (output differs)"
+            diff "$expected" "$WORK_DIR/$name.out" | head -n 20
+            continue
+        fi
+        missing=
+        if [ -f "$TESTS_DIR/$name.stats" ]; then
+            for counter in $(awk -v options="$options" \
+                    '{ counter = $NF; $NF = ""; sub(/ +$/, ""); if ($0 == options) print counter }' \
+                    "$TESTS_DIR/$name.stats"); do
+                value=$(awk -v counter="$counter" '$1 == counter { print $2 }' "$WORK_DIR/compile.log")
+                if [ -z "$value" ] || [ "$value" -eq 0 ]; then
+                    missing="$missing $counter"
+                fi
+            done
+        fi
+        if [ -n "$missing" ]; then
+            fail "$label (zero counters:$missing)"
+            continue
+        fi
+        passed=$((passed + 1))
+    done
+done
+
+echo "$passed passed, $failed failed"
+[ "$failed" -eq 0 ]
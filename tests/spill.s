@@ -0,0 +1,154 @@
+bits 32
+global main         ; Make main visible to linker
+extern printf       ; External C library functions
+extern exit
+extern malloc       ; For 'new' operator if you have one
+
+section .text
+
+    ; TAC: FUNCTION_BEGIN main
+
+main:
+    ; Function prologue
+    push ebp
+    mov ebp, esp
+    sub esp, 24
+    push ebx
+    push esi
+    push edi
+    ; TAC: a = 1
+    mov DWORD [ebp-4], 1
+    ; TAC: b = 2
+    mov esi, 2
+    ; TAC: c = 3
+    mov edi, 3
+    ; TAC: d = 4
+    mov DWORD [ebp-8], 4
+    ; TAC: e = 5
+    mov DWORD [ebp-12], 5
+    ; TAC: f = 6
+    mov DWORD [ebp-16], 6
+    ; TAC: g = 7
+    mov DWORD [ebp-20], 7
+    ; TAC: h = 8
+    mov DWORD [ebp-24], 8
+    ; TAC: i = 0
+    xor ebx, ebx
+    ; TAC: LABEL L1:
+L1:
+    ; TAC: _t0 = i < 10
+    ; TAC: IF_NOT _t0 GOTO L2
+    cmp ebx, 10
+    jge L2
+    ; TAC: a = a + b
+    add DWORD [ebp-4], esi
+    ; TAC: b = b + c
+    add esi, edi
+    ; TAC: c = c + d
+    add edi, DWORD [ebp-8]
+    ; TAC: d = d + e
+    mov eax, DWORD [ebp-8]
+    add eax, DWORD [ebp-12]
+    mov DWORD [ebp-8], eax
+    ; TAC: e = e + f
+    mov eax, DWORD [ebp-12]
+    add eax, DWORD [ebp-16]
+    mov DWORD [ebp-12], eax
+    ; TAC: f = f + g
+    mov eax, DWORD [ebp-16]
+    add eax, DWORD [ebp-20]
+    mov DWORD [ebp-16], eax
+    ; TAC: g = g + h
+    mov eax, DWORD [ebp-20]
+    add eax, DWORD [ebp-24]
+    mov DWORD [ebp-20], eax
+    ; TAC: _t8 = a % 3
+    mov eax, DWORD [ebp-4]
+    mov ecx, 3
+    cdq
+    idiv ecx
+    ; TAC: h = _t8 + h
+    add DWORD [ebp-24], edx
+    ; TAC: i = i + 1
+    inc ebx
+    ; TAC: GOTO L1
+    jmp L1
+    ; TAC: LABEL L2:
+L2:
+    ; TAC: PRINT a
+    push DWORD [ebp-4]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT b
+    push esi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT c
+    push edi
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT d
+    push DWORD [ebp-8]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT e
+    push DWORD [ebp-12]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT f
+    push DWORD [ebp-16]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT g
+    push DWORD [ebp-20]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: PRINT h
+    push DWORD [ebp-24]
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: _t11 = a + b
+    mov ecx, DWORD [ebp-4]
+    add ecx, esi
+    ; TAC: _t12 = _t11 + c
+    add ecx, edi
+    ; TAC: _t13 = _t12 + d
+    add ecx, DWORD [ebp-8]
+    ; TAC: _t14 = _t13 + e
+    add ecx, DWORD [ebp-12]
+    ; TAC: _t15 = _t14 + f
+    add ecx, DWORD [ebp-16]
+    ; TAC: _t16 = _t15 + g
+    add ecx, DWORD [ebp-20]
+    ; TAC: _t17 = _t16 + h
+    add ecx, DWORD [ebp-24]
+    ; TAC: PRINT _t17
+    push ecx
+    push DWORD _int_fmt
+    call printf
+    add esp, 8
+    ; TAC: FUNCTION_END main
+
+.epilogue_main:
+    ; Function epilogue
+    pop edi
+    pop esi
+    pop ebx
+    mov esp, ebp
+    pop ebp
+    ret
+
+section .data
+    _int_fmt db "%d", 10, 0
+    _char_fmt db "%c", 10, 0
+    _true_str db "true", 10, 0
+    _false_str db "false", 10, 0
+    _str_nl_fmt db "%s", 10, 0
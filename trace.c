@@ -0,0 +1,78 @@
+// trace.c
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int trace_levels[TRACE_CHANNEL_COUNT] = {0};
+
+static const char *channel_names[TRACE_CHANNEL_COUNT] = {
+    "phase",
+    "lex",
+    "ast",
+    "tac",
+    "cfg",
+    "opt",
+    "asm",
+    "mem",
+};
+
+const char *trace_channel_name(TraceChannel channel)
+{
+    if (channel < 0 || channel >= TRACE_CHANNEL_COUNT)
+        return "unknown";
+    return channel_names[channel];
+}
+
+// Applies a single "name" or "name:level" item of the --trace list.
+static int configure_channel(const char *item, size_t len)
+{
+    int level = 1;
+    const char *colon = memchr(item, ':', len);
+    size_t name_len = colon ? (size_t)(colon - item) : len;
+
+    if (colon)
+    {
+        level = atoi(colon + 1);
+        if (level < 0)
+            level = 0;
+    }
+
+    if (name_len == 3 && strncmp(item, "all", 3) == 0)
+    {
+        for (int i = 0; i < TRACE_CHANNEL_COUNT; i++)
+            trace_levels[i] = level;
+        return 1;
+    }
+
+    for (int i = 0; i < TRACE_CHANNEL_COUNT; i++)
+    {
+        if (strlen(channel_names[i]) == name_len && strncmp(item, channel_names[i], name_len) == 0)
+        {
+            trace_levels[i] = level;
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "Unknown trace channel '%.*s'. Valid channels: phase, lex, ast, tac, cfg, opt, asm, mem, all.\n", (int)name_len, item);
+    return 0;
+}
+
+int trace_configure(const char *spec)
+{
+    if (!spec)
+        return 0;
+
+    const char *item = spec;
+    while (*item)
+    {
+        const char *comma = strchr(item, ',');
+        size_t len = comma ? (size_t)(comma - item) : strlen(item);
+        if (len > 0 && !configure_channel(item, len))
+            return 0;
+        if (!comma)
+            break;
+        item = comma + 1;
+    }
+    return 1;
+}
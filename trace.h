@@ -0,0 +1,50 @@
+// trace.h
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+
+// Diagnostic output channels, one per compiler phase.
+// A channel prints nothing unless it was switched on with --trace=<channels>.
+typedef enum TraceChannel
+{
+    TRACE_PHASE, // Progress messages ("Starting semantic analysis...")
+    TRACE_LEX,   // Every token produced by the lexer
+    TRACE_AST,   // AST dump after parsing
+    TRACE_TAC,   // TAC listing after IR generation
+    TRACE_CFG,   // Basic blocks, dominators and loops of each function
+    TRACE_OPT,   // Each function in SSA form and after every optimizer pass
+    TRACE_ASM,   // Echo of the generated assembly file
+    TRACE_MEM,   // Peak memory of each arena when it is released
+    TRACE_CHANNEL_COUNT
+} TraceChannel;
+
+// Verbosity per channel (0 = off). Defined in trace.c.
+extern int trace_levels[TRACE_CHANNEL_COUNT];
+
+// Building with -DMINIJAVA_NO_TRACE compiles every trace site away entirely.
+#ifdef MINIJAVA_NO_TRACE
+#define TRACE_ENABLED(channel, level) 0
+#else
+#define TRACE_ENABLED(channel, level) (trace_levels[(channel)] >= (level))
+#endif
+
+// Formatting is lazy: the arguments are only evaluated when the channel is on,
+// so a disabled trace site costs one load and one branch.
+#define TRACE_AT(channel, level, ...)          \
+    do                                         \
+    {                                          \
+        if (TRACE_ENABLED(channel, level))     \
+            printf(__VA_ARGS__);               \
+    } while (0)
+
+#define TRACE(channel, ...) TRACE_AT(channel, 1, __VA_ARGS__)
+
+// Parses a comma separated channel list such as "lex,tac:2" or "all".
+// An optional ":<n>" sets the verbosity level (default 1).
+// Returns 1 on success, 0 (after printing a message) on an unknown channel.
+int trace_configure(const char *spec);
+
+const char *trace_channel_name(TraceChannel channel);
+
+#endif // TRACE_H
@@ -0,0 +1,193 @@
+// x86.c
+#include "x86.h"
+
+static const char *opcode_names[X86_OPCODE_COUNT] = {
+    "mov", "movzx", "lea", "add", "sub", "imul", "and", "or", "xor", "neg", "inc", "dec", "cmp", "test", "set",
+    "push", "pop", "call", "jmp", "j", "ret", "cdq", "idiv", "nop", "", ";",
+};
+
+// Base cost of each opcode, before memory operands
+static const int opcode_costs[X86_OPCODE_COUNT] = {
+    1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 20, 1, 0, 0,
+};
+
+#define MEMORY_OPERAND_COST 2
+
+const char *x86_reg_name(X86Reg reg)
+{
+    static const char *names[X86_REG_COUNT] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi"};
+    return reg >= 0 && reg < X86_REG_COUNT ? names[reg] : "NO_REG";
+}
+
+const char *x86_reg_byte_name(X86Reg reg)
+{
+    static const char *names[X86_REG_COUNT] = {"al", "cl", "dl", "bl", NULL, NULL, NULL, NULL};
+    return reg >= 0 && reg < X86_REG_COUNT ? names[reg] : NULL;
+}
+
+const char *x86_cond_name(X86Cond cond)
+{
+    static const char *names[] = {"e", "ne", "l", "le", "g", "ge"};
+    return names[cond];
+}
+
+X86Cond x86_cond_negate(X86Cond cond)
+{
+    static const X86Cond negated[] = {X86_CC_NE, X86_CC_E, X86_CC_GE, X86_CC_G, X86_CC_LE, X86_CC_L};
+    return negated[cond];
+}
+
+X86Cond x86_cond_mirror(X86Cond cond)
+{
+    static const X86Cond mirrored[] = {X86_CC_E, X86_CC_NE, X86_CC_G, X86_CC_GE, X86_CC_L, X86_CC_LE};
+    return mirrored[cond];
+}
+
+X86Operand x86_reg_operand(X86Reg reg)
+{
+    X86Operand operand = {.kind = X86_OPERAND_REG, .size = 4, .scale = 1, .reg = reg, .index = X86_NO_REG};
+    return operand;
+}
+
+X86Operand x86_byte_reg_operand(X86Reg reg)
+{
+    X86Operand operand = {.kind = X86_OPERAND_REG, .size = 1, .scale = 1, .reg = reg, .index = X86_NO_REG};
+    return operand;
+}
+
+X86Operand x86_vreg_operand(uint32_t value, X86Reg assigned)
+{
+    X86Operand operand = {.kind = X86_OPERAND_REG, .size = 4, .scale = 1, .assigned = (int8_t)assigned,
+                          .reg = X86_FIRST_VREG + (int32_t)value, .index = X86_NO_REG};
+    return operand;
+}
+
+X86Operand x86_imm_operand(int32_t value)
+{
+    X86Operand operand = {.kind = X86_OPERAND_IMM, .size = 4, .scale = 1, .reg = X86_NO_REG, .index = X86_NO_REG,
+                          .disp = value};
+    return operand;
+}
+
+X86Operand x86_symbol_operand(Atom symbol)
+{
+    X86Operand operand = {.kind = X86_OPERAND_SYMBOL, .size = 4, .scale = 1, .reg = X86_NO_REG,
+                          .index = X86_NO_REG, .symbol = symbol};
+    return operand;
+}
+
+X86Operand x86_frame_operand(int offset, int size)
+{
+    X86Operand operand = {.kind = X86_OPERAND_MEM, .size = (uint8_t)size, .scale = 1, .reg = X86_EBP,
+                          .index = X86_NO_REG, .disp = offset};
+    return operand;
+}
+
+X86Operand x86_mem_operand(X86Reg base, X86Reg index, int scale, int size)
+{
+    X86Operand operand = {.kind = X86_OPERAND_MEM, .size = (uint8_t)size, .scale = (uint8_t)scale, .reg = base,
+                          .index = index};
+    return operand;
+}
+
+int x86_instr_cost(const X86Instr *instr)
+{
+    int cost = opcode_costs[instr->opcode];
+    if (instr->dst.kind == X86_OPERAND_MEM)
+        cost += MEMORY_OPERAND_COST;
+    if (instr->src.kind == X86_OPERAND_MEM)
+        cost += MEMORY_OPERAND_COST;
+    return cost;
+}
+
+// Appends a register's name, "v<value>" for a virtual one
+static char *format_register(char *text, int32_t reg, int size)
+{
+    if (X86_IS_VREG(reg))
+        return text + sprintf(text, "v%d", reg - X86_FIRST_VREG);
+    return text + sprintf(text, "%s", size == 1 ? x86_reg_byte_name((X86Reg)reg) : x86_reg_name((X86Reg)reg));
+}
+
+// Appends "[base+index*scale+disp]" at 'text' and returns the end of it
+static char *format_address(char *text, const X86Operand *operand)
+{
+    *text++ = '[';
+    text = format_register(text, operand->reg, 4);
+    if (operand->index != X86_NO_REG)
+    {
+        *text++ = '+';
+        text = format_register(text, operand->index, 4);
+        if (operand->scale > 1)
+            text += sprintf(text, "*%d", operand->scale);
+    }
+    if (operand->disp != 0)
+        text += sprintf(text, "%+d", operand->disp);
+    return text + sprintf(text, "]");
+}
+
+// Appends the operand's text at 'text' and returns the end of it
+static char *format_operand(char *text, const X86Operand *operand)
+{
+    switch ((X86OperandKind)operand->kind)
+    {
+    case X86_OPERAND_REG:
+        return format_register(text, operand->reg, operand->size);
+    case X86_OPERAND_MEM:
+        text += sprintf(text, "%s ", operand->size == 1 ? "BYTE" : "DWORD");
+        return format_address(text, operand);
+    case X86_OPERAND_ADDR:
+        return format_address(text, operand);
+    case X86_OPERAND_IMM:
+        return text + sprintf(text, "%d", operand->disp);
+    case X86_OPERAND_SYMBOL: // Written by put_operand(): names have no length limit
+    case X86_OPERAND_NONE:
+        break;
+    }
+    return text;
+}
+
+// Appends the operand to the line being built in 'line'. A symbol is written
+// straight to 'out' after whatever the line holds so far.
+static char *put_operand(FILE *out, char *line, char *text, const X86Operand *operand)
+{
+    if (operand->kind != X86_OPERAND_SYMBOL)
+        return format_operand(text, operand);
+    *text = '\0';
+    fputs(line, out);
+    fputs(atom_name(operand->symbol), out);
+    return line;
+}
+
+void x86_print_instr(FILE *out, const X86Instr *instr)
+{
+    if (instr->opcode == X86_LABEL)
+    {
+        fprintf(out, "%s%s:\n", instr->src.kind == X86_OPERAND_IMM ? "\n" : "", atom_name(instr->dst.symbol));
+        return;
+    }
+    // Built in one buffer and written with one call (two around a symbol):
+    // the printer writes a line per instruction, and stdio calls add up
+    char line[X86_INSTR_TEXT_MAX];
+    char *text = line + sprintf(line, "    %s", opcode_names[instr->opcode]);
+    if (instr->opcode == X86_SETCC || instr->opcode == X86_JCC)
+        text += sprintf(text, "%s", x86_cond_name((X86Cond)instr->cond));
+    if (instr->dst.kind != X86_OPERAND_NONE)
+    {
+        *text++ = ' ';
+        // An immediate push needs its size spelled out
+        if (instr->opcode == X86_PUSH && (instr->dst.kind == X86_OPERAND_IMM || instr->dst.kind == X86_OPERAND_SYMBOL))
+            text += sprintf(text, "DWORD ");
+        text = put_operand(out, line, text, &instr->dst);
+    }
+    if (instr->src.kind != X86_OPERAND_NONE)
+    {
+        text += sprintf(text, ", ");
+        text = put_operand(out, line, text, &instr->src);
+    }
+    if (instr->has_multiplier)
+        text += sprintf(text, ", %d", instr->multiplier);
+    *text++ = '\n';
+    *text = '\0';
+    fputs(line, out);
+}
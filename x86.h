@@ -0,0 +1,146 @@
+// x86.h
+#ifndef X86_H
+#define X86_H
+
+#include "intern.h" // Symbol operands are atoms
+#include <stdint.h>
+#include <stdio.h>
+
+// The 32-bit general purpose registers, in encoding order
+typedef enum X86Reg
+{
+    X86_NO_REG = -1,
+    X86_EAX,
+    X86_ECX,
+    X86_EDX,
+    X86_EBX,
+    X86_ESP,
+    X86_EBP,
+    X86_ESI,
+    X86_EDI,
+    X86_REG_COUNT
+} X86Reg;
+
+// Condition codes of setcc and jcc (signed comparisons)
+typedef enum X86Cond
+{
+    X86_CC_E,
+    X86_CC_NE,
+    X86_CC_L,
+    X86_CC_LE,
+    X86_CC_G,
+    X86_CC_GE
+} X86Cond;
+
+typedef enum X86Opcode
+{
+    X86_MOV,
+    X86_MOVZX,
+    X86_LEA,
+    X86_ADD,
+    X86_SUB,
+    X86_IMUL,  // dst *= src, or dst = src * multiplier
+    X86_AND,
+    X86_OR,
+    X86_XOR,
+    X86_NEG,
+    X86_INC,
+    X86_DEC,
+    X86_CMP,
+    X86_TEST,
+    X86_SETCC,
+    X86_PUSH,
+    X86_POP,
+    X86_CALL,
+    X86_JMP,
+    X86_JCC,
+    X86_RET,
+    X86_CDQ,
+    X86_IDIV,
+    X86_NOP,
+    // Pseudo-instructions of the machine IR (mir.h); they emit no code
+    X86_LABEL,   // dst: the label (a SYMBOL) defined here; src IMM 1 puts a blank line before it
+    X86_COMMENT, // dst IMM: index of the TAC instruction described; dst SYMBOL: the text itself
+    X86_OPCODE_COUNT
+} X86Opcode;
+
+typedef enum X86OperandKind
+{
+    X86_OPERAND_NONE,
+    X86_OPERAND_REG,    // reg, or its low byte when size is 1
+    X86_OPERAND_MEM,    // size [reg + index*scale + disp]
+    X86_OPERAND_ADDR,   // [reg + index*scale + disp], the address itself (lea)
+    X86_OPERAND_IMM,    // disp
+    X86_OPERAND_SYMBOL  // A label or data symbol, as a jump target or an address
+} X86OperandKind;
+
+// Register numbers from X86_FIRST_VREG on are virtual: X86_FIRST_VREG + v
+// stands for TAC value v (see dataflow.h) until mir_assign_registers()
+// replaces it with the register the allocator gave the value.
+#define X86_FIRST_VREG 64
+#define X86_IS_VREG(reg) ((reg) >= X86_FIRST_VREG)
+
+typedef struct X86Operand
+{
+    uint8_t kind;  // X86OperandKind
+    uint8_t size;  // REG and MEM: 1 (byte) or 4 (dword)
+    uint8_t scale; // MEM and ADDR: 1, 2, 4 or 8
+    int8_t assigned; // REG with a virtual reg: the register it will get, X86_NO_REG if not known yet
+    int32_t reg;   // REG: the register; MEM and ADDR: the base (X86Reg or virtual)
+    int32_t index; // MEM and ADDR: index register, X86_NO_REG if none
+    union
+    {
+        int32_t disp; // MEM and ADDR: displacement; IMM: the value
+        Atom symbol;  // SYMBOL: its name
+    };
+} X86Operand;
+
+typedef struct X86Instr
+{
+    uint8_t opcode; // X86Opcode
+    uint8_t cond;   // X86Cond of X86_SETCC and X86_JCC
+    uint8_t has_multiplier;
+    X86Operand dst; // Also the only operand of push, pop, call, jumps, neg, inc, dec and idiv
+    X86Operand src;
+    int32_t multiplier; // Three-operand imul, when has_multiplier is set: dst = src * multiplier
+} X86Instr;
+
+// "eax", "ecx", ...
+const char *x86_reg_name(X86Reg reg);
+
+// Low byte ("al", "cl", "dl", "bl"), or NULL for registers without one
+const char *x86_reg_byte_name(X86Reg reg);
+
+// "e", "ne", "l", ... as in je / setne
+const char *x86_cond_name(X86Cond cond);
+
+// The condition that holds when 'cond' does not
+X86Cond x86_cond_negate(X86Cond cond);
+
+// The condition for the same comparison with its operands swapped (a < b is b > a)
+X86Cond x86_cond_mirror(X86Cond cond);
+
+X86Operand x86_reg_operand(X86Reg reg);
+X86Operand x86_byte_reg_operand(X86Reg reg); // al, cl, dl or bl
+X86Operand x86_vreg_operand(uint32_t value, X86Reg assigned); // Virtual register of a TAC value
+X86Operand x86_imm_operand(int32_t value);
+X86Operand x86_symbol_operand(Atom symbol);
+X86Operand x86_frame_operand(int offset, int size);                         // size [ebp + offset]
+X86Operand x86_mem_operand(X86Reg base, X86Reg index, int scale, int size); // size [base + index*scale]
+
+// Estimated cost of executing the instruction: a base cost per opcode
+// (roughly its latency on a 32-bit core, 1 for simple ALU operations and
+// moves, 3 for imul, 20 for idiv, 0 for pseudo-instructions) plus 2 for
+// every memory operand it reads or writes.
+int x86_instr_cost(const X86Instr *instr);
+
+// Longest line x86_print_instr() builds before writing it out; symbol names
+// are written separately and may be longer
+#define X86_INSTR_TEXT_MAX 128
+
+// Writes the instruction as one line of NASM text. A virtual register prints
+// as v<value>, which only traces show. Pseudo-instructions are the
+// printer's business (see codegen.c); X86_LABEL prints as "name:" here.
+void x86_print_instr(FILE *out, const X86Instr *instr);
+
+#endif // X86_H